@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2024 Intel Corporation
+ */
+
+#include "../sample/sample_util.h"
+
+static int perf_frame_init(struct st_frame* frame, enum st_frame_fmt fmt, int w, int h,
+                           size_t line_align) {
+  uint8_t planes = st_frame_fmt_planes(fmt);
+  size_t size = 0;
+
+  memset(frame, 0, sizeof(*frame));
+  frame->fmt = fmt;
+  frame->width = w;
+  frame->height = h;
+  for (uint8_t plane = 0; plane < planes; plane++) {
+    size_t least = st_frame_least_linesize(fmt, w, plane);
+    frame->linesize[plane] = line_align ? MTL_ALIGN(least, line_align) : least;
+    size += frame->linesize[plane] * h;
+  }
+
+  uint8_t* fb = malloc(size);
+  if (!fb) return -ENOMEM;
+  memset(fb, 0, size);
+  frame->addr[0] = fb;
+  for (uint8_t plane = 1; plane < planes; plane++) {
+    frame->addr[plane] =
+        (uint8_t*)frame->addr[plane - 1] + st_frame_plane_size(frame, plane - 1);
+  }
+  frame->buffer_size = frame->data_size = size;
+  return 0;
+}
+
+/* the dispatch overhead of st_frame_convert to the direct simd kernel */
+static int perf_frame_convert(int w, int h, int frames, size_t line_align) {
+  struct st_frame src, dst;
+  enum mtl_simd_level level = mtl_get_simd_level();
+  clock_t start, end;
+  int ret;
+
+  ret = perf_frame_init(&src, ST_FRAME_FMT_YUV422RFC4175PG2BE10, w, h, line_align);
+  if (ret < 0) return ret;
+  ret = perf_frame_init(&dst, ST_FRAME_FMT_YUV422PLANAR10LE, w, h, line_align);
+  if (ret < 0) {
+    free(src.addr[0]);
+    return ret;
+  }
+  fill_rfc4175_422_10_pg2_data(src.addr[0], w, h);
+
+  /* the direct kernel, only valid for no padding */
+  float duration_kernel = 0;
+  if (!line_align) {
+    start = clock();
+    for (int i = 0; i < frames; i++) {
+      st20_rfc4175_422be10_to_yuv422p10le_simd(src.addr[0], dst.addr[0], dst.addr[1],
+                                               dst.addr[2], w, h, level);
+    }
+    end = clock();
+    duration_kernel = (float)(end - start) / CLOCKS_PER_SEC;
+  }
+
+  start = clock();
+  for (int i = 0; i < frames; i++) {
+    st_frame_convert(&src, &dst);
+  }
+  end = clock();
+  float duration = (float)(end - start) / CLOCKS_PER_SEC;
+
+  info("%dx%d(align %" PRIu64 "), st_frame_convert %f us per frame\n", w, h, line_align,
+       duration * 1000 * 1000 / frames);
+  if (!line_align) {
+    info("%dx%d, kernel %f us per frame, dispatch overhead %f us\n", w, h,
+         duration_kernel * 1000 * 1000 / frames,
+         (duration - duration_kernel) * 1000 * 1000 / frames);
+  }
+
+  free(src.addr[0]);
+  free(dst.addr[0]);
+  return 0;
+}
+
+static void perf_simd_level(int loops) {
+  clock_t start = clock();
+  for (int i = 0; i < loops; i++) {
+    mtl_get_simd_level();
+  }
+  clock_t end = clock();
+  float duration = (float)(end - start) / CLOCKS_PER_SEC;
+  info("mtl_get_simd_level %f ns per call\n", duration * 1000 * 1000 * 1000 / loops);
+}
+
+static void* perf_thread(void* arg) {
+  struct st_sample_context* ctx = arg;
+  mtl_handle dev_handle = ctx->st;
+  int frames = ctx->perf_frames * 10; /* small frames, more loops */
+
+  unsigned int lcore = 0;
+  int ret = mtl_get_lcore(dev_handle, &lcore);
+  if (ret < 0) {
+    return NULL;
+  }
+  mtl_bind_to_lcore(dev_handle, pthread_self(), lcore);
+  info("%s, run in lcore %u\n", __func__, lcore);
+
+  perf_simd_level(1000 * 1000);
+
+  perf_frame_convert(720, 480, frames, 0);
+  perf_frame_convert(720, 576, frames, 0);
+  perf_frame_convert(1280, 720, frames, 0);
+  perf_frame_convert(1920, 1080, ctx->perf_frames, 0);
+  /* the line by line path */
+  perf_frame_convert(720, 480, frames, 512);
+  perf_frame_convert(1920, 1080, ctx->perf_frames, 512);
+
+  mtl_put_lcore(dev_handle, lcore);
+
+  return NULL;
+}
+
+int main(int argc, char** argv) {
+  struct st_sample_context ctx;
+  int ret;
+
+  memset(&ctx, 0, sizeof(ctx));
+  ret = tx_sample_parse_args(&ctx, argc, argv);
+  if (ret < 0) return ret;
+
+  ctx.st = mtl_init(&ctx.param);
+  if (!ctx.st) {
+    err("%s: mtl_init fail\n", __func__);
+    return -EIO;
+  }
+
+  pthread_t thread;
+  ret = pthread_create(&thread, NULL, perf_thread, &ctx);
+  if (ret) goto exit;
+  pthread_join(thread, NULL);
+
+exit:
+  /* release sample(st) dev */
+  if (ctx.st) {
+    mtl_uninit(ctx.st);
+    ctx.st = NULL;
+  }
+  return ret;
+}
@@ -69,6 +69,23 @@ static int perf_cvt_planar_le_to_422_10_pg2(mtl_handle st, int w, int h, int fra
   info("scalar, time: %f secs with %d frames(%dx%d,%fm@%d buffers)\n", duration, frames,
        w, h, planar_size_m, fb_cnt);
 
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX2) {
+    start = clock();
+    for (int i = 0; i < frames; i++) {
+      pg_be_out = pg_be + (i % fb_cnt) * (fb_pg2_size / sizeof(*pg_be));
+      p10_u16_in = p10_u16 + (i % fb_cnt) * (planar_size / sizeof(*p10_u16));
+      p10_u16_b_in = p10_u16_b + (i % fb_cnt) * (planar_size / sizeof(*p10_u16_b));
+      p10_u16_r_in = p10_u16_r + (i % fb_cnt) * (planar_size / sizeof(*p10_u16_r));
+      st20_yuv422p10le_to_rfc4175_422be10_simd(p10_u16_in, p10_u16_b_in, p10_u16_r_in,
+                                               pg_be_out, w, h, MTL_SIMD_LEVEL_AVX2);
+    }
+    end = clock();
+    float duration_simd = (float)(end - start) / CLOCKS_PER_SEC;
+    info("avx2, time: %f secs with %d frames(%dx%d@%d buffers)\n", duration_simd,
+         frames, w, h, fb_cnt);
+    info("avx2, %fx performance to scalar\n", duration / duration_simd);
+  }
+
   if (cpu_level >= MTL_SIMD_LEVEL_AVX512) {
     start = clock();
     for (int i = 0; i < frames; i++) {
@@ -33,6 +33,10 @@ perf_func PerfY210ToRfc4175422be10
 perf_func PerfRfc4175422be12ToLe
 perf_func PerfRfc4175422be12ToP12Le
 perf_func PerfRfc4175422be10ToP8
+perf_func PerfRfc4175444be10ToP10Le
+perf_func PerfRfc4175444be12ToP12Le
+perf_func PerfSt40Udws
+perf_func PerfFrameConvert
 perf_func PerfDma
 
 echo "****** All Perf test OK ******"
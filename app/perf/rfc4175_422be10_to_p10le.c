@@ -47,6 +47,23 @@ static int perf_cvt_422_10_pg2_to_planar_le(mtl_handle st, int w, int h, int fra
   info("scalar, time: %f secs with %d frames(%dx%d,%fm@%d buffers)\n", duration, frames,
        w, h, planar_size_m, fb_cnt);
 
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX2) {
+    start = clock();
+    for (int i = 0; i < frames; i++) {
+      pg_be_in = pg_be + (i % fb_cnt) * (fb_pg2_size / sizeof(*pg_be));
+      p10_u16_out = p10_u16 + (i % fb_cnt) * (planar_size / sizeof(*p10_u16));
+      p10_u16_b_out = p10_u16_b + (i % fb_cnt) * (planar_size / sizeof(*p10_u16_b));
+      p10_u16_r_out = p10_u16_r + (i % fb_cnt) * (planar_size / sizeof(*p10_u16_r));
+      st20_rfc4175_422be10_to_yuv422p10le_simd(pg_be_in, p10_u16_out, p10_u16_b_out,
+                                               p10_u16_r_out, w, h, MTL_SIMD_LEVEL_AVX2);
+    }
+    end = clock();
+    float duration_simd = (float)(end - start) / CLOCKS_PER_SEC;
+    info("avx2, time: %f secs with %d frames(%dx%d@%d buffers)\n", duration_simd,
+         frames, w, h, fb_cnt);
+    info("avx2, %fx performance to scalar\n", duration / duration_simd);
+  }
+
   if (cpu_level >= MTL_SIMD_LEVEL_AVX512) {
     start = clock();
     for (int i = 0; i < frames; i++) {
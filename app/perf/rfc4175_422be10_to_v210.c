@@ -50,6 +50,41 @@ static int perf_cvt_422_10_pg2_be_to_v210(mtl_handle st, int w, int h, int frame
   info("scalar, time: %f secs with %d frames(%dx%d,%fm@%d buffers)\n", duration, frames,
        w, h, planar_size_m, fb_cnt);
 
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX2) {
+    start = clock();
+    for (int i = 0; i < frames; i++) {
+      pg_be_in = pg_be + (i % fb_cnt) * (fb_pg2_size / sizeof(*pg_be));
+      pg_v210_out = pg_v210 + (i % fb_cnt) * (fb_pg2_size_v210 / sizeof(*pg_v210));
+      st20_rfc4175_422be10_to_v210_simd(pg_be_in, pg_v210_out, w, h, MTL_SIMD_LEVEL_AVX2);
+    }
+    end = clock();
+    float duration_simd = (float)(end - start) / CLOCKS_PER_SEC;
+    info("avx2, time: %f secs with %d frames(%dx%d@%d buffers)\n", duration_simd,
+         frames, w, h, fb_cnt);
+    info("avx2, %fx performance to scalar\n", duration / duration_simd);
+
+    if (v210_1line_size) {
+      /* 1line conversion */
+      start = clock();
+      for (int i = 0; i < frames; i++) {
+        pg_be_in = pg_be + (i % fb_cnt) * (fb_pg2_size / sizeof(*pg_be));
+        pg_v210_out = pg_v210 + (i % fb_cnt) * (fb_pg2_size_v210 / sizeof(*pg_v210));
+
+        for (int j = 0; j < h; j++) {
+          st20_rfc4175_422be10_to_v210_simd(pg_be_in, pg_v210_out, w, 1,
+                                            MTL_SIMD_LEVEL_AVX2);
+          pg_be_in += be_1line_size / sizeof(*pg_be_in);
+          pg_v210_out += v210_1line_size / sizeof(*pg_v210_out);
+        }
+      }
+      end = clock();
+      duration_simd = (float)(end - start) / CLOCKS_PER_SEC;
+      info("avx2_1line, time: %f secs with %d frames(%dx%d@%d buffers)\n", duration_simd,
+           frames, w, h, fb_cnt);
+      info("avx2_1line, %fx performance to scalar\n", duration / duration_simd);
+    }
+  }
+
   if (cpu_level >= MTL_SIMD_LEVEL_AVX512) {
     start = clock();
     for (int i = 0; i < frames; i++) {
@@ -149,6 +184,24 @@ static int perf_cvt_422_10_pg2_be_to_v210(mtl_handle st, int w, int h, int frame
   info("scalar, time: %f secs with %d frames(%dx%d,%fm@%d buffers)\n", duration, frames,
        w, h, planar_size_m, fb_cnt);
 
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX2) {
+    start = clock();
+    for (int i = 0; i < frames; i++) {
+      pg_be_in = pg_be + (i % fb_cnt) * (fb_pg2_size / sizeof(*pg_be));
+      pg_le_out = pg_le + (i % fb_cnt) * (fb_pg2_size / sizeof(*pg_le));
+      pg_v210_out = pg_v210 + (i % fb_cnt) * (fb_pg2_size_v210 / sizeof(*pg_v210));
+      st20_rfc4175_422be10_to_422le10_simd(pg_be_in, pg_le_out, w, h,
+                                           MTL_SIMD_LEVEL_AVX2);
+      st20_rfc4175_422le10_to_v210_simd((uint8_t*)pg_le_out, pg_v210_out, w, h,
+                                        MTL_SIMD_LEVEL_AVX2);
+    }
+    end = clock();
+    float duration_simd = (float)(end - start) / CLOCKS_PER_SEC;
+    info("avx2, time: %f secs with %d frames(%dx%d@%d buffers)\n", duration_simd,
+         frames, w, h, fb_cnt);
+    info("avx2, %fx performance to scalar\n", duration / duration_simd);
+  }
+
   if (cpu_level >= MTL_SIMD_LEVEL_AVX512) {
     start = clock();
     for (int i = 0; i < frames; i++) {
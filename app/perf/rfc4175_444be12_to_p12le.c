@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2024 Intel Corporation
+ */
+
+#include "../sample/sample_util.h"
+
+struct perf_444_12_bufs {
+  struct st20_rfc4175_444_12_pg2_be* pg_be;
+  mtl_iova_t pg_be_iova;
+  size_t fb_pg_size;
+  uint16_t* planar;
+  size_t planar_size;
+};
+
+static float perf_cvt_444_12_pg2_to_planar_le(mtl_udma_handle dma,
+                                              struct perf_444_12_bufs* bufs, int w, int h,
+                                              int frames, int fb_cnt,
+                                              enum mtl_simd_level level) {
+  clock_t start, end;
+
+  start = clock();
+  for (int i = 0; i < frames; i++) {
+    size_t pg_offset = (i % fb_cnt) * bufs->fb_pg_size;
+    struct st20_rfc4175_444_12_pg2_be* pg_be_in =
+        (struct st20_rfc4175_444_12_pg2_be*)((uint8_t*)bufs->pg_be + pg_offset);
+    uint16_t* y_g = bufs->planar + (i % fb_cnt) * (bufs->planar_size / sizeof(uint16_t));
+    uint16_t* b_r = y_g + w * h;
+    uint16_t* r_b = b_r + w * h;
+    if (dma)
+      st20_rfc4175_444be12_to_444p12le_simd_dma(
+          dma, pg_be_in, bufs->pg_be_iova + pg_offset, y_g, b_r, r_b, w, h, level);
+    else
+      st20_rfc4175_444be12_to_444p12le_simd(pg_be_in, y_g, b_r, r_b, w, h, level);
+  }
+  end = clock();
+
+  return (float)(end - start) / CLOCKS_PER_SEC;
+}
+
+static float perf_cvt_planar_le_to_444_12_pg2(struct perf_444_12_bufs* bufs, int w, int h,
+                                              int frames, int fb_cnt,
+                                              enum mtl_simd_level level) {
+  clock_t start, end;
+
+  start = clock();
+  for (int i = 0; i < frames; i++) {
+    struct st20_rfc4175_444_12_pg2_be* pg_be_out =
+        (struct st20_rfc4175_444_12_pg2_be*)((uint8_t*)bufs->pg_be +
+                                             (i % fb_cnt) * bufs->fb_pg_size);
+    uint16_t* y_g = bufs->planar + (i % fb_cnt) * (bufs->planar_size / sizeof(uint16_t));
+    uint16_t* b_r = y_g + w * h;
+    uint16_t* r_b = b_r + w * h;
+    st20_444p12le_to_rfc4175_444be12_simd(y_g, b_r, r_b, pg_be_out, w, h, level);
+  }
+  end = clock();
+
+  return (float)(end - start) / CLOCKS_PER_SEC;
+}
+
+static int perf_cvt_444_12(mtl_handle st, int w, int h, int frames, int fb_cnt) {
+  struct perf_444_12_bufs bufs;
+  mtl_udma_handle dma = mtl_udma_create(st, 128, MTL_PORT_P);
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  float duration, duration_simd;
+
+  bufs.fb_pg_size = (size_t)w * h * 9 / 2;
+  bufs.planar_size = (size_t)w * h * 3 * sizeof(uint16_t);
+  bufs.pg_be = mtl_hp_malloc(st, bufs.fb_pg_size * fb_cnt, MTL_PORT_P);
+  bufs.planar = malloc(bufs.planar_size * fb_cnt);
+  if (!bufs.pg_be || !bufs.planar) {
+    err("%s, malloc fail\n", __func__);
+    if (bufs.pg_be) mtl_hp_free(st, bufs.pg_be);
+    if (bufs.planar) free(bufs.planar);
+    if (dma) mtl_udma_free(dma);
+    return -ENOMEM;
+  }
+  bufs.pg_be_iova = mtl_hp_virt2iova(st, bufs.pg_be);
+  uint8_t* pg = (uint8_t*)bufs.pg_be;
+  for (size_t i = 0; i < bufs.fb_pg_size * fb_cnt; i++) pg[i] = rand();
+
+  float planar_size_m = (float)bufs.planar_size / 1024 / 1024;
+  duration = perf_cvt_444_12_pg2_to_planar_le(NULL, &bufs, w, h, frames, fb_cnt,
+                                              MTL_SIMD_LEVEL_NONE);
+  info("scalar, time: %f secs with %d frames(%dx%d,%fm@%d buffers)\n", duration, frames,
+       w, h, planar_size_m, fb_cnt);
+
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX2) {
+    duration_simd = perf_cvt_444_12_pg2_to_planar_le(NULL, &bufs, w, h, frames, fb_cnt,
+                                                     MTL_SIMD_LEVEL_AVX2);
+    info("avx2, %fx performance to scalar\n", duration / duration_simd);
+  }
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX512) {
+    duration_simd = perf_cvt_444_12_pg2_to_planar_le(NULL, &bufs, w, h, frames, fb_cnt,
+                                                     MTL_SIMD_LEVEL_AVX512);
+    info("avx512, %fx performance to scalar\n", duration / duration_simd);
+    if (dma) {
+      duration_simd = perf_cvt_444_12_pg2_to_planar_le(dma, &bufs, w, h, frames, fb_cnt,
+                                                       MTL_SIMD_LEVEL_AVX512);
+      info("dma+avx512, %fx performance to scalar\n", duration / duration_simd);
+    }
+  }
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX512_VBMI2) {
+    duration_simd = perf_cvt_444_12_pg2_to_planar_le(NULL, &bufs, w, h, frames, fb_cnt,
+                                                     MTL_SIMD_LEVEL_AVX512_VBMI2);
+    info("avx512_vbmi, %fx performance to scalar\n", duration / duration_simd);
+    if (dma) {
+      duration_simd = perf_cvt_444_12_pg2_to_planar_le(dma, &bufs, w, h, frames, fb_cnt,
+                                                       MTL_SIMD_LEVEL_AVX512_VBMI2);
+      info("dma+avx512_vbmi, %fx performance to scalar\n", duration / duration_simd);
+    }
+  }
+
+  /* the reverse direction with the planar data from above */
+  duration = perf_cvt_planar_le_to_444_12_pg2(&bufs, w, h, frames, fb_cnt,
+                                              MTL_SIMD_LEVEL_NONE);
+  info("reverse scalar, time: %f secs with %d frames(%dx%d@%d buffers)\n", duration,
+       frames, w, h, fb_cnt);
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX2) {
+    duration_simd = perf_cvt_planar_le_to_444_12_pg2(&bufs, w, h, frames, fb_cnt,
+                                                     MTL_SIMD_LEVEL_AVX2);
+    info("reverse avx2, %fx performance to scalar\n", duration / duration_simd);
+  }
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX512) {
+    duration_simd = perf_cvt_planar_le_to_444_12_pg2(&bufs, w, h, frames, fb_cnt,
+                                                     MTL_SIMD_LEVEL_AVX512);
+    info("reverse avx512, %fx performance to scalar\n", duration / duration_simd);
+  }
+
+  mtl_hp_free(st, bufs.pg_be);
+  free(bufs.planar);
+  if (dma) mtl_udma_free(dma);
+
+  return 0;
+}
+
+static void* perf_thread(void* arg) {
+  struct st_sample_context* ctx = arg;
+  mtl_handle dev_handle = ctx->st;
+  int frames = ctx->perf_frames;
+  int fb_cnt = ctx->perf_fb_cnt;
+
+  unsigned int lcore = 0;
+  int ret = mtl_get_lcore(dev_handle, &lcore);
+  if (ret < 0) {
+    return NULL;
+  }
+  mtl_bind_to_lcore(dev_handle, pthread_self(), lcore);
+  info("%s, run in lcore %u\n", __func__, lcore);
+
+  perf_cvt_444_12(dev_handle, 640, 480, frames, fb_cnt);
+  perf_cvt_444_12(dev_handle, 1280, 720, frames, fb_cnt);
+  perf_cvt_444_12(dev_handle, 1920, 1080, frames, fb_cnt);
+  perf_cvt_444_12(dev_handle, 1920 * 2, 1080 * 2, frames, fb_cnt);
+  perf_cvt_444_12(dev_handle, 1920 * 4, 1080 * 4, frames, fb_cnt);
+
+  mtl_put_lcore(dev_handle, lcore);
+
+  return NULL;
+}
+
+int main(int argc, char** argv) {
+  struct st_sample_context ctx;
+  int ret;
+
+  memset(&ctx, 0, sizeof(ctx));
+  ret = tx_sample_parse_args(&ctx, argc, argv);
+  if (ret < 0) return ret;
+
+  ctx.st = mtl_init(&ctx.param);
+  if (!ctx.st) {
+    err("%s: mtl_init fail\n", __func__);
+    return -EIO;
+  }
+
+  pthread_t thread;
+  ret = pthread_create(&thread, NULL, perf_thread, &ctx);
+  if (ret) goto exit;
+  pthread_join(thread, NULL);
+
+exit:
+  /* release sample(st) dev */
+  if (ctx.st) {
+    mtl_uninit(ctx.st);
+    ctx.st = NULL;
+  }
+  return ret;
+}
@@ -0,0 +1,129 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2024 Intel Corporation
+ */
+
+#include "../sample/sample_util.h"
+
+/* ancillary packets per frame, eg: closed captions with large metadata payloads */
+#define PERF_ST40_PKTS_PER_FRAME (1000)
+
+static float perf_st40_udws_level(uint8_t* words, uint8_t* payload, uint16_t* udws,
+                                  int udw_num, int frames, int fb_cnt,
+                                  enum mtl_simd_level level) {
+  size_t payload_size = (size_t)(udw_num + 3) * 10 / 8 + 4;
+  clock_t start, end;
+  uint16_t chks = 0;
+
+  start = clock();
+  for (int i = 0; i < frames * PERF_ST40_PKTS_PER_FRAME; i++) {
+    uint8_t* words_in = words + (i % fb_cnt) * udw_num;
+    uint8_t* payload_out = payload + (i % fb_cnt) * payload_size;
+    uint16_t* udws_out = udws + (i % fb_cnt) * udw_num;
+    /* the 3 udws of DID, SDID and data count ahead the user data words */
+    st40_set_udws_parity_simd(3, udw_num, words_in, payload_out, level);
+    st40_get_udws_simd(3, udw_num, payload_out, udws_out, level);
+    chks += st40_calc_checksum_simd(udw_num + 3, payload_out, level);
+  }
+  end = clock();
+  dbg("%s, chks %u\n", __func__, chks);
+  MTL_MAY_UNUSED(chks);
+
+  return (float)(end - start) / CLOCKS_PER_SEC;
+}
+
+static int perf_st40_udws(int udw_num, int frames, int fb_cnt) {
+  size_t payload_size = (size_t)(udw_num + 3) * 10 / 8 + 4;
+  uint8_t* words = malloc((size_t)udw_num * fb_cnt);
+  uint8_t* payload = malloc(payload_size * fb_cnt);
+  uint16_t* udws = malloc((size_t)udw_num * fb_cnt * sizeof(*udws));
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+
+  if (!words || !payload || !udws) {
+    err("%s, malloc fail\n", __func__);
+    if (words) free(words);
+    if (payload) free(payload);
+    if (udws) free(udws);
+    return -ENOMEM;
+  }
+
+  for (int i = 0; i < udw_num * fb_cnt; i++) words[i] = rand();
+  memset(payload, 0, payload_size * fb_cnt);
+
+  float duration = perf_st40_udws_level(words, payload, udws, udw_num, frames, fb_cnt,
+                                        MTL_SIMD_LEVEL_NONE);
+  info("scalar, time: %f secs with %d frames(%d pkts, %d udws@%d buffers)\n", duration,
+       frames, PERF_ST40_PKTS_PER_FRAME, udw_num, fb_cnt);
+
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX2) {
+    float duration_simd = perf_st40_udws_level(words, payload, udws, udw_num, frames,
+                                               fb_cnt, MTL_SIMD_LEVEL_AVX2);
+    info("avx2, time: %f secs with %d frames(%d pkts, %d udws@%d buffers)\n",
+         duration_simd, frames, PERF_ST40_PKTS_PER_FRAME, udw_num, fb_cnt);
+    info("avx2, %fx performance to scalar\n", duration / duration_simd);
+  }
+
+  if (cpu_level >= MTL_SIMD_LEVEL_AVX512) {
+    float duration_simd = perf_st40_udws_level(words, payload, udws, udw_num, frames,
+                                               fb_cnt, MTL_SIMD_LEVEL_AVX512);
+    info("avx512, time: %f secs with %d frames(%d pkts, %d udws@%d buffers)\n",
+         duration_simd, frames, PERF_ST40_PKTS_PER_FRAME, udw_num, fb_cnt);
+    info("avx512, %fx performance to scalar\n", duration / duration_simd);
+  }
+
+  free(words);
+  free(payload);
+  free(udws);
+
+  return 0;
+}
+
+static void* perf_thread(void* arg) {
+  struct st_sample_context* ctx = arg;
+  mtl_handle dev_handle = ctx->st;
+  int frames = ctx->perf_frames;
+  int fb_cnt = ctx->perf_fb_cnt;
+
+  unsigned int lcore = 0;
+  int ret = mtl_get_lcore(dev_handle, &lcore);
+  if (ret < 0) {
+    return NULL;
+  }
+  mtl_bind_to_lcore(dev_handle, pthread_self(), lcore);
+  info("%s, run in lcore %u\n", __func__, lcore);
+
+  perf_st40_udws(32, frames, fb_cnt);
+  perf_st40_udws(128, frames, fb_cnt);
+  perf_st40_udws(255, frames, fb_cnt);
+
+  mtl_put_lcore(dev_handle, lcore);
+
+  return NULL;
+}
+
+int main(int argc, char** argv) {
+  struct st_sample_context ctx;
+  int ret;
+
+  memset(&ctx, 0, sizeof(ctx));
+  ret = tx_sample_parse_args(&ctx, argc, argv);
+  if (ret < 0) return ret;
+
+  ctx.st = mtl_init(&ctx.param);
+  if (!ctx.st) {
+    err("%s: mtl_init fail\n", __func__);
+    return -EIO;
+  }
+
+  pthread_t thread;
+  ret = pthread_create(&thread, NULL, perf_thread, &ctx);
+  if (ret) goto exit;
+  pthread_join(thread, NULL);
+
+exit:
+  /* release sample(st) dev */
+  if (ctx.st) {
+    mtl_uninit(ctx.st);
+    ctx.st = NULL;
+  }
+  return ret;
+}
@@ -466,6 +466,15 @@ enum mtl_init_flag {
   MTL_FLAG_RX_UDP_PORT_ONLY = (MTL_BIT64(46)),
   /** not bind current process to NIC numa socket */
   MTL_FLAG_NOT_BIND_PROCESS_NUMA = (MTL_BIT64(47)),
+  /**
+   * Use recvmmsg/sendmmsg batch mode for the MTL_PMD_KERNEL_SOCKET datapath.
+   */
+  MTL_FLAG_SOCKET_BATCH = (MTL_BIT64(48)),
+  /**
+   * Enable the admin rebalancer which moves video sessions from an overloaded sch to an
+   * idle sch on the same numa socket, see sch_rebalance_notify for the decisions.
+   */
+  MTL_FLAG_SCH_REBALANCE = (MTL_BIT64(49)),
 };
 
 /** MTL port init flag */
@@ -481,6 +490,28 @@ struct mtl_ptp_sync_notify_meta {
   int64_t delta;
 };
 
+/**
+ * The structure info for one session move decided by the sch rebalancer.
+ */
+struct mtl_sch_rebalance_meta {
+  /** true for tx video session, false for rx video session */
+  bool tx;
+  /** the sch index the session moved from */
+  int from_sch;
+  /** the session index in the from sch */
+  int from_idx;
+  /** the sch index the session moved to */
+  int to_sch;
+  /** the load score(percentage of the pkt interval) of from sch before the move */
+  float from_load;
+  /** the load score of to sch before the move */
+  float to_load;
+  /** the expected load score of from sch after the move */
+  float from_load_expect;
+  /** the expected load score of to sch after the move */
+  float to_load_expect;
+};
+
 /**
  * The structure describing how to init a mtl port device.
  */
@@ -505,6 +536,8 @@ struct mtl_init_params {
    *
    * Below PMDs are only for experimental usage, not for production usage.
    * MTL_PMD_KERNEL_SOCKET, use kernel + ifname, ex: kernel:enp175s0f0.
+   * MTL_PMD_KERNEL_SOCKET with io_uring backend, use kernel_uring + ifname, ex:
+   * kernel_uring:enp175s0f0.
    * MTL_PMD_RDMA_UD with ST2110 packing, use rdma_ud + ifname, ex: rdma_ud:enp175s0f0.
    * MTL_PMD_DPDK_AF_XDP, use dpdk_af_xdp + ifname, ex: dpdk_af_xdp:enp175s0f0.
    * MTL_PMD_DPDK_AF_PACKET, use dpdk_af_packet + ifname, ex: dpdk_af_packet:enp175s0f0.
@@ -553,7 +586,10 @@ struct mtl_init_params {
 
   /** Optional. Flags to control MTL behaviors. See MTL_FLAG_* for possible value */
   uint64_t flags;
-  /** Optional. Private data to the cb functions(ptp_get_time_fn and stat_dump_cb_fn) */
+  /**
+   * Optional. Private data to the cb functions(ptp_get_time_fn, stat_dump_cb_fn and
+   * sch_rebalance_notify)
+   */
   void* priv;
   /** Optional. log level control */
   enum mtl_log_level log_level;
@@ -691,6 +727,12 @@ struct mtl_init_params {
 #else
   uint16_t rx_sessions_cnt_max __mtl_deprecated_msg("Use rx_queues_cnt instead");
 #endif
+
+  /**
+   * Optional for MTL_FLAG_SCH_REBALANCE. The callback is notified from the admin thread
+   * every time the rebalancer moves one session.
+   */
+  void (*sch_rebalance_notify)(void* priv, struct mtl_sch_rebalance_meta* meta);
 };
 
 /**
@@ -739,6 +781,10 @@ struct mtl_port_status {
   uint64_t rx_nombuf_packets;
   /** Total number of failed transmitted packets. */
   uint64_t tx_err_packets;
+  /** Total number of sendmmsg calls, kernel socket with MTL_FLAG_SOCKET_BATCH only. */
+  uint64_t tx_batches;
+  /** Total number of recvmmsg calls, kernel socket with MTL_FLAG_SOCKET_BATCH only. */
+  uint64_t rx_batches;
 };
 
 /**
@@ -29,6 +29,20 @@ typedef struct mt_sch_tasklet_impl* mtl_tasklet_handle;
 /** the tasklet is likely has finished all task */
 #define MTL_TASKLET_ALL_DONE (0)
 
+/**
+ * Priority class of a tasklet, decide how often the tasklet is polled by the sch.
+ */
+enum mtl_tasklet_priority {
+  /** polled on every sch loop, for the pacing sensitive tasks like video */
+  MTL_TASKLET_PRIORITY_REALTIME = 0,
+  /** polled with adaptive back-off up to 8 sch loops if no pending task */
+  MTL_TASKLET_PRIORITY_NORMAL,
+  /** polled with adaptive back-off up to 64 sch loops if no pending task */
+  MTL_TASKLET_PRIORITY_LOW,
+  /** max value of this enum */
+  MTL_TASKLET_PRIORITY_MAX,
+};
+
 /**
  * The structure describing how to create a sch.
  */
@@ -65,6 +79,13 @@ struct mtl_tasklet_ops {
    * leave to zero if you don't know.
    */
   uint64_t advice_sleep_us;
+  /** the priority class, default(zero) is MTL_TASKLET_PRIORITY_REALTIME */
+  enum mtl_tasklet_priority priority;
+  /**
+   * the max poll interval(in sch loops) for the adaptive back-off of non realtime class,
+   * leave to zero to use the default value of the priority class.
+   */
+  uint32_t poll_interval_max;
 };
 
 /**
@@ -29,6 +29,23 @@ extern "C" {
  */
 typedef struct mudp_impl* mudp_handle;
 
+/* forward declare for the mmsg api */
+struct mmsghdr;
+
+/**
+ * The zero-copy rx buffer lent to user by mudp_recv_zc.
+ */
+struct mudp_zc_buf {
+  /** The udp payload in the rx packet buffer, valid until mudp_release_zc */
+  void* payload;
+  /** The payload length in bytes */
+  size_t len;
+  /** The source address of the packet */
+  struct sockaddr_in src_addr;
+  /** Opaque token for mudp_release_zc, user should not modify it */
+  void* token;
+};
+
 /**
  * Create a udp transport socket.
  *
@@ -47,7 +64,8 @@ typedef struct mudp_impl* mudp_handle;
 mudp_handle mudp_socket(mtl_handle mt, int domain, int type, int protocol);
 
 /**
- * Un-initialize the udp transport socket.
+ * Un-initialize the udp transport socket. It fails with EBUSY if any zero-copy buffer
+ * lent by mudp_recv_zc is not released yet.
  *
  * @param ut
  *   The handle to udp transport socket.
@@ -110,6 +128,26 @@ ssize_t mudp_sendto(mudp_handle ut, const void* buf, size_t len, int flags,
  */
 ssize_t mudp_sendmsg(mudp_handle ut, const struct msghdr* msg, int flags);
 
+/**
+ * Send multiple messages on the udp transport socket with a single call.
+ * The pkts of all messages are built and enqueued to the tx queue in bulk, and the dst
+ * mac is resolved only once for consecutive messages to the same destination.
+ *
+ * @param ut
+ *   The handle to udp transport socket.
+ * @param msgvec
+ *   The array of struct mmsghdr, the msg_len of each sent entry is updated with the
+ *   number of bytes sent.
+ * @param vlen
+ *   The number of elements in msgvec.
+ * @param flags
+ *   Not support any flags now.
+ * @return
+ *   - >0: the number of messages sent.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mudp_sendmmsg(mudp_handle ut, struct mmsghdr* msgvec, unsigned int vlen, int flags);
+
 /**
  * The structure describing a polling request on mudp.
  */
@@ -201,6 +239,69 @@ static inline ssize_t mudp_recv(mudp_handle ut, void* buf, size_t len, int flags
  */
 ssize_t mudp_recvmsg(mudp_handle ut, struct msghdr* msg, int flags);
 
+/**
+ * Receive multiple messages on the udp transport socket with a single call.
+ * The pkts are dequeued from the rx ring in bulk. It returns once at least one message
+ * is received, same as the MSG_WAITFORONE behavior of the kernel.
+ *
+ * @param ut
+ *   The handle to udp transport socket.
+ * @param msgvec
+ *   The array of struct mmsghdr, the msg_len of each received entry is updated with
+ *   the number of bytes received.
+ * @param vlen
+ *   The number of elements in msgvec.
+ * @param flags
+ *   Only support MSG_DONTWAIT now.
+ * @param timeout
+ *   Optional, the max time to wait for the first message, capped by the rx timeout of
+ *   the socket.
+ * @return
+ *   - >0: the number of messages received.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mudp_recvmmsg(mudp_handle ut, struct mmsghdr* msgvec, unsigned int vlen, int flags,
+                  struct timespec* timeout);
+
+/**
+ * Receive packets on the udp transport socket without copy, the payload is lent to
+ * user in place of the rx packet buffer. It returns once at least one packet is
+ * received. User must return the buffers by mudp_release_zc after the usage, the rx
+ * path will be starved if too many buffers are outstanding. All the buffers must be
+ * returned before mudp_close, the close is rejected with EBUSY otherwise.
+ * Not support for the kernel socket fallback path.
+ *
+ * @param ut
+ *   The handle to udp transport socket.
+ * @param bufs
+ *   The array of struct mudp_zc_buf to hold the lent buffers.
+ * @param nb
+ *   The number of elements in bufs.
+ * @param flags
+ *   Only support MSG_DONTWAIT now.
+ * @return
+ *   - >0: the number of buffers lent.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mudp_recv_zc(mudp_handle ut, struct mudp_zc_buf* bufs, unsigned int nb, int flags);
+
+/**
+ * Release the zero-copy buffers lent by mudp_recv_zc. It's safe to be called from a
+ * different thread than mudp_recv_zc, but must be called before mudp_close of the
+ * socket.
+ *
+ * @param ut
+ *   The handle to udp transport socket.
+ * @param bufs
+ *   The array of struct mudp_zc_buf lent by mudp_recv_zc.
+ * @param nb
+ *   The number of elements in bufs.
+ * @return
+ *   - 0: Success.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mudp_release_zc(mudp_handle ut, struct mudp_zc_buf* bufs, unsigned int nb);
+
 /**
  * getsockopt on the udp transport socket.
  *
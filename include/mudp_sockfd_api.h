@@ -48,7 +48,8 @@ extern "C" {
 int mufd_socket(int domain, int type, int protocol);
 
 /**
- * Close the udp transport socket.
+ * Close the udp transport socket. It fails with EBUSY if any zero-copy buffer lent by
+ * mufd_recv_zc is not released yet.
  *
  * @param sockfd
  *   the sockfd by mufd_socket.
@@ -111,6 +112,24 @@ ssize_t mufd_sendto(int sockfd, const void* buf, size_t len, int flags,
  */
 ssize_t mufd_sendmsg(int sockfd, const struct msghdr* msg, int flags);
 
+/**
+ * Send multiple messages on the udp transport socket with a single call.
+ *
+ * @param sockfd
+ *   the sockfd by mufd_socket.
+ * @param msgvec
+ *   The array of struct mmsghdr, the msg_len of each sent entry is updated with the
+ *   number of bytes sent.
+ * @param vlen
+ *   The number of elements in msgvec.
+ * @param flags
+ *   Not support any flags now.
+ * @return
+ *   - >0: the number of messages sent.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mufd_sendmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags);
+
 /**
  * Poll the udp transport socket, blocks until one of the events occurs.
  * Only support POLLIN now.
@@ -185,6 +204,60 @@ static inline ssize_t mufd_recv(int sockfd, void* buf, size_t len, int flags) {
  */
 ssize_t mufd_recvmsg(int sockfd, struct msghdr* msg, int flags);
 
+/**
+ * Receive multiple messages on the udp transport socket with a single call.
+ * It returns once at least one message is received.
+ *
+ * @param sockfd
+ *   the sockfd by mufd_socket.
+ * @param msgvec
+ *   The array of struct mmsghdr, the msg_len of each received entry is updated with
+ *   the number of bytes received.
+ * @param vlen
+ *   The number of elements in msgvec.
+ * @param flags
+ *   Only support MSG_DONTWAIT now.
+ * @param timeout
+ *   Optional, the max time to wait for the first message.
+ * @return
+ *   - >0: the number of messages received.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mufd_recvmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags,
+                  struct timespec* timeout);
+
+/**
+ * Receive packets on the udp transport socket without copy, see mudp_recv_zc.
+ *
+ * @param sockfd
+ *   the sockfd by mufd_socket.
+ * @param bufs
+ *   The array of struct mudp_zc_buf to hold the lent buffers.
+ * @param nb
+ *   The number of elements in bufs.
+ * @param flags
+ *   Only support MSG_DONTWAIT now.
+ * @return
+ *   - >0: the number of buffers lent.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mufd_recv_zc(int sockfd, struct mudp_zc_buf* bufs, unsigned int nb, int flags);
+
+/**
+ * Release the zero-copy buffers lent by mufd_recv_zc, must be called before mufd_close.
+ *
+ * @param sockfd
+ *   the sockfd by mufd_socket.
+ * @param bufs
+ *   The array of struct mudp_zc_buf lent by mufd_recv_zc.
+ * @param nb
+ *   The number of elements in bufs.
+ * @return
+ *   - 0: Success.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mufd_release_zc(int sockfd, struct mudp_zc_buf* bufs, unsigned int nb);
+
 /**
  * getsockopt on the udp transport socket.
  *
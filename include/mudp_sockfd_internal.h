@@ -268,6 +268,56 @@ int mufd_socket_check(int domain, int type, int protocol);
 int mufd_poll_query(struct pollfd* fds, nfds_t nfds, int timeout,
                     int (*query)(void* priv), void* priv);
 
+/**
+ * Poll mufd transport socket with a query callback and a kernel fd for the query event.
+ * In the lcore mode the poll blocks in kernel on the rx event of the mufd sockets and
+ * the wait_fd, instead of the sleep between the query calls.
+ *
+ * @param fds
+ *   The pointer to pollfd request.
+ * @param nfds
+ *   The number of request in fds.
+ * @param timeout
+ *   timeout value in ms.
+ * @param query
+ *   query callback, return > 0 means it has ready data on the query.
+ * @param priv
+ *   priv data to the query callback.
+ * @param wait_fd
+ *   The kernel fd which is readable when the query has ready data, -1 if not used.
+ * @return
+ *   - > 0: Success, returns a nonnegative value which is the number of elements
+ *          in the fds whose revents fields have been set to a nonzero value.
+ *   - =0: Timeout.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mufd_poll_query_fd(struct pollfd* fds, nfds_t nfds, int timeout,
+                       int (*query)(void* priv), void* priv, int wait_fd);
+
+/**
+ * Get the rx event fd of the mufd transport socket, only available in the lcore mode.
+ * The fd is readable after the rx data arrived on a armed socket, see mufd_rx_ready_arm.
+ *
+ * @param sockfd
+ *   the sockfd by mufd_socket.
+ * @return
+ *   - >=0: the event fd.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mufd_get_event_fd(int sockfd);
+
+/**
+ * Check the pending rx pkts of the mufd transport socket, the rx event fd is armed if
+ * no pending pkt, then the next arrived pkt notify the event fd once.
+ *
+ * @param sockfd
+ *   the sockfd by mufd_socket.
+ * @return
+ *   - >=0: the number of pending rx pkts.
+ *   - <0: Error code. -1 is returned, and errno is set appropriately.
+ */
+int mufd_rx_ready_arm(int sockfd);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -46,6 +46,14 @@ struct msghdr {
   int msg_flags;
 };
 
+/** Structure used by `sendmmsg' and `recvmmsg'. */
+struct mmsghdr {
+  /** Actual message header. */
+  struct msghdr msg_hdr;
+  /** Number of received or sent bytes for the entry. */
+  unsigned int msg_len;
+};
+
 /** Structure used for storage of ancillary data object information.  */
 struct cmsghdr {
   /** Length of data in cmsg_data plus length of cmsghdr structure. */
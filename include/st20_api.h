@@ -28,6 +28,12 @@ extern "C" {
  */
 #define ST22_FB_MAX_COUNT (8)
 
+/**
+ * Max number of out of order frame slots for st20/st22 rx reassembly, see ofo_slots in
+ * struct st20_rx_ops/st22_rx_ops.
+ */
+#define ST20_RX_OFO_SLOTS_MAX (8)
+
 /**
  * Flag bit in flags of struct st20_tx_ops.
  * P TX destination mac assigned by user
@@ -373,6 +379,27 @@ enum st20_packing {
   ST20_PACKING_MAX,     /**< max value of this enum */
 };
 
+/**
+ * Color matrix of the YUV and RGB convert
+ */
+enum st20_color_matrix {
+  ST20_COLOR_MATRIX_BT709 = 0, /**< ITU-R BT.709 */
+  ST20_COLOR_MATRIX_BT2020,    /**< ITU-R BT.2020 non-constant luminance */
+  ST20_COLOR_MATRIX_MAX,       /**< max value of this enum */
+};
+
+/**
+ * Sample range of the YUV side for the YUV and RGB convert
+ */
+enum st20_color_range {
+  /** narrow(video) range, Y in [64, 940] and C in [64, 960] for 10 bit */
+  ST20_COLOR_RANGE_NARROW = 0,
+  /** full range, all of [0, 1023] for 10 bit */
+  ST20_COLOR_RANGE_FULL,
+  /** max value of this enum */
+  ST20_COLOR_RANGE_MAX,
+};
+
 /**
  * A structure describing a st2110-20(video) pixel group
  */
@@ -622,6 +649,30 @@ struct st20_rx_uframe_pg_meta {
   uint64_t timestamp;
 };
 
+/**
+ * Pixel group meta data for user frame st2110-20(video) tx streaming.
+ */
+struct st20_tx_uframe_pg_meta {
+  /** Frame resolution width */
+  uint32_t width;
+  /** Frame resolution height */
+  uint32_t height;
+  /** Frame resolution format */
+  enum st20_fmt fmt;
+  /** Second field type indicate for interlaced mode */
+  bool second_field;
+  /** Point to the packet payload which the pixel groups should be filled to */
+  void* payload;
+  /** Number of octets of pixel groups data to fill */
+  uint16_t row_length;
+  /** Scan line number */
+  uint16_t row_number;
+  /** Offset of the first pixel of the payload data within current scan line */
+  uint16_t row_offset;
+  /** How many pixel groups in current meta */
+  uint32_t pg_cnt;
+};
+
 /**
  * Frame meta data of st2110-22(video) tx streaming
  */
@@ -1235,6 +1286,20 @@ struct st20_tx_ops {
   int (*notify_rtp_done)(void* priv);
   /**  Use this socket if ST20_TX_FLAG_FORCE_NUMA is on, default use the NIC numa */
   int socket_id;
+  /**
+   * Optional for ST20_TYPE_FRAME_LEVEL.
+   * User frame callback when lib build the payload of one packet, the callback should
+   * fill the pixel groups of the packet from the frame of frame_idx, then lib will not
+   * read the framebuffer for the payload. Only non-chain(copy) mode is used if set.
+   * meta: point to the meta data.
+   * return:
+   *   - 0: if app fill the pixel group successfully.
+   *   < 0: the error code if app can't handle.
+   * And only non-block method can be used in this callback as it run from lcore tasklet
+   * routine.
+   */
+  int (*uframe_pg_callback)(void* priv, uint16_t frame_idx,
+                            struct st20_tx_uframe_pg_meta* meta);
 };
 
 /**
@@ -1573,6 +1638,14 @@ struct st20_rx_ops {
   /* use to store framebuffers on vram */
   bool gpu_direct_framebuffer_in_vram_device_address;
   void* gpu_context;
+
+  /**
+   * Optional. Number of frames(timestamps) tracked in parallel for out of order pkts,
+   * range [2:ST20_RX_OFO_SLOTS_MAX]. Zero means the default window(1 slot, 2 slots with
+   * RTCP). A bigger window helps with redundant(ST2022-7) legs skew or network
+   * reordering at the cost of framebuffers, framebuff_cnt should be bigger than it.
+   */
+  uint16_t ofo_slots;
 };
 
 /**
@@ -1674,6 +1747,11 @@ struct st22_rx_ops {
   int (*notify_rtp_ready)(void* priv);
   /**  Use this socket if ST22_RX_FLAG_FORCE_NUMA is on, default use the NIC numa */
   int socket_id;
+  /**
+   * Optional. Number of frames(timestamps) tracked in parallel for out of order pkts,
+   * range [2:ST20_RX_OFO_SLOTS_MAX]. Zero means the default window.
+   */
+  uint16_t ofo_slots;
 };
 
 /**
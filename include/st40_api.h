@@ -548,6 +548,147 @@ void st40_set_udw(uint32_t idx, uint16_t udw, uint8_t* data);
  */
 uint16_t st40_calc_checksum(uint32_t data_num, uint8_t* data);
 
+/**
+ * Calculate checksum from st2110-40(ancillary) payload with the required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ *
+ * @param data_num
+ *   Number of udw.
+ * @param data
+ *   The pointer to st2110-40 payload.
+ * @param level
+ *   simd level.
+ * @return
+ *   - checksum
+ */
+uint16_t st40_calc_checksum_simd(uint32_t data_num, uint8_t* data,
+                                 enum mtl_simd_level level);
+
+/**
+ * Get a bulk of udw from st2110-40(ancillary) payload with the required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ *
+ * @param idx
+ *   Index of the first udw.
+ * @param num
+ *   Number of udw.
+ * @param data
+ *   The pointer to st2110-40 payload.
+ * @param udws
+ *   The pointer to the 10 bit udw array, parity bits included.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if fail.
+ */
+int st40_get_udws_simd(uint32_t idx, uint32_t num, uint8_t* data, uint16_t* udws,
+                       enum mtl_simd_level level);
+
+/**
+ * Get a bulk of udw from st2110-40(ancillary) payload with the max optimized SIMD level.
+ *
+ * @param idx
+ *   Index of the first udw.
+ * @param num
+ *   Number of udw.
+ * @param data
+ *   The pointer to st2110-40 payload.
+ * @param udws
+ *   The pointer to the 10 bit udw array, parity bits included.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if fail.
+ */
+static inline int st40_get_udws(uint32_t idx, uint32_t num, uint8_t* data,
+                                uint16_t* udws) {
+  return st40_get_udws_simd(idx, num, data, udws, MTL_SIMD_LEVEL_MAX);
+}
+
+/**
+ * Set a bulk of udw to st2110-40(ancillary) payload with the required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ *
+ * @param idx
+ *   Index of the first udw.
+ * @param num
+ *   Number of udw.
+ * @param udws
+ *   The pointer to the 10 bit udw array.
+ * @param data
+ *   The pointer to st2110-40 payload.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if fail.
+ */
+int st40_set_udws_simd(uint32_t idx, uint32_t num, uint16_t* udws, uint8_t* data,
+                       enum mtl_simd_level level);
+
+/**
+ * Set a bulk of udw to st2110-40(ancillary) payload with the max optimized SIMD level.
+ *
+ * @param idx
+ *   Index of the first udw.
+ * @param num
+ *   Number of udw.
+ * @param udws
+ *   The pointer to the 10 bit udw array.
+ * @param data
+ *   The pointer to st2110-40 payload.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if fail.
+ */
+static inline int st40_set_udws(uint32_t idx, uint32_t num, uint16_t* udws,
+                                uint8_t* data) {
+  return st40_set_udws_simd(idx, num, udws, data, MTL_SIMD_LEVEL_MAX);
+}
+
+/**
+ * Add parity bits to a bulk of 8 bit words and set them as udw to st2110-40(ancillary)
+ * payload with the required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ *
+ * @param idx
+ *   Index of the first udw.
+ * @param num
+ *   Number of udw.
+ * @param words
+ *   The pointer to the 8 bit user data words.
+ * @param data
+ *   The pointer to st2110-40 payload.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if fail.
+ */
+int st40_set_udws_parity_simd(uint32_t idx, uint32_t num, uint8_t* words, uint8_t* data,
+                              enum mtl_simd_level level);
+
+/**
+ * Add parity bits to a bulk of 8 bit words and set them as udw to st2110-40(ancillary)
+ * payload with the max optimized SIMD level.
+ *
+ * @param idx
+ *   Index of the first udw.
+ * @param num
+ *   Number of udw.
+ * @param words
+ *   The pointer to the 8 bit user data words.
+ * @param data
+ *   The pointer to st2110-40 payload.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if fail.
+ */
+static inline int st40_set_udws_parity(uint32_t idx, uint32_t num, uint8_t* words,
+                                       uint8_t* data) {
+  return st40_set_udws_parity_simd(idx, num, words, data, MTL_SIMD_LEVEL_MAX);
+}
+
 /**
  * Add parity from st2110-40(ancillary) payload.
  *
@@ -998,6 +998,174 @@ static inline int st20_rfc4175_444le12_to_gbrp12le(struct st20_rfc4175_444_12_pg
   return st20_rfc4175_444le12_to_444p12le(pg, g, r, b, w, h);
 }
 
+/**
+ * Convert rfc4175_422be10 to argb(8bit ARGB).
+ *
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param argb
+ *   Point to argb data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+static inline int st20_rfc4175_422be10_to_argb(struct st20_rfc4175_422_10_pg2_be* pg,
+                                               uint8_t* argb, uint32_t w, uint32_t h,
+                                               enum st20_color_matrix matrix,
+                                               enum st20_color_range range) {
+  return st20_rfc4175_422be10_to_argb_simd(pg, argb, w, h, matrix, range,
+                                           MTL_SIMD_LEVEL_MAX);
+}
+
+/**
+ * Convert argb(8bit ARGB) to rfc4175_422be10.
+ * The chroma is from the average of the two pixels in one pg.
+ *
+ * @param argb
+ *   Point to argb data.
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+static inline int st20_argb_to_rfc4175_422be10(uint8_t* argb,
+                                               struct st20_rfc4175_422_10_pg2_be* pg,
+                                               uint32_t w, uint32_t h,
+                                               enum st20_color_matrix matrix,
+                                               enum st20_color_range range) {
+  return st20_argb_to_rfc4175_422be10_simd(argb, pg, w, h, matrix, range,
+                                           MTL_SIMD_LEVEL_MAX);
+}
+
+/**
+ * Convert rfc4175_422be10 to bgra(8bit BGRA).
+ *
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param bgra
+ *   Point to bgra data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+static inline int st20_rfc4175_422be10_to_bgra(struct st20_rfc4175_422_10_pg2_be* pg,
+                                               uint8_t* bgra, uint32_t w, uint32_t h,
+                                               enum st20_color_matrix matrix,
+                                               enum st20_color_range range) {
+  return st20_rfc4175_422be10_to_bgra_simd(pg, bgra, w, h, matrix, range,
+                                           MTL_SIMD_LEVEL_MAX);
+}
+
+/**
+ * Convert bgra(8bit BGRA) to rfc4175_422be10.
+ * The chroma is from the average of the two pixels in one pg.
+ *
+ * @param bgra
+ *   Point to bgra data.
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+static inline int st20_bgra_to_rfc4175_422be10(uint8_t* bgra,
+                                               struct st20_rfc4175_422_10_pg2_be* pg,
+                                               uint32_t w, uint32_t h,
+                                               enum st20_color_matrix matrix,
+                                               enum st20_color_range range) {
+  return st20_bgra_to_rfc4175_422be10_simd(bgra, pg, w, h, matrix, range,
+                                           MTL_SIMD_LEVEL_MAX);
+}
+
+/**
+ * Convert rfc4175_422be10 to rgb8(8bit RGB8).
+ *
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param rgb8
+ *   Point to rgb8 data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+static inline int st20_rfc4175_422be10_to_rgb8(struct st20_rfc4175_422_10_pg2_be* pg,
+                                               uint8_t* rgb8, uint32_t w, uint32_t h,
+                                               enum st20_color_matrix matrix,
+                                               enum st20_color_range range) {
+  return st20_rfc4175_422be10_to_rgb8_simd(pg, rgb8, w, h, matrix, range,
+                                           MTL_SIMD_LEVEL_MAX);
+}
+
+/**
+ * Convert rgb8(8bit RGB8) to rfc4175_422be10.
+ * The chroma is from the average of the two pixels in one pg.
+ *
+ * @param rgb8
+ *   Point to rgb8 data.
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+static inline int st20_rgb8_to_rfc4175_422be10(uint8_t* rgb8,
+                                               struct st20_rfc4175_422_10_pg2_be* pg,
+                                               uint32_t w, uint32_t h,
+                                               enum st20_color_matrix matrix,
+                                               enum st20_color_range range) {
+  return st20_rgb8_to_rfc4175_422be10_simd(rgb8, pg, w, h, matrix, range,
+                                           MTL_SIMD_LEVEL_MAX);
+}
+
 /**
  * Convert AM824 subframe to AES3 subframe.
  *
@@ -466,6 +466,38 @@ int st20_rfc4175_444be10_to_444p10le_simd(struct st20_rfc4175_444_10_pg4_be* pg,
                                           uint32_t w, uint32_t h,
                                           enum mtl_simd_level level);
 
+/**
+ * Convert rfc4175_444be10 to yuv444p10le/gbrp10le with required SIMD level and DMA
+ * helper. Note the level may downgrade to the SIMD which system really support.
+ *
+ * @param udma
+ *   Point to dma engine.
+ * @param pg_be
+ *   Point to pg(rfc4175_444be10) data.
+ * @param pg_be_iova
+ *   The mtl_iova_t address of the pg_be buffer.
+ * @param y_g
+ *   Point to Y(yuv444p10le) or g(gbrp10le) vector.
+ * @param b_r
+ *   Point to b(yuv444p10le) or r(gbrp10le) vector.
+ * @param r_b
+ *   Point to r(yuv444p10le) or b(gbrp10le) vector.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+int st20_rfc4175_444be10_to_444p10le_simd_dma(mtl_udma_handle udma,
+                                              struct st20_rfc4175_444_10_pg4_be* pg_be,
+                                              mtl_iova_t pg_be_iova, uint16_t* y_g,
+                                              uint16_t* b_r, uint16_t* r_b, uint32_t w,
+                                              uint32_t h, enum mtl_simd_level level);
+
 /**
  * Convert rfc4175_444be10 to rfc4175_444le10 with required SIMD level.
  * Note the level may downgrade to the SIMD which system really support.
@@ -516,6 +548,38 @@ int st20_rfc4175_444be12_to_444p12le_simd(struct st20_rfc4175_444_12_pg2_be* pg,
                                           uint32_t w, uint32_t h,
                                           enum mtl_simd_level level);
 
+/**
+ * Convert rfc4175_444be12 to yuv444p12le/gbrp12le with required SIMD level and DMA
+ * helper. Note the level may downgrade to the SIMD which system really support.
+ *
+ * @param udma
+ *   Point to dma engine.
+ * @param pg_be
+ *   Point to pg(rfc4175_444be12) data.
+ * @param pg_be_iova
+ *   The mtl_iova_t address of the pg_be buffer.
+ * @param y_g
+ *   Point to Y(yuv444p12le) or g(gbrp12le) vector.
+ * @param b_r
+ *   Point to b(yuv444p12le) or r(gbrp12le) vector.
+ * @param r_b
+ *   Point to r(yuv444p12le) or b(gbrp12le) vector.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+int st20_rfc4175_444be12_to_444p12le_simd_dma(mtl_udma_handle udma,
+                                              struct st20_rfc4175_444_12_pg2_be* pg_be,
+                                              mtl_iova_t pg_be_iova, uint16_t* y_g,
+                                              uint16_t* b_r, uint16_t* r_b, uint32_t w,
+                                              uint32_t h, enum mtl_simd_level level);
+
 /**
  * Convert rfc4175_444be12 to rfc4175_444le12 with required SIMD level.
  * Note the level may downgrade to the SIMD which system really support.
@@ -732,6 +796,177 @@ int st20_444p12le_to_rfc4175_444be12_simd(uint16_t* y_g, uint16_t* b_r, uint16_t
                                           uint32_t w, uint32_t h,
                                           enum mtl_simd_level level);
 
+/**
+ * Convert rfc4175_422be10 to argb(8bit ARGB) with required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ *
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param argb
+ *   Point to argb data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+int st20_rfc4175_422be10_to_argb_simd(struct st20_rfc4175_422_10_pg2_be* pg,
+                                      uint8_t* argb, uint32_t w, uint32_t h,
+                                      enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level);
+
+/**
+ * Convert argb(8bit ARGB) to rfc4175_422be10 with required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ * The chroma is from the average of the two pixels in one pg.
+ *
+ * @param argb
+ *   Point to argb data.
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+int st20_argb_to_rfc4175_422be10_simd(uint8_t* argb,
+                                      struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                      uint32_t h, enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level);
+
+/**
+ * Convert rfc4175_422be10 to bgra(8bit BGRA) with required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ *
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param bgra
+ *   Point to bgra data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+int st20_rfc4175_422be10_to_bgra_simd(struct st20_rfc4175_422_10_pg2_be* pg,
+                                      uint8_t* bgra, uint32_t w, uint32_t h,
+                                      enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level);
+
+/**
+ * Convert bgra(8bit BGRA) to rfc4175_422be10 with required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ * The chroma is from the average of the two pixels in one pg.
+ *
+ * @param bgra
+ *   Point to bgra data.
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+int st20_bgra_to_rfc4175_422be10_simd(uint8_t* bgra,
+                                      struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                      uint32_t h, enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level);
+
+/**
+ * Convert rfc4175_422be10 to rgb8(8bit RGB8) with required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ *
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param rgb8
+ *   Point to rgb8 data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+int st20_rfc4175_422be10_to_rgb8_simd(struct st20_rfc4175_422_10_pg2_be* pg,
+                                      uint8_t* rgb8, uint32_t w, uint32_t h,
+                                      enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level);
+
+/**
+ * Convert rgb8(8bit RGB8) to rfc4175_422be10 with required SIMD level.
+ * Note the level may downgrade to the SIMD which system really support.
+ * The chroma is from the average of the two pixels in one pg.
+ *
+ * @param rgb8
+ *   Point to rgb8 data.
+ * @param pg
+ *   Point to pg(rfc4175_422be10) data.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the rfc4175_422be10 data.
+ * @param level
+ *   simd level.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+int st20_rgb8_to_rfc4175_422be10_simd(uint8_t* rgb8,
+                                      struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                      uint32_t h, enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level);
+
 /**
  * Convert rfc4175_422le10 to rfc4175_422be10 with required SIMD level.
  * Note the level may downgrade to the SIMD which system really support.
@@ -1389,6 +1624,70 @@ static inline int st20_y210_to_rfc4175_422be10_dma(
                                                MTL_SIMD_LEVEL_MAX);
 }
 
+/**
+ * Convert rfc4175_444be10 to yuv444p10le/gbrp10le with max SIMD level and DMA helper.
+ * Profiling shows gain with 4k/8k solution due to LLC cache miss migration, thus pls
+ * only applied with 4k/8k.
+ *
+ * @param udma
+ *   Point to dma engine.
+ * @param pg_be
+ *   Point to pg(rfc4175_444be10) data.
+ * @param pg_be_iova
+ *   The mtl_iova_t address of the pg_be buffer.
+ * @param y_g
+ *   Point to Y(yuv444p10le) or g(gbrp10le) vector.
+ * @param b_r
+ *   Point to b(yuv444p10le) or r(gbrp10le) vector.
+ * @param r_b
+ *   Point to r(yuv444p10le) or b(gbrp10le) vector.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+static inline int st20_rfc4175_444be10_to_444p10le_dma(
+    mtl_udma_handle udma, struct st20_rfc4175_444_10_pg4_be* pg_be, mtl_iova_t pg_be_iova,
+    uint16_t* y_g, uint16_t* b_r, uint16_t* r_b, uint32_t w, uint32_t h) {
+  return st20_rfc4175_444be10_to_444p10le_simd_dma(udma, pg_be, pg_be_iova, y_g, b_r,
+                                                      r_b, w, h, MTL_SIMD_LEVEL_MAX);
+}
+
+/**
+ * Convert rfc4175_444be12 to yuv444p12le/gbrp12le with max SIMD level and DMA helper.
+ * Profiling shows gain with 4k/8k solution due to LLC cache miss migration, thus pls
+ * only applied with 4k/8k.
+ *
+ * @param udma
+ *   Point to dma engine.
+ * @param pg_be
+ *   Point to pg(rfc4175_444be12) data.
+ * @param pg_be_iova
+ *   The mtl_iova_t address of the pg_be buffer.
+ * @param y_g
+ *   Point to Y(yuv444p12le) or g(gbrp12le) vector.
+ * @param b_r
+ *   Point to b(yuv444p12le) or r(gbrp12le) vector.
+ * @param r_b
+ *   Point to r(yuv444p12le) or b(gbrp12le) vector.
+ * @param w
+ *   The st2110-20(video) width.
+ * @param h
+ *   The st2110-20(video) height.
+ * @return
+ *   - 0 if successful.
+ *   - <0: Error code if convert fail.
+ */
+static inline int st20_rfc4175_444be12_to_444p12le_dma(
+    mtl_udma_handle udma, struct st20_rfc4175_444_12_pg2_be* pg_be, mtl_iova_t pg_be_iova,
+    uint16_t* y_g, uint16_t* b_r, uint16_t* r_b, uint32_t w, uint32_t h) {
+  return st20_rfc4175_444be12_to_444p12le_simd_dma(udma, pg_be, pg_be_iova, y_g, b_r,
+                                                      r_b, w, h, MTL_SIMD_LEVEL_MAX);
+}
+
 /**
  * Convert rfc4175_422be10 to dual v210 streams(one full and one decimated) with required
  * SIMD level. Note the level may downgrade to the SIMD which system really support.
@@ -465,6 +465,13 @@ enum st20p_tx_flag {
   ST20P_TX_FLAG_DISABLE_BULK = (MTL_BIT32(10)),
   /** Force the numa of the created session, both CPU and memory */
   ST20P_TX_FLAG_FORCE_NUMA = (MTL_BIT32(11)),
+  /**
+   * Only used for ST20_FMT_YUV_422_10BIT transport and limited input formats:
+   * ST_FRAME_FMT_YUV422PLANAR10LE, ST_FRAME_FMT_Y210.
+   * Perform the color format conversion on each packet when it's built, no intermediate
+   * transport frame.
+   */
+  ST20P_TX_FLAG_PKT_CONVERT = (MTL_BIT32(12)),
   /** Enable the st20p_tx_get_frame block behavior to wait until a frame becomes
      available or (default: 1s, use st20p_tx_set_block_timeout to customize) */
   ST20P_TX_FLAG_BLOCK_GET = (MTL_BIT32(15)),
@@ -527,8 +534,8 @@ enum st20p_rx_flag {
    */
   ST20P_RX_FLAG_EXT_FRAME = (MTL_BIT32(2)),
   /**
-   * Only used for internal convert mode and limited formats:
-   * ST_FRAME_FMT_YUV422PLANAR10LE, ST_FRAME_FMT_Y210, ST_FRAME_FMT_UYVY
+   * Only used for internal convert mode, all output formats of the internal converters
+   * except ST_FRAME_FMT_V210 and the 420 formats.
    * Perform the color format conversion on each packet.
    */
   ST20P_RX_FLAG_PKT_CONVERT = (MTL_BIT32(3)),
@@ -592,6 +599,12 @@ enum st20p_rx_flag {
    * Use gpu_direct vram for framebuffers
    */
   ST20P_RX_FLAG_USE_GPU_DIRECT_FRAMEBUFFERS = (MTL_BIT32(24)),
+  /**
+   * Only used for internal convert mode and the same formats as
+   * ST20P_RX_FLAG_PKT_CONVERT. Perform the color format conversion on each slice(lines) once the slice is received,
+   * and notify the ready lines by notify_slice_ready.
+   */
+  ST20P_RX_FLAG_SLICE_CONVERT = (MTL_BIT32(25)),
 };
 
 /** Bit define for flag_resp of struct st22_decoder_create_req. */
@@ -912,6 +925,22 @@ struct st20p_tx_ops {
   int (*notify_event)(void* priv, enum st_event event, void* args);
   /**  Use this socket if ST20P_TX_FLAG_FORCE_NUMA is on, default use the NIC numa */
   int socket_id;
+  /**
+   * Optional. The number of lcore workers to split the internal convert of each frame
+   * into line bands, the app thread converts one band also. Leave to zero to convert on
+   * the app thread only. Only for the internal converter.
+   */
+  uint16_t convert_workers;
+  /**
+   * Optional. The color matrix of the internal convert between YUV and RGB formats,
+   * leave to zero for ST20_COLOR_MATRIX_BT709.
+   */
+  enum st20_color_matrix color_matrix;
+  /**
+   * Optional. The sample range of the YUV side for the internal convert between YUV and
+   * RGB formats, leave to zero for ST20_COLOR_RANGE_NARROW.
+   */
+  enum st20_color_range color_range;
 };
 
 /** The structure describing how to create a rx st2110-20 pipeline session. */
@@ -987,6 +1016,46 @@ struct st20p_rx_ops {
 
   /* use to store framebuffers on vram */
   void* gpu_context;
+
+  /**
+   * Optional for ST20P_RX_FLAG_SLICE_CONVERT, lines in one slice, leave to zero to let
+   * lib select a default value(height / 32).
+   */
+  uint32_t slice_lines;
+  /**
+   * Optional for ST20P_RX_FLAG_SLICE_CONVERT. Callback when more lines of the frame are
+   * converted, only the lines in range [0, ready_lines) of the frame are valid.
+   * The frame is still owned by lib, app should get the whole frame by st20p_rx_get_frame
+   * once it's available and never write to the frame inside this callback.
+   * And only non-block method can be used within this callback as it run from lcore
+   * tasklet routine.
+   */
+  int (*notify_slice_ready)(void* priv, struct st_frame* frame, uint32_t ready_lines);
+  /**
+   * Optional. The number of lcore workers to split the internal convert of each frame
+   * into line bands, the app thread converts one band also. Leave to zero to convert on
+   * the app thread only. Only for the internal converter.
+   */
+  uint16_t convert_workers;
+  /**
+   * Optional. The color matrix of the internal convert between YUV and RGB formats,
+   * leave to zero for ST20_COLOR_MATRIX_BT709.
+   */
+  enum st20_color_matrix color_matrix;
+  /**
+   * Optional. The sample range of the YUV side for the internal convert between YUV and
+   * RGB formats, leave to zero for ST20_COLOR_RANGE_NARROW.
+   */
+  enum st20_color_range color_range;
+  /**
+   * Optional. The width of the output frames, the frame is scaled from the transport
+   * width in the same pass of the internal convert, leave to zero for no scale.
+   * The scale is always by the internal converter without convert_workers, and not for
+   * the auto detect or packet/slice convert mode.
+   */
+  uint32_t output_width;
+  /** Optional. The height of the output frames, see output_width. */
+  uint32_t output_height;
 };
 
 /** The structure describing how to create a tx st2110-22 pipeline session. */
@@ -2028,7 +2097,28 @@ int st20p_rx_set_block_timeout(st20p_rx_handle handle, uint64_t timedwait_ns);
 int st_frame_convert(struct st_frame* src, struct st_frame* dst);
 
 /**
- * Downsample frame size to destination frame.
+ * Convert color format from source frame to destination frame with the color matrix and
+ * range, only used by the convert between YUV and RGB formats.
+ *
+ * @param src
+ *   The source frame.
+ * @param dst
+ *   The destination frame.
+ * @param matrix
+ *   The color matrix.
+ * @param range
+ *   The sample range of the YUV side.
+ * @return
+ *   - 0: Success.
+ *   - <0: Error code.
+ */
+int st_frame_convert_color(struct st_frame* src, struct st_frame* dst,
+                           enum st20_color_matrix matrix, enum st20_color_range range);
+
+/**
+ * Downsample frame size to destination frame. The width and height of source should be
+ * integer multiples of the destination, the sample box idx is only for the one half of
+ * RFC4175 formats and other ratios need idx 0. Use st_frame_scale for any other size.
  *
  * @param src
  *   The source frame.
@@ -2042,6 +2132,41 @@ int st_frame_convert(struct st_frame* src, struct st_frame* dst);
  */
 int st_frame_downsample(struct st_frame* src, struct st_frame* dst, int idx);
 
+/**
+ * Scale the source frame to the size of destination frame, and convert to the format of
+ * destination frame in the same pass if the formats differ. The filter is bilinear for
+ * upscale and widened to the ratio for downscale to average all the source samples.
+ * The source should be a RFC4175 or 16bit planar format of 4:2:2 or 4:4:4, the
+ * destination can be any format converted from the source except 4:2:0.
+ * The filters are created in each call, use the output size of st20p rx for a stream.
+ *
+ * @param src
+ *   The source frame.
+ * @param dst
+ *   The destination frame.
+ * @return
+ *   - 0: Success.
+ *   - <0: Error code.
+ */
+int st_frame_scale(struct st_frame* src, struct st_frame* dst);
+
+/**
+ * Scale the source frame to the size of destination frame with the max simd level, the
+ * output is same for all levels.
+ *
+ * @param src
+ *   The source frame.
+ * @param dst
+ *   The destination frame.
+ * @param level
+ *   The max simd level of the scale filters.
+ * @return
+ *   - 0: Success.
+ *   - <0: Error code.
+ */
+int st_frame_scale_simd(struct st_frame* src, struct st_frame* dst,
+                        enum mtl_simd_level level);
+
 /**
  * Calculate the least linesize per the format, w, plane
  *
@@ -123,6 +123,7 @@ static int upl_resolve_libc_fn(struct upl_functions* fns) {
   UPL_LIBC_FN(sendto);
   UPL_LIBC_FN(send);
   UPL_LIBC_FN(sendmsg);
+  UPL_LIBC_FN(sendmmsg);
   UPL_LIBC_FN(poll);
   UPL_LIBC_FN(ppoll);
   UPL_LIBC_FN(select);
@@ -130,6 +131,7 @@ static int upl_resolve_libc_fn(struct upl_functions* fns) {
   UPL_LIBC_FN(recv);
   UPL_LIBC_FN(recvfrom);
   UPL_LIBC_FN(recvmsg);
+  UPL_LIBC_FN(recvmmsg);
   UPL_LIBC_FN(getsockopt);
   UPL_LIBC_FN(setsockopt);
   UPL_LIBC_FN(fcntl);
@@ -261,6 +263,12 @@ static int upl_epoll_create(struct upl_ctx* ctx, int efd) {
   entry->efd = efd;
   pthread_mutex_init(&entry->mutex, NULL);
   TAILQ_INIT(&entry->fds);
+  TAILQ_INIT(&entry->ready_list);
+  /* internal epoll for the rx event fd of ufds */
+  entry->ready_efd = LIBC_FN(epoll_create1, EPOLL_CLOEXEC);
+  if (entry->ready_efd < 0) {
+    warn("%s(%d), ready efd create fail, query all ufds in wait\n", __func__, efd);
+  }
 
   upl_set_upl_entry(ctx, efd, entry);
   return 0;
@@ -277,8 +285,15 @@ static int upl_epoll_close(struct upl_efd_entry* entry) {
     TAILQ_REMOVE(&entry->fds, item, next);
     upl_free(item);
   }
+  TAILQ_INIT(&entry->ready_list);
+  entry->ready_cnt = 0;
   pthread_mutex_unlock(&entry->mutex);
 
+  if (entry->ready_efd >= 0) {
+    LIBC_FN(close, entry->ready_efd);
+    entry->ready_efd = -1;
+  }
+
   pthread_mutex_destroy(&entry->mutex);
   dbg("%s(%d), close epoll efd\n", __func__, efd_entry->efd);
   return 0;
@@ -297,6 +312,24 @@ static int upl_efd_ctl_add(struct upl_ctx* ctx, struct upl_efd_entry* efd,
   }
   if (event) item->event = *event;
   item->ufd = ufd;
+  item->event_fd = -1;
+
+  /* the rx event fd only available in lcore mode, child can't init the rxq */
+  if (efd->ready_efd >= 0 && !ctx->child) {
+    int event_fd = mufd_get_event_fd(ufd->ufd);
+    if (event_fd >= 0) {
+      struct epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      ev.data.ptr = item;
+      if (LIBC_FN(epoll_ctl, efd->ready_efd, EPOLL_CTL_ADD, event_fd, &ev) < 0) {
+        warn("%s(%d), add event fd %d for ufd %d fail\n", __func__, efd->efd, event_fd,
+             ufd->kfd);
+      } else {
+        item->event_fd = event_fd;
+      }
+    }
+  }
 
   dbg("%s, efd %p ufd %p\n", __func__, efd, ufd);
   pthread_mutex_lock(&efd->mutex);
@@ -304,6 +337,14 @@ static int upl_efd_ctl_add(struct upl_ctx* ctx, struct upl_efd_entry* efd,
   if (!ctx->child) ufd->efd = efd->efd;
   TAILQ_INSERT_TAIL(&efd->fds, item, next);
   efd->fds_cnt++;
+  if (item->event_fd < 0) {
+    efd->no_event_fd_cnt++;
+  } else if (mufd_rx_ready_arm(ufd->ufd) != 0) {
+    /* already has pending pkts, or error to report by the recv */
+    item->ready = true;
+    TAILQ_INSERT_TAIL(&efd->ready_list, item, ready_next);
+    efd->ready_cnt++;
+  }
   pthread_mutex_unlock(&efd->mutex);
 
   dbg("%s(%d), add ufd %d succ\n", __func__, efd->efd, ufd->kfd);
@@ -323,6 +364,14 @@ static int upl_efd_ctl_del(struct upl_ctx* ctx, struct upl_efd_entry* efd,
       /* todo: how to update ufd for child efd */
       if (!ctx->child) ufd->efd = -1;
       efd->fds_cnt--;
+      if (item->ready) {
+        TAILQ_REMOVE(&efd->ready_list, item, ready_next);
+        efd->ready_cnt--;
+      }
+      if (item->event_fd >= 0)
+        LIBC_FN(epoll_ctl, efd->ready_efd, EPOLL_CTL_DEL, item->event_fd, NULL);
+      else
+        efd->no_event_fd_cnt--;
       pthread_mutex_unlock(&efd->mutex);
       upl_free(item);
       dbg("%s(%d), del ufd %d succ\n", __func__, efd->efd, ufd->kfd);
@@ -414,6 +463,97 @@ static int upl_poll_query(void* priv) {
   return ret;
 }
 
+/* move the notified ufds to the ready list and report the ones with pending pkts */
+static int upl_efd_ready_collect(struct upl_efd_entry* entry, struct epoll_event* events,
+                                 int maxevents) {
+  struct epoll_event ready_events[UPL_EFD_READY_BURST];
+  struct upl_efd_fd_item* item;
+  int n;
+
+  do {
+    n = LIBC_FN(epoll_wait, entry->ready_efd, ready_events, UPL_EFD_READY_BURST, 0);
+    for (int i = 0; i < n; i++) {
+      item = ready_events[i].data.ptr;
+      if (item->ready) continue;
+      item->ready = true;
+      TAILQ_INSERT_TAIL(&entry->ready_list, item, ready_next);
+      entry->ready_cnt++;
+    }
+  } while (n == UPL_EFD_READY_BURST);
+
+  /* level triggered, the ufd stays on the list until no pending pkt */
+  int ready = 0;
+  int check_cnt = entry->ready_cnt;
+  for (int i = 0; i < check_cnt && ready < maxevents; i++) {
+    item = TAILQ_FIRST(&entry->ready_list);
+    TAILQ_REMOVE(&entry->ready_list, item, ready_next);
+    if (mufd_rx_ready_arm(item->ufd->ufd) != 0) {
+      /* move to the tail for the fairness if more than maxevents ready */
+      TAILQ_INSERT_TAIL(&entry->ready_list, item, ready_next);
+      events[ready] = item->event;
+      ready++;
+      item->ufd->stat_epoll_revents_cnt++;
+    } else { /* armed now */
+      item->ready = false;
+      entry->ready_cnt--;
+    }
+  }
+
+  return ready;
+}
+
+/* the readiness list based wait, O(ready) for each wait */
+static int upl_efd_epoll_ready_wait(struct upl_efd_entry* entry,
+                                    struct epoll_event* events, int maxevents,
+                                    int timeout_ms, const sigset_t* sigmask) {
+  int efd = entry->efd;
+  int kfd_cnt = atomic_load(&entry->kfd_cnt);
+  struct timespec start, now, tmo;
+  struct pollfd p_fds[2];
+  int ret;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  p_fds[0].fd = entry->ready_efd;
+  p_fds[0].events = POLLIN;
+  p_fds[1].fd = efd; /* the kernel epoll fd is readable once any kfd has event */
+  p_fds[1].events = POLLIN;
+
+  while (true) {
+    pthread_mutex_lock(&entry->mutex);
+    ret = upl_efd_ready_collect(entry, events, maxevents);
+    pthread_mutex_unlock(&entry->mutex);
+    if (ret > 0) return ret;
+
+    if (kfd_cnt > 0) {
+      entry->events = events;
+      entry->maxevents = maxevents;
+      entry->sigmask = sigmask;
+      ret = upl_efd_epoll_query(entry);
+      if (ret != 0) return ret;
+    }
+
+    if (timeout_ms >= 0) {
+      clock_gettime(CLOCK_MONOTONIC, &now);
+      int64_t left_ns = (int64_t)timeout_ms * NS_PER_MS -
+                        ((int64_t)(now.tv_sec - start.tv_sec) * NS_PER_S +
+                         (now.tv_nsec - start.tv_nsec));
+      if (left_ns <= 0) return 0;
+      tmo.tv_sec = left_ns / NS_PER_S;
+      tmo.tv_nsec = left_ns % NS_PER_S;
+    }
+
+    p_fds[0].revents = 0;
+    p_fds[1].revents = 0;
+    /* negative timeout is infinite, as epoll_wait */
+    ret = LIBC_FN(ppoll, p_fds, kfd_cnt > 0 ? 2 : 1, timeout_ms < 0 ? NULL : &tmo,
+                  sigmask);
+    if (ret < 0) return ret; /* EINTR */
+    dbg("%s(%d), ppoll ret %d\n", __func__, efd, ret);
+  }
+
+  return 0;
+}
+
 /* reuse mufd_poll now */
 static int upl_efd_epoll_pwait(struct upl_efd_entry* entry, struct epoll_event* events,
                                int maxevents, int timeout_ms, const sigset_t* sigmask) {
@@ -428,6 +568,10 @@ static int upl_efd_epoll_pwait(struct upl_efd_entry* entry, struct epoll_event*
 
   dbg("%s(%d), timeout_ms %d maxevents %d kfd_cnt %d\n", __func__, efd, timeout_ms,
       maxevents, kfd_cnt);
+  if (entry->ready_efd >= 0 && !entry->no_event_fd_cnt) {
+    return upl_efd_epoll_ready_wait(entry, events, maxevents, timeout_ms, sigmask);
+  }
+
   pthread_mutex_lock(&entry->mutex);
   TAILQ_FOREACH(item, &entry->fds, next) {
     if (p_fds_cnt >= fds_cnt) {
@@ -448,7 +592,9 @@ static int upl_efd_epoll_pwait(struct upl_efd_entry* entry, struct epoll_event*
     entry->events = events;
     entry->maxevents = maxevents;
     entry->sigmask = sigmask;
-    ret = mufd_poll_query(p_fds, p_fds_cnt, timeout_ms, upl_efd_epoll_query, entry);
+    /* the kernel epoll fd is readable once any kfd has event */
+    ret = mufd_poll_query_fd(p_fds, p_fds_cnt, timeout_ms, upl_efd_epoll_query, entry,
+                             efd);
   } else {
     ret = mufd_poll(p_fds, p_fds_cnt, timeout_ms);
   }
@@ -829,6 +975,38 @@ ssize_t sendmsg(int sockfd, const struct msghdr* msg, int flags) {
   }
 }
 
+int sendmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags) {
+  struct upl_ctx* ctx = upl_get_ctx();
+  if (!ctx) return LIBC_FN(sendmmsg, sockfd, msgvec, vlen, flags);
+
+  dbg("%s(%d), vlen %u\n", __func__, sockfd, vlen);
+  struct upl_ufd_entry* entry = upl_get_ufd_entry(ctx, sockfd);
+  if (!entry || !vlen) return LIBC_FN(sendmmsg, sockfd, msgvec, vlen, flags);
+
+  /* all msgs should be in ufd address scope, otherwise fallback to kfd */
+  int ufd = entry->ufd;
+  for (unsigned int i = 0; i < vlen; i++) {
+    const struct msghdr* msg = &msgvec[i].msg_hdr;
+    if (!msg->msg_name || msg->msg_namelen < sizeof(struct sockaddr_in)) {
+      warn("%s(%d), no msg_name or msg_namelen not valid for msg %u\n", __func__, sockfd,
+           i);
+      return LIBC_FN(sendmmsg, sockfd, msgvec, vlen, flags);
+    }
+    /* ufd only support ipv4 now */
+    const struct sockaddr_in* addr_in = (struct sockaddr_in*)msg->msg_name;
+    uint8_t* ip = (uint8_t*)&addr_in->sin_addr.s_addr;
+    if (mufd_tx_valid_ip(ufd, ip) < 0) {
+      dbg("%s(%d), fallback to kernel for ip %u.%u.%u.%u\n", __func__, sockfd, ip[0],
+          ip[1], ip[2], ip[3]);
+      entry->stat_tx_kfd_cnt++;
+      return LIBC_FN(sendmmsg, sockfd, msgvec, vlen, flags);
+    }
+  }
+
+  entry->stat_tx_ufd_cnt++;
+  return mufd_sendmmsg(ufd, msgvec, vlen, flags);
+}
+
 ssize_t send(int sockfd, const void* buf, size_t len, int flags) {
   struct upl_ctx* ctx = upl_get_ctx();
   if (!ctx) return LIBC_FN(send, sockfd, buf, len, flags);
@@ -917,6 +1095,21 @@ ssize_t recvmsg(int sockfd, struct msghdr* msg, int flags) {
   }
 }
 
+int recvmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags,
+             struct timespec* timeout) {
+  struct upl_ctx* ctx = upl_get_ctx();
+  if (!ctx) return LIBC_FN(recvmmsg, sockfd, msgvec, vlen, flags, timeout);
+
+  struct upl_ufd_entry* entry = upl_get_ufd_entry(ctx, sockfd);
+  if (!entry || entry->bind_kfd) {
+    if (entry) entry->stat_rx_kfd_cnt++;
+    return LIBC_FN(recvmmsg, sockfd, msgvec, vlen, flags, timeout);
+  } else {
+    entry->stat_rx_ufd_cnt++;
+    return mufd_recvmmsg(entry->ufd, msgvec, vlen, flags, timeout);
+  }
+}
+
 int getsockopt(int sockfd, int level, int optname, void* optval, socklen_t* optlen) {
   struct upl_ctx* ctx = upl_get_ctx();
   if (!ctx) return LIBC_FN(getsockopt, sockfd, level, optname, optval, optlen);
@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <sys/epoll.h>
 #include <sys/queue.h>
+#include <time.h>
 
 #include "../preload_platform.h"
 
@@ -62,6 +63,9 @@ enum mtl_log_level upl_get_log_level(void);
     return -1;            \
   } while (0)
 
+#define NS_PER_S (1000000000)
+#define NS_PER_MS (1000 * 1000)
+
 /* child only can't use rte malloc */
 static inline void* upl_malloc(size_t sz) {
   return malloc(sz);
@@ -85,6 +89,7 @@ struct upl_functions {
   ssize_t (*sendto)(int sockfd, const void* buf, size_t len, int flags,
                     const struct sockaddr* dest_addr, socklen_t addrlen);
   ssize_t (*sendmsg)(int sockfd, const struct msghdr* msg, int flags);
+  int (*sendmmsg)(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags);
   int (*poll)(struct pollfd* fds, nfds_t nfds, int timeout);
   int (*ppoll)(struct pollfd* fds, nfds_t nfds, const struct timespec* tmo_p,
                const sigset_t* sigmask);
@@ -96,6 +101,8 @@ struct upl_functions {
                       struct sockaddr* src_addr, socklen_t* addrlen);
   ssize_t (*recv)(int sockfd, void* buf, size_t len, int flags);
   ssize_t (*recvmsg)(int sockfd, struct msghdr* msg, int flags);
+  int (*recvmmsg)(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags,
+                  struct timespec* timeout);
   int (*getsockopt)(int sockfd, int level, int optname, void* optval, socklen_t* optlen);
   int (*setsockopt)(int sockfd, int level, int optname, const void* optval,
                     socklen_t optlen);
@@ -153,21 +160,39 @@ struct upl_ufd_entry {
 struct upl_efd_fd_item {
   struct epoll_event event;
   struct upl_ufd_entry* ufd;
+  int event_fd; /* the rx event fd of the ufd, -1 if not support */
+  bool ready;   /* on the ready list */
   /* linked list */
   TAILQ_ENTRY(upl_efd_fd_item) next;
+  TAILQ_ENTRY(upl_efd_fd_item) ready_next;
 };
 /* List of efd fd items */
 TAILQ_HEAD(upl_efd_fd_list, upl_efd_fd_item);
 
+/* List of ready efd fd items */
+TAILQ_HEAD(upl_efd_ready_list, upl_efd_fd_item);
+
+/* max events for one query on the ready_efd */
+#define UPL_EFD_READY_BURST (64)
+
 /* efd entry for epoll */
 struct upl_efd_entry {
   /* base, always the first element */
   struct upl_base_entry base;
   int efd;
-  pthread_mutex_t mutex; /* protect fds */
+  pthread_mutex_t mutex; /* protect fds and ready list */
   struct upl_efd_fd_list fds;
   int fds_cnt;
   atomic_int kfd_cnt;
+  /*
+   * Readiness list mode, the rx event fd of each ufd is added to the ready_efd, the
+   * notified ufd is moved to the ready list and stays until it has no pending pkt.
+   * Only used if all ufds has the rx event fd, otherwise query all ufds.
+   */
+  int ready_efd;
+  struct upl_efd_ready_list ready_list;
+  int ready_cnt;
+  int no_event_fd_cnt; /* the number of ufds without the rx event fd */
   /* for kfd query */
   struct epoll_event* events;
   int maxevents;
@@ -85,6 +85,59 @@ static int tx_socket_send_mbuf(struct mt_tx_socket_thread* t, struct rte_mbuf* m
   return 0;
 }
 
+/* send up to MT_DP_SOCKET_BATCH_SIZE mbufs with one sendmmsg, return the sent number */
+static uint16_t tx_socket_send_mbufs(struct mt_tx_socket_thread* t,
+                                     struct rte_mbuf** tx_pkts, uint16_t nb_pkts) {
+  struct mt_tx_socket_entry* entry = t->parent;
+  enum mtl_port port = entry->port;
+  int fd = t->fd, ret;
+  struct mtl_port_status* stats = mt_if(entry->parent, port)->dev_stats_sw;
+  uint16_t nb = RTE_MIN(nb_pkts, MT_DP_SOCKET_BATCH_SIZE);
+  uint16_t valid = 0;
+
+  for (uint16_t i = 0; i < nb; i++) {
+    struct rte_mbuf* m = tx_pkts[i];
+    /* check if suppoted, stop the batch at the first bad mbuf */
+    ret = tx_socket_verify_mbuf(m);
+    if (ret < 0) {
+      err("%s(%d,%d), unsupported mbuf %p ret %d\n", __func__, port, fd, m, ret);
+      break;
+    }
+
+    struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(m, struct mt_udp_hdr*);
+    struct sockaddr_in* addr = &t->mmsg_addrs[i];
+    struct iovec* iov = &t->mmsg_iovs[i];
+    struct msghdr* msg = &t->mmsgs[i].msg_hdr;
+
+    mudp_init_sockaddr(addr, (uint8_t*)&hdr->ipv4.dst_addr, ntohs(hdr->udp.dst_port));
+    iov->iov_base = rte_pktmbuf_mtod_offset(m, void*, sizeof(struct mt_udp_hdr));
+    iov->iov_len = m->data_len - sizeof(struct mt_udp_hdr);
+    memset(msg, 0, sizeof(*msg));
+    msg->msg_name = addr;
+    msg->msg_namelen = sizeof(*addr);
+    msg->msg_iov = iov;
+    msg->msg_iovlen = 1;
+    valid++;
+  }
+  if (!valid) return 0;
+
+  t->stat_tx_try++;
+  /* nonblocking */
+  int sent = sendmmsg(fd, t->mmsgs, valid, MSG_DONTWAIT);
+  dbg("%s(%d,%d), valid %u sent %d\n", __func__, port, fd, valid, sent);
+  if (sent <= 0) return 0;
+
+  if (stats) {
+    stats->tx_packets += sent;
+    for (int i = 0; i < sent; i++) stats->tx_bytes += tx_pkts[i]->data_len;
+    stats->tx_batches++;
+  }
+  t->stat_tx_pkt += sent;
+  t->stat_tx_batch++;
+
+  return sent;
+}
+
 static uint16_t tx_socket_send_mbuf_gso(struct mt_tx_socket_thread* t,
                                         struct rte_mbuf** tx_pkts, uint16_t nb_pkts) {
   uint16_t tx = 0;
@@ -174,6 +227,24 @@ static uint16_t tx_socket_send_mbuf_gso(struct mt_tx_socket_thread* t,
   return tx;
 }
 
+static void tx_socket_thread_batch(struct mt_tx_socket_thread* t) {
+  struct mt_tx_socket_entry* entry = t->parent;
+  struct rte_mbuf* pkts[MT_DP_SOCKET_BATCH_SIZE];
+  unsigned int n;
+  uint16_t sent;
+
+  while (rte_atomic32_read(&t->stop_thread) == 0) {
+    n = rte_ring_mc_dequeue_burst(entry->ring, (void**)pkts, MT_DP_SOCKET_BATCH_SIZE,
+                                  NULL);
+    if (!n) continue;
+    sent = 0;
+    do {
+      sent += tx_socket_send_mbufs(t, &pkts[sent], n - sent);
+    } while ((sent < n) && (rte_atomic32_read(&t->stop_thread) == 0));
+    rte_pktmbuf_free_bulk(pkts, n);
+  }
+}
+
 static void* tx_socket_thread_loop(void* arg) {
   struct mt_tx_socket_thread* t = arg;
   struct mt_tx_socket_entry* entry = t->parent;
@@ -182,6 +253,11 @@ static void* tx_socket_thread_loop(void* arg) {
   int ret;
 
   info("%s(%d,%d), start\n", __func__, port, t->fd);
+  if (entry->batch) {
+    tx_socket_thread_batch(t);
+    info("%s(%d,%d), stop\n", __func__, port, t->fd);
+    return NULL;
+  }
   while (rte_atomic32_read(&t->stop_thread) == 0) {
     ret = rte_ring_mc_dequeue(entry->ring, (void**)&m);
     if (ret < 0) continue;
@@ -195,34 +271,43 @@ static void* tx_socket_thread_loop(void* arg) {
   return NULL;
 }
 
-static int tx_socket_init_thread_data(struct mt_tx_socket_thread* t) {
+int mt_tx_socket_init_fd(struct mtl_main_impl* impl, enum mtl_port port, int fd) {
   int ret;
-  struct mt_tx_socket_entry* entry = t->parent;
-  enum mtl_port port = entry->port;
-  int idx = t->idx;
-  int fd = socket(AF_INET, SOCK_DGRAM, 0);
-  if (fd < 0) {
-    err("%s(%d,%d), socket open fail %d\n", __func__, port, idx, fd);
-    return fd;
-  }
-  t->fd = fd;
-  info("%s(%d), fd %d for thread %d\n", __func__, idx, fd, idx);
 
   /* non-blocking */
   ret = mt_fd_set_nonbolck(fd);
   if (ret < 0) {
-    err("%s(%d,%d), set nonbolck fail %d\n", __func__, port, idx, ret);
+    err("%s(%d,%d), set nonbolck fail %d\n", __func__, port, fd, ret);
     return ret;
   }
 
   /* bind to device */
-  const char* if_name = mt_kernel_if_name(entry->parent, port);
+  const char* if_name = mt_kernel_if_name(impl, port);
   ret = setsockopt(fd, SOL_SOCKET, SO_BINDTODEVICE, if_name, strlen(if_name));
   if (ret < 0) {
-    err("%s(%d,%d), SO_BINDTODEVICE to %s fail %d\n", __func__, port, idx, if_name, ret);
+    err("%s(%d,%d), SO_BINDTODEVICE to %s fail %d\n", __func__, port, fd, if_name, ret);
     return ret;
   }
 
+  return 0;
+}
+
+static int tx_socket_init_thread_data(struct mt_tx_socket_thread* t) {
+  int ret;
+  struct mt_tx_socket_entry* entry = t->parent;
+  enum mtl_port port = entry->port;
+  int idx = t->idx;
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    err("%s(%d,%d), socket open fail %d\n", __func__, port, idx, fd);
+    return fd;
+  }
+  t->fd = fd;
+  info("%s(%d), fd %d for thread %d\n", __func__, idx, fd, idx);
+
+  ret = mt_tx_socket_init_fd(entry->parent, port, fd);
+  if (ret < 0) return ret;
+
   if (entry->gso_sz) {
     mudp_init_sockaddr(&t->send_addr, entry->flow.dip_addr, entry->flow.dst_port);
     t->msg.msg_namelen = sizeof(t->send_addr);
@@ -296,6 +381,11 @@ static int tx_socket_stat_dump(void* priv) {
 
     info("%s(%d,%d), tx pkt %d gso %d try %d on thread %d\n", __func__, port, fd,
          t->stat_tx_pkt, t->stat_tx_gso, t->stat_tx_try, i);
+    if (t->stat_tx_batch) {
+      info("%s(%d,%d), tx batch %d avg %.1f pkts per batch on thread %d\n", __func__,
+           port, fd, t->stat_tx_batch, (float)t->stat_tx_pkt / t->stat_tx_batch, i);
+      t->stat_tx_batch = 0;
+    }
     t->stat_tx_pkt = 0;
     t->stat_tx_gso = 0;
     t->stat_tx_try = 0;
@@ -325,6 +415,7 @@ struct mt_tx_socket_entry* mt_tx_socket_get(struct mtl_main_impl* impl,
   /* 5g bit per second */
   entry->rate_limit_per_thread = (uint64_t)6 * 1000 * 1000 * 1000;
   entry->gso_sz = flow->gso_sz;
+  if (mt_get_user_params(impl)->flags & MTL_FLAG_SOCKET_BATCH) entry->batch = true;
   rte_memcpy(&entry->flow, flow, sizeof(entry->flow));
 
   for (int i = 0; i < MT_DP_SOCKET_THREADS_MAX; i++) {
@@ -361,9 +452,9 @@ struct mt_tx_socket_entry* mt_tx_socket_get(struct mtl_main_impl* impl,
   entry->stat_registered = true;
 
   uint8_t* ip = flow->dip_addr;
-  info("%s(%d), fd %d ip %u.%u.%u.%u, port %u, threads %u gso_sz %u\n", __func__, port,
-       entry->threads_data[0].fd, ip[0], ip[1], ip[2], ip[3], flow->dst_port,
-       entry->threads, entry->gso_sz);
+  info("%s(%d), fd %d ip %u.%u.%u.%u, port %u, threads %u gso_sz %u batch %s\n",
+       __func__, port, entry->threads_data[0].fd, ip[0], ip[1], ip[2], ip[3],
+       flow->dst_port, entry->threads, entry->gso_sz, entry->batch ? "yes" : "no");
   return entry;
 }
 
@@ -423,6 +514,13 @@ uint16_t mt_tx_socket_burst(struct mt_tx_socket_entry* entry, struct rte_mbuf**
 
   if (entry->gso_sz) {
     tx = tx_socket_send_mbuf_gso(&entry->threads_data[0], tx_pkts, nb_pkts);
+  } else if (entry->batch) {
+    uint16_t sent;
+    while (tx < nb_pkts) {
+      sent = tx_socket_send_mbufs(&entry->threads_data[0], &tx_pkts[tx], nb_pkts - tx);
+      tx += sent;
+      if (sent < MT_DP_SOCKET_BATCH_SIZE) break; /* socket busy */
+    }
   } else {
     for (tx = 0; tx < nb_pkts; tx++) {
       struct rte_mbuf* m = tx_pkts[tx];
@@ -435,11 +533,9 @@ uint16_t mt_tx_socket_burst(struct mt_tx_socket_entry* entry, struct rte_mbuf**
   return tx;
 }
 
-static int rx_socket_init_fd(struct mt_rx_socket_entry* entry, int fd, bool reuse) {
+int mt_rx_socket_init_fd(struct mtl_main_impl* impl, enum mtl_port port,
+                         struct mt_rxq_flow* flow, int fd, bool reuse) {
   int ret;
-  enum mtl_port port = entry->port;
-  struct mtl_main_impl* impl = entry->parent;
-  struct mt_rxq_flow* flow = &entry->flow;
 
   if (reuse) {
     int optval = 1;
@@ -539,6 +635,93 @@ static struct rte_mbuf* rx_socket_recv_mbuf(struct mt_rx_socket_thread* t) {
   return pkt;
 }
 
+/* receive up to MT_DP_SOCKET_BATCH_SIZE pkts with one recvmmsg */
+static uint16_t rx_socket_recv_mbufs(struct mt_rx_socket_thread* t,
+                                     struct rte_mbuf** rx_pkts, uint16_t nb_pkts) {
+  struct mt_rx_socket_entry* entry = t->parent;
+  enum mtl_port port = entry->port;
+  struct mtl_port_status* stats = mt_if(entry->parent, port)->dev_stats_sw;
+  int fd = entry->fd, ret;
+  uint16_t nb = RTE_MIN(nb_pkts, MT_DP_SOCKET_BATCH_SIZE);
+
+  /* refill the mbufs consumed by last call */
+  if (t->nb_mbufs < nb) {
+    ret = rte_pktmbuf_alloc_bulk(entry->pool, &t->mbufs[t->nb_mbufs], nb - t->nb_mbufs);
+    if (ret < 0) {
+      dbg("%s(%d), pkts alloc fail %d\n", __func__, port, ret);
+      if (!t->nb_mbufs) return 0;
+      nb = t->nb_mbufs; /* try with what we have */
+    } else {
+      t->nb_mbufs = nb;
+    }
+  }
+
+  for (uint16_t i = 0; i < nb; i++) {
+    struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(t->mbufs[i], struct mt_udp_hdr*);
+    struct iovec* iov = &t->mmsg_iovs[i];
+    struct msghdr* msg = &t->mmsgs[i].msg_hdr;
+
+    iov->iov_base = &hdr[1];
+    iov->iov_len = entry->pool_element_sz;
+    memset(msg, 0, sizeof(*msg));
+    msg->msg_name = &t->mmsg_addrs[i];
+    msg->msg_namelen = sizeof(t->mmsg_addrs[i]);
+    msg->msg_iov = iov;
+    msg->msg_iovlen = 1;
+  }
+
+  t->stat_rx_try++;
+  int rx = recvmmsg(fd, t->mmsgs, nb, MSG_DONTWAIT, NULL);
+  if (rx <= 0) return 0;
+  dbg("%s(%d,%d), recv %d pkts\n", __func__, port, fd, rx);
+
+  for (int i = 0; i < rx; i++) {
+    struct rte_mbuf* pkt = t->mbufs[i];
+    struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(pkt, struct mt_udp_hdr*);
+    struct sockaddr_in* addr_in = &t->mmsg_addrs[i];
+    uint32_t len = t->mmsgs[i].msg_len;
+
+    pkt->pkt_len = len + sizeof(*hdr);
+    pkt->data_len = pkt->pkt_len;
+    hdr->udp.dgram_len = htons(len + sizeof(hdr->udp));
+    hdr->udp.src_port = addr_in->sin_port;
+    hdr->ipv4.src_addr = addr_in->sin_addr.s_addr;
+    hdr->ipv4.next_proto_id = IPPROTO_UDP;
+    if (stats) stats->rx_bytes += pkt->data_len;
+    rx_pkts[i] = pkt;
+  }
+  if (stats) {
+    stats->rx_packets += rx;
+    stats->rx_batches++;
+  }
+  t->stat_rx_pkt += rx;
+  t->stat_rx_batch++;
+
+  /* move the unused mbufs to the head */
+  t->nb_mbufs -= rx;
+  if (t->nb_mbufs) memmove(&t->mbufs[0], &t->mbufs[rx], t->nb_mbufs * sizeof(t->mbufs[0]));
+
+  return rx;
+}
+
+static void rx_socket_thread_batch(struct mt_rx_socket_thread* t) {
+  struct mt_rx_socket_entry* entry = t->parent;
+  struct rte_mbuf* pkts[MT_DP_SOCKET_BATCH_SIZE];
+  uint16_t rx;
+  unsigned int n;
+
+  while (rte_atomic32_read(&t->stop_thread) == 0) {
+    rx = rx_socket_recv_mbufs(t, pkts, MT_DP_SOCKET_BATCH_SIZE);
+    if (!rx) continue;
+    n = 0;
+    while (rte_atomic32_read(&t->stop_thread) == 0) {
+      n += rte_ring_mp_enqueue_burst(entry->ring, (void**)&pkts[n], rx - n, NULL);
+      if (n >= rx) break; /* succ */
+    }
+    if (n < rx) rte_pktmbuf_free_bulk(&pkts[n], rx - n);
+  }
+}
+
 static void* rx_socket_thread_loop(void* arg) {
   struct mt_rx_socket_thread* t = arg;
   struct mt_rx_socket_entry* entry = t->parent;
@@ -548,6 +731,11 @@ static void* rx_socket_thread_loop(void* arg) {
   int ret;
 
   info("%s(%d,%d), start thread %d\n", __func__, port, fd, idx);
+  if (entry->batch) {
+    rx_socket_thread_batch(t);
+    info("%s(%d,%d), stop thread %d\n", __func__, port, fd, idx);
+    return NULL;
+  }
   while (rte_atomic32_read(&t->stop_thread) == 0) {
     m = rx_socket_recv_mbuf(t);
     if (!m) continue;
@@ -605,6 +793,11 @@ static int rx_socket_stat_dump(void* priv) {
 
     info("%s(%d,%d), rx pkt %d try %d on thread %d\n", __func__, port, fd, t->stat_rx_pkt,
          t->stat_rx_try, i);
+    if (t->stat_rx_batch) {
+      info("%s(%d,%d), rx batch %d avg %.1f pkts per batch on thread %d\n", __func__,
+           port, fd, t->stat_rx_batch, (float)t->stat_rx_pkt / t->stat_rx_batch, i);
+      t->stat_rx_batch = 0;
+    }
     t->stat_rx_pkt = 0;
     t->stat_rx_try = 0;
   }
@@ -647,6 +840,7 @@ struct mt_rx_socket_entry* mt_rx_socket_get(struct mtl_main_impl* impl,
   entry->parent = impl;
   entry->port = port;
   entry->pool_element_sz = 2048;
+  if (mt_get_user_params(impl)->flags & MTL_FLAG_SOCKET_BATCH) entry->batch = true;
   rte_memcpy(&entry->flow, flow, sizeof(entry->flow));
   /* 5g bit per second */
   entry->rate_limit_per_thread = (uint64_t)5 * 1000 * 1000 * 1000;
@@ -661,7 +855,7 @@ struct mt_rx_socket_entry* mt_rx_socket_get(struct mtl_main_impl* impl,
   uint64_t required = flow->bytes_per_sec * 8;
   entry->threads = required / entry->rate_limit_per_thread + 1;
   entry->threads = RTE_MIN(entry->threads, MT_DP_SOCKET_THREADS_MAX);
-  ret = rx_socket_init_fd(entry, fd, false);
+  ret = mt_rx_socket_init_fd(impl, port, &entry->flow, fd, false);
   if (ret < 0) {
     mt_rx_socket_put(entry);
     return NULL;
@@ -699,8 +893,9 @@ struct mt_rx_socket_entry* mt_rx_socket_get(struct mtl_main_impl* impl,
   entry->stat_registered = true;
 
   uint8_t* ip = flow->dip_addr;
-  info("%s(%d), fd %d ip %u.%u.%u.%u port %u threads %d\n", __func__, port, fd, ip[0],
-       ip[1], ip[2], ip[3], flow->dst_port, entry->threads);
+  info("%s(%d), fd %d ip %u.%u.%u.%u port %u threads %d batch %s\n", __func__, port, fd,
+       ip[0], ip[1], ip[2], ip[3], flow->dst_port, entry->threads,
+       entry->batch ? "yes" : "no");
   return entry;
 }
 
@@ -728,6 +923,10 @@ int mt_rx_socket_put(struct mt_rx_socket_entry* entry) {
       rte_pktmbuf_free(t->mbuf);
       t->mbuf = NULL;
     }
+    if (t->nb_mbufs) {
+      rte_pktmbuf_free_bulk(t->mbufs, t->nb_mbufs);
+      t->nb_mbufs = 0;
+    }
   }
 
   if (entry->ring) {
@@ -759,6 +958,16 @@ uint16_t mt_rx_socket_burst(struct mt_rx_socket_entry* entry, struct rte_mbuf**
     return rte_ring_sc_dequeue_burst(entry->ring, (void**)rx_pkts, nb_pkts, NULL);
   }
 
+  if (entry->batch) {
+    uint16_t n;
+    while (rx < nb_pkts) {
+      n = rx_socket_recv_mbufs(t, &rx_pkts[rx], nb_pkts - rx);
+      rx += n;
+      if (n < MT_DP_SOCKET_BATCH_SIZE) break; /* no more pkts */
+    }
+    return rx;
+  }
+
   for (rx = 0; rx < nb_pkts; rx++) {
     struct rte_mbuf* pkt = rx_socket_recv_mbuf(t);
     if (!pkt) break;
@@ -769,6 +978,23 @@ uint16_t mt_rx_socket_burst(struct mt_rx_socket_entry* entry, struct rte_mbuf**
 }
 
 #else
+int mt_tx_socket_init_fd(struct mtl_main_impl* impl, enum mtl_port port, int fd) {
+  MTL_MAY_UNUSED(impl);
+  MTL_MAY_UNUSED(fd);
+  err("%s(%d), not support on this platform\n", __func__, port);
+  return -ENOTSUP;
+}
+
+int mt_rx_socket_init_fd(struct mtl_main_impl* impl, enum mtl_port port,
+                         struct mt_rxq_flow* flow, int fd, bool reuse) {
+  MTL_MAY_UNUSED(impl);
+  MTL_MAY_UNUSED(flow);
+  MTL_MAY_UNUSED(fd);
+  MTL_MAY_UNUSED(reuse);
+  err("%s(%d), not support on this platform\n", __func__, port);
+  return -ENOTSUP;
+}
+
 struct mt_tx_socket_entry* mt_tx_socket_get(struct mtl_main_impl* impl,
                                             enum mtl_port port,
                                             struct mt_txq_flow* flow) {
@@ -7,6 +7,12 @@
 
 #include "../mt_main.h"
 
+/* nonblock and bind to the kernel interface, shared with the io_uring backend */
+int mt_tx_socket_init_fd(struct mtl_main_impl* impl, enum mtl_port port, int fd);
+/* nonblock, bind to the interface and udp port, join multicast if needed */
+int mt_rx_socket_init_fd(struct mtl_main_impl* impl, enum mtl_port port,
+                         struct mt_rxq_flow* flow, int fd, bool reuse);
+
 struct mt_tx_socket_entry* mt_tx_socket_get(struct mtl_main_impl* impl,
                                             enum mtl_port port, struct mt_txq_flow* flow);
 int mt_tx_socket_put(struct mt_tx_socket_entry* entry);
@@ -0,0 +1,624 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2024 Intel Corporation
+ * The data path based on io_uring of linux kernel socket interface
+ */
+
+#include "mt_dp_uring.h"
+
+#include <liburing.h>
+
+#include "../mt_log.h"
+#include "../mt_stat.h"
+#include "mt_dp_socket.h"
+#include "mudp_api.h"
+
+#define MT_URING_RX_PREFIX "UR_"
+/* nb of the provided buffers(mbuf) for one rx socket, power of 2 */
+#define MT_URING_RX_BUFS (512)
+/* provided buffer group id, one ring per socket so always 0 */
+#define MT_URING_RX_BGID (0)
+/* nb of the inflight sendmsg for one tx socket */
+#define MT_URING_TX_SLOTS (512)
+
+struct mt_uring_rxq {
+  struct io_uring ring;
+  bool ring_inited;
+  struct io_uring_buf_ring* br;
+  /* the mbufs lent to the kernel, index by the buffer id */
+  struct rte_mbuf* bufs[MT_URING_RX_BUFS];
+  /* buffer ids wait for a new mbuf */
+  uint16_t refill_bids[MT_URING_RX_BUFS];
+  uint16_t nb_refill;
+  /* offset from the mbuf data start to the provided buffer addr */
+  uint16_t buf_offset;
+  /* template for multishot recvmsg, only the name is required */
+  struct msghdr msg;
+  bool armed;
+
+  uint32_t stat_rx_pkt;
+  uint32_t stat_rx_cqe;
+  uint32_t stat_rx_rearm;
+  uint32_t stat_rx_nobuf;
+  uint32_t stat_rx_err;
+  uint32_t stat_rx_trunc;
+  uint32_t stat_refill_fail;
+};
+
+struct mt_uring_tx_slot {
+  struct rte_mbuf* mbuf;
+  struct msghdr msg;
+  struct iovec iov;
+  struct sockaddr_in addr;
+};
+
+struct mt_uring_txq {
+  struct io_uring ring;
+  bool ring_inited;
+  struct mt_uring_tx_slot slots[MT_URING_TX_SLOTS];
+  uint16_t free_slots[MT_URING_TX_SLOTS];
+  uint16_t nb_free;
+
+  uint32_t stat_tx_pkt;
+  uint32_t stat_tx_submit;
+  uint32_t stat_tx_submit_fail;
+  uint32_t stat_tx_submit_short;
+  uint32_t stat_tx_full;
+  uint32_t stat_tx_err;
+};
+
+static inline void* rx_uring_buf_addr(struct mt_uring_rxq* q, struct rte_mbuf* m) {
+  return rte_pktmbuf_mtod_offset(m, uint8_t*, q->buf_offset);
+}
+
+/* hand the mbuf to the kernel as the provided buffer of bid */
+static inline void rx_uring_buf_add(struct mt_uring_rxq* q, struct rte_mbuf* m,
+                                    uint16_t bid, int offset) {
+  q->bufs[bid] = m;
+  io_uring_buf_ring_add(q->br, rx_uring_buf_addr(q, m),
+                        rte_pktmbuf_tailroom(m) - q->buf_offset, bid,
+                        io_uring_buf_ring_mask(MT_URING_RX_BUFS), offset);
+}
+
+static void rx_uring_refill(struct mt_rx_uring_entry* entry) {
+  struct mt_uring_rxq* q = entry->rxq;
+  uint16_t nb = q->nb_refill;
+
+  if (!nb) return;
+  struct rte_mbuf* mbufs[nb];
+  if (rte_pktmbuf_alloc_bulk(entry->pool, mbufs, nb) < 0) {
+    q->stat_refill_fail++;
+    return; /* retry in next burst */
+  }
+  for (uint16_t i = 0; i < nb; i++) rx_uring_buf_add(q, mbufs[i], q->refill_bids[i], i);
+  io_uring_buf_ring_advance(q->br, nb);
+  q->nb_refill = 0;
+}
+
+static int rx_uring_arm(struct mt_rx_uring_entry* entry) {
+  struct mt_uring_rxq* q = entry->rxq;
+  struct io_uring_sqe* sqe = io_uring_get_sqe(&q->ring);
+
+  if (!sqe) return -EBUSY;
+  io_uring_prep_recvmsg_multishot(sqe, entry->fd, &q->msg, 0);
+  sqe->flags |= IOSQE_BUFFER_SELECT;
+  sqe->buf_group = MT_URING_RX_BGID;
+  int ret = io_uring_submit(&q->ring);
+  if (ret < 0) return ret;
+  q->armed = true;
+  q->stat_rx_rearm++;
+  return 0;
+}
+
+/* return the mbuf if it's a valid udp payload, NULL if dropped */
+static struct rte_mbuf* rx_uring_handle_cqe(struct mt_rx_uring_entry* entry,
+                                            struct io_uring_cqe* cqe) {
+  struct mt_uring_rxq* q = entry->rxq;
+  struct mtl_port_status* stats = mt_if(entry->parent, entry->port)->dev_stats_sw;
+
+  if (!(cqe->flags & IORING_CQE_F_MORE)) q->armed = false;
+  if (cqe->res < 0) {
+    if (cqe->res == -ENOBUFS)
+      q->stat_rx_nobuf++;
+    else
+      q->stat_rx_err++;
+    return NULL;
+  }
+  if (!(cqe->flags & IORING_CQE_F_BUFFER)) return NULL;
+
+  uint16_t bid = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+  struct rte_mbuf* pkt = q->bufs[bid];
+  q->bufs[bid] = NULL;
+  q->refill_bids[q->nb_refill++] = bid;
+
+  void* buf = rx_uring_buf_addr(q, pkt);
+  struct io_uring_recvmsg_out* out = io_uring_recvmsg_validate(buf, cqe->res, &q->msg);
+  if (!out || (out->flags & MSG_TRUNC)) {
+    q->stat_rx_trunc++;
+    rte_pktmbuf_free(pkt);
+    return NULL;
+  }
+  /* copy the source address out since the header below overlaps it */
+  struct sockaddr_in addr_in = *(struct sockaddr_in*)io_uring_recvmsg_name(out);
+  uint32_t len = io_uring_recvmsg_payload_length(out, cqe->res, &q->msg);
+  void* payload = io_uring_recvmsg_payload(out, &q->msg);
+  struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(pkt, struct mt_udp_hdr*);
+  if (payload != (void*)&hdr[1]) memmove(&hdr[1], payload, len);
+
+  pkt->pkt_len = len + sizeof(*hdr);
+  pkt->data_len = pkt->pkt_len;
+  hdr->udp.dgram_len = htons(len + sizeof(hdr->udp));
+  hdr->udp.src_port = addr_in.sin_port;
+  hdr->ipv4.src_addr = addr_in.sin_addr.s_addr;
+  hdr->ipv4.next_proto_id = IPPROTO_UDP;
+
+  if (stats) {
+    stats->rx_packets++;
+    stats->rx_bytes += pkt->data_len;
+  }
+  q->stat_rx_pkt++;
+  return pkt;
+}
+
+static int rx_uring_stat_dump(void* priv) {
+  struct mt_rx_uring_entry* entry = priv;
+  struct mt_uring_rxq* q = entry->rxq;
+  enum mtl_port port = entry->port;
+  int fd = entry->fd;
+
+  info("%s(%d,%d), rx pkt %u cqe %u rearm %u\n", __func__, port, fd, q->stat_rx_pkt,
+       q->stat_rx_cqe, q->stat_rx_rearm);
+  q->stat_rx_pkt = 0;
+  q->stat_rx_cqe = 0;
+  q->stat_rx_rearm = 0;
+  if (q->stat_rx_nobuf || q->stat_refill_fail) {
+    warn("%s(%d,%d), no buf %u refill fail %u\n", __func__, port, fd, q->stat_rx_nobuf,
+         q->stat_refill_fail);
+    q->stat_rx_nobuf = 0;
+    q->stat_refill_fail = 0;
+  }
+  if (q->stat_rx_err || q->stat_rx_trunc) {
+    err("%s(%d,%d), err %u trunc %u\n", __func__, port, fd, q->stat_rx_err,
+        q->stat_rx_trunc);
+    q->stat_rx_err = 0;
+    q->stat_rx_trunc = 0;
+  }
+
+  return 0;
+}
+
+static int rx_uring_init(struct mt_rx_uring_entry* entry) {
+  struct mt_uring_rxq* q = entry->rxq;
+  enum mtl_port port = entry->port;
+  int ret;
+
+  /* the recvmsg out header and the name are placed just before the payload */
+  int prefix = sizeof(struct io_uring_recvmsg_out) + sizeof(struct sockaddr_in);
+  if (prefix > (int)sizeof(struct mt_udp_hdr)) {
+    err("%s(%d), prefix %d bigger than udp hdr\n", __func__, port, prefix);
+    return -EINVAL;
+  }
+  q->buf_offset = sizeof(struct mt_udp_hdr) - prefix;
+  q->msg.msg_namelen = sizeof(struct sockaddr_in);
+
+  ret = io_uring_queue_init(MT_URING_RX_BUFS, &q->ring, 0);
+  if (ret < 0) {
+    err("%s(%d), io_uring init fail %d\n", __func__, port, ret);
+    return ret;
+  }
+  q->ring_inited = true;
+
+  q->br = io_uring_setup_buf_ring(&q->ring, MT_URING_RX_BUFS, MT_URING_RX_BGID, 0, &ret);
+  if (!q->br) {
+    err("%s(%d), buf ring setup fail %d\n", __func__, port, ret);
+    return ret;
+  }
+
+  for (uint16_t bid = 0; bid < MT_URING_RX_BUFS; bid++) q->refill_bids[bid] = bid;
+  q->nb_refill = MT_URING_RX_BUFS;
+  rx_uring_refill(entry);
+  if (q->nb_refill) {
+    err("%s(%d), mbufs alloc fail\n", __func__, port);
+    return -ENOMEM;
+  }
+
+  ret = rx_uring_arm(entry);
+  if (ret < 0) {
+    err("%s(%d), arm multishot recvmsg fail %d\n", __func__, port, ret);
+    return ret;
+  }
+
+  return 0;
+}
+
+struct mt_rx_uring_entry* mt_rx_uring_get(struct mtl_main_impl* impl, enum mtl_port port,
+                                          struct mt_rxq_flow* flow) {
+  int ret;
+
+  if (!mt_drv_kernel_based(impl, port)) {
+    err("%s(%d), this pmd is not kernel based\n", __func__, port);
+    return NULL;
+  }
+  if (flow->flags & MT_RXQ_FLOW_F_SYS_QUEUE) {
+    err("%s(%d), sys_queue not supported\n", __func__, port);
+    return NULL;
+  }
+  if (flow->flags & MT_RXQ_FLOW_F_NO_PORT) {
+    err("%s(%d), no_port_flow not supported\n", __func__, port);
+    return NULL;
+  }
+
+  struct mt_rx_uring_entry* entry =
+      mt_rte_zmalloc_socket(sizeof(*entry), mt_socket_id(impl, port));
+  if (!entry) {
+    err("%s(%d), entry malloc fail\n", __func__, port);
+    return NULL;
+  }
+  entry->parent = impl;
+  entry->port = port;
+  entry->pool_element_sz = 2048;
+  rte_memcpy(&entry->flow, flow, sizeof(entry->flow));
+
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    err("%s(%d), socket open fail %d\n", __func__, port, fd);
+    mt_rte_free(entry);
+    return NULL;
+  }
+  entry->fd = fd;
+  ret = mt_rx_socket_init_fd(impl, port, &entry->flow, fd, false);
+  if (ret < 0) {
+    mt_rx_uring_put(entry);
+    return NULL;
+  }
+
+  /* mbufs for the provided buffers and the ones hold by the app */
+  unsigned int mbuf_elements = MT_URING_RX_BUFS + mt_if_nb_rx_desc(impl, port) + 1024;
+  char pool_name[ST_MAX_NAME_LEN];
+  snprintf(pool_name, ST_MAX_NAME_LEN, "%sP%dF%d_MBUF", MT_URING_RX_PREFIX, port, fd);
+  entry->pool = mt_mempool_create(impl, port, pool_name, mbuf_elements,
+                                  MT_MBUF_CACHE_SIZE, 0, entry->pool_element_sz);
+  if (!entry->pool) {
+    err("%s(%d), mempool %s create fail\n", __func__, port, pool_name);
+    mt_rx_uring_put(entry);
+    return NULL;
+  }
+
+  entry->rxq = mt_rte_zmalloc_socket(sizeof(*entry->rxq), mt_socket_id(impl, port));
+  if (!entry->rxq) {
+    err("%s(%d), rxq malloc fail\n", __func__, port);
+    mt_rx_uring_put(entry);
+    return NULL;
+  }
+  ret = rx_uring_init(entry);
+  if (ret < 0) {
+    err("%s(%d), uring init fail %d\n", __func__, port, ret);
+    mt_rx_uring_put(entry);
+    return NULL;
+  }
+
+  ret = mt_stat_register(impl, rx_uring_stat_dump, entry, "rx_uring");
+  if (ret < 0) {
+    err("%s(%d), stat register fail %d\n", __func__, port, ret);
+    mt_rx_uring_put(entry);
+    return NULL;
+  }
+  entry->stat_registered = true;
+
+  uint8_t* ip = flow->dip_addr;
+  info("%s(%d), fd %d ip %u.%u.%u.%u port %u\n", __func__, port, fd, ip[0], ip[1], ip[2],
+       ip[3], flow->dst_port);
+  return entry;
+}
+
+int mt_rx_uring_put(struct mt_rx_uring_entry* entry) {
+  int fd = entry->fd;
+  enum mtl_port port = entry->port;
+  struct mt_uring_rxq* q = entry->rxq;
+
+  if (entry->stat_registered) {
+    rx_uring_stat_dump(entry);
+    mt_stat_unregister(entry->parent, rx_uring_stat_dump, entry);
+    entry->stat_registered = false;
+  }
+
+  /* close fd first to terminate the multishot recvmsg */
+  if (entry->fd >= 0) {
+    close(entry->fd);
+    entry->fd = -1;
+  }
+  if (q) {
+    if (q->br) {
+      io_uring_free_buf_ring(&q->ring, q->br, MT_URING_RX_BUFS, MT_URING_RX_BGID);
+      q->br = NULL;
+    }
+    if (q->ring_inited) {
+      io_uring_queue_exit(&q->ring);
+      q->ring_inited = false;
+    }
+    for (uint16_t bid = 0; bid < MT_URING_RX_BUFS; bid++) {
+      if (q->bufs[bid]) {
+        rte_pktmbuf_free(q->bufs[bid]);
+        q->bufs[bid] = NULL;
+      }
+    }
+    mt_rte_free(q);
+    entry->rxq = NULL;
+  }
+  if (entry->pool) {
+    mt_mempool_free(entry->pool);
+    entry->pool = NULL;
+  }
+
+  info("%s(%d,%d), succ\n", __func__, port, fd);
+  mt_rte_free(entry);
+  return 0;
+}
+
+uint16_t mt_rx_uring_burst(struct mt_rx_uring_entry* entry, struct rte_mbuf** rx_pkts,
+                           const uint16_t nb_pkts) {
+  struct mt_uring_rxq* q = entry->rxq;
+  struct io_uring_cqe* cqes[nb_pkts];
+  uint16_t rx = 0;
+
+  unsigned int n = io_uring_peek_batch_cqe(&q->ring, cqes, nb_pkts);
+  for (unsigned int i = 0; i < n; i++) {
+    struct rte_mbuf* pkt = rx_uring_handle_cqe(entry, cqes[i]);
+    if (pkt) rx_pkts[rx++] = pkt;
+  }
+  if (n) {
+    io_uring_cq_advance(&q->ring, n);
+    q->stat_rx_cqe += n;
+  }
+
+  /* give the buffers back to kernel and rearm if the multishot terminated */
+  rx_uring_refill(entry);
+  if (!q->armed && !q->nb_refill) rx_uring_arm(entry);
+
+  return rx;
+}
+
+static void tx_uring_reap(struct mt_tx_uring_entry* entry) {
+  struct mt_uring_txq* q = entry->txq;
+  struct mtl_port_status* stats = mt_if(entry->parent, entry->port)->dev_stats_sw;
+  struct io_uring_cqe* cqes[MT_URING_TX_SLOTS];
+
+  unsigned int n = io_uring_peek_batch_cqe(&q->ring, cqes, MT_URING_TX_SLOTS);
+  for (unsigned int i = 0; i < n; i++) {
+    uint16_t idx = io_uring_cqe_get_data64(cqes[i]);
+    struct mt_uring_tx_slot* slot = &q->slots[idx];
+
+    if (cqes[i]->res < 0) {
+      q->stat_tx_err++;
+    } else {
+      if (stats) {
+        stats->tx_packets++;
+        stats->tx_bytes += slot->mbuf->data_len;
+      }
+      q->stat_tx_pkt++;
+    }
+    rte_pktmbuf_free(slot->mbuf);
+    slot->mbuf = NULL;
+    q->free_slots[q->nb_free++] = idx;
+  }
+  if (n) io_uring_cq_advance(&q->ring, n);
+}
+
+static int tx_uring_stat_dump(void* priv) {
+  struct mt_tx_uring_entry* entry = priv;
+  struct mt_uring_txq* q = entry->txq;
+  enum mtl_port port = entry->port;
+  int fd = entry->fd;
+
+  info("%s(%d,%d), tx pkt %u submit %u inflight %u\n", __func__, port, fd,
+       q->stat_tx_pkt, q->stat_tx_submit, MT_URING_TX_SLOTS - q->nb_free);
+  q->stat_tx_pkt = 0;
+  q->stat_tx_submit = 0;
+  if (q->stat_tx_full) {
+    warn("%s(%d,%d), slots full %u\n", __func__, port, fd, q->stat_tx_full);
+    q->stat_tx_full = 0;
+  }
+  if (q->stat_tx_err) {
+    err("%s(%d,%d), send err %u\n", __func__, port, fd, q->stat_tx_err);
+    q->stat_tx_err = 0;
+  }
+  if (q->stat_tx_submit_fail) {
+    err("%s(%d,%d), submit fail %u\n", __func__, port, fd, q->stat_tx_submit_fail);
+    q->stat_tx_submit_fail = 0;
+  }
+  if (q->stat_tx_submit_short) {
+    warn("%s(%d,%d), submit short %u\n", __func__, port, fd, q->stat_tx_submit_short);
+    q->stat_tx_submit_short = 0;
+  }
+
+  return 0;
+}
+
+struct mt_tx_uring_entry* mt_tx_uring_get(struct mtl_main_impl* impl, enum mtl_port port,
+                                          struct mt_txq_flow* flow) {
+  int ret;
+
+  if (!mt_drv_kernel_based(impl, port)) {
+    err("%s(%d), this pmd is not kernel based\n", __func__, port);
+    return NULL;
+  }
+
+  struct mt_tx_uring_entry* entry =
+      mt_rte_zmalloc_socket(sizeof(*entry), mt_socket_id(impl, port));
+  if (!entry) {
+    err("%s(%d), entry malloc fail\n", __func__, port);
+    return NULL;
+  }
+  entry->parent = impl;
+  entry->port = port;
+  rte_memcpy(&entry->flow, flow, sizeof(entry->flow));
+
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    err("%s(%d), socket open fail %d\n", __func__, port, fd);
+    mt_rte_free(entry);
+    return NULL;
+  }
+  entry->fd = fd;
+  ret = mt_tx_socket_init_fd(impl, port, fd);
+  if (ret < 0) {
+    mt_tx_uring_put(entry);
+    return NULL;
+  }
+
+  struct mt_uring_txq* q =
+      mt_rte_zmalloc_socket(sizeof(*entry->txq), mt_socket_id(impl, port));
+  if (!q) {
+    err("%s(%d), txq malloc fail\n", __func__, port);
+    mt_tx_uring_put(entry);
+    return NULL;
+  }
+  entry->txq = q;
+  for (uint16_t i = 0; i < MT_URING_TX_SLOTS; i++) {
+    struct mt_uring_tx_slot* slot = &q->slots[i];
+    slot->msg.msg_name = &slot->addr;
+    slot->msg.msg_namelen = sizeof(slot->addr);
+    slot->msg.msg_iov = &slot->iov;
+    slot->msg.msg_iovlen = 1;
+    q->free_slots[i] = i;
+  }
+  q->nb_free = MT_URING_TX_SLOTS;
+
+  ret = io_uring_queue_init(MT_URING_TX_SLOTS, &q->ring, 0);
+  if (ret < 0) {
+    err("%s(%d), io_uring init fail %d\n", __func__, port, ret);
+    mt_tx_uring_put(entry);
+    return NULL;
+  }
+  q->ring_inited = true;
+
+  ret = mt_stat_register(impl, tx_uring_stat_dump, entry, "tx_uring");
+  if (ret < 0) {
+    err("%s(%d), stat register fail %d\n", __func__, port, ret);
+    mt_tx_uring_put(entry);
+    return NULL;
+  }
+  entry->stat_registered = true;
+
+  uint8_t* ip = flow->dip_addr;
+  info("%s(%d), fd %d ip %u.%u.%u.%u, port %u\n", __func__, port, fd, ip[0], ip[1], ip[2],
+       ip[3], flow->dst_port);
+  return entry;
+}
+
+int mt_tx_uring_put(struct mt_tx_uring_entry* entry) {
+  int fd = entry->fd;
+  enum mtl_port port = entry->port;
+  struct mt_uring_txq* q = entry->txq;
+
+  if (entry->stat_registered) {
+    tx_uring_stat_dump(entry);
+    mt_stat_unregister(entry->parent, tx_uring_stat_dump, entry);
+    entry->stat_registered = false;
+  }
+
+  if (q) {
+    if (q->ring_inited) {
+      /* wait the inflight sendmsg, at most 100ms */
+      struct __kernel_timespec ts = {.tv_sec = 0, .tv_nsec = 100 * NS_PER_MS};
+      struct io_uring_cqe* cqe;
+      while (q->nb_free < MT_URING_TX_SLOTS) {
+        if (io_uring_wait_cqe_timeout(&q->ring, &cqe, &ts) < 0) break;
+        tx_uring_reap(entry);
+      }
+      io_uring_queue_exit(&q->ring);
+      q->ring_inited = false;
+    }
+    for (uint16_t i = 0; i < MT_URING_TX_SLOTS; i++) {
+      if (q->slots[i].mbuf) {
+        rte_pktmbuf_free(q->slots[i].mbuf);
+        q->slots[i].mbuf = NULL;
+      }
+    }
+    mt_rte_free(q);
+    entry->txq = NULL;
+  }
+  if (entry->fd >= 0) {
+    close(entry->fd);
+    entry->fd = -1;
+  }
+
+  info("%s(%d,%d), succ\n", __func__, port, fd);
+  mt_rte_free(entry);
+  return 0;
+}
+
+/* submit all the queued sqes, the ones not taken by kernel go with the next submit */
+static void tx_uring_submit(struct mt_tx_uring_entry* entry) {
+  struct mt_uring_txq* q = entry->txq;
+  unsigned int pending = io_uring_sq_ready(&q->ring);
+
+  if (!pending) return;
+  int ret = io_uring_submit(&q->ring);
+  if (ret < 0) {
+    /* -EBUSY/-EAGAIN, retried by the next burst even if it has no pkt */
+    err_once("%s(%d,%d), submit fail %d\n", __func__, entry->port, entry->fd, ret);
+    q->stat_tx_submit_fail++;
+    return;
+  }
+  q->stat_tx_submit++;
+  if ((unsigned int)ret < pending) q->stat_tx_submit_short++;
+}
+
+static struct io_uring_sqe* tx_uring_get_sqe(struct mt_tx_uring_entry* entry) {
+  struct mt_uring_txq* q = entry->txq;
+  struct io_uring_sqe* sqe;
+
+  if (q->nb_free) {
+    sqe = io_uring_get_sqe(&q->ring);
+    if (sqe) return sqe;
+  }
+
+  /* push the queued sqes and reap the completions before reporting full */
+  tx_uring_submit(entry);
+  tx_uring_reap(entry);
+  if (!q->nb_free) return NULL;
+  return io_uring_get_sqe(&q->ring);
+}
+
+uint16_t mt_tx_uring_burst(struct mt_tx_uring_entry* entry, struct rte_mbuf** tx_pkts,
+                           uint16_t nb_pkts) {
+  struct mt_uring_txq* q = entry->txq;
+  uint16_t tx = 0;
+
+  /* free the mbufs of the finished sendmsg */
+  tx_uring_reap(entry);
+
+  for (tx = 0; tx < nb_pkts; tx++) {
+    struct rte_mbuf* m = tx_pkts[tx];
+
+    if (m->nb_segs > 1) {
+      err("%s(%d), only support one nb_segs %u\n", __func__, entry->port, m->nb_segs);
+      break;
+    }
+    struct io_uring_sqe* sqe = tx_uring_get_sqe(entry);
+    if (!sqe) {
+      q->stat_tx_full++;
+      break;
+    }
+
+    uint16_t idx = q->free_slots[--q->nb_free];
+    struct mt_uring_tx_slot* slot = &q->slots[idx];
+    struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(m, struct mt_udp_hdr*);
+
+    slot->mbuf = m;
+    mudp_init_sockaddr(&slot->addr, (uint8_t*)&hdr->ipv4.dst_addr,
+                       ntohs(hdr->udp.dst_port));
+    slot->iov.iov_base = &hdr[1];
+    slot->iov.iov_len = m->data_len - sizeof(*hdr);
+    io_uring_prep_sendmsg(sqe, entry->fd, &slot->msg, 0);
+    io_uring_sqe_set_data64(sqe, idx);
+  }
+
+  /*
+   * one syscall for the whole burst, mbufs are freed at completion. Also run when
+   * tx is 0 so the sqes left by a failed or short submit never stall the queue.
+   */
+  tx_uring_submit(entry);
+
+  return tx;
+}
@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2024 Intel Corporation
+ */
+
+#ifndef _MT_LIB_DP_URING_HEAD_H_
+#define _MT_LIB_DP_URING_HEAD_H_
+
+#include "../mt_main.h"
+#include "../mt_util.h"
+
+/* kernel socket pmd with the io_uring backend, selected by kernel_uring:ifname */
+static inline bool mt_pmd_is_kernel_uring(struct mtl_main_impl* impl,
+                                          enum mtl_port port) {
+  if (!mt_pmd_is_kernel_socket(impl, port)) return false;
+  return mt_kernel_port_is_uring(mt_get_user_params(impl)->port[port]);
+}
+
+#ifdef MTL_HAS_URING_BACKEND
+
+struct mt_tx_uring_entry* mt_tx_uring_get(struct mtl_main_impl* impl, enum mtl_port port,
+                                          struct mt_txq_flow* flow);
+int mt_tx_uring_put(struct mt_tx_uring_entry* entry);
+uint16_t mt_tx_uring_burst(struct mt_tx_uring_entry* entry, struct rte_mbuf** tx_pkts,
+                           uint16_t nb_pkts);
+
+struct mt_rx_uring_entry* mt_rx_uring_get(struct mtl_main_impl* impl, enum mtl_port port,
+                                          struct mt_rxq_flow* flow);
+int mt_rx_uring_put(struct mt_rx_uring_entry* entry);
+uint16_t mt_rx_uring_burst(struct mt_rx_uring_entry* entry, struct rte_mbuf** rx_pkts,
+                           const uint16_t nb_pkts);
+
+#else
+
+#include "../mt_log.h"
+
+static inline struct mt_tx_uring_entry* mt_tx_uring_get(struct mtl_main_impl* impl,
+                                                        enum mtl_port port,
+                                                        struct mt_txq_flow* flow) {
+  MTL_MAY_UNUSED(impl);
+  MTL_MAY_UNUSED(flow);
+  err("%s(%d), no io_uring support for this build\n", __func__, port);
+  return NULL;
+}
+
+static inline int mt_tx_uring_put(struct mt_tx_uring_entry* entry) {
+  MTL_MAY_UNUSED(entry);
+  return -ENOTSUP;
+}
+
+static inline uint16_t mt_tx_uring_burst(struct mt_tx_uring_entry* entry,
+                                         struct rte_mbuf** tx_pkts, uint16_t nb_pkts) {
+  MTL_MAY_UNUSED(entry);
+  MTL_MAY_UNUSED(tx_pkts);
+  MTL_MAY_UNUSED(nb_pkts);
+  return 0;
+}
+
+static inline struct mt_rx_uring_entry* mt_rx_uring_get(struct mtl_main_impl* impl,
+                                                        enum mtl_port port,
+                                                        struct mt_rxq_flow* flow) {
+  MTL_MAY_UNUSED(impl);
+  MTL_MAY_UNUSED(flow);
+  err("%s(%d), no io_uring support for this build\n", __func__, port);
+  return NULL;
+}
+
+static inline int mt_rx_uring_put(struct mt_rx_uring_entry* entry) {
+  MTL_MAY_UNUSED(entry);
+  return -ENOTSUP;
+}
+
+static inline uint16_t mt_rx_uring_burst(struct mt_rx_uring_entry* entry,
+                                         struct rte_mbuf** rx_pkts,
+                                         const uint16_t nb_pkts) {
+  MTL_MAY_UNUSED(entry);
+  MTL_MAY_UNUSED(rx_pkts);
+  MTL_MAY_UNUSED(nb_pkts);
+  return 0;
+}
+#endif
+
+static inline uint16_t mt_tx_uring_queue_id(struct mt_tx_uring_entry* entry) {
+  return entry->fd;
+}
+
+static inline uint16_t mt_rx_uring_queue_id(struct mt_rx_uring_entry* entry) {
+  return entry->fd;
+}
+
+#endif
@@ -10,6 +10,7 @@
 #include "../mt_cni.h"
 #include "../mt_log.h"
 #include "mt_dp_socket.h"
+#include "mt_dp_uring.h"
 #include "mt_shared_queue.h"
 #include "mt_shared_rss.h"
 
@@ -18,6 +19,11 @@ static uint16_t rx_socket_burst(struct mt_rxq_entry* entry, struct rte_mbuf** rx
   return mt_rx_socket_burst(entry->rx_socket_q, rx_pkts, nb_pkts);
 }
 
+static uint16_t rx_uring_burst(struct mt_rxq_entry* entry, struct rte_mbuf** rx_pkts,
+                               const uint16_t nb_pkts) {
+  return mt_rx_uring_burst(entry->rx_uring_q, rx_pkts, nb_pkts);
+}
+
 static uint16_t rx_xdp_burst(struct mt_rxq_entry* entry, struct rte_mbuf** rx_pkts,
                              const uint16_t nb_pkts) {
   return mt_rx_xdp_burst(entry->rx_xdp_q, rx_pkts, nb_pkts);
@@ -59,7 +65,13 @@ struct mt_rxq_entry* mt_rxq_get(struct mtl_main_impl* impl, enum mtl_port port,
   entry->parent = impl;
 
   dbg("%s(%d), flags 0x%x\n", __func__, port, flow->flags);
-  if (mt_pmd_is_kernel_socket(impl, port) || (flow->flags & MT_RXQ_FLOW_F_FORCE_SOCKET)) {
+  if (mt_pmd_is_kernel_uring(impl, port)) {
+    entry->rx_uring_q = mt_rx_uring_get(impl, port, flow);
+    if (!entry->rx_uring_q) goto fail;
+    entry->queue_id = mt_rx_uring_queue_id(entry->rx_uring_q);
+    entry->burst = rx_uring_burst;
+  } else if (mt_pmd_is_kernel_socket(impl, port) ||
+             (flow->flags & MT_RXQ_FLOW_F_FORCE_SOCKET)) {
     entry->rx_socket_q = mt_rx_socket_get(impl, port, flow);
     if (!entry->rx_socket_q) goto fail;
     entry->queue_id = mt_rx_socket_queue_id(entry->rx_socket_q);
@@ -124,6 +136,10 @@ int mt_rxq_put(struct mt_rxq_entry* entry) {
     mt_rx_socket_put(entry->rx_socket_q);
     entry->rx_socket_q = NULL;
   }
+  if (entry->rx_uring_q) {
+    mt_rx_uring_put(entry->rx_uring_q);
+    entry->rx_uring_q = NULL;
+  }
   if (entry->rx_xdp_q) {
     mt_rx_xdp_put(entry->rx_xdp_q);
     entry->rx_xdp_q = NULL;
@@ -146,6 +162,11 @@ static uint16_t tx_socket_burst(struct mt_txq_entry* entry, struct rte_mbuf** tx
   return mt_tx_socket_burst(entry->tx_socket_q, tx_pkts, nb_pkts);
 }
 
+static uint16_t tx_uring_burst(struct mt_txq_entry* entry, struct rte_mbuf** tx_pkts,
+                               uint16_t nb_pkts) {
+  return mt_tx_uring_burst(entry->tx_uring_q, tx_pkts, nb_pkts);
+}
+
 static uint16_t tx_xdp_burst(struct mt_txq_entry* entry, struct rte_mbuf** tx_pkts,
                              uint16_t nb_pkts) {
   return mt_tx_xdp_burst(entry->tx_xdp_q, tx_pkts, nb_pkts);
@@ -177,7 +198,13 @@ struct mt_txq_entry* mt_txq_get(struct mtl_main_impl* impl, enum mtl_port port,
   entry->parent = impl;
 
   dbg("%s(%d), flags 0x%x\n", __func__, port, flow->flags);
-  if (mt_pmd_is_kernel_socket(impl, port) || (flow->flags & MT_TXQ_FLOW_F_FORCE_SOCKET)) {
+  if (mt_pmd_is_kernel_uring(impl, port) && !flow->gso_sz) {
+    entry->tx_uring_q = mt_tx_uring_get(impl, port, flow);
+    if (!entry->tx_uring_q) goto fail;
+    entry->queue_id = mt_tx_uring_queue_id(entry->tx_uring_q);
+    entry->burst = tx_uring_burst;
+  } else if (mt_pmd_is_kernel_socket(impl, port) ||
+             (flow->flags & MT_TXQ_FLOW_F_FORCE_SOCKET)) {
     entry->tx_socket_q = mt_tx_socket_get(impl, port, flow);
     if (!entry->tx_socket_q) goto fail;
     entry->queue_id = mt_tx_socket_queue_id(entry->tx_socket_q);
@@ -224,6 +251,10 @@ int mt_txq_put(struct mt_txq_entry* entry) {
     mt_tx_socket_put(entry->tx_socket_q);
     entry->tx_socket_q = NULL;
   }
+  if (entry->tx_uring_q) {
+    mt_tx_uring_put(entry->tx_uring_q);
+    entry->tx_uring_q = NULL;
+  }
   if (entry->tx_xdp_q) {
     mt_tx_xdp_put(entry->tx_xdp_q);
     entry->tx_xdp_q = NULL;
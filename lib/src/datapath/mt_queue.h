@@ -18,6 +18,7 @@ struct mt_rxq_entry {
   struct mt_srss_entry* srss;
   struct mt_csq_entry* csq;
   struct mt_rx_socket_entry* rx_socket_q;
+  struct mt_rx_uring_entry* rx_uring_q;
   struct mt_rx_xdp_entry* rx_xdp_q;
   struct mt_rx_rdma_entry* rx_rdma_q;
 
@@ -40,6 +41,7 @@ struct mt_txq_entry {
   struct mt_tx_queue* txq;
   struct mt_tsq_entry* tsq;
   struct mt_tx_socket_entry* tx_socket_q;
+  struct mt_tx_uring_entry* tx_uring_q;
   struct mt_tx_xdp_entry* tx_xdp_q;
   struct mt_tx_rdma_entry* tx_rdma_q;  // TODO: remove this when rdma is ready
 
@@ -47,8 +47,12 @@ static int rsq_stat_dump(void* priv) {
     if (s->stat_pkts_recv) {
       notice("%s(%d,%u), entries %d, pkt recv %d deliver %d\n", __func__, port, q,
              rte_atomic32_read(&s->entry_cnt), s->stat_pkts_recv, s->stat_pkts_deliver);
+      notice("%s(%d,%u), hash hit %u miss %u, fallback entries %d\n", __func__, port, q,
+             s->stat_hash_hit, s->stat_hash_miss, s->nb_fallback_entry);
       s->stat_pkts_recv = 0;
       s->stat_pkts_deliver = 0;
+      s->stat_hash_hit = 0;
+      s->stat_hash_miss = 0;
 
       MT_TAILQ_FOREACH(entry, &s->head, next) {
         idx = entry->idx;
@@ -138,6 +142,7 @@ static int rsq_init(struct mtl_main_impl* impl, struct mt_rsq_impl* rsq) {
     rte_atomic32_set(&rsq_queue->entry_cnt, 0);
     rte_spinlock_init(&rsq_queue->mutex);
     MT_TAILQ_INIT(&rsq_queue->head);
+    for (int b = 0; b < MT_RSQ_HASH_BUCKETS; b++) MT_TAILQ_INIT(&rsq_queue->hash[b]);
   }
 
   int ret = mt_stat_register(impl, rsq_stat_dump, rsq, "rsq");
@@ -165,6 +170,91 @@ static uint32_t rsq_flow_hash(struct mt_rxq_flow* flow) {
   return mt_softrss((uint32_t*)&tuple, len);
 }
 
+/*
+ * Bucket of the (ip, dst port) key in the flow table, ip in network order and port in
+ * host order. The queue itself is selected by the toeplitz rsq_flow_hash at get time,
+ * a cheap fold is enough here since it runs for every received packet.
+ */
+static inline uint16_t rsq_hash_bucket(uint32_t ip, uint16_t port) {
+  uint32_t h = ip ^ (((uint32_t)port << 16) | port);
+
+  h ^= h >> 16;
+  h ^= h >> 8;
+  return h & (MT_RSQ_HASH_BUCKETS - 1);
+}
+
+/* return true if the flow can be indexed by the hash table */
+static inline bool rsq_flow_hashable(struct mt_rxq_flow* flow) {
+  if (flow->flags & (MT_RXQ_FLOW_F_SYS_QUEUE | MT_RXQ_FLOW_F_NO_IP |
+                     MT_RXQ_FLOW_F_NO_PORT))
+    return false;
+  return true;
+}
+
+/* call with rsq_lock */
+static void rsq_hash_add(struct mt_rsq_queue* rsq_queue, struct mt_rsq_entry* entry) {
+  struct mt_rxq_flow* flow = &entry->flow;
+
+  if (flow->flags & MT_RXQ_FLOW_F_SYS_QUEUE) return;
+
+  if (!rsq_flow_hashable(flow)) {
+    rsq_queue->nb_fallback_entry++;
+    return;
+  }
+
+  entry->hash_ip = *(uint32_t*)flow->dip_addr;
+  entry->hash_port = flow->dst_port;
+  entry->hash_bucket = rsq_hash_bucket(entry->hash_ip, entry->hash_port);
+  MT_TAILQ_INSERT_HEAD(&rsq_queue->hash[entry->hash_bucket], entry, hash_next);
+  entry->in_hash = true;
+}
+
+/* call with rsq_lock */
+static void rsq_hash_del(struct mt_rsq_queue* rsq_queue, struct mt_rsq_entry* entry) {
+  if (entry->in_hash) {
+    MT_TAILQ_REMOVE(&rsq_queue->hash[entry->hash_bucket], entry, hash_next);
+    entry->in_hash = false;
+  } else if (!(entry->flow.flags & MT_RXQ_FLOW_F_SYS_QUEUE)) {
+    rsq_queue->nb_fallback_entry--;
+  }
+}
+
+static inline struct mt_rsq_entry* rsq_hash_find(struct mt_rsq_queue* rsq_queue,
+                                                 uint32_t ip, uint16_t port) {
+  struct mt_rsq_entry* entry;
+
+  MT_TAILQ_FOREACH(entry, &rsq_queue->hash[rsq_hash_bucket(ip, port)], hash_next) {
+    if (entry->hash_ip == ip && entry->hash_port == port) return entry;
+  }
+  return NULL;
+}
+
+/* same match rule as mt_udp_matched: multicast flow by dst ip, unicast by src ip */
+static inline struct mt_rsq_entry* rsq_hash_lookup(struct mt_rsq_queue* rsq_queue,
+                                                   struct mt_udp_hdr* hdr) {
+  uint16_t port = ntohs(hdr->udp.dst_port);
+  uint32_t dst_ip = hdr->ipv4.dst_addr;
+  struct mt_rsq_entry* entry;
+
+  if (mt_is_multicast_ip((uint8_t*)&dst_ip)) {
+    entry = rsq_hash_find(rsq_queue, dst_ip, port);
+    if (entry) return entry;
+  }
+  return rsq_hash_find(rsq_queue, hdr->ipv4.src_addr, port);
+}
+
+/* walk the entries which are not in the hash table */
+static inline struct mt_rsq_entry* rsq_fallback_lookup(struct mt_rsq_queue* rsq_queue,
+                                                       struct mt_udp_hdr* hdr) {
+  struct mt_rsq_entry* entry;
+
+  MT_TAILQ_FOREACH(entry, &rsq_queue->head, next) {
+    if (entry->in_hash || (entry->flow.flags & MT_RXQ_FLOW_F_SYS_QUEUE)) continue;
+    if (mt_udp_matched(&entry->flow, hdr)) return entry;
+  }
+  return NULL;
+}
+
 struct mt_rsq_entry* mt_rsq_get(struct mtl_main_impl* impl, enum mtl_port port,
                                 struct mt_rxq_flow* flow) {
   if (!mt_user_shared_rxq(impl, port)) {
@@ -243,6 +333,7 @@ struct mt_rsq_entry* mt_rsq_get(struct mtl_main_impl* impl, enum mtl_port port,
 
   rsq_lock(rsq_queue);
   MT_TAILQ_INSERT_HEAD(&rsq_queue->head, entry, next);
+  rsq_hash_add(rsq_queue, entry);
   rte_atomic32_inc(&rsq_queue->entry_cnt);
   rsq_queue->entry_idx++;
   if (flow->flags & MT_RXQ_FLOW_F_SYS_QUEUE) rsq_queue->cni_entry = entry;
@@ -260,6 +351,8 @@ int mt_rsq_put(struct mt_rsq_entry* entry) {
 
   rsq_lock(rsq_queue);
   MT_TAILQ_REMOVE(&rsq_queue->head, entry, next);
+  rsq_hash_del(rsq_queue, entry);
+  if (rsq_queue->cni_entry == entry) rsq_queue->cni_entry = NULL;
   rte_atomic32_dec(&rsq_queue->entry_cnt);
   rsq_unlock(rsq_queue);
 
@@ -305,21 +398,22 @@ static int rsq_rx(struct mt_rsq_queue* rsq_queue) {
   rsq_queue->stat_pkts_recv += rx;
 
   for (uint16_t i = 0; i < rx; i++) {
-    rsq_entry = NULL;
-
     hdr = rte_pktmbuf_mtod(pkts[i], struct mt_udp_hdr*);
     dbg("%s, pkt %u ip %u, port dst %u src %u\n", __func__, q, i,
         (unsigned int)ntohs(hdr->udp.dst_port), (unsigned int)ntohs(hdr->udp.src_port));
 
-    MT_TAILQ_FOREACH(rsq_entry, &rsq_queue->head, next) {
-      bool matched = mt_udp_matched(&rsq_entry->flow, hdr);
-      if (matched) {
-        if (rsq_entry != last_rsq_entry) UPDATE_ENTRY();
-        matched_pkts[matched_pkts_nb++] = pkts[i];
-        break;
-      }
+    rsq_entry = rsq_hash_lookup(rsq_queue, hdr);
+    if (rsq_entry) {
+      rsq_queue->stat_hash_hit++;
+    } else {
+      rsq_queue->stat_hash_miss++;
+      if (rsq_queue->nb_fallback_entry) rsq_entry = rsq_fallback_lookup(rsq_queue, hdr);
     }
-    if (!rsq_entry) { /* no match, redirect to cni */
+
+    if (rsq_entry) {
+      if (rsq_entry != last_rsq_entry) UPDATE_ENTRY();
+      matched_pkts[matched_pkts_nb++] = pkts[i];
+    } else { /* no match, redirect to cni */
       UPDATE_ENTRY();
       if (rsq_queue->cni_entry) rsq_entry_pkts_enqueue(rsq_queue->cni_entry, &pkts[i], 1);
     }
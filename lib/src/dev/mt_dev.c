@@ -236,6 +236,8 @@ static void stat_update_sw(struct mtl_port_status* sum, struct mtl_port_status*
   sum->tx_err_packets += update->tx_err_packets;
   sum->rx_hw_dropped_packets += update->rx_hw_dropped_packets;
   sum->rx_nombuf_packets += update->rx_nombuf_packets;
+  sum->tx_batches += update->tx_batches;
+  sum->rx_batches += update->rx_batches;
 }
 
 static int dev_inf_get_stat_sw(struct mt_interface* inf) {
@@ -280,6 +282,10 @@ static int dev_inf_stat(void* pri) {
   notice("DEV(%d): Avr rate, tx: %f Mb/s, rx: %f Mb/s, pkts, tx: %" PRIu64
          ", rx: %" PRIu64 "\n",
          port, orate_m, irate_m, stats_sum->tx_packets, stats_sum->rx_packets);
+  if (stats_sum->tx_batches || stats_sum->rx_batches) {
+    notice("DEV(%d): Batches, tx: %" PRIu64 ", rx: %" PRIu64 "\n", port,
+           stats_sum->tx_batches, stats_sum->rx_batches);
+  }
   if (stats_sum->rx_hw_dropped_packets || stats_sum->rx_err_packets ||
       stats_sum->rx_nombuf_packets || stats_sum->tx_err_packets) {
     err("DEV(%d): Status: rx_hw_dropped_packets %" PRIu64 " rx_err_packets %" PRIu64
@@ -316,6 +316,235 @@ static int admin_rx_video_migrate(struct mtl_main_impl* impl, bool* migrated) {
   return 0;
 }
 
+/* the load info of one sch for the rebalancer */
+struct admin_sch_load {
+  struct mtl_sch_impl* sch;
+  float load; /* max cpu busy score of the video sessions */
+  int nb_sessions;
+  uint64_t weight_sum;
+  bool time_weight; /* use stat_time for the weight of each session */
+};
+
+/* the candidate session to move */
+struct admin_rebalance_cand {
+  bool tx;
+  int idx;
+  int quota_mbs;
+  float gain;
+  float from_load_expect;
+  float to_load_expect;
+};
+
+static inline uint64_t admin_session_weight(struct mt_stat_u64* stat_time, int quota_mbs,
+                                            bool time_weight) {
+  /* the tasklet time if time measure enabled, otherwise the data quota */
+  if (time_weight) return stat_time->sum;
+  return quota_mbs;
+}
+
+static void admin_sch_load(struct mtl_sch_impl* sch, struct admin_sch_load* l) {
+  struct st_tx_video_sessions_mgr* tx_mgr = &sch->tx_video_mgr;
+  struct st_rx_video_sessions_mgr* rx_mgr = &sch->rx_video_mgr;
+
+  memset(l, 0, sizeof(*l));
+  l->sch = sch;
+  l->time_weight = true;
+
+  for (int j = 0; j < tx_mgr->max_idx; j++) {
+    struct st_tx_video_session_impl* tx_s = tx_video_session_get(tx_mgr, j);
+    if (!tx_s) continue;
+    l->load = RTE_MAX(l->load, (float)tx_s->cpu_busy_score);
+    l->nb_sessions++;
+    if (!tx_s->stat_time.cnt) l->time_weight = false;
+    tx_video_session_put(tx_mgr, j);
+  }
+  for (int j = 0; j < rx_mgr->max_idx; j++) {
+    struct st_rx_video_session_impl* rx_s = rx_video_session_get(rx_mgr, j);
+    if (!rx_s) continue;
+    l->load = RTE_MAX(l->load, (float)rx_s->cpu_busy_score);
+    l->nb_sessions++;
+    if (!rx_s->stat_time.cnt) l->time_weight = false;
+    rx_video_session_put(rx_mgr, j);
+  }
+
+  /* second pass for the weight sum */
+  for (int j = 0; j < tx_mgr->max_idx; j++) {
+    struct st_tx_video_session_impl* tx_s = tx_video_session_get(tx_mgr, j);
+    if (!tx_s) continue;
+    l->weight_sum += admin_session_weight(&tx_s->stat_time, tx_video_quota_mbs(tx_s),
+                                          l->time_weight);
+    tx_video_session_put(tx_mgr, j);
+  }
+  for (int j = 0; j < rx_mgr->max_idx; j++) {
+    struct st_rx_video_session_impl* rx_s = rx_video_session_get(rx_mgr, j);
+    if (!rx_s) continue;
+    l->weight_sum += admin_session_weight(&rx_s->stat_time, rx_video_quota_mbs(rx_s),
+                                          l->time_weight);
+    rx_video_session_put(rx_mgr, j);
+  }
+}
+
+/* cost model: the loop time moves with the share of the session */
+static void admin_rebalance_try(struct admin_sch_load* from, struct admin_sch_load* to,
+                                bool tx, int idx, uint64_t weight, int quota_mbs,
+                                struct admin_rebalance_cand* cand) {
+  if (!from->weight_sum) return;
+  float share = (float)weight / from->weight_sum;
+  float from_expect = from->load * (1.0 - share);
+  float to_expect = to->load + from->load * share;
+  float gain = from->load - RTE_MAX(from_expect, to_expect);
+
+  if (gain <= MT_ADMIN_REBALANCE_COST) return;
+  if (to_expect >= MT_ADMIN_REBALANCE_HIGH) return; /* avoid ping-pong */
+  if (gain <= cand->gain) return;
+
+  cand->tx = tx;
+  cand->idx = idx;
+  cand->quota_mbs = quota_mbs;
+  cand->gain = gain;
+  cand->from_load_expect = from_expect;
+  cand->to_load_expect = to_expect;
+}
+
+static int admin_rebalance(struct mtl_main_impl* impl, bool* migrated) {
+  struct mt_admin* admin = mt_get_admin(impl);
+  struct admin_sch_load loads[MT_MAX_SCH_NUM];
+  struct admin_sch_load* from = NULL;
+  struct admin_sch_load* to = NULL;
+  struct admin_rebalance_cand cand;
+  int nb_loads = 0;
+  int ret;
+
+  for (int sch_idx = 0; sch_idx < MT_MAX_SCH_NUM; sch_idx++) {
+    struct mtl_sch_impl* sch = mt_sch_instance(impl, sch_idx);
+    if (admin->rebalance_hold[sch_idx] > 0) {
+      admin->rebalance_hold[sch_idx]--;
+      continue;
+    }
+    if (!mt_sch_started(sch)) continue;
+    if ((sch->type != MT_SCH_TYPE_DEFAULT) && (sch->type != MT_SCH_TYPE_RX_VIDEO_ONLY))
+      continue;
+    admin_sch_load(sch, &loads[nb_loads]);
+    nb_loads++;
+  }
+
+  /* the hottest sch with at least two sessions */
+  for (int i = 0; i < nb_loads; i++) {
+    struct admin_sch_load* l = &loads[i];
+    if (l->nb_sessions < 2 || l->load < MT_ADMIN_REBALANCE_HIGH) continue;
+    if (!from || l->load > from->load) from = l;
+  }
+  if (!from) return 0;
+
+  /* the most idle sch on the same numa */
+  for (int i = 0; i < nb_loads; i++) {
+    struct admin_sch_load* l = &loads[i];
+    if (l == from) continue;
+    if (l->sch->type != from->sch->type) continue;
+    if (mt_sch_socket_id(l->sch) != mt_sch_socket_id(from->sch)) continue;
+    if (l->sch->cpu_busy || l->load > MT_ADMIN_REBALANCE_LOW) continue;
+    if (!to || l->load < to->load) to = l;
+  }
+  if (!to) {
+    dbg("%s, no idle sch for sch %d load %f\n", __func__, from->sch->idx, from->load);
+    return 0;
+  }
+
+  /* pick the session with the best gain */
+  memset(&cand, 0, sizeof(cand));
+  cand.idx = -1;
+  struct st_tx_video_sessions_mgr* tx_mgr = &from->sch->tx_video_mgr;
+  for (int j = 0; j < tx_mgr->max_idx; j++) {
+    struct st_tx_video_session_impl* tx_s = tx_video_session_get(tx_mgr, j);
+    if (!tx_s) continue;
+    int quota_mbs = tx_video_quota_mbs(tx_s);
+    admin_rebalance_try(from, to, true, j,
+                        admin_session_weight(&tx_s->stat_time, quota_mbs,
+                                             from->time_weight),
+                        quota_mbs, &cand);
+    tx_video_session_put(tx_mgr, j);
+  }
+  struct st_rx_video_sessions_mgr* rx_mgr = &from->sch->rx_video_mgr;
+  for (int j = 0; j < rx_mgr->max_idx; j++) {
+    struct st_rx_video_session_impl* rx_s = rx_video_session_get(rx_mgr, j);
+    if (!rx_s) continue;
+    if (rx_video_session_can_migrate(rx_s)) {
+      int quota_mbs = rx_video_quota_mbs(rx_s);
+      admin_rebalance_try(from, to, false, j,
+                          admin_session_weight(&rx_s->stat_time, quota_mbs,
+                                               from->time_weight),
+                          quota_mbs, &cand);
+    }
+    rx_video_session_put(rx_mgr, j);
+  }
+  if (cand.idx < 0) {
+    dbg("%s, no session worth to move from sch %d\n", __func__, from->sch->idx);
+    return 0;
+  }
+
+  struct mtl_sch_impl* from_sch = from->sch;
+  struct mtl_sch_impl* to_sch = to->sch;
+  ret = mt_sch_get_quota(to_sch, cand.quota_mbs, from_sch->type);
+  if (ret < 0) {
+    dbg("%s, sch %d has no quota for %d\n", __func__, to_sch->idx, cand.quota_mbs);
+    return 0;
+  }
+
+  if (cand.tx) {
+    struct st_tx_video_session_impl* tx_s = tx_video_session_get(tx_mgr, cand.idx);
+    if (tx_s) tx_video_session_put(tx_mgr, cand.idx);
+    ret = -EIO;
+    if (tx_s) {
+      mt_pthread_mutex_lock(&to_sch->tx_video_mgr_mutex);
+      st_tx_video_sessions_sch_init(impl, to_sch); /* ensure video sch context */
+      mt_pthread_mutex_unlock(&to_sch->tx_video_mgr_mutex);
+      ret = tx_video_migrate_to(tx_s, from_sch, to_sch);
+    }
+  } else {
+    struct st_rx_video_session_impl* rx_s = rx_video_session_get(rx_mgr, cand.idx);
+    if (rx_s) rx_video_session_put(rx_mgr, cand.idx);
+    ret = -EIO;
+    if (rx_s) {
+      mt_pthread_mutex_lock(&to_sch->rx_video_mgr_mutex);
+      st_rx_video_sessions_sch_init(impl, to_sch); /* ensure video sch context */
+      mt_pthread_mutex_unlock(&to_sch->rx_video_mgr_mutex);
+      ret = rx_video_migrate_to(impl, rx_s, from_sch, to_sch);
+    }
+  }
+  if (ret < 0) {
+    err("%s, session(%d,%d) move to sch %d fail\n", __func__, from_sch->idx, cand.idx,
+        to_sch->idx);
+    mt_sch_put(to_sch, cand.quota_mbs); /* put back new sch */
+    return ret;
+  }
+  mt_sch_put(from_sch, cand.quota_mbs); /* put back old sch */
+
+  admin->rebalance_hold[from_sch->idx] = MT_ADMIN_REBALANCE_HOLD;
+  admin->rebalance_hold[to_sch->idx] = MT_ADMIN_REBALANCE_HOLD;
+  admin->stat_rebalance_moves++;
+  *migrated = true;
+  info("%s(%u), %s session(%d,%d) to sch %d, load %f:%f expect %f:%f\n", __func__,
+       admin->stat_rebalance_moves, cand.tx ? "tx" : "rx", from_sch->idx, cand.idx,
+       to_sch->idx, from->load, to->load, cand.from_load_expect, cand.to_load_expect);
+
+  struct mtl_init_params* p = mt_get_user_params(impl);
+  if (p->sch_rebalance_notify) {
+    struct mtl_sch_rebalance_meta meta;
+    memset(&meta, 0, sizeof(meta));
+    meta.tx = cand.tx;
+    meta.from_sch = from_sch->idx;
+    meta.from_idx = cand.idx;
+    meta.to_sch = to_sch->idx;
+    meta.from_load = from->load;
+    meta.to_load = to->load;
+    meta.from_load_expect = cand.from_load_expect;
+    meta.to_load_expect = cand.to_load_expect;
+    p->sch_rebalance_notify(p->priv, &meta);
+  }
+
+  return 0;
+}
+
 static void admin_wakeup_thread(struct mt_admin* admin) {
   mt_pthread_mutex_lock(&admin->admin_wake_mutex);
   mt_pthread_cond_signal(&admin->admin_wake_cond);
@@ -345,6 +574,9 @@ static int admin_func(struct mtl_main_impl* impl) {
   if (!migrated && mt_user_rx_video_migrate(impl)) {
     admin_rx_video_migrate(impl, &migrated);
   }
+  if (!migrated && mt_user_sch_rebalance(impl)) {
+    admin_rebalance(impl, &migrated);
+  }
 
   if (migrated) admin_clear_cpu_busy(impl);
 
@@ -7,6 +7,15 @@
 
 #include "mt_main.h"
 
+/* sch load(cpu busy score) to start the rebalance */
+#define MT_ADMIN_REBALANCE_HIGH (60.0)
+/* max sch load for the rebalance target */
+#define MT_ADMIN_REBALANCE_LOW (30.0)
+/* min load gain required for one move, covers the migration cost */
+#define MT_ADMIN_REBALANCE_COST (10.0)
+/* admin periods both sch are frozen after one move */
+#define MT_ADMIN_REBALANCE_HOLD (3)
+
 int mt_admin_init(struct mtl_main_impl* impl);
 int mt_admin_uinit(struct mtl_main_impl* impl);
 
@@ -30,6 +30,7 @@ static void arp_reset(struct mt_arp_impl* arp) {
     entry->ip = 0;
     memset(&entry->ea, 0, sizeof(entry->ea));
   }
+  rte_atomic32_inc(&arp->generation);
 }
 
 static bool arp_is_valid_hdr(struct rte_arp_hdr* hdr) {
@@ -124,6 +125,12 @@ static int arp_receive_reply(struct mtl_main_impl* impl, struct rte_arp_hdr* rep
   }
 
   /* save to arp table */
+  if (rte_atomic32_read(&entry->mac_ready) &&
+      memcmp(entry->ea.addr_bytes, addr_bytes, RTE_ETHER_ADDR_LEN)) {
+    info("%s(%d), mac changed for %d.%d.%d.%d\n", __func__, port, ip[0], ip[1], ip[2],
+         ip[3]);
+    rte_atomic32_inc(&arp_impl->generation);
+  }
   memcpy(entry->ea.addr_bytes, reply->arp_data.arp_sha.addr_bytes, RTE_ETHER_ADDR_LEN);
   rte_atomic32_set(&entry->mac_ready, 1);
   mt_pthread_mutex_unlock(&arp_impl->mutex);
@@ -328,6 +335,7 @@ int mt_arp_init(struct mtl_main_impl* impl) {
     }
 
     mt_pthread_mutex_init(&arp->mutex, NULL);
+    rte_atomic32_set(&arp->generation, 0);
     arp->port = i;
     arp->parent = impl;
 
@@ -377,3 +385,10 @@ int mt_arp_get_mac(struct mtl_main_impl* impl, uint8_t dip[MTL_IP_ADDR_LEN],
 
   return 0;
 }
+
+uint32_t mt_arp_generation(struct mtl_main_impl* impl, enum mtl_port port) {
+  struct mt_arp_impl* arp_impl = get_arp(impl, port);
+
+  if (!arp_impl) return 0; /* kernel arp path */
+  return rte_atomic32_read(&arp_impl->generation);
+}
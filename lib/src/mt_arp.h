@@ -15,4 +15,7 @@ int mt_arp_uinit(struct mtl_main_impl* impl);
 int mt_arp_get_mac(struct mtl_main_impl* impl, uint8_t dip[MTL_IP_ADDR_LEN],
                    struct rte_ether_addr* ea, enum mtl_port port, int timeout_ms);
 
+/* the generation is increased once any mac in the arp table changed */
+uint32_t mt_arp_generation(struct mtl_main_impl* impl, enum mtl_port port);
+
 #endif
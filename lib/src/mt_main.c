@@ -259,6 +259,12 @@ bool mt_sessions_time_measure(struct mtl_main_impl* impl) {
   return enabled;
 }
 
+/* the loopback of kernel socket, kernel:lo or kernel_uring:lo */
+static bool mt_user_port_is_kernel_lo(const char* port) {
+  if (mtl_pmd_by_port_name(port) != MTL_PMD_KERNEL_SOCKET) return false;
+  return !strncmp(mt_kernel_port2if(port), "lo", MTL_PORT_MAX_LEN);
+}
+
 static int mt_user_params_check(struct mtl_init_params* p) {
   int num_ports = p->num_ports, ret;
   uint8_t* ip = NULL;
@@ -328,8 +334,8 @@ static int mt_user_params_check(struct mtl_init_params* p) {
       for (int j = 0; j < i; j++) {
         /* check if duplicate port name */
         if (0 == strncmp(p->port[i], p->port[j], MTL_PORT_MAX_LEN)) {
-          if (!strncmp(p->port[i], "kernel:lo", MTL_PORT_MAX_LEN)) {
-            /* duplicated kernel:lo for test purpose */
+          if (mt_user_port_is_kernel_lo(p->port[i])) {
+            /* duplicated kernel:lo or kernel_uring:lo for test purpose */
             warn("%s, same name %s for port %d and %d\n", __func__, p->port[i], i, j);
           } else {
             err("%s, same name %s for port %d and %d\n", __func__, p->port[i], i, j);
@@ -1248,7 +1254,7 @@ int mtl_port_ip_info(mtl_handle mt, enum mtl_port port, uint8_t ip[MTL_IP_ADDR_L
   return 0;
 }
 
-enum mtl_simd_level mtl_get_simd_level(void) {
+static enum mtl_simd_level mt_cpu_simd_level(void) {
   if (rte_cpu_get_flag_enabled(RTE_CPUFLAG_AVX512VBMI2))
     return MTL_SIMD_LEVEL_AVX512_VBMI2;
   if (rte_cpu_get_flag_enabled(RTE_CPUFLAG_AVX512VL)) return MTL_SIMD_LEVEL_AVX512;
@@ -1257,6 +1263,18 @@ enum mtl_simd_level mtl_get_simd_level(void) {
   return MTL_SIMD_LEVEL_NONE;
 }
 
+enum mtl_simd_level mtl_get_simd_level(void) {
+  /* the cpuid query is slow(trap in vm), resolve once as it's called on each convert */
+  static rte_atomic32_t simd_level = RTE_ATOMIC32_INIT(-1);
+  int level = rte_atomic32_read(&simd_level);
+
+  if (level < 0) {
+    level = mt_cpu_simd_level();
+    rte_atomic32_set(&simd_level, level);
+  }
+  return (enum mtl_simd_level)level;
+}
+
 static const char* mt_simd_level_names[MTL_SIMD_LEVEL_MAX] = {
     "none",
     "avx2",
@@ -414,6 +414,8 @@ struct mt_arp_entry {
 struct mt_arp_impl {
   pthread_mutex_t mutex; /* arp impl protect */
   struct mt_arp_entry entries[MT_ARP_ENTRY_MAX];
+  /* increased once any mac in the table changed, for the user side cache */
+  rte_atomic32_t generation;
   bool timer_active;
   enum mtl_port port;
   struct mtl_main_impl* parent;
@@ -478,6 +480,12 @@ struct mt_sch_tasklet_impl {
   bool request_exit;
   bool ack_exit;
 
+  /* adaptive back-off for non realtime class, 1 means poll on every loop */
+  uint32_t poll_interval;
+  uint32_t poll_interval_max;
+  uint32_t poll_skip; /* loops to skip before next poll */
+  uint32_t idle_cnt;  /* continuous MTL_TASKLET_ALL_DONE */
+
   /* for time measure */
   struct mt_stat_u64 stat_time;
 };
@@ -585,6 +593,10 @@ struct mtl_sch_impl {
   uint64_t stat_sleep_ns_max;
   /* for time measure */
   struct mt_stat_u64 stat_time;
+  /* per tasklet priority class stat */
+  uint64_t stat_class_ns[MTL_TASKLET_PRIORITY_MAX];
+  uint64_t stat_class_polls[MTL_TASKLET_PRIORITY_MAX];
+  uint64_t stat_class_skips[MTL_TASKLET_PRIORITY_MAX];
 };
 
 struct mt_lcore_mgr {
@@ -599,6 +611,7 @@ enum mt_lcore_type {
   MT_LCORE_TYPE_RXV_RING_LCORE,
   MT_LCORE_TYPE_USER,     /* allocated by application */
   MT_LCORE_TYPE_SCH_USER, /* application allocated by mtl_sch_create  */
+  MT_LCORE_TYPE_CONVERT,  /* pipeline convert worker */
   MT_LCORE_TYPE_MAX,
 };
 
@@ -858,6 +871,10 @@ struct mt_admin {
   pthread_cond_t admin_wake_cond;
   pthread_mutex_t admin_wake_mutex;
   rte_atomic32_t admin_stop;
+
+  /* rebalancer, admin periods left before the sch can join the next move */
+  int rebalance_hold[MT_MAX_SCH_NUM];
+  uint32_t stat_rebalance_moves;
 };
 
 struct mt_kport_info {
@@ -936,9 +953,19 @@ struct mt_rsq_entry {
   uint32_t stat_enqueue_fail_cnt;
   /* linked list */
   MT_TAILQ_ENTRY(mt_rsq_entry) next;
+  /* hash lookup key, only valid if in_hash */
+  bool in_hash;
+  uint32_t hash_ip;
+  uint16_t hash_port;
+  uint16_t hash_bucket;
+  /* linked list in the hash bucket */
+  MT_TAILQ_ENTRY(mt_rsq_entry) hash_next;
 };
 MT_TAILQ_HEAD(mt_rsq_entrys_list, mt_rsq_entry);
 
+/* bucket number of the rsq flow hash table, must be power of 2 */
+#define MT_RSQ_HASH_BUCKETS (256)
+
 struct mt_rsq_queue {
   uint16_t port_id;
   uint16_t queue_id;
@@ -946,6 +973,10 @@ struct mt_rsq_queue {
   struct mt_rx_xdp_entry* xdp;
   /* List of rsq entry */
   struct mt_rsq_entrys_list head;
+  /* hash table of the entries with both ip and port, indexed by (ip, dst port) */
+  struct mt_rsq_entrys_list hash[MT_RSQ_HASH_BUCKETS];
+  /* entries which can't be indexed by hash(no ip or no port), fallback to list walk */
+  int nb_fallback_entry;
   rte_spinlock_t mutex;
   rte_atomic32_t entry_cnt;
   int entry_idx;
@@ -953,6 +984,8 @@ struct mt_rsq_queue {
   /* stat */
   int stat_pkts_recv;
   int stat_pkts_deliver;
+  uint32_t stat_hash_hit;
+  uint32_t stat_hash_miss;
 };
 
 struct mt_rsq_impl {
@@ -1084,6 +1117,8 @@ struct mt_srss_impl {
 };
 
 #define MT_DP_SOCKET_THREADS_MAX (4)
+/* max pkts for one recvmmsg/sendmmsg call */
+#define MT_DP_SOCKET_BATCH_SIZE (32)
 
 struct mt_tx_socket_thread {
   struct mt_tx_socket_entry* parent;
@@ -1096,11 +1131,16 @@ struct mt_tx_socket_thread {
   struct sockaddr_in send_addr;
   struct msghdr msg;
   char msg_control[CMSG_SPACE(sizeof(uint16_t))];
+  /* for sendmmsg batch mode */
+  struct mmsghdr mmsgs[MT_DP_SOCKET_BATCH_SIZE];
+  struct iovec mmsg_iovs[MT_DP_SOCKET_BATCH_SIZE];
+  struct sockaddr_in mmsg_addrs[MT_DP_SOCKET_BATCH_SIZE];
 #endif
 
   int stat_tx_try;
   int stat_tx_pkt;
   int stat_tx_gso;
+  int stat_tx_batch;
 };
 
 struct mt_tx_socket_entry {
@@ -1110,6 +1150,7 @@ struct mt_tx_socket_entry {
 
   uint64_t rate_limit_per_thread;
   uint16_t gso_sz;
+  bool batch; /* sendmmsg batch mode */
   int threads;
   struct rte_ring* ring;
   struct mt_tx_socket_thread threads_data[MT_DP_SOCKET_THREADS_MAX];
@@ -1123,8 +1164,18 @@ struct mt_rx_socket_thread {
   pthread_t tid;
   rte_atomic32_t stop_thread;
 
+  /* for recvmmsg batch mode, mbufs pre-allocated and not yet filled */
+  struct rte_mbuf* mbufs[MT_DP_SOCKET_BATCH_SIZE];
+  uint16_t nb_mbufs;
+#ifndef WINDOWSENV
+  struct mmsghdr mmsgs[MT_DP_SOCKET_BATCH_SIZE];
+  struct iovec mmsg_iovs[MT_DP_SOCKET_BATCH_SIZE];
+  struct sockaddr_in mmsg_addrs[MT_DP_SOCKET_BATCH_SIZE];
+#endif
+
   int stat_rx_try;
   int stat_rx_pkt;
+  int stat_rx_batch;
 };
 
 struct mt_rx_socket_entry {
@@ -1135,6 +1186,7 @@ struct mt_rx_socket_entry {
   struct rte_mempool* pool;
   uint16_t pool_element_sz;
   int fd;
+  bool batch; /* recvmmsg batch mode */
 
   uint64_t rate_limit_per_thread;
   int threads;
@@ -1163,6 +1215,29 @@ struct mt_rx_xdp_entry {
   int mcast_fd;
 };
 
+struct mt_uring_txq; /* opaque, io_uring context in mt_dp_uring.c */
+struct mt_uring_rxq;
+
+struct mt_tx_uring_entry {
+  struct mtl_main_impl* parent;
+  enum mtl_port port;
+  struct mt_txq_flow flow;
+  int fd;
+  struct mt_uring_txq* txq;
+  bool stat_registered;
+};
+
+struct mt_rx_uring_entry {
+  struct mtl_main_impl* parent;
+  enum mtl_port port;
+  struct mt_rxq_flow flow;
+  int fd;
+  struct rte_mempool* pool;
+  uint16_t pool_element_sz;
+  struct mt_uring_rxq* rxq;
+  bool stat_registered;
+};
+
 struct mt_tx_rdma_entry {
   struct mtl_main_impl* parent;
   enum mtl_port port;
@@ -1546,6 +1621,14 @@ static inline bool mt_user_rx_video_migrate(struct mtl_main_impl* impl) {
     return false;
 }
 
+/* if user enable the sch rebalancer */
+static inline bool mt_user_sch_rebalance(struct mtl_main_impl* impl) {
+  if (mt_get_user_params(impl)->flags & MTL_FLAG_SCH_REBALANCE)
+    return true;
+  else
+    return false;
+}
+
 /* if user enable tasklet time measure */
 static inline bool mt_user_tasklet_time_measure(struct mtl_main_impl* impl) {
   if (mt_get_user_params(impl)->flags & MTL_FLAG_TASKLET_TIME_MEASURE)
@@ -2017,4 +2100,58 @@ static inline bool mt_spinlock_lock_timeout(struct mtl_main_impl* impl,
   return false; /* timeout */
 }
 
+/* read and clear in one step, for the counter or flag updated from any thread */
+static inline int32_t mt_atomic32_read_clear(rte_atomic32_t* v) {
+  return __atomic_exchange_n(&v->cnt, 0, __ATOMIC_SEQ_CST);
+}
+
+/*
+ * Epoch based lockless session lookup for the tasklet hot path, the reader bump the
+ * epoch to odd on enter and even on exit. A writer marks the session busy under the
+ * session spinlock and then waits for any in-flight reader pass to finish.
+ */
+static inline void mt_sessions_reader_enter(rte_atomic32_t* epoch) {
+  rte_atomic32_inc(epoch);
+  rte_smp_mb();
+}
+
+static inline void mt_sessions_reader_exit(rte_atomic32_t* epoch) {
+  rte_smp_mb();
+  rte_atomic32_inc(epoch);
+}
+
+/*
+ * timeout_us 0 means wait forever, for the get/detach path only and try_get use
+ * mt_sessions_writer_try_sync. Return false if timeout and busy is cleared.
+ */
+static inline bool mt_sessions_writer_sync(struct mtl_main_impl* impl,
+                                           rte_atomic32_t* busy, rte_atomic32_t* epoch,
+                                           int timeout_us) {
+  rte_atomic32_set(busy, 1);
+  rte_smp_mb();
+  int32_t cur = rte_atomic32_read(epoch);
+  if (!(cur & 0x1)) return true; /* no reader in flight */
+
+  uint64_t end = mt_get_tsc(impl) + (uint64_t)timeout_us * NS_PER_US;
+  while (rte_atomic32_read(epoch) == cur) {
+    if (timeout_us && mt_get_tsc(impl) >= end) {
+      rte_atomic32_set(busy, 0);
+      return false; /* timeout */
+    }
+    rte_pause();
+  }
+  return true;
+}
+
+/* never wait, return false and busy is cleared if a reader pass is in flight */
+static inline bool mt_sessions_writer_try_sync(rte_atomic32_t* busy,
+                                               rte_atomic32_t* epoch) {
+  rte_atomic32_set(busy, 1);
+  rte_smp_mb();
+  if (!(rte_atomic32_read(epoch) & 0x1)) return true; /* no reader in flight */
+
+  rte_atomic32_set(busy, 0);
+  return false;
+}
+
 #endif
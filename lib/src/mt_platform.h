@@ -15,6 +15,7 @@
 #include <numa.h>
 #include <poll.h>
 #include <pthread.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <sys/shm.h>
 #include <sys/socket.h>
@@ -36,7 +36,7 @@ static inline void sch_unlock(struct mtl_sch_impl* sch) {
 }
 
 static const char* lcore_type_names[MT_LCORE_TYPE_MAX] = {
-    "lib_sch", "lib_tap", "lib_rxv_ring", "app_allocated", "lib_app_sch",
+    "lib_sch", "lib_tap", "lib_rxv_ring", "app_allocated", "lib_app_sch", "lib_convert",
 };
 
 static const char* lcore_type_name(enum mt_lcore_type type) {
@@ -112,6 +112,41 @@ static int sch_tasklet_sleep(struct mtl_main_impl* impl, struct mtl_sch_impl* sc
   return 0;
 }
 
+static const char* tasklet_priority_names[MTL_TASKLET_PRIORITY_MAX] = {
+    "realtime",
+    "normal",
+    "low",
+};
+
+/* return true if the tasklet should be skipped in this loop */
+static inline bool sch_tasklet_backoff(struct mt_sch_tasklet_impl* tasklet, bool slept) {
+  if (!tasklet->poll_skip) return false;
+  /* the sleep already idled this slot, don't count it as a busy loop */
+  if (slept) {
+    tasklet->poll_skip = 0;
+    return false;
+  }
+  tasklet->poll_skip--;
+  return true;
+}
+
+static inline void sch_tasklet_backoff_update(struct mt_sch_tasklet_impl* tasklet,
+                                              int pending) {
+  if (pending != MTL_TASKLET_ALL_DONE) {
+    /* back to full speed once any pending */
+    tasklet->idle_cnt = 0;
+    tasklet->poll_interval = 1;
+  } else {
+    tasklet->idle_cnt++;
+    if (tasklet->idle_cnt >= MT_SCH_TASKLET_IDLE_THRESH) {
+      tasklet->idle_cnt = 0;
+      tasklet->poll_interval =
+          RTE_MIN(tasklet->poll_interval * 2, tasklet->poll_interval_max);
+    }
+  }
+  tasklet->poll_skip = tasklet->poll_interval - 1;
+}
+
 static bool sch_tasklet_time_measure(struct mtl_main_impl* impl) {
   bool enabled = mt_user_tasklet_time_measure(impl);
   if (MT_USDT_TASKLET_TIME_MEASURE_ENABLED()) enabled = true;
@@ -144,6 +179,7 @@ static int sch_tasklet_func(struct mtl_sch_impl* sch) {
 
   sch->sleep_ratio_start_ns = mt_get_tsc(impl);
   loop_cal_start_ns = mt_get_tsc(impl);
+  bool slept = false;
 
   while (rte_atomic32_read(&sch->request_stop) == 0) {
     int pending = MTL_TASKLET_ALL_DONE;
@@ -163,17 +199,30 @@ static int sch_tasklet_func(struct mtl_sch_impl* sch) {
         continue;
       }
       ops = &tasklet->ops;
+      enum mtl_tasklet_priority priority = ops->priority;
+      bool backoff = (priority != MTL_TASKLET_PRIORITY_REALTIME);
+
+      if (backoff && sch_tasklet_backoff(tasklet, slept)) {
+        sch->stat_class_skips[priority]++;
+        continue;
+      }
 
       uint64_t tm_tasklet_tsc_s = 0; /* for tasklet time_measure */
       if (time_measure) tm_tasklet_tsc_s = mt_get_tsc(impl);
-      pending += ops->handler(ops->priv);
+      int ret = ops->handler(ops->priv);
+      pending += ret;
+      sch->stat_class_polls[priority]++;
+      if (backoff) sch_tasklet_backoff_update(tasklet, ret);
       if (time_measure) {
         uint64_t delta_ns = mt_get_tsc(impl) - tm_tasklet_tsc_s;
         mt_stat_u64_update(&tasklet->stat_time, delta_ns);
+        sch->stat_class_ns[priority] += delta_ns;
       }
     }
+    slept = false;
     if (sch->allow_sleep && (pending == MTL_TASKLET_ALL_DONE)) {
       sch_tasklet_sleep(impl, sch);
+      slept = true;
     }
 
     loop_cnt++;
@@ -447,6 +496,27 @@ static int sch_stat(void* priv) {
     }
   }
 
+  bool time_measure = sch_tasklet_time_measure(sch->parent);
+  for (int c = 0; c < MTL_TASKLET_PRIORITY_MAX; c++) {
+    uint64_t polls = sch->stat_class_polls[c];
+    uint64_t skips = sch->stat_class_skips[c];
+    if (!polls && !skips) continue;
+
+    if (time_measure) {
+      notice("SCH(%d): class %s, polls %" PRIu64 " skips %" PRIu64
+             ", time %.2fms avg %.2fus\n",
+             idx, tasklet_priority_names[c], polls, skips,
+             (float)sch->stat_class_ns[c] / NS_PER_MS,
+             polls ? (float)sch->stat_class_ns[c] / polls / NS_PER_US : 0);
+    } else {
+      notice("SCH(%d): class %s, polls %" PRIu64 " skips %" PRIu64 "\n", idx,
+             tasklet_priority_names[c], polls, skips);
+    }
+    sch->stat_class_ns[c] = 0;
+    sch->stat_class_polls[c] = 0;
+    sch->stat_class_skips[c] = 0;
+  }
+
   if (sch->allow_sleep) {
     notice("SCH(%d): sleep %fms(ratio:%f), cnt %u, min %" PRIu64 "us, max %" PRIu64
            "us\n",
@@ -868,6 +938,12 @@ mtl_tasklet_handle mtl_sch_register_tasklet(struct mtl_sch_impl* sch,
                                             struct mtl_tasklet_ops* tasklet_ops) {
   int idx = sch->idx;
   struct mt_sch_tasklet_impl* tasklet;
+  enum mtl_tasklet_priority priority = tasklet_ops->priority;
+
+  if ((priority < 0) || (priority >= MTL_TASKLET_PRIORITY_MAX)) {
+    err("%s(%d), invalid priority %d\n", __func__, idx, priority);
+    return NULL;
+  }
 
   sch_lock(sch);
 
@@ -888,6 +964,15 @@ mtl_tasklet_handle mtl_sch_register_tasklet(struct mtl_sch_impl* sch,
     tasklet->sch = sch;
     tasklet->idx = i;
     mt_stat_u64_init(&tasklet->stat_time);
+    tasklet->poll_interval = 1;
+    if (tasklet_ops->poll_interval_max)
+      tasklet->poll_interval_max = tasklet_ops->poll_interval_max;
+    else if (priority == MTL_TASKLET_PRIORITY_LOW)
+      tasklet->poll_interval_max = MT_SCH_TASKLET_LOW_INTERVAL_MAX;
+    else if (priority == MTL_TASKLET_PRIORITY_NORMAL)
+      tasklet->poll_interval_max = MT_SCH_TASKLET_NORMAL_INTERVAL_MAX;
+    else
+      tasklet->poll_interval_max = 1;
 
     sch->tasklet[i] = tasklet;
     sch->max_tasklet_idx = RTE_MAX(sch->max_tasklet_idx, i + 1);
@@ -897,8 +982,8 @@ mtl_tasklet_handle mtl_sch_register_tasklet(struct mtl_sch_impl* sch,
     }
 
     sch_unlock(sch);
-    info("%s(%d), tasklet %s registered into slot %d\n", __func__, idx, tasklet_ops->name,
-         i);
+    info("%s(%d), tasklet %s registered into slot %d, priority %s\n", __func__, idx,
+         tasklet_ops->name, i, tasklet_priority_names[priority]);
     return tasklet;
   }
 
@@ -1023,6 +1108,26 @@ int mt_sch_add_quota(struct mtl_sch_impl* sch, int quota_mbs) {
   return -ENOMEM;
 }
 
+int mt_sch_get_quota(struct mtl_sch_impl* sch, int quota_mbs, enum mt_sch_type type) {
+  struct mt_sch_mgr* mgr = mt_sch_get_mgr(sch->parent);
+  int idx = sch->idx, ret;
+
+  sch_mgr_lock(mgr);
+  if (!mt_sch_is_active(sch) || !sch_is_capable(sch, quota_mbs, type)) {
+    sch_mgr_unlock(mgr);
+    return -EINVAL;
+  }
+  ret = mt_sch_add_quota(sch, quota_mbs);
+  if (ret < 0) {
+    dbg("%s(%d), no quota for %d\n", __func__, idx, quota_mbs);
+    sch_mgr_unlock(mgr);
+    return ret;
+  }
+  rte_atomic32_inc(&sch->ref_cnt);
+  sch_mgr_unlock(mgr);
+  return 0;
+}
+
 int mt_sch_put(struct mtl_sch_impl* sch, int quota_mbs) {
   int sidx = sch->idx, ret;
   struct mtl_main_impl* impl = sch->parent;
@@ -7,6 +7,12 @@
 
 #include "mt_main.h"
 
+/* max poll interval(sch loops) for the adaptive back-off of each tasklet class */
+#define MT_SCH_TASKLET_NORMAL_INTERVAL_MAX (8)
+#define MT_SCH_TASKLET_LOW_INTERVAL_MAX (64)
+/* continuous all done loops before the poll interval doubled */
+#define MT_SCH_TASKLET_IDLE_THRESH (16)
+
 static inline struct mt_sch_mgr* mt_sch_get_mgr(struct mtl_main_impl* impl) {
   return &impl->sch_mgr;
 }
@@ -53,6 +59,8 @@ static inline void mt_tasklet_set_sleep(struct mt_sch_tasklet_impl* tasklet,
 }
 
 int mt_sch_add_quota(struct mtl_sch_impl* sch, int quota_mbs);
+/* get the quota and a reference on one specified active sch */
+int mt_sch_get_quota(struct mtl_sch_impl* sch, int quota_mbs, enum mt_sch_type type);
 
 struct mtl_sch_impl* mt_sch_get_by_socket(struct mtl_main_impl* impl, int quota_mbs,
                                           enum mt_sch_type type, mt_sch_mask_t mask,
@@ -935,6 +935,7 @@ uint16_t mt_random_port(uint16_t base_port) {
 static const char* dpdk_afxdp_port_prefix = "dpdk_af_xdp:";
 static const char* dpdk_afpkt_port_prefix = "dpdk_af_packet:";
 static const char* kernel_port_prefix = "kernel:";
+static const char* kernel_uring_port_prefix = "kernel_uring:";
 static const char* native_afxdp_port_prefix = "native_af_xdp:";
 static const char* rdma_ud_port_prefix = "rdma_ud:";
 
@@ -946,6 +947,8 @@ enum mtl_pmd_type mtl_pmd_by_port_name(const char* port) {
     return MTL_PMD_DPDK_AF_PACKET;
   else if (strncmp(port, kernel_port_prefix, strlen(kernel_port_prefix)) == 0)
     return MTL_PMD_KERNEL_SOCKET;
+  else if (mt_kernel_port_is_uring(port)) /* io_uring backend of kernel socket */
+    return MTL_PMD_KERNEL_SOCKET;
   else if (strncmp(port, native_afxdp_port_prefix, strlen(native_afxdp_port_prefix)) == 0)
     return MTL_PMD_NATIVE_AF_XDP;
   else if (strncmp(port, rdma_ud_port_prefix, strlen(rdma_ud_port_prefix)) == 0)
@@ -954,11 +957,19 @@ enum mtl_pmd_type mtl_pmd_by_port_name(const char* port) {
     return MTL_PMD_DPDK_USER; /* default */
 }
 
+bool mt_kernel_port_is_uring(const char* port) {
+  if (strncmp(port, kernel_uring_port_prefix, strlen(kernel_uring_port_prefix)) == 0)
+    return true;
+  else
+    return false;
+}
+
 const char* mt_kernel_port2if(const char* port) {
   if (mtl_pmd_by_port_name(port) != MTL_PMD_KERNEL_SOCKET) {
     err("%s, port %s is not a kernel based\n", __func__, port);
     return NULL;
   }
+  if (mt_kernel_port_is_uring(port)) return port + strlen(kernel_uring_port_prefix);
   return port + strlen(kernel_port_prefix);
 }
 
@@ -281,6 +281,8 @@ static inline int mt_mkstemps(char* template, int suffix_len) {
 const char* mt_dpdk_afxdp_port2if(const char* port);
 const char* mt_dpdk_afpkt_port2if(const char* port);
 const char* mt_kernel_port2if(const char* port);
+/* if the port name select the io_uring backend of MTL_PMD_KERNEL_SOCKET */
+bool mt_kernel_port_is_uring(const char* port);
 const char* mt_native_afxdp_port2if(const char* port);
 const char* mt_rdma_ud_port2if(const char* port);
 
@@ -18,15 +18,10 @@ static const char* tx_st40p_stat_name(enum st40p_tx_frame_status stat) {
   return st40p_tx_frame_stat_name[stat];
 }
 
-static uint16_t tx_st40p_next_idx(struct st40p_tx_ctx* ctx, uint16_t idx) {
-  /* point to next */
-  uint16_t next_idx = idx;
-  next_idx++;
-  if (next_idx >= ctx->framebuff_cnt) next_idx = 0;
-  return next_idx;
-}
-
 static void tx_st40p_block_wake(struct st40p_tx_ctx* ctx) {
+  /* the frame enqueued before is seen by the waiter if we see no waiter */
+  rte_smp_mb();
+  if (!rte_atomic32_read(&ctx->block_waiters)) return;
   /* notify block */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
   mt_pthread_cond_signal(&ctx->block_wake_cond);
@@ -45,26 +40,21 @@ static void tx_st40p_notify_frame_available(struct st40p_tx_ctx* ctx) {
 }
 
 static struct st40p_tx_frame* tx_st40p_next_available(
-    struct st40p_tx_ctx* ctx, uint16_t idx_start, enum st40p_tx_frame_status desired) {
-  uint16_t idx = idx_start;
+    struct st40p_tx_ctx* ctx, enum st40p_tx_frame_status desired) {
   struct st40p_tx_frame* framebuff;
 
-  /* check ready frame from idx_start */
-  while (1) {
-    framebuff = &ctx->framebuffs[idx];
-    if (desired == framebuff->stat) {
-      /* find one desired */
-      return framebuff;
-    }
-    idx = tx_st40p_next_idx(ctx, idx);
-    if (idx == idx_start) {
-      /* loop all frames end */
-      break;
-    }
-  }
+  /* the oldest one in the desired status */
+  if (rte_ring_dequeue(ctx->frame_rings[desired], (void**)&framebuff) < 0) return NULL;
+
+  return framebuff;
+}
 
-  /* no any desired frame */
-  return NULL;
+static void tx_st40p_set_stat(struct st40p_tx_ctx* ctx, struct st40p_tx_frame* framebuff,
+                              enum st40p_tx_frame_status stat) {
+  /* set before the enqueue, the frame may be taken by others just after */
+  framebuff->stat = stat;
+  /* the ring has room for all frames, never full */
+  if (ctx->frame_rings[stat]) rte_ring_enqueue(ctx->frame_rings[stat], framebuff);
 }
 
 static int tx_st40p_next_frame(void* priv, uint16_t* next_frame_idx,
@@ -75,20 +65,12 @@ static int tx_st40p_next_frame(void* priv, uint16_t* next_frame_idx,
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st40p_next_available(ctx, ctx->framebuff_consumer_idx, ST40P_TX_FRAME_READY);
+  framebuff = tx_st40p_next_available(ctx, ST40P_TX_FRAME_READY);
   /* not any converted frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return -EBUSY;
-  }
+  if (!framebuff) return -EBUSY;
 
-  framebuff->stat = ST40P_TX_FRAME_IN_TRANSMITTING;
+  tx_st40p_set_stat(ctx, framebuff, ST40P_TX_FRAME_IN_TRANSMITTING);
   *next_frame_idx = framebuff->idx;
-  /* point to next */
-  ctx->framebuff_consumer_idx = tx_st40p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
   dbg("%s(%d), frame %u succ\n", __func__, ctx->idx, framebuff->idx);
   return 0;
 }
@@ -102,23 +84,22 @@ static int tx_st40p_frame_done(void* priv, uint16_t frame_idx,
 
   framebuff = &ctx->framebuffs[frame_idx];
 
-  mt_pthread_mutex_lock(&ctx->lock);
+  /* update the meta before the frame is free for the app */
+  frame_info = &framebuff->frame_info;
+  frame_info->tfmt = meta->tfmt;
+  frame_info->timestamp = meta->timestamp;
+  frame_info->epoch = meta->epoch;
+  frame_info->rtp_timestamp = meta->rtp_timestamp;
+
   if (ST40P_TX_FRAME_IN_TRANSMITTING == framebuff->stat) {
     ret = 0;
-    framebuff->stat = ST40P_TX_FRAME_FREE;
+    tx_st40p_set_stat(ctx, framebuff, ST40P_TX_FRAME_FREE);
     dbg("%s(%d), done_idx %u\n", __func__, ctx->idx, frame_idx);
   } else {
     ret = -EIO;
     err("%s(%d), err status %d for frame %u\n", __func__, ctx->idx, framebuff->stat,
         frame_idx);
   }
-  mt_pthread_mutex_unlock(&ctx->lock);
-
-  frame_info = &framebuff->frame_info;
-  frame_info->tfmt = meta->tfmt;
-  frame_info->timestamp = meta->timestamp;
-  frame_info->epoch = meta->epoch;
-  frame_info->rtp_timestamp = meta->rtp_timestamp;
 
   if (ctx->ops.notify_frame_done) { /* notify app which frame done */
     ctx->ops.notify_frame_done(ctx->ops.priv, frame_info);
@@ -257,25 +238,63 @@ static int tx_st40p_init_fbs(struct st40p_tx_ctx* ctx, struct st40p_tx_ops* ops)
   return 0;
 }
 
+static int tx_st40p_init_ring(struct st40p_tx_ctx* ctx, enum st40p_tx_frame_status stat,
+                              unsigned int flags) {
+  char ring_name[32];
+  struct rte_ring* ring;
+
+  snprintf(ring_name, sizeof(ring_name), "%sS%d_%s", ST40P_TX_PREFIX, ctx->idx,
+           tx_st40p_stat_name(stat));
+  ring = rte_ring_create(ring_name, ctx->framebuff_cnt, ctx->socket_id,
+                         flags | RING_F_EXACT_SZ);
+  if (!ring) {
+    err("%s(%d), rte_ring_create %s failed\n", __func__, ctx->idx, ring_name);
+    return -ENOMEM;
+  }
+  ctx->frame_rings[stat] = ring;
+  return 0;
+}
+
+static int tx_st40p_uinit_rings(struct st40p_tx_ctx* ctx) {
+  for (int stat = 0; stat < ST40P_TX_FRAME_STATUS_MAX; stat++) {
+    if (ctx->frame_rings[stat]) {
+      rte_ring_free(ctx->frame_rings[stat]);
+      ctx->frame_rings[stat] = NULL;
+    }
+  }
+
+  return 0;
+}
+
+static int tx_st40p_init_rings(struct st40p_tx_ctx* ctx) {
+  int ret;
+
+  /* only the transport tasklet puts the free frames and gets the ready frames */
+  ret = tx_st40p_init_ring(ctx, ST40P_TX_FRAME_FREE, RING_F_SP_ENQ);
+  if (ret < 0) return ret;
+  ret = tx_st40p_init_ring(ctx, ST40P_TX_FRAME_READY, RING_F_SC_DEQ);
+  if (ret < 0) return ret;
+
+  /* no transport yet, safe for the single producer */
+  for (uint16_t i = 0; i < ctx->framebuff_cnt; i++)
+    tx_st40p_set_stat(ctx, &ctx->framebuffs[i], ST40P_TX_FRAME_FREE);
+
+  return 0;
+}
+
 static int tx_st40p_stat(void* priv) {
   struct st40p_tx_ctx* ctx = priv;
-  struct st40p_tx_frame* framebuff = ctx->framebuffs;
-  uint16_t producer_idx;
-  uint16_t consumer_idx;
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  producer_idx = ctx->framebuff_producer_idx;
-  consumer_idx = ctx->framebuff_consumer_idx;
-  notice("TX_st40p(%d,%s), p(%d:%s) c(%d:%s)\n", ctx->idx, ctx->ops_name, producer_idx,
-         tx_st40p_stat_name(framebuff[producer_idx].stat), consumer_idx,
-         tx_st40p_stat_name(framebuff[consumer_idx].stat));
+  notice("TX_st40p(%d,%s), free %u ready %u\n", ctx->idx, ctx->ops_name,
+         rte_ring_count(ctx->frame_rings[ST40P_TX_FRAME_FREE]),
+         rte_ring_count(ctx->frame_rings[ST40P_TX_FRAME_READY]));
 
   notice("TX_st40p(%d), frame get try %d succ %d, put %d\n", ctx->idx,
-         ctx->stat_get_frame_try, ctx->stat_get_frame_succ, ctx->stat_put_frame);
-  ctx->stat_get_frame_try = 0;
-  ctx->stat_get_frame_succ = 0;
-  ctx->stat_put_frame = 0;
+         mt_atomic32_read_clear(&ctx->stat_get_frame_try),
+         mt_atomic32_read_clear(&ctx->stat_get_frame_succ),
+         mt_atomic32_read_clear(&ctx->stat_put_frame));
 
   return 0;
 }
@@ -283,11 +302,15 @@ static int tx_st40p_stat(void* priv) {
 static int tx_st40p_get_block_wait(struct st40p_tx_ctx* ctx) {
   dbg("%s(%d), start\n", __func__, ctx->idx);
 
+  rte_atomic32_inc(&ctx->block_waiters);
   /* wait on the block cond */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
-  mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
-                               ctx->block_timeout_ns);
+  /* check again as the wake skips the signal if it sees no waiter */
+  if (rte_ring_empty(ctx->frame_rings[ST40P_TX_FRAME_FREE]))
+    mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
+                                 ctx->block_timeout_ns);
   mt_pthread_mutex_unlock(&ctx->block_wake_mutex);
+  rte_atomic32_dec(&ctx->block_waiters);
   dbg("%s(%d), end\n", __func__, ctx->idx);
 
   return 0;
@@ -336,33 +359,22 @@ struct st40_frame_info* st40p_tx_get_frame(st40p_tx_handle handle) {
 
   if (!ctx->ready) return NULL; /* not ready */
 
-  ctx->stat_get_frame_try++;
+  rte_atomic32_inc(&ctx->stat_get_frame_try);
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st40p_next_available(ctx, ctx->framebuff_producer_idx, ST40P_TX_FRAME_FREE);
+  framebuff = tx_st40p_next_available(ctx, ST40P_TX_FRAME_FREE);
   if (!framebuff && ctx->block_get) { /* wait here */
-    mt_pthread_mutex_unlock(&ctx->lock);
     tx_st40p_get_block_wait(ctx);
     /* get again */
-    mt_pthread_mutex_lock(&ctx->lock);
-    framebuff =
-        tx_st40p_next_available(ctx, ctx->framebuff_producer_idx, ST40P_TX_FRAME_FREE);
+    framebuff = tx_st40p_next_available(ctx, ST40P_TX_FRAME_FREE);
   }
 
   /* not any free frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return NULL;
-  }
+  if (!framebuff) return NULL;
 
-  framebuff->stat = ST40P_TX_FRAME_IN_USER;
-  /* point to next */
-  ctx->framebuff_producer_idx = tx_st40p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  tx_st40p_set_stat(ctx, framebuff, ST40P_TX_FRAME_IN_USER);
 
   frame_info = &framebuff->frame_info;
-  ctx->stat_get_frame_succ++;
+  rte_atomic32_inc(&ctx->stat_get_frame_succ);
   dbg("%s(%d), frame %u(%p) succ\n", __func__, idx, framebuff->idx,
       frame_info->anc_frame);
   return frame_info;
@@ -391,8 +403,8 @@ int st40p_tx_put_frame(st40p_tx_handle handle, struct st40_frame_info* frame_inf
     return -EIO;
   }
 
-  framebuff->stat = ST40P_TX_FRAME_READY;
-  ctx->stat_put_frame++;
+  tx_st40p_set_stat(ctx, framebuff, ST40P_TX_FRAME_READY);
+  rte_atomic32_inc(&ctx->stat_put_frame);
   dbg("%s(%d), frame %u(%p) succ\n", __func__, idx, producer_idx, frame_info->anc_frame);
   return 0;
 }
@@ -420,9 +432,9 @@ int st40p_tx_free(st40p_tx_handle handle) {
     st40_tx_free(ctx->transport);
     ctx->transport = NULL;
   }
+  tx_st40p_uinit_rings(ctx);
   tx_st40p_uinit_fbs(ctx);
 
-  mt_pthread_mutex_destroy(&ctx->lock);
   mt_pthread_mutex_destroy(&ctx->block_wake_mutex);
   mt_pthread_cond_destroy(&ctx->block_wake_cond);
   notice("%s(%d), succ\n", __func__, ctx->idx);
@@ -472,11 +484,11 @@ st40p_tx_handle st40p_tx_create(mtl_handle mt, struct st40p_tx_ops* ops) {
   ctx->ready = false;
   ctx->impl = impl;
   ctx->type = MT_ST40_HANDLE_PIPELINE_TX;
-  mt_pthread_mutex_init(&ctx->lock, NULL);
 
   mt_pthread_mutex_init(&ctx->block_wake_mutex, NULL);
   mt_pthread_cond_wait_init(&ctx->block_wake_cond);
   ctx->block_timeout_ns = NS_PER_S;
+  rte_atomic32_set(&ctx->block_waiters, 0);
   if (ops->flags & ST40P_TX_FLAG_BLOCK_GET) {
     ctx->block_get = true;
   }
@@ -498,6 +510,13 @@ st40p_tx_handle st40p_tx_create(mtl_handle mt, struct st40p_tx_ops* ops) {
     return NULL;
   }
 
+  ret = tx_st40p_init_rings(ctx);
+  if (ret < 0) {
+    err("%s(%d), init rings failed %d\n", __func__, idx, ret);
+    st40p_tx_free(ctx);
+    return NULL;
+  }
+
   /* crete transport handle */
   ret = tx_st40p_create_transport(impl, ctx, ops);
   if (ret < 0) {
@@ -13,6 +13,8 @@
 extern "C" {
 #endif
 
+#define ST40P_TX_PREFIX "T40P_"
+
 enum st40p_tx_frame_status {
   ST40P_TX_FRAME_FREE = 0,
   ST40P_TX_FRAME_IN_USER,         /* in user */
@@ -32,10 +34,9 @@ struct st40p_tx_ctx {
 
   st40_tx_handle transport;
   uint16_t framebuff_cnt;
-  uint16_t framebuff_producer_idx;
-  uint16_t framebuff_consumer_idx;
   struct st40p_tx_frame* framebuffs;
-  pthread_mutex_t lock;
+  /* lock-free fifo of the frames for free and ready, NULL for others */
+  struct rte_ring* frame_rings[ST40P_TX_FRAME_STATUS_MAX];
   bool ready;
 
   int frames_per_sec;
@@ -45,11 +46,12 @@ struct st40p_tx_ctx {
   pthread_cond_t block_wake_cond;
   pthread_mutex_t block_wake_mutex;
   uint64_t block_timeout_ns;
+  rte_atomic32_t block_waiters; /* the wake skips the cond signal if no waiter */
 
   /* get frame stat */
-  int stat_get_frame_try;
-  int stat_get_frame_succ;
-  int stat_put_frame;
+  rte_atomic32_t stat_get_frame_try;
+  rte_atomic32_t stat_get_frame_succ;
+  rte_atomic32_t stat_put_frame;
 };
 
 /** Bit define for flags of struct st40p_tx_ops. */
@@ -17,15 +17,10 @@ static const char* rx_st20p_stat_name(enum st20p_rx_frame_status stat) {
   return st20p_rx_frame_stat_name[stat];
 }
 
-static uint16_t rx_st20p_next_idx(struct st20p_rx_ctx* ctx, uint16_t idx) {
-  /* point to next */
-  uint16_t next_idx = idx;
-  next_idx++;
-  if (next_idx >= ctx->framebuff_cnt) next_idx = 0;
-  return next_idx;
-}
-
 static void rx_st20p_block_wake(struct st20p_rx_ctx* ctx) {
+  /* the frame enqueued before is seen by the waiter if we see no waiter */
+  rte_smp_mb();
+  if (!rte_atomic32_read(&ctx->block_waiters)) return;
   /* notify block */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
   mt_pthread_cond_signal(&ctx->block_wake_cond);
@@ -44,103 +39,163 @@ static void rx_st20p_notify_frame_available(struct st20p_rx_ctx* ctx) {
 }
 
 static struct st20p_rx_frame* rx_st20p_next_available(
-    struct st20p_rx_ctx* ctx, uint16_t idx_start, enum st20p_rx_frame_status desired) {
-  uint16_t idx = idx_start;
+    struct st20p_rx_ctx* ctx, enum st20p_rx_frame_status desired) {
+  struct st20p_rx_frame* framebuff;
+
+  /* the oldest one in the desired status */
+  if (rte_ring_dequeue(ctx->frame_rings[desired], (void**)&framebuff) < 0) return NULL;
+
+  return framebuff;
+}
+
+static void rx_st20p_set_stat(struct st20p_rx_ctx* ctx, struct st20p_rx_frame* framebuff,
+                              enum st20p_rx_frame_status stat) {
+  /* set before the enqueue, the frame may be taken by others just after */
+  framebuff->stat = stat;
+  /* the ring has room for all frames, never full */
+  if (ctx->frame_rings[stat]) rte_ring_enqueue(ctx->frame_rings[stat], framebuff);
+}
+
+/* the inline converting frames are only touched by the transport tasklet */
+static struct st20p_rx_frame* rx_st20p_converting_framebuff(struct st20p_rx_ctx* ctx,
+                                                            uint64_t timestamp) {
   struct st20p_rx_frame* framebuff;
 
-  /* check ready frame from idx_start */
-  while (1) {
-    framebuff = &ctx->framebuffs[idx];
-    if (desired == framebuff->stat) {
-      /* find one desired */
+  for (uint16_t i = 0; i < ctx->framebuff_cnt; i++) {
+    framebuff = &ctx->framebuffs[i];
+    if (framebuff->stat == ST20P_RX_FRAME_IN_CONVERTING &&
+        framebuff->dst.timestamp == timestamp)
       return framebuff;
-    }
-    idx = rx_st20p_next_idx(ctx, idx);
-    if (idx == idx_start) {
-      /* loop all frames end */
-      break;
-    }
   }
 
-  /* no any desired frame */
   return NULL;
 }
 
+/* prepare the one line dst template when the frame starts converting */
+static void rx_st20p_inline_frame_init(struct st20p_rx_ctx* ctx,
+                                       struct st20p_rx_frame* framebuff,
+                                       uint64_t timestamp) {
+  struct st_frame* dst = &framebuff->inline_dst;
+
+  framebuff->dst.timestamp = timestamp;
+  *dst = framebuff->dst;
+  dst->height = 1;
+  dst->interlaced = false;
+  rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_IN_CONVERTING);
+}
+
+/* convert one line segment of pixel groups with the table converter */
+static int rx_st20p_pg_convert(struct st20p_rx_ctx* ctx,
+                               struct st20p_rx_frame* framebuff,
+                               struct st20_rx_uframe_pg_meta* meta) {
+  struct st_frame* src = &ctx->inline_src;
+  struct st_frame* dst = &framebuff->inline_dst;
+  uint32_t pixels = meta->pg_cnt * ctx->pg.coverage;
+  uint32_t pg_offset = meta->row_offset / ctx->pg.coverage;
+
+  /* the payload as one line transport frame */
+  src->addr[0] = meta->payload;
+  src->width = pixels;
+  src->linesize[0] = meta->pg_cnt * ctx->pg.size;
+
+  /* the segment in the dst frame */
+  dst->width = pixels;
+  for (uint8_t plane = 0; plane < ST_MAX_PLANES; plane++) {
+    if (!ctx->inline_pg_bytes[plane]) break;
+    size_t offset = framebuff->dst.linesize[plane] * meta->row_number +
+                    ctx->inline_pg_bytes[plane] * pg_offset;
+    dst->addr[plane] = (uint8_t*)framebuff->dst.addr[plane] + offset;
+  }
+
+  return st_frame_converter_convert(&ctx->inline_converter, src, dst);
+}
+
 static int rx_st20p_packet_convert(void* priv, void* frame,
                                    struct st20_rx_uframe_pg_meta* meta) {
   struct st20p_rx_ctx* ctx = priv;
   struct st20p_rx_frame* framebuff;
-  int ret = 0;
-  struct st20_rfc4175_422_10_pg2_be* src = meta->payload;
   MTL_MAY_UNUSED(frame);
 
-  mt_pthread_mutex_lock(&ctx->lock);
   if (meta->row_number == 0 && meta->row_offset == 0) {
     /* first packet of frame */
-    framebuff =
-        rx_st20p_next_available(ctx, ctx->framebuff_producer_idx, ST20P_RX_FRAME_FREE);
-    if (framebuff) {
-      framebuff->stat = ST20P_RX_FRAME_IN_CONVERTING;
-      framebuff->dst.timestamp = meta->timestamp;
-    }
+    framebuff = rx_st20p_next_available(ctx, ST20P_RX_FRAME_FREE);
+    if (framebuff) rx_st20p_inline_frame_init(ctx, framebuff, meta->timestamp);
   } else {
-    framebuff = rx_st20p_next_available(ctx, ctx->framebuff_producer_idx,
-                                        ST20P_RX_FRAME_IN_CONVERTING);
-    if (framebuff && framebuff->dst.timestamp != meta->timestamp) {
-      dbg("%s(%d), not this frame, find next one\n", __func__, ctx->idx);
-      framebuff =
-          rx_st20p_next_available(ctx, framebuff->idx, ST20P_RX_FRAME_IN_CONVERTING);
-      if (framebuff && framebuff->dst.timestamp != meta->timestamp) {
-        /* should never happen */
-        err_once("%s(%d), wrong frame timestamp\n", __func__, ctx->idx);
-        mt_pthread_mutex_unlock(&ctx->lock);
-        return -EIO;
-      }
-    }
+    framebuff = rx_st20p_converting_framebuff(ctx, meta->timestamp);
   }
   if (!framebuff) {
     rte_atomic32_inc(&ctx->stat_busy);
-    mt_pthread_mutex_unlock(&ctx->lock);
     return -EBUSY;
   }
-  mt_pthread_mutex_unlock(&ctx->lock);
-  if (ctx->ops.output_fmt == ST_FRAME_FMT_YUV422PLANAR10LE) {
-    uint8_t* y = (uint8_t*)framebuff->dst.addr[0] +
-                 framebuff->dst.linesize[0] * meta->row_number + meta->row_offset * 2;
-    uint8_t* b = (uint8_t*)framebuff->dst.addr[1] +
-                 framebuff->dst.linesize[1] * meta->row_number + meta->row_offset;
-    uint8_t* r = (uint8_t*)framebuff->dst.addr[2] +
-                 framebuff->dst.linesize[2] * meta->row_number + meta->row_offset;
-    ret = st20_rfc4175_422be10_to_yuv422p10le(src, (uint16_t*)y, (uint16_t*)b,
-                                              (uint16_t*)r, meta->pg_cnt, 2);
-  } else if (ctx->ops.output_fmt == ST_FRAME_FMT_Y210) {
-    uint8_t* dst = (uint8_t*)framebuff->dst.addr[0] +
-                   framebuff->dst.linesize[0] * meta->row_number + meta->row_offset * 4;
-    ret = st20_rfc4175_422be10_to_y210(src, (uint16_t*)dst, meta->pg_cnt, 2);
-  } else if (ctx->ops.output_fmt == ST_FRAME_FMT_UYVY) {
-    uint8_t* dst = (uint8_t*)framebuff->dst.addr[0] +
-                   framebuff->dst.linesize[0] * meta->row_number + meta->row_offset * 2;
-    ret = st20_rfc4175_422be10_to_422le8(src, (struct st20_rfc4175_422_8_pg2_le*)dst,
-                                         meta->pg_cnt, 2);
-  } else if (ctx->ops.output_fmt == ST_FRAME_FMT_YUV422PLANAR8) {
-    uint8_t* y = (uint8_t*)framebuff->dst.addr[0] +
-                 framebuff->dst.linesize[0] * meta->row_number + meta->row_offset * 2;
-    uint8_t* b = (uint8_t*)framebuff->dst.addr[1] +
-                 framebuff->dst.linesize[1] * meta->row_number + meta->row_offset;
-    uint8_t* r = (uint8_t*)framebuff->dst.addr[2] +
-                 framebuff->dst.linesize[2] * meta->row_number + meta->row_offset;
-    ret = st20_rfc4175_422be10_to_yuv422p8(src, y, b, r, meta->pg_cnt, 2);
-  } else if (ctx->ops.output_fmt == ST_FRAME_FMT_YUV420PLANAR8) {
-    uint8_t* y = (uint8_t*)framebuff->dst.addr[0] +
-                 framebuff->dst.linesize[0] * meta->row_number + meta->row_offset * 2;
-    uint8_t* b = (uint8_t*)framebuff->dst.addr[1] +
-                 framebuff->dst.linesize[1] * meta->row_number + meta->row_offset;
-    uint8_t* r = (uint8_t*)framebuff->dst.addr[2] +
-                 framebuff->dst.linesize[2] * meta->row_number + meta->row_offset;
-    ret = st20_rfc4175_422be10_to_yuv420p8(src, y, b, r, meta->pg_cnt, 2);
-  }
-
-  return ret;
+
+  return rx_st20p_pg_convert(ctx, framebuff, meta);
+}
+
+/* find the converting frame of this timestamp, or start a new one from free frames */
+static struct st20p_rx_frame* rx_st20p_slice_framebuff(struct st20p_rx_ctx* ctx,
+                                                       uint64_t timestamp) {
+  struct st20p_rx_frame* framebuff;
+
+  framebuff = rx_st20p_converting_framebuff(ctx, timestamp);
+  if (framebuff) return framebuff;
+
+  framebuff = rx_st20p_next_available(ctx, ST20P_RX_FRAME_FREE);
+  if (framebuff) {
+    framebuff->slice_lines = 0;
+    rx_st20p_inline_frame_init(ctx, framebuff, timestamp);
+  }
+  return framebuff;
+}
+
+static int rx_st20p_slice_convert(struct st20p_rx_ctx* ctx, void* frame,
+                                  uint64_t timestamp, uint32_t ready_lines) {
+  struct st20p_rx_frame* framebuff;
+  struct st20_rx_uframe_pg_meta pg_meta;
+  int ret = 0;
+
+  framebuff = rx_st20p_slice_framebuff(ctx, timestamp);
+  if (!framebuff) {
+    rte_atomic32_inc(&ctx->stat_busy);
+    return -EBUSY;
+  }
+
+  uint32_t height = framebuff->dst.height;
+  if (framebuff->dst.interlaced) height /= 2;
+  ready_lines = RTE_MIN(ready_lines, height);
+  if (ready_lines <= framebuff->slice_lines) return 0; /* nothing new */
+
+  memset(&pg_meta, 0, sizeof(pg_meta));
+  pg_meta.width = framebuff->dst.width;
+  pg_meta.height = framebuff->dst.height;
+  pg_meta.timestamp = timestamp;
+  pg_meta.row_offset = 0;
+  pg_meta.pg_cnt = framebuff->dst.width / ctx->pg.coverage;
+  /* line by line as the src and dst linesize may have padding */
+  for (uint32_t line = framebuff->slice_lines; line < ready_lines; line++) {
+    pg_meta.row_number = line;
+    pg_meta.payload = (uint8_t*)frame + framebuff->src.linesize[0] * line;
+    ret = rx_st20p_pg_convert(ctx, framebuff, &pg_meta);
+    if (ret < 0) {
+      rte_atomic32_inc(&ctx->stat_convert_fail);
+      return ret;
+    }
+  }
+  framebuff->slice_lines = ready_lines;
+
+  if (ctx->ops.notify_slice_ready) {
+    ctx->ops.notify_slice_ready(ctx->ops.priv, &framebuff->dst, ready_lines);
+    rte_atomic32_inc(&ctx->stat_slice_notify);
+  }
+  return 0;
+}
+
+static int rx_st20p_slice_ready(void* priv, void* frame,
+                                struct st20_rx_slice_meta* meta) {
+  struct st20p_rx_ctx* ctx = priv;
+
+  if (!ctx->ready) return -EBUSY; /* not ready */
+
+  return rx_st20p_slice_convert(ctx, frame, meta->timestamp, meta->frame_recv_lines);
 }
 
 static int rx_st20p_frame_ready(void* priv, void* frame,
@@ -150,30 +205,23 @@ static int rx_st20p_frame_ready(void* priv, void* frame,
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  if (ctx->ops.flags & ST20P_RX_FLAG_PKT_CONVERT) {
-    framebuff = rx_st20p_next_available(ctx, ctx->framebuff_producer_idx,
-                                        ST20P_RX_FRAME_IN_CONVERTING);
-    if (framebuff && framebuff->dst.timestamp != meta->timestamp) {
-      dbg("%s(%d), not this frame, find next one\n", __func__, ctx->idx);
-      framebuff =
-          rx_st20p_next_available(ctx, framebuff->idx, ST20P_RX_FRAME_IN_CONVERTING);
-      if (framebuff && framebuff->dst.timestamp != meta->timestamp) {
-        /* should never happen */
-        mt_pthread_mutex_unlock(&ctx->lock);
-        err_once("%s(%d), wrong frame timestamp\n", __func__, ctx->idx);
-        return 0; /* surpress the error */
-      }
-    }
+  /* convert the lines left after the last slice */
+  if (ctx->ops.flags & ST20P_RX_FLAG_SLICE_CONVERT)
+    rx_st20p_slice_convert(ctx, frame, meta->timestamp, UINT32_MAX);
+
+  if (ctx->inline_convert) {
+    framebuff = rx_st20p_converting_framebuff(ctx, meta->timestamp);
+  } else if (ctx->ext_framebuff) {
+    /* the one taken by query_ext_frame */
+    framebuff = ctx->ext_framebuff;
+    ctx->ext_framebuff = NULL;
   } else {
-    framebuff =
-        rx_st20p_next_available(ctx, ctx->framebuff_producer_idx, ST20P_RX_FRAME_FREE);
+    framebuff = rx_st20p_next_available(ctx, ST20P_RX_FRAME_FREE);
   }
 
   /* not any free frame */
   if (!framebuff) {
     rte_atomic32_inc(&ctx->stat_busy);
-    mt_pthread_mutex_unlock(&ctx->lock);
     return -EBUSY;
   }
 
@@ -188,7 +236,7 @@ static int rx_st20p_frame_ready(void* priv, void* frame,
     if (ret < 0) {
       err("%s(%d), query_ext_frame for frame %u fail %d\n", __func__, ctx->idx,
           framebuff->idx, ret);
-      mt_pthread_mutex_unlock(&ctx->lock);
+      rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_FREE);
       return ret;
     }
 
@@ -205,7 +253,7 @@ static int rx_st20p_frame_ready(void* priv, void* frame,
     if (ret < 0) {
       err("%s(%d), ext_frame check frame %u fail %d\n", __func__, ctx->idx,
           framebuff->idx, ret);
-      mt_pthread_mutex_unlock(&ctx->lock);
+      rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_FREE);
       return ret;
     }
   }
@@ -247,28 +295,20 @@ static int rx_st20p_frame_ready(void* priv, void* frame,
   }
 
   /* ask app to consume src frame directly */
-  if (ctx->derive || (ctx->ops.flags & ST20P_RX_FLAG_PKT_CONVERT)) {
+  if (ctx->derive || ctx->inline_convert) {
     if (ctx->derive) framebuff->dst = framebuff->src;
-    framebuff->stat = ST20P_RX_FRAME_CONVERTED;
-    /* point to next */
-    ctx->framebuff_producer_idx = rx_st20p_next_idx(ctx, framebuff->idx);
-    mt_pthread_mutex_unlock(&ctx->lock);
+    rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_CONVERTED);
     rx_st20p_notify_frame_available(ctx);
     return 0;
   }
-  framebuff->stat = ST20P_RX_FRAME_READY;
-
-  /* point to next */
-  ctx->framebuff_producer_idx = rx_st20p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
-
   dbg("%s(%d), frame %u succ\n", __func__, ctx->idx, framebuff->idx);
+  rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_READY);
 
   /* ask convert plugin to consume */
   if (ctx->convert_impl) st20_convert_notify_frame_ready(ctx->convert_impl);
 
   /* or ask app to consume with internal converter */
-  if (ctx->internal_converter) {
+  if (ctx->internal_converter || ctx->scaler) {
     rx_st20p_notify_frame_available(ctx);
   }
 
@@ -283,30 +323,26 @@ static int rx_st20p_query_ext_frame(void* priv, struct st20_ext_frame* ext_frame
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      rx_st20p_next_available(ctx, ctx->framebuff_producer_idx, ST20P_RX_FRAME_FREE);
+  /* hold the free frame for the frame ready, reuse it if no frame ready after */
+  framebuff = ctx->ext_framebuff;
+  if (!framebuff) framebuff = rx_st20p_next_available(ctx, ST20P_RX_FRAME_FREE);
   /* not any free frame */
   if (!framebuff) {
     rte_atomic32_inc(&ctx->stat_busy);
-    mt_pthread_mutex_unlock(&ctx->lock);
     return -EBUSY;
   }
+  ctx->ext_framebuff = framebuff;
 
   struct st_ext_frame ext_st;
   memset(&ext_st, 0, sizeof(ext_st));
   ret = ctx->ops.query_ext_frame(ctx->ops.priv, &ext_st, meta);
-  if (ret < 0) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return -EBUSY;
-  }
+  if (ret < 0) return -EBUSY;
   /* only 1 plane for no converter mode */
   ext_frame->buf_addr = ext_st.addr[0];
   ext_frame->buf_iova = ext_st.iova[0];
   ext_frame->buf_len = ext_st.size;
   ext_frame->opaque = ext_st.opaque;
   framebuff->src.opaque = ext_st.opaque;
-  mt_pthread_mutex_unlock(&ctx->lock);
 
   return 0;
 }
@@ -389,19 +425,11 @@ static struct st20_convert_frame_meta* rx_st20p_convert_get_frame(void* priv) {
 
   if (!ctx->ready) return NULL; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      rx_st20p_next_available(ctx, ctx->framebuff_convert_idx, ST20P_RX_FRAME_READY);
+  framebuff = rx_st20p_next_available(ctx, ST20P_RX_FRAME_READY);
   /* not any ready frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return NULL;
-  }
+  if (!framebuff) return NULL;
 
-  framebuff->stat = ST20P_RX_FRAME_IN_CONVERTING;
-  /* point to next */
-  ctx->framebuff_convert_idx = rx_st20p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_IN_CONVERTING);
 
   dbg("%s(%d), frame %u succ\n", __func__, idx, framebuff->idx);
   return &framebuff->convert_frame;
@@ -429,10 +457,10 @@ static int rx_st20p_convert_put_frame(void* priv, struct st20_convert_frame_meta
   if (result < 0) {
     /* free the frame */
     st20_rx_put_framebuff(ctx->transport, framebuff->src.addr[0]);
-    framebuff->stat = ST20P_RX_FRAME_FREE;
+    rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_FREE);
     rte_atomic32_inc(&ctx->stat_convert_fail);
   } else {
-    framebuff->stat = ST20P_RX_FRAME_CONVERTED;
+    rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_CONVERTED);
     rx_st20p_notify_frame_available(ctx);
   }
 
@@ -441,13 +469,11 @@ static int rx_st20p_convert_put_frame(void* priv, struct st20_convert_frame_meta
 
 static int rx_st20p_convert_dump(void* priv) {
   struct st20p_rx_ctx* ctx = priv;
-  struct st20p_rx_frame* framebuff = ctx->framebuffs;
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  uint16_t convert_idx = ctx->framebuff_convert_idx;
-  notice("RX_st20p(%s), cv(%d:%s)\n", ctx->ops_name, convert_idx,
-         rx_st20p_stat_name(framebuff[convert_idx].stat));
+  notice("RX_st20p(%s), cv ready %u\n", ctx->ops_name,
+         rte_ring_count(ctx->frame_rings[ST20P_RX_FRAME_READY]));
 
   int convert_fail = rte_atomic32_read(&ctx->stat_convert_fail);
   rte_atomic32_set(&ctx->stat_convert_fail, 0);
@@ -497,18 +523,36 @@ static int rx_st20p_create_transport(struct mtl_main_impl* impl, struct st20p_rx
     ops_rx.flags |= ST20_RX_FLAG_TIMING_PARSER_META;
   if (ops->flags & ST20P_RX_FLAG_USE_MULTI_THREADS)
     ops_rx.flags |= ST20_RX_FLAG_USE_MULTI_THREADS;
-  if (ops->flags & ST20P_RX_FLAG_PKT_CONVERT) {
-    uint64_t pkt_cvt_output_cap =
-        ST_FMT_CAP_YUV422PLANAR10LE | ST_FMT_CAP_Y210 | ST_FMT_CAP_UYVY;
-    if (ops->transport_fmt != ST20_FMT_YUV_422_10BIT) {
-      err("%s(%d), only 422 10bit support packet convert\n", __func__, idx);
+  if (ctx->inline_convert) {
+    enum st_frame_fmt t_fmt = st_frame_fmt_from_transport(ops->transport_fmt);
+    /* the pixel groups of one pkt can't be mapped to v210 words or 420 chroma lines */
+    if (ops->output_fmt == ST_FRAME_FMT_V210 ||
+        st_frame_fmt_get_sampling(ops->output_fmt) == ST_FRAME_SAMPLING_420) {
+      err("%s(%d), %s not supported by packet/slice convert\n", __func__, idx,
+          st_frame_fmt_name(ops->output_fmt));
       return -EIO;
     }
-    if (!(MTL_BIT64(ops->output_fmt) & pkt_cvt_output_cap)) {
-      err("%s(%d), %s not supported by packet convert\n", __func__, idx,
-          st_frame_fmt_name(ops->output_fmt));
+    if (st_frame_get_converter(t_fmt, ops->output_fmt, &ctx->inline_converter) < 0) {
+      err("%s(%d), no converter from %s to %s for packet/slice convert\n", __func__, idx,
+          st_frame_fmt_name(t_fmt), st_frame_fmt_name(ops->output_fmt));
+      return -EIO;
+    }
+    ctx->inline_converter.color_matrix = ops->color_matrix;
+    ctx->inline_converter.color_range = ops->color_range;
+    if (st20_get_pgroup(ops->transport_fmt, &ctx->pg) < 0) {
+      err("%s(%d), get pgroup fail for packet/slice convert\n", __func__, idx);
       return -EIO;
     }
+    /* pg aligned segments are linear in all the supported dst fmts */
+    memset(ctx->inline_pg_bytes, 0, sizeof(ctx->inline_pg_bytes));
+    for (uint8_t plane = 0; plane < st_frame_fmt_planes(ops->output_fmt); plane++)
+      ctx->inline_pg_bytes[plane] =
+          st_frame_least_linesize(ops->output_fmt, ctx->pg.coverage, plane);
+    memset(&ctx->inline_src, 0, sizeof(ctx->inline_src));
+    ctx->inline_src.fmt = t_fmt;
+    ctx->inline_src.height = 1;
+  }
+  if (ops->flags & ST20P_RX_FLAG_PKT_CONVERT) {
     ops_rx.uframe_pg_callback = rx_st20p_packet_convert;
     ops_rx.uframe_size = st20_frame_size(ops->transport_fmt, ops->width, ops->height);
   }
@@ -538,6 +582,11 @@ static int rx_st20p_create_transport(struct mtl_main_impl* impl, struct st20p_rx
   ops_rx.payload_type = ops->port.payload_type;
   ops_rx.ssrc = ops->port.ssrc;
   ops_rx.type = ST20_TYPE_FRAME_LEVEL;
+  if (ops->flags & ST20P_RX_FLAG_SLICE_CONVERT) {
+    ops_rx.type = ST20_TYPE_SLICE_LEVEL;
+    ops_rx.slice_lines = ops->slice_lines;
+    ops_rx.notify_slice_ready = rx_st20p_slice_ready;
+  }
   ops_rx.framebuff_cnt = ops->framebuff_cnt;
   ops_rx.rx_burst_size = ops->rx_burst_size;
   ops_rx.notify_frame_ready = rx_st20p_frame_ready;
@@ -656,8 +705,8 @@ static int rx_st20p_init_dst_fbs(struct mtl_main_impl* impl, struct st20p_rx_ctx
     frames[i].idx = i;
     frames[i].dst.fmt = ops->output_fmt;
     frames[i].dst.interlaced = ops->interlaced;
-    frames[i].dst.width = ops->width;
-    frames[i].dst.height = ops->height;
+    frames[i].dst.width = ctx->dst_width;
+    frames[i].dst.height = ctx->dst_height;
     if (!ctx->derive) { /* when derive, no need to alloc dst frames */
       uint8_t planes = st_frame_fmt_planes(frames[i].dst.fmt);
       if (ops->ext_frames) {
@@ -712,6 +761,52 @@ static int rx_st20p_init_dst_fbs(struct mtl_main_impl* impl, struct st20p_rx_ctx
   return 0;
 }
 
+static int rx_st20p_init_ring(struct st20p_rx_ctx* ctx, enum st20p_rx_frame_status stat,
+                              unsigned int flags) {
+  char ring_name[32];
+  struct rte_ring* ring;
+
+  snprintf(ring_name, sizeof(ring_name), "%sS%d_%s", ST20P_RX_PREFIX, ctx->idx,
+           rx_st20p_stat_name(stat));
+  ring = rte_ring_create(ring_name, ctx->framebuff_cnt, ctx->socket_id,
+                         flags | RING_F_EXACT_SZ);
+  if (!ring) {
+    err("%s(%d), rte_ring_create %s fail\n", __func__, ctx->idx, ring_name);
+    return -ENOMEM;
+  }
+  ctx->frame_rings[stat] = ring;
+  return 0;
+}
+
+static int rx_st20p_uinit_rings(struct st20p_rx_ctx* ctx) {
+  for (int stat = 0; stat < ST20P_RX_FRAME_STATUS_MAX; stat++) {
+    if (ctx->frame_rings[stat]) {
+      rte_ring_free(ctx->frame_rings[stat]);
+      ctx->frame_rings[stat] = NULL;
+    }
+  }
+
+  return 0;
+}
+
+static int rx_st20p_init_rings(struct st20p_rx_ctx* ctx) {
+  int ret;
+
+  /* only the transport tasklet gets the free frames and puts the ready frames */
+  ret = rx_st20p_init_ring(ctx, ST20P_RX_FRAME_FREE, RING_F_SC_DEQ);
+  if (ret < 0) return ret;
+  ret = rx_st20p_init_ring(ctx, ST20P_RX_FRAME_READY, RING_F_SP_ENQ);
+  if (ret < 0) return ret;
+  /* converted frames are put by the plugin and transport threads */
+  ret = rx_st20p_init_ring(ctx, ST20P_RX_FRAME_CONVERTED, 0);
+  if (ret < 0) return ret;
+
+  for (uint16_t i = 0; i < ctx->framebuff_cnt; i++)
+    rx_st20p_set_stat(ctx, &ctx->framebuffs[i], ST20P_RX_FRAME_FREE);
+
+  return 0;
+}
+
 static int rx_st20p_get_converter(struct mtl_main_impl* impl, struct st20p_rx_ctx* ctx,
                                   struct st20p_rx_ops* ops) {
   int idx = ctx->idx;
@@ -745,8 +840,19 @@ static int rx_st20p_get_converter(struct mtl_main_impl* impl, struct st20p_rx_ct
       mt_rte_free(converter);
       return -EIO;
     }
+    converter->color_matrix = ops->color_matrix;
+    converter->color_range = ops->color_range;
     ctx->internal_converter = converter;
     info("%s(%d), use internal converter\n", __func__, idx);
+
+    if (ops->convert_workers) {
+      ctx->convert_pool = st_convert_pool_create(impl, ctx->ops_name,
+                                                 ops->convert_workers, ctx->socket_id);
+      if (!ctx->convert_pool) {
+        err("%s(%d), convert pool create fail\n", __func__, idx);
+        return -EIO;
+      }
+    }
     return 0;
   }
   ctx->convert_impl = convert_impl;
@@ -756,21 +862,26 @@ static int rx_st20p_get_converter(struct mtl_main_impl* impl, struct st20p_rx_ct
 
 static int rx_st20p_stat(void* priv) {
   struct st20p_rx_ctx* ctx = priv;
-  struct st20p_rx_frame* framebuff = ctx->framebuffs;
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  uint16_t producer_idx = ctx->framebuff_producer_idx;
-  uint16_t consumer_idx = ctx->framebuff_consumer_idx;
-  notice("RX_st20p(%d,%s), p(%d:%s) c(%d:%s)\n", ctx->idx, ctx->ops_name, producer_idx,
-         rx_st20p_stat_name(framebuff[producer_idx].stat), consumer_idx,
-         rx_st20p_stat_name(framebuff[consumer_idx].stat));
+  notice("RX_st20p(%d,%s), free %u ready %u converted %u\n", ctx->idx, ctx->ops_name,
+         rte_ring_count(ctx->frame_rings[ST20P_RX_FRAME_FREE]),
+         rte_ring_count(ctx->frame_rings[ST20P_RX_FRAME_READY]),
+         rte_ring_count(ctx->frame_rings[ST20P_RX_FRAME_CONVERTED]));
 
   notice("RX_st20p(%d), frame get try %d succ %d, put %d\n", ctx->idx,
-         ctx->stat_get_frame_try, ctx->stat_get_frame_succ, ctx->stat_put_frame);
-  ctx->stat_get_frame_try = 0;
-  ctx->stat_get_frame_succ = 0;
-  ctx->stat_put_frame = 0;
+         mt_atomic32_read_clear(&ctx->stat_get_frame_try),
+         mt_atomic32_read_clear(&ctx->stat_get_frame_succ),
+         mt_atomic32_read_clear(&ctx->stat_put_frame));
+
+  int slice_notify = rte_atomic32_read(&ctx->stat_slice_notify);
+  rte_atomic32_set(&ctx->stat_slice_notify, 0);
+  if (slice_notify) {
+    notice("RX_st20p(%d), slice notify %d\n", ctx->idx, slice_notify);
+  }
+
+  if (ctx->convert_pool) st_convert_pool_dump(ctx->convert_pool);
 
   return 0;
 }
@@ -780,11 +891,10 @@ static int rx_st20p_usdt_dump_frame(struct st20p_rx_ctx* ctx, struct st_frame* f
   struct mtl_main_impl* impl = ctx->impl;
   int fd;
   char usdt_dump_path[64];
-  struct st20p_rx_ops* ops = &ctx->ops;
   uint64_t tsc_s = mt_get_tsc(impl);
 
   snprintf(usdt_dump_path, sizeof(usdt_dump_path),
-           "imtl_usdt_st20prx_s%d_%d_%d_XXXXXX.yuv", idx, ops->width, ops->height);
+           "imtl_usdt_st20prx_s%d_%d_%d_XXXXXX.yuv", idx, frame->width, frame->height);
   fd = mt_mkstemps(usdt_dump_path, strlen(".yuv"));
   if (fd < 0) {
     err("%s(%d), mkstemps %s fail %d\n", __func__, idx, usdt_dump_path, fd);
@@ -806,13 +916,18 @@ static int rx_st20p_usdt_dump_frame(struct st20p_rx_ctx* ctx, struct st_frame* f
   return 0;
 }
 
-static int st20p_rx_get_block_wait(struct st20p_rx_ctx* ctx) {
+static int st20p_rx_get_block_wait(struct st20p_rx_ctx* ctx,
+                                   enum st20p_rx_frame_status desired) {
   dbg("%s(%d), start\n", __func__, ctx->idx);
+  rte_atomic32_inc(&ctx->block_waiters);
   /* wait on the block cond */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
-  mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
-                               ctx->block_timeout_ns);
+  /* check again as the wake skips the signal if it sees no waiter */
+  if (rte_ring_empty(ctx->frame_rings[desired]))
+    mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
+                                 ctx->block_timeout_ns);
   mt_pthread_mutex_unlock(&ctx->block_wake_mutex);
+  rte_atomic32_dec(&ctx->block_waiters);
   dbg("%s(%d), end\n", __func__, ctx->idx);
   return 0;
 }
@@ -830,50 +945,49 @@ struct st_frame* st20p_rx_get_frame(st20p_rx_handle handle) {
 
   if (!ctx->ready) return NULL; /* not ready */
 
-  ctx->stat_get_frame_try++;
-
-  mt_pthread_mutex_lock(&ctx->lock);
+  rte_atomic32_inc(&ctx->stat_get_frame_try);
 
-  if (ctx->internal_converter) { /* convert internal */
-    framebuff =
-        rx_st20p_next_available(ctx, ctx->framebuff_consumer_idx, ST20P_RX_FRAME_READY);
+  if (ctx->internal_converter || ctx->scaler) { /* convert internal */
+    framebuff = rx_st20p_next_available(ctx, ST20P_RX_FRAME_READY);
     if (!framebuff && ctx->block_get) { /* wait here */
-      mt_pthread_mutex_unlock(&ctx->lock);
-      st20p_rx_get_block_wait(ctx);
+      st20p_rx_get_block_wait(ctx, ST20P_RX_FRAME_READY);
       /* get again */
-      mt_pthread_mutex_lock(&ctx->lock);
-      framebuff =
-          rx_st20p_next_available(ctx, ctx->framebuff_consumer_idx, ST20P_RX_FRAME_READY);
+      framebuff = rx_st20p_next_available(ctx, ST20P_RX_FRAME_READY);
     }
     /* not any ready frame */
-    if (!framebuff) {
-      mt_pthread_mutex_unlock(&ctx->lock);
+    if (!framebuff) return NULL;
+    int ret;
+    /* the ring handoff is lock-free, but the scaler and the pool are shared */
+    mt_pthread_mutex_lock(&ctx->convert_mutex);
+    if (ctx->scaler)
+      ret = st_frame_scaler_scale(ctx->scaler, &framebuff->src, &framebuff->dst);
+    else if (ctx->convert_pool)
+      ret = st_convert_pool_convert(ctx->convert_pool, ctx->internal_converter,
+                                    &framebuff->src, &framebuff->dst);
+    else
+      ret = st_frame_converter_convert(ctx->internal_converter, &framebuff->src,
+                                       &framebuff->dst);
+    mt_pthread_mutex_unlock(&ctx->convert_mutex);
+    if (ret < 0) {
+      /* drop the frame, the dst is not valid */
+      dbg("%s(%d), frame %u convert fail %d\n", __func__, idx, framebuff->idx, ret);
+      st20_rx_put_framebuff(ctx->transport, framebuff->src.addr[0]);
+      rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_FREE);
+      rte_atomic32_inc(&ctx->stat_convert_fail);
       return NULL;
     }
-    ctx->internal_converter->convert_func(&framebuff->src, &framebuff->dst);
   } else {
-    framebuff = rx_st20p_next_available(ctx, ctx->framebuff_consumer_idx,
-                                        ST20P_RX_FRAME_CONVERTED);
+    framebuff = rx_st20p_next_available(ctx, ST20P_RX_FRAME_CONVERTED);
     if (!framebuff && ctx->block_get) { /* wait here */
-      mt_pthread_mutex_unlock(&ctx->lock);
-      st20p_rx_get_block_wait(ctx);
+      st20p_rx_get_block_wait(ctx, ST20P_RX_FRAME_CONVERTED);
       /* get again */
-      mt_pthread_mutex_lock(&ctx->lock);
-      framebuff = rx_st20p_next_available(ctx, ctx->framebuff_consumer_idx,
-                                          ST20P_RX_FRAME_CONVERTED);
+      framebuff = rx_st20p_next_available(ctx, ST20P_RX_FRAME_CONVERTED);
     }
     /* not any converted frame */
-    if (!framebuff) {
-      mt_pthread_mutex_unlock(&ctx->lock);
-      return NULL;
-    }
+    if (!framebuff) return NULL;
   }
 
-  framebuff->stat = ST20P_RX_FRAME_IN_USER;
-  /* point to next */
-  ctx->framebuff_consumer_idx = rx_st20p_next_idx(ctx, framebuff->idx);
-
-  mt_pthread_mutex_unlock(&ctx->lock);
+  rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_IN_USER);
 
   dbg("%s(%d), frame %u succ\n", __func__, idx, framebuff->idx);
   frame = &framebuff->dst;
@@ -884,7 +998,7 @@ struct st_frame* st20p_rx_get_frame(st20p_rx_handle handle) {
     frame->user_meta = NULL;
     frame->user_meta_size = 0;
   }
-  ctx->stat_get_frame_succ++;
+  rte_atomic32_inc(&ctx->stat_get_frame_succ);
   MT_USDT_ST20P_RX_FRAME_GET(idx, framebuff->idx, frame->addr[0]);
   /* check if dump USDT enabled */
   if (MT_USDT_ST20P_RX_FRAME_DUMP_ENABLED()) {
@@ -918,8 +1032,8 @@ int st20p_rx_put_frame(st20p_rx_handle handle, struct st_frame* frame) {
 
   /* free the frame */
   st20_rx_put_framebuff(ctx->transport, framebuff->src.addr[0]);
-  framebuff->stat = ST20P_RX_FRAME_FREE;
-  ctx->stat_put_frame++;
+  rx_st20p_set_stat(ctx, framebuff, ST20P_RX_FRAME_FREE);
+  rte_atomic32_inc(&ctx->stat_put_frame);
 
   MT_USDT_ST20P_RX_FRAME_PUT(idx, framebuff->idx, frame->addr[0]);
   dbg("%s(%d), frame %u succ\n", __func__, idx, consumer_idx);
@@ -935,6 +1049,8 @@ st20p_rx_handle st20p_rx_create(mtl_handle mt, struct st20p_rx_ops* ops) {
   int idx = st20p_rx_idx;
   size_t dst_size = 0;
   bool auto_detect;
+  bool scale = false;
+  uint32_t dst_w, dst_h;
 
   /* validate the input parameters */
   if (!mt || !ops) {
@@ -957,10 +1073,44 @@ st20p_rx_handle st20p_rx_create(mtl_handle mt, struct st20p_rx_ops* ops) {
     }
   }
 
+  if ((ops->flags & ST20P_RX_FLAG_PKT_CONVERT) &&
+      (ops->flags & ST20P_RX_FLAG_SLICE_CONVERT)) {
+    err("%s, pkt convert and slice convert can't be enabled both\n", __func__);
+    return NULL;
+  }
+
+  if (ops->color_matrix >= ST20_COLOR_MATRIX_MAX ||
+      ops->color_range >= ST20_COLOR_RANGE_MAX) {
+    err("%s, invalid color matrix %d or range %d\n", __func__, ops->color_matrix,
+        ops->color_range);
+    return NULL;
+  }
+
+  dst_w = ops->width;
+  dst_h = ops->height;
+  if (ops->output_width || ops->output_height) {
+    if (!ops->output_width || !ops->output_height) {
+      err("%s(%d), invalid output size %ux%u\n", __func__, idx, ops->output_width,
+          ops->output_height);
+      return NULL;
+    }
+    dst_w = ops->output_width;
+    dst_h = ops->output_height;
+    scale = (dst_w != ops->width) || (dst_h != ops->height);
+  }
+  if (scale) {
+    if (auto_detect || ops->convert_workers ||
+        (ops->flags & (ST20P_RX_FLAG_PKT_CONVERT | ST20P_RX_FLAG_SLICE_CONVERT))) {
+      err("%s(%d), scale not support with auto detect, inline convert or workers\n",
+          __func__, idx);
+      return NULL;
+    }
+  }
+
   if (auto_detect) {
     info("%s(%d), auto_detect enabled\n", __func__, idx);
   } else {
-    dst_size = st_frame_size(ops->output_fmt, ops->width, ops->height, ops->interlaced);
+    dst_size = st_frame_size(ops->output_fmt, dst_w, dst_h, ops->interlaced);
     if (!dst_size) {
       err("%s(%d), get dst size fail\n", __func__, idx);
       return NULL;
@@ -986,17 +1136,27 @@ st20p_rx_handle st20p_rx_create(mtl_handle mt, struct st20p_rx_ops* ops) {
   ctx->socket_id = socket;
   ctx->ready = false;
   ctx->derive = st_frame_fmt_equal_transport(ops->output_fmt, ops->transport_fmt);
+  if (scale) ctx->derive = false;
   ctx->dynamic_ext_frame = (ops->flags & ST20P_RX_FLAG_EXT_FRAME) ? true : false;
+  if (ops->flags & (ST20P_RX_FLAG_PKT_CONVERT | ST20P_RX_FLAG_SLICE_CONVERT))
+    ctx->inline_convert = true;
   ctx->impl = impl;
   ctx->type = MT_ST20_HANDLE_PIPELINE_RX;
   ctx->dst_size = dst_size;
+  ctx->dst_width = dst_w;
+  ctx->dst_height = dst_h;
   rte_atomic32_set(&ctx->stat_convert_fail, 0);
   rte_atomic32_set(&ctx->stat_busy, 0);
-  mt_pthread_mutex_init(&ctx->lock, NULL);
+  rte_atomic32_set(&ctx->stat_slice_notify, 0);
+  rte_atomic32_set(&ctx->stat_get_frame_try, 0);
+  rte_atomic32_set(&ctx->stat_get_frame_succ, 0);
+  rte_atomic32_set(&ctx->stat_put_frame, 0);
+  mt_pthread_mutex_init(&ctx->convert_mutex, NULL);
 
   mt_pthread_mutex_init(&ctx->block_wake_mutex, NULL);
   mt_pthread_cond_wait_init(&ctx->block_wake_cond);
   ctx->block_timeout_ns = NS_PER_S;
+  rte_atomic32_set(&ctx->block_waiters, 0);
   if (ops->flags & ST20P_RX_FLAG_BLOCK_GET) ctx->block_get = true;
 
   /* copy ops */
@@ -1007,8 +1167,23 @@ st20p_rx_handle st20p_rx_create(mtl_handle mt, struct st20p_rx_ops* ops) {
   }
   ctx->ops = *ops;
 
-  /* get one suitable convert device */
-  if (!ctx->derive && !(ctx->ops.flags & ST20P_RX_FLAG_PKT_CONVERT)) {
+  if (scale) {
+    /* the scaler converts to output fmt in the same pass */
+    uint32_t src_h = ops->interlaced ? ops->height / 2 : ops->height;
+    uint32_t scale_h = ops->interlaced ? dst_h / 2 : dst_h;
+    ctx->scaler = st_frame_scaler_create(st_frame_fmt_from_transport(ops->transport_fmt),
+                                         ops->width, src_h, ops->output_fmt, dst_w,
+                                         scale_h, socket);
+    if (!ctx->scaler) {
+      err("%s(%d), create scaler fail\n", __func__, idx);
+      st20p_rx_free(ctx);
+      return NULL;
+    }
+    st_frame_scaler_set_color(ctx->scaler, ops->color_matrix, ops->color_range);
+    info("%s(%d), scale %ux%u to %ux%u\n", __func__, idx, ops->width, ops->height, dst_w,
+         dst_h);
+  } else if (!ctx->derive && !ctx->inline_convert) {
+    /* get one suitable convert device */
     ret = rx_st20p_get_converter(impl, ctx, ops);
     if (ret < 0) {
       err("%s(%d), get converter fail %d\n", __func__, idx, ret);
@@ -1025,6 +1200,13 @@ st20p_rx_handle st20p_rx_create(mtl_handle mt, struct st20p_rx_ops* ops) {
     return NULL;
   }
 
+  ret = rx_st20p_init_rings(ctx);
+  if (ret < 0) {
+    err("%s(%d), init rings fail %d\n", __func__, idx, ret);
+    st20p_rx_free(ctx);
+    return NULL;
+  }
+
   /* crete transport handle */
   ret = rx_st20p_create_transport(impl, ctx, ops);
   if (ret < 0) {
@@ -1033,6 +1215,11 @@ st20p_rx_handle st20p_rx_create(mtl_handle mt, struct st20p_rx_ops* ops) {
     return NULL;
   }
 
+  /* resolve the convert path for the geometry of the framebuffers */
+  if (ctx->internal_converter)
+    st_frame_converter_bind(ctx->internal_converter, &ctx->framebuffs[0].src,
+                            &ctx->framebuffs[0].dst);
+
   /* all ready now */
   ctx->ready = true;
   notice("%s(%d), transport fmt %s, output fmt %s, flags 0x%x\n", __func__, idx,
@@ -1067,18 +1254,29 @@ int st20p_rx_free(st20p_rx_handle handle) {
     ctx->convert_impl = NULL;
   }
 
+  if (ctx->convert_pool) {
+    st_convert_pool_free(ctx->convert_pool);
+    ctx->convert_pool = NULL;
+  }
+
   if (ctx->internal_converter) {
     mt_rte_free(ctx->internal_converter);
     ctx->internal_converter = NULL;
   }
 
+  if (ctx->scaler) {
+    st_frame_scaler_free(ctx->scaler);
+    ctx->scaler = NULL;
+  }
+
   if (ctx->transport) {
     st20_rx_free(ctx->transport);
     ctx->transport = NULL;
   }
+  rx_st20p_uinit_rings(ctx);
   rx_st20p_uinit_dst_fbs(ctx);
 
-  mt_pthread_mutex_destroy(&ctx->lock);
+  mt_pthread_mutex_destroy(&ctx->convert_mutex);
   mt_pthread_mutex_destroy(&ctx->block_wake_mutex);
   mt_pthread_cond_destroy(&ctx->block_wake_cond);
   notice("%s(%d), succ\n", __func__, ctx->idx);
@@ -6,8 +6,11 @@
 #define _ST_LIB_PIPELINE_ST20_RX_HEAD_H_
 
 #include "../st_main.h"
+#include "st_convert_pool.h"
 #include "st_plugin.h"
 
+#define ST20P_RX_PREFIX "R20P_"
+
 enum st20p_rx_frame_status {
   ST20P_RX_FRAME_FREE = 0,
   ST20P_RX_FRAME_READY,         /* get from transport */
@@ -27,6 +30,10 @@ struct st20p_rx_frame {
   size_t user_meta_buffer_size;
   size_t user_meta_data_size;
   struct st20_rx_tp_meta tp[MTL_SESSION_PORT_MAX];
+  /* lines converted for ST20P_RX_FLAG_SLICE_CONVERT */
+  uint32_t slice_lines;
+  /* one line segment of dst for packet/slice convert, set once per frame */
+  struct st_frame inline_dst;
 };
 
 struct st20p_rx_ctx {
@@ -40,11 +47,11 @@ struct st20p_rx_ctx {
 
   st20_rx_handle transport;
   uint16_t framebuff_cnt;
-  uint16_t framebuff_producer_idx;
-  uint16_t framebuff_convert_idx;
-  uint16_t framebuff_consumer_idx;
   struct st20p_rx_frame* framebuffs;
-  pthread_mutex_t lock;
+  /* lock-free fifo of the frames for free, ready and converted, NULL for others */
+  struct rte_ring* frame_rings[ST20P_RX_FRAME_STATUS_MAX];
+  /* the free frame taken by query_ext_frame for the next frame ready */
+  struct st20p_rx_frame* ext_framebuff;
   int usdt_frame_cnt;
 
   /* for ST20P_RX_FLAG_BLOCK_GET */
@@ -52,21 +59,37 @@ struct st20p_rx_ctx {
   pthread_cond_t block_wake_cond;
   pthread_mutex_t block_wake_mutex;
   uint64_t block_timeout_ns;
+  rte_atomic32_t block_waiters; /* the wake skips the cond signal if no waiter */
 
   struct st20_convert_session_impl* convert_impl;
   struct st_frame_converter* internal_converter;
+  struct st_convert_pool* convert_pool; /* for ops.convert_workers */
+  struct st_frame_scaler* scaler;       /* for ops.output_width/height */
+  /* serialize the get_frame convert, the scaler is not reentrant and the pool
+   * takes one frame at a time */
+  pthread_mutex_t convert_mutex;
   bool ready;
   bool derive;
   bool dynamic_ext_frame;
+  /* convert from transport callback, ST20P_RX_FLAG_PKT_CONVERT or SLICE_CONVERT */
+  bool inline_convert;
+  struct st_frame_converter inline_converter; /* the table converter for inline */
+  struct st20_pgroup pg;                      /* the transport pg for inline */
+  struct st_frame inline_src;                 /* one line src template for inline */
+  size_t inline_pg_bytes[ST_MAX_PLANES];      /* dst bytes of one pg in each plane */
 
   size_t dst_size;
+  /* the size of dst frames, scaled from the transport if differ */
+  uint32_t dst_width;
+  uint32_t dst_height;
 
   rte_atomic32_t stat_convert_fail;
   rte_atomic32_t stat_busy;
-  /* get frame stat */
-  int stat_get_frame_try;
-  int stat_get_frame_succ;
-  int stat_put_frame;
+  rte_atomic32_t stat_slice_notify;
+  /* get frame stat, get/put may be called from several app threads */
+  rte_atomic32_t stat_get_frame_try;
+  rte_atomic32_t stat_get_frame_succ;
+  rte_atomic32_t stat_put_frame;
 };
 
 #endif
@@ -15,20 +15,15 @@ static const char* tx_st20p_stat_name(enum st20p_tx_frame_status stat) {
   return st20p_tx_frame_stat_name[stat];
 }
 
-static uint16_t tx_st20p_next_idx(struct st20p_tx_ctx* ctx, uint16_t idx) {
-  /* point to next */
-  uint16_t next_idx = idx;
-  next_idx++;
-  if (next_idx >= ctx->framebuff_cnt) next_idx = 0;
-  return next_idx;
-}
-
 static inline struct st_frame* tx_st20p_user_frame(struct st20p_tx_ctx* ctx,
                                                    struct st20p_tx_frame* framebuff) {
   return ctx->derive ? &framebuff->dst : &framebuff->src;
 }
 
 static void tx_st20p_block_wake(struct st20p_tx_ctx* ctx) {
+  /* the frame enqueued before is seen by the waiter if we see no waiter */
+  rte_smp_mb();
+  if (!rte_atomic32_read(&ctx->block_waiters)) return;
   /* notify block */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
   mt_pthread_cond_signal(&ctx->block_wake_cond);
@@ -47,26 +42,21 @@ static void tx_st20p_notify_frame_available(struct st20p_tx_ctx* ctx) {
 }
 
 static struct st20p_tx_frame* tx_st20p_next_available(
-    struct st20p_tx_ctx* ctx, uint16_t idx_start, enum st20p_tx_frame_status desired) {
-  uint16_t idx = idx_start;
+    struct st20p_tx_ctx* ctx, enum st20p_tx_frame_status desired) {
   struct st20p_tx_frame* framebuff;
 
-  /* check ready frame from idx_start */
-  while (1) {
-    framebuff = &ctx->framebuffs[idx];
-    if (desired == framebuff->stat) {
-      /* find one desired */
-      return framebuff;
-    }
-    idx = tx_st20p_next_idx(ctx, idx);
-    if (idx == idx_start) {
-      /* loop all frames end */
-      break;
-    }
-  }
+  /* the oldest one in the desired status */
+  if (rte_ring_dequeue(ctx->frame_rings[desired], (void**)&framebuff) < 0) return NULL;
 
-  /* no any desired frame */
-  return NULL;
+  return framebuff;
+}
+
+static void tx_st20p_set_stat(struct st20p_tx_ctx* ctx, struct st20p_tx_frame* framebuff,
+                              enum st20p_tx_frame_status stat) {
+  /* set before the enqueue, the frame may be taken by others just after */
+  framebuff->stat = stat;
+  /* the ring has room for all frames, never full */
+  if (ctx->frame_rings[stat]) rte_ring_enqueue(ctx->frame_rings[stat], framebuff);
 }
 
 static int tx_st20p_next_frame(void* priv, uint16_t* next_frame_idx,
@@ -76,16 +66,11 @@ static int tx_st20p_next_frame(void* priv, uint16_t* next_frame_idx,
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st20p_next_available(ctx, ctx->framebuff_consumer_idx, ST20P_TX_FRAME_CONVERTED);
+  framebuff = tx_st20p_next_available(ctx, ST20P_TX_FRAME_CONVERTED);
   /* not any converted frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return -EBUSY;
-  }
+  if (!framebuff) return -EBUSY;
 
-  framebuff->stat = ST20P_TX_FRAME_IN_TRANSMITTING;
+  tx_st20p_set_stat(ctx, framebuff, ST20P_TX_FRAME_IN_TRANSMITTING);
   *next_frame_idx = framebuff->idx;
 
   struct st_frame* frame = tx_st20p_user_frame(ctx, framebuff);
@@ -98,9 +83,6 @@ static int tx_st20p_next_frame(void* priv, uint16_t* next_frame_idx,
     meta->user_meta = framebuff->user_meta;
     meta->user_meta_size = framebuff->user_meta_data_size;
   }
-  /* point to next */
-  ctx->framebuff_consumer_idx = tx_st20p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
   dbg("%s(%d), frame %u succ\n", __func__, ctx->idx, framebuff->idx);
   MT_USDT_ST20P_TX_FRAME_NEXT(ctx->idx, framebuff->idx);
   return 0;
@@ -112,23 +94,22 @@ static int tx_st20p_frame_done(void* priv, uint16_t frame_idx,
   int ret;
   struct st20p_tx_frame* framebuff = &ctx->framebuffs[frame_idx];
 
-  mt_pthread_mutex_lock(&ctx->lock);
+  /* the meta is updated before the frame is free for the app */
+  struct st_frame* frame = tx_st20p_user_frame(ctx, framebuff);
+  frame->tfmt = meta->tfmt;
+  frame->timestamp = meta->timestamp;
+  frame->epoch = meta->epoch;
+  frame->rtp_timestamp = meta->rtp_timestamp;
+
   if (ST20P_TX_FRAME_IN_TRANSMITTING == framebuff->stat) {
     ret = 0;
-    framebuff->stat = ST20P_TX_FRAME_FREE;
+    tx_st20p_set_stat(ctx, framebuff, ST20P_TX_FRAME_FREE);
     dbg("%s(%d), done_idx %u\n", __func__, ctx->idx, frame_idx);
   } else {
     ret = -EIO;
     err("%s(%d), err status %d for frame %u\n", __func__, ctx->idx, framebuff->stat,
         frame_idx);
   }
-  mt_pthread_mutex_unlock(&ctx->lock);
-
-  struct st_frame* frame = tx_st20p_user_frame(ctx, framebuff);
-  frame->tfmt = meta->tfmt;
-  frame->timestamp = meta->timestamp;
-  frame->epoch = meta->epoch;
-  frame->rtp_timestamp = meta->rtp_timestamp;
 
   if (ctx->ops.notify_frame_done) { /* notify app which frame done */
     ctx->ops.notify_frame_done(ctx->ops.priv, frame);
@@ -152,6 +133,31 @@ static int tx_st20p_notify_event(void* priv, enum st_event event, void* args) {
   return 0;
 }
 
+static int tx_st20p_packet_convert(void* priv, uint16_t frame_idx,
+                                   struct st20_tx_uframe_pg_meta* meta) {
+  struct st20p_tx_ctx* ctx = priv;
+  struct st_frame* src = &ctx->framebuffs[frame_idx].src;
+  struct st20_rfc4175_422_10_pg2_be* dst = meta->payload;
+  int ret = -EIO;
+
+  if (src->fmt == ST_FRAME_FMT_YUV422PLANAR10LE) {
+    uint8_t* y = (uint8_t*)src->addr[0] + src->linesize[0] * meta->row_number +
+                 meta->row_offset * 2;
+    uint8_t* b = (uint8_t*)src->addr[1] + src->linesize[1] * meta->row_number +
+                 meta->row_offset;
+    uint8_t* r = (uint8_t*)src->addr[2] + src->linesize[2] * meta->row_number +
+                 meta->row_offset;
+    ret = st20_yuv422p10le_to_rfc4175_422be10((uint16_t*)y, (uint16_t*)b, (uint16_t*)r,
+                                              dst, meta->pg_cnt, 2);
+  } else if (src->fmt == ST_FRAME_FMT_Y210) {
+    uint8_t* y210 = (uint8_t*)src->addr[0] + src->linesize[0] * meta->row_number +
+                    meta->row_offset * 4;
+    ret = st20_y210_to_rfc4175_422be10((uint16_t*)y210, dst, meta->pg_cnt, 2);
+  }
+
+  return ret;
+}
+
 static struct st20_convert_frame_meta* tx_st20p_convert_get_frame(void* priv) {
   struct st20p_tx_ctx* ctx = priv;
   int idx = ctx->idx;
@@ -164,19 +170,11 @@ static struct st20_convert_frame_meta* tx_st20p_convert_get_frame(void* priv) {
 
   if (!ctx->ready) return NULL; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st20p_next_available(ctx, ctx->framebuff_convert_idx, ST20P_TX_FRAME_READY);
-  /* not any free frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return NULL;
-  }
+  framebuff = tx_st20p_next_available(ctx, ST20P_TX_FRAME_READY);
+  /* not any ready frame */
+  if (!framebuff) return NULL;
 
-  framebuff->stat = ST20P_TX_FRAME_IN_CONVERTING;
-  /* point to next */
-  ctx->framebuff_convert_idx = tx_st20p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  tx_st20p_set_stat(ctx, framebuff, ST20P_TX_FRAME_IN_CONVERTING);
 
   dbg("%s(%d), frame %u succ\n", __func__, idx, framebuff->idx);
   return &framebuff->convert_frame;
@@ -204,12 +202,12 @@ static int tx_st20p_convert_put_frame(void* priv, struct st20_convert_frame_meta
   if ((result < 0) || (data_size <= 0)) {
     dbg("%s(%d), frame %u result %d data_size %" PRIu64 "\n", __func__, idx, convert_idx,
         result, data_size);
-    framebuff->stat = ST20P_TX_FRAME_FREE;
+    tx_st20p_set_stat(ctx, framebuff, ST20P_TX_FRAME_FREE);
     /* notify app can get frame */
     tx_st20p_notify_frame_available(ctx);
     rte_atomic32_inc(&ctx->stat_convert_fail);
   } else {
-    framebuff->stat = ST20P_TX_FRAME_CONVERTED;
+    tx_st20p_set_stat(ctx, framebuff, ST20P_TX_FRAME_CONVERTED);
   }
 
   return 0;
@@ -217,13 +215,11 @@ static int tx_st20p_convert_put_frame(void* priv, struct st20_convert_frame_meta
 
 static int tx_st20p_convert_dump(void* priv) {
   struct st20p_tx_ctx* ctx = priv;
-  struct st20p_tx_frame* framebuff = ctx->framebuffs;
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  uint16_t convert_idx = ctx->framebuff_convert_idx;
-  notice("TX_st20p(%s), cv(%d:%s)\n", ctx->ops_name, convert_idx,
-         tx_st20p_stat_name(framebuff[convert_idx].stat));
+  notice("TX_st20p(%s), cv ready %u\n", ctx->ops_name,
+         rte_ring_count(ctx->frame_rings[ST20P_TX_FRAME_READY]));
 
   int convert_fail = rte_atomic32_read(&ctx->stat_convert_fail);
   rte_atomic32_set(&ctx->stat_convert_fail, 0);
@@ -307,6 +303,19 @@ static int tx_st20p_create_transport(struct mtl_main_impl* impl, struct st20p_tx
     ops_tx.socket_id = ops->socket_id;
     ops_tx.flags |= ST20_TX_FLAG_FORCE_NUMA;
   }
+  if (ctx->pkt_convert) {
+    uint64_t pkt_cvt_input_cap = ST_FMT_CAP_YUV422PLANAR10LE | ST_FMT_CAP_Y210;
+    if (ops->transport_fmt != ST20_FMT_YUV_422_10BIT) {
+      err("%s(%d), only 422 10bit support packet convert\n", __func__, idx);
+      return -EIO;
+    }
+    if (!(MTL_BIT64(ops->input_fmt) & pkt_cvt_input_cap)) {
+      err("%s(%d), %s not supported by packet convert\n", __func__, idx,
+          st_frame_fmt_name(ops->input_fmt));
+      return -EIO;
+    }
+    ops_tx.uframe_pg_callback = tx_st20p_packet_convert;
+  }
 
   transport = st20_tx_create(impl, &ops_tx);
   if (!transport) {
@@ -437,6 +446,52 @@ static int tx_st20p_init_src_fbs(struct mtl_main_impl* impl, struct st20p_tx_ctx
   return 0;
 }
 
+static int tx_st20p_init_ring(struct st20p_tx_ctx* ctx, enum st20p_tx_frame_status stat,
+                              unsigned int flags) {
+  char ring_name[32];
+  struct rte_ring* ring;
+
+  snprintf(ring_name, sizeof(ring_name), "%sS%d_%s", ST20P_TX_PREFIX, ctx->idx,
+           tx_st20p_stat_name(stat));
+  ring = rte_ring_create(ring_name, ctx->framebuff_cnt, ctx->socket_id,
+                         flags | RING_F_EXACT_SZ);
+  if (!ring) {
+    err("%s(%d), rte_ring_create %s fail\n", __func__, ctx->idx, ring_name);
+    return -ENOMEM;
+  }
+  ctx->frame_rings[stat] = ring;
+  return 0;
+}
+
+static int tx_st20p_uinit_rings(struct st20p_tx_ctx* ctx) {
+  for (int stat = 0; stat < ST20P_TX_FRAME_STATUS_MAX; stat++) {
+    if (ctx->frame_rings[stat]) {
+      rte_ring_free(ctx->frame_rings[stat]);
+      ctx->frame_rings[stat] = NULL;
+    }
+  }
+
+  return 0;
+}
+
+static int tx_st20p_init_rings(struct st20p_tx_ctx* ctx) {
+  int ret;
+
+  /* free and ready frames are put by the app, plugin and transport threads */
+  ret = tx_st20p_init_ring(ctx, ST20P_TX_FRAME_FREE, 0);
+  if (ret < 0) return ret;
+  ret = tx_st20p_init_ring(ctx, ST20P_TX_FRAME_READY, 0);
+  if (ret < 0) return ret;
+  /* only the transport tasklet gets the converted frames */
+  ret = tx_st20p_init_ring(ctx, ST20P_TX_FRAME_CONVERTED, RING_F_SC_DEQ);
+  if (ret < 0) return ret;
+
+  for (uint16_t i = 0; i < ctx->framebuff_cnt; i++)
+    tx_st20p_set_stat(ctx, &ctx->framebuffs[i], ST20P_TX_FRAME_FREE);
+
+  return 0;
+}
+
 static int tx_st20p_get_converter(struct mtl_main_impl* impl, struct st20p_tx_ctx* ctx,
                                   struct st20p_tx_ops* ops) {
   int idx = ctx->idx;
@@ -470,8 +525,19 @@ static int tx_st20p_get_converter(struct mtl_main_impl* impl, struct st20p_tx_ct
       mt_rte_free(converter);
       return -EIO;
     }
+    converter->color_matrix = ops->color_matrix;
+    converter->color_range = ops->color_range;
     ctx->internal_converter = converter;
     info("%s(%d), use internal converter\n", __func__, idx);
+
+    if (ops->convert_workers) {
+      ctx->convert_pool = st_convert_pool_create(impl, ctx->ops_name,
+                                                 ops->convert_workers, ctx->socket_id);
+      if (!ctx->convert_pool) {
+        err("%s(%d), convert pool create fail\n", __func__, idx);
+        return -EIO;
+      }
+    }
     return 0;
   }
   ctx->convert_impl = convert_impl;
@@ -479,23 +545,31 @@ static int tx_st20p_get_converter(struct mtl_main_impl* impl, struct st20p_tx_ct
   return 0;
 }
 
+static int tx_st20p_convert_internal(struct st20p_tx_ctx* ctx,
+                                     struct st20p_tx_frame* framebuff) {
+  if (ctx->convert_pool)
+    return st_convert_pool_convert(ctx->convert_pool, ctx->internal_converter,
+                                   &framebuff->src, &framebuff->dst);
+  return st_frame_converter_convert(ctx->internal_converter, &framebuff->src,
+                                    &framebuff->dst);
+}
+
 static int tx_st20p_stat(void* priv) {
   struct st20p_tx_ctx* ctx = priv;
-  struct st20p_tx_frame* framebuff = ctx->framebuffs;
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  uint16_t producer_idx = ctx->framebuff_producer_idx;
-  uint16_t consumer_idx = ctx->framebuff_consumer_idx;
-  notice("TX_st20p(%d,%s), p(%d:%s) c(%d:%s)\n", ctx->idx, ctx->ops_name, producer_idx,
-         tx_st20p_stat_name(framebuff[producer_idx].stat), consumer_idx,
-         tx_st20p_stat_name(framebuff[consumer_idx].stat));
+  notice("TX_st20p(%d,%s), free %u ready %u converted %u\n", ctx->idx, ctx->ops_name,
+         rte_ring_count(ctx->frame_rings[ST20P_TX_FRAME_FREE]),
+         rte_ring_count(ctx->frame_rings[ST20P_TX_FRAME_READY]),
+         rte_ring_count(ctx->frame_rings[ST20P_TX_FRAME_CONVERTED]));
 
   notice("TX_st20p(%d), frame get try %d succ %d, put %d\n", ctx->idx,
-         ctx->stat_get_frame_try, ctx->stat_get_frame_succ, ctx->stat_put_frame);
-  ctx->stat_get_frame_try = 0;
-  ctx->stat_get_frame_succ = 0;
-  ctx->stat_put_frame = 0;
+         mt_atomic32_read_clear(&ctx->stat_get_frame_try),
+         mt_atomic32_read_clear(&ctx->stat_get_frame_succ),
+         mt_atomic32_read_clear(&ctx->stat_put_frame));
+
+  if (ctx->convert_pool) st_convert_pool_dump(ctx->convert_pool);
 
   return 0;
 }
@@ -561,11 +635,15 @@ static void tx_st20p_framebuffs_flush(struct st20p_tx_ctx* ctx) {
 
 static int st20p_tx_get_block_wait(struct st20p_tx_ctx* ctx) {
   dbg("%s(%d), start\n", __func__, ctx->idx);
+  rte_atomic32_inc(&ctx->block_waiters);
   /* wait on the block cond */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
-  mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
-                               ctx->block_timeout_ns);
+  /* check again as the wake skips the signal if it sees no waiter */
+  if (rte_ring_empty(ctx->frame_rings[ST20P_TX_FRAME_FREE]))
+    mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
+                                 ctx->block_timeout_ns);
   mt_pthread_mutex_unlock(&ctx->block_wake_mutex);
+  rte_atomic32_dec(&ctx->block_waiters);
   dbg("%s(%d), end\n", __func__, ctx->idx);
   return 0;
 }
@@ -582,29 +660,18 @@ struct st_frame* st20p_tx_get_frame(st20p_tx_handle handle) {
 
   if (!ctx->ready) return NULL; /* not ready */
 
-  ctx->stat_get_frame_try++;
+  rte_atomic32_inc(&ctx->stat_get_frame_try);
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st20p_next_available(ctx, ctx->framebuff_producer_idx, ST20P_TX_FRAME_FREE);
+  framebuff = tx_st20p_next_available(ctx, ST20P_TX_FRAME_FREE);
   if (!framebuff && ctx->block_get) { /* wait here */
-    mt_pthread_mutex_unlock(&ctx->lock);
     st20p_tx_get_block_wait(ctx);
     /* get again */
-    mt_pthread_mutex_lock(&ctx->lock);
-    framebuff =
-        tx_st20p_next_available(ctx, ctx->framebuff_producer_idx, ST20P_TX_FRAME_FREE);
+    framebuff = tx_st20p_next_available(ctx, ST20P_TX_FRAME_FREE);
   }
   /* not any free frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return NULL;
-  }
+  if (!framebuff) return NULL;
 
-  framebuff->stat = ST20P_TX_FRAME_IN_USER;
-  /* point to next */
-  ctx->framebuff_producer_idx = tx_st20p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  tx_st20p_set_stat(ctx, framebuff, ST20P_TX_FRAME_IN_USER);
 
   dbg("%s(%d), frame %u succ\n", __func__, idx, framebuff->idx);
   struct st_frame* frame = tx_st20p_user_frame(ctx, framebuff);
@@ -614,7 +681,7 @@ struct st_frame* st20p_tx_get_frame(st20p_tx_handle handle) {
   }
   frame->user_meta = NULL;
   frame->user_meta_size = 0;
-  ctx->stat_get_frame_succ++;
+  rte_atomic32_inc(&ctx->stat_get_frame_succ);
   MT_USDT_ST20P_TX_FRAME_GET(idx, framebuff->idx, frame->addr[0]);
   return frame;
 }
@@ -624,6 +691,7 @@ int st20p_tx_put_frame(st20p_tx_handle handle, struct st_frame* frame) {
   int idx = ctx->idx;
   struct st20p_tx_frame* framebuff = frame->priv;
   uint16_t producer_idx = framebuff->idx;
+  enum st20p_tx_frame_status stat;
 
   if (ctx->type != MT_ST20_HANDLE_PIPELINE_TX) {
     err("%s(%d), invalid type %d\n", __func__, idx, ctx->type);
@@ -647,7 +715,7 @@ int st20p_tx_put_frame(st20p_tx_handle handle, struct st_frame* frame) {
     if (frame->user_meta_size > framebuff->user_meta_buffer_size) {
       err("%s(%d), frame %u user meta size %" PRId64 " too large\n", __func__, idx,
           producer_idx, frame->user_meta_size);
-      framebuff->stat = ST20P_TX_FRAME_FREE;
+      tx_st20p_set_stat(ctx, framebuff, ST20P_TX_FRAME_FREE);
       return -EIO;
     }
 
@@ -661,17 +729,19 @@ int st20p_tx_put_frame(st20p_tx_handle handle, struct st_frame* frame) {
   }
 
   if (ctx->internal_converter) { /* convert internal */
-    ctx->internal_converter->convert_func(&framebuff->src, &framebuff->dst);
-    framebuff->stat = ST20P_TX_FRAME_CONVERTED;
-  } else if (ctx->derive) {
-    framebuff->stat = ST20P_TX_FRAME_CONVERTED;
+    tx_st20p_convert_internal(ctx, framebuff);
+    stat = ST20P_TX_FRAME_CONVERTED;
+  } else if (ctx->derive || ctx->pkt_convert) {
+    /* pkt convert will read the src frame when build each pkt */
+    stat = ST20P_TX_FRAME_CONVERTED;
   } else {
-    framebuff->stat = ST20P_TX_FRAME_READY;
-    st20_convert_notify_frame_ready(ctx->convert_impl);
+    stat = ST20P_TX_FRAME_READY;
   }
-  ctx->stat_put_frame++;
+  tx_st20p_set_stat(ctx, framebuff, stat);
+  if (stat == ST20P_TX_FRAME_READY) st20_convert_notify_frame_ready(ctx->convert_impl);
+  rte_atomic32_inc(&ctx->stat_put_frame);
 
-  MT_USDT_ST20P_TX_FRAME_PUT(idx, framebuff->idx, frame->addr[0], framebuff->stat);
+  MT_USDT_ST20P_TX_FRAME_PUT(idx, producer_idx, frame->addr[0], stat);
   /* check if dump USDT enabled */
   if (MT_USDT_ST20P_TX_FRAME_DUMP_ENABLED()) {
     int period = st_frame_rate(ctx->ops.fps) * 5; /* dump every 5s now */
@@ -692,6 +762,7 @@ int st20p_tx_put_ext_frame(st20p_tx_handle handle, struct st_frame* frame,
   int idx = ctx->idx;
   struct st20p_tx_frame* framebuff = frame->priv;
   uint16_t producer_idx = framebuff->idx;
+  enum st20p_tx_frame_status stat;
   int ret = 0;
 
   if (ctx->type != MT_ST20_HANDLE_PIPELINE_TX) {
@@ -729,7 +800,7 @@ int st20p_tx_put_ext_frame(st20p_tx_handle handle, struct st_frame* frame,
     framebuff->dst.iova[0] = ext_frame->iova[0];
     framebuff->dst.opaque = ext_frame->opaque;
     framebuff->dst.flags |= ST_FRAME_FLAG_EXT_BUF;
-    framebuff->stat = ST20P_TX_FRAME_CONVERTED;
+    stat = ST20P_TX_FRAME_CONVERTED;
   } else {
     for (int plane = 0; plane < planes; plane++) {
       framebuff->src.addr[plane] = ext_frame->addr[plane];
@@ -746,18 +817,22 @@ int st20p_tx_put_ext_frame(st20p_tx_handle handle, struct st_frame* frame,
       return -EIO;
     }
     if (ctx->internal_converter) { /* convert internal */
-      ctx->internal_converter->convert_func(&framebuff->src, &framebuff->dst);
-      framebuff->stat = ST20P_TX_FRAME_CONVERTED;
+      tx_st20p_convert_internal(ctx, framebuff);
       if (ctx->ops.notify_frame_done)
         ctx->ops.notify_frame_done(ctx->ops.priv, &framebuff->src);
+      stat = ST20P_TX_FRAME_CONVERTED;
+    } else if (ctx->pkt_convert) {
+      /* the ext src frame is in use until the transport done */
+      stat = ST20P_TX_FRAME_CONVERTED;
     } else {
-      framebuff->stat = ST20P_TX_FRAME_READY;
-      st20_convert_notify_frame_ready(ctx->convert_impl);
+      stat = ST20P_TX_FRAME_READY;
     }
   }
-  ctx->stat_put_frame++;
+  tx_st20p_set_stat(ctx, framebuff, stat);
+  if (stat == ST20P_TX_FRAME_READY) st20_convert_notify_frame_ready(ctx->convert_impl);
+  rte_atomic32_inc(&ctx->stat_put_frame);
 
-  MT_USDT_ST20P_TX_FRAME_PUT(idx, framebuff->idx, frame->addr[0], framebuff->stat);
+  MT_USDT_ST20P_TX_FRAME_PUT(idx, producer_idx, frame->addr[0], stat);
   /* check if dump USDT enabled */
   if (MT_USDT_ST20P_TX_FRAME_DUMP_ENABLED()) {
     int period = st_frame_rate(ctx->ops.fps) * 5; /* dump every 5s now */
@@ -794,6 +869,13 @@ st20p_tx_handle st20p_tx_create(mtl_handle mt, struct st20p_tx_ops* ops) {
     return NULL;
   }
 
+  if (ops->color_matrix >= ST20_COLOR_MATRIX_MAX ||
+      ops->color_range >= ST20_COLOR_RANGE_MAX) {
+    err("%s, invalid color matrix %d or range %d\n", __func__, ops->color_matrix,
+        ops->color_range);
+    return NULL;
+  }
+
   src_size = st_frame_size(ops->input_fmt, ops->width, ops->height, ops->interlaced);
   if (!src_size) {
     err("%s(%d), get src size fail\n", __func__, idx);
@@ -819,16 +901,17 @@ st20p_tx_handle st20p_tx_create(mtl_handle mt, struct st20p_tx_ops* ops) {
   ctx->socket_id = socket;
   ctx->ready = false;
   ctx->derive = st_frame_fmt_equal_transport(ops->input_fmt, ops->transport_fmt);
+  if (!ctx->derive && (ops->flags & ST20P_TX_FLAG_PKT_CONVERT)) ctx->pkt_convert = true;
   ctx->impl = impl;
   ctx->type = MT_ST20_HANDLE_PIPELINE_TX;
   ctx->src_size = src_size;
   rte_atomic32_set(&ctx->stat_convert_fail, 0);
   rte_atomic32_set(&ctx->stat_busy, 0);
-  mt_pthread_mutex_init(&ctx->lock, NULL);
 
   mt_pthread_mutex_init(&ctx->block_wake_mutex, NULL);
   mt_pthread_cond_wait_init(&ctx->block_wake_cond);
   ctx->block_timeout_ns = NS_PER_S;
+  rte_atomic32_set(&ctx->block_waiters, 0);
   if (ops->flags & ST20P_TX_FLAG_BLOCK_GET) {
     ctx->block_get = true;
   }
@@ -842,7 +925,7 @@ st20p_tx_handle st20p_tx_create(mtl_handle mt, struct st20p_tx_ops* ops) {
   ctx->ops = *ops;
 
   /* get one suitable convert device */
-  if (!ctx->derive) {
+  if (!ctx->derive && !ctx->pkt_convert) {
     ret = tx_st20p_get_converter(impl, ctx, ops);
     if (ret < 0) {
       err("%s(%d), get converter fail %d\n", __func__, idx, ret);
@@ -859,6 +942,13 @@ st20p_tx_handle st20p_tx_create(mtl_handle mt, struct st20p_tx_ops* ops) {
     return NULL;
   }
 
+  ret = tx_st20p_init_rings(ctx);
+  if (ret < 0) {
+    err("%s(%d), init rings fail %d\n", __func__, idx, ret);
+    st20p_tx_free(ctx);
+    return NULL;
+  }
+
   /* crete transport handle */
   ret = tx_st20p_create_transport(impl, ctx, ops);
   if (ret < 0) {
@@ -867,6 +957,11 @@ st20p_tx_handle st20p_tx_create(mtl_handle mt, struct st20p_tx_ops* ops) {
     return NULL;
   }
 
+  /* resolve the convert path for the geometry of the framebuffers */
+  if (ctx->internal_converter)
+    st_frame_converter_bind(ctx->internal_converter, &ctx->framebuffs[0].src,
+                            &ctx->framebuffs[0].dst);
+
   /* all ready now */
   ctx->ready = true;
   notice("%s(%d), transport fmt %s, input fmt: %s, flags 0x%x\n", __func__, idx,
@@ -906,6 +1001,11 @@ int st20p_tx_free(st20p_tx_handle handle) {
     ctx->convert_impl = NULL;
   }
 
+  if (ctx->convert_pool) {
+    st_convert_pool_free(ctx->convert_pool);
+    ctx->convert_pool = NULL;
+  }
+
   if (ctx->internal_converter) {
     mt_rte_free(ctx->internal_converter);
     ctx->internal_converter = NULL;
@@ -916,9 +1016,9 @@ int st20p_tx_free(st20p_tx_handle handle) {
     ctx->transport = NULL;
   }
 
+  tx_st20p_uinit_rings(ctx);
   tx_st20p_uinit_src_fbs(ctx);
 
-  mt_pthread_mutex_destroy(&ctx->lock);
   mt_pthread_mutex_destroy(&ctx->block_wake_mutex);
   mt_pthread_cond_destroy(&ctx->block_wake_cond);
   notice("%s(%d), succ\n", __func__, ctx->idx);
@@ -6,8 +6,11 @@
 #define _ST_LIB_PIPELINE_ST20_TX_HEAD_H_
 
 #include "../st_main.h"
+#include "st_convert_pool.h"
 #include "st_plugin.h"
 
+#define ST20P_TX_PREFIX "T20P_"
+
 enum st20p_tx_frame_status {
   ST20P_TX_FRAME_FREE = 0,
   ST20P_TX_FRAME_READY,
@@ -40,17 +43,17 @@ struct st20p_tx_ctx {
 
   st20_tx_handle transport;
   uint16_t framebuff_cnt;
-  uint16_t framebuff_producer_idx;
-  uint16_t framebuff_convert_idx;
-  uint16_t framebuff_consumer_idx;
   struct st20p_tx_frame* framebuffs;
-  pthread_mutex_t lock;
+  /* lock-free fifo of the frames for free, ready and converted, NULL for others */
+  struct rte_ring* frame_rings[ST20P_TX_FRAME_STATUS_MAX];
   int usdt_frame_cnt;
 
   struct st20_convert_session_impl* convert_impl;
   struct st_frame_converter* internal_converter;
+  struct st_convert_pool* convert_pool; /* for ops.convert_workers */
   bool ready;
   bool derive; /* input_fmt == transport_fmt */
+  bool pkt_convert; /* convert on each pkt by the transport, ST20P_TX_FLAG_PKT_CONVERT */
 
   size_t src_size;
 
@@ -61,13 +64,14 @@ struct st20p_tx_ctx {
   pthread_cond_t block_wake_cond;
   pthread_mutex_t block_wake_mutex;
   uint64_t block_timeout_ns;
+  rte_atomic32_t block_waiters; /* the wake skips the cond signal if no waiter */
 
   rte_atomic32_t stat_convert_fail;
   rte_atomic32_t stat_busy;
   /* get frame stat */
-  int stat_get_frame_try;
-  int stat_get_frame_succ;
-  int stat_put_frame;
+  rte_atomic32_t stat_get_frame_try;
+  rte_atomic32_t stat_get_frame_succ;
+  rte_atomic32_t stat_put_frame;
 };
 
 #endif
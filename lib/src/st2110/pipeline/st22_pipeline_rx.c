@@ -14,15 +14,10 @@ static const char* rx_st22p_stat_name(enum st22p_rx_frame_status stat) {
   return st22p_rx_frame_stat_name[stat];
 }
 
-static uint16_t rx_st22p_next_idx(struct st22p_rx_ctx* ctx, uint16_t idx) {
-  /* point to next */
-  uint16_t next_idx = idx;
-  next_idx++;
-  if (next_idx >= ctx->framebuff_cnt) next_idx = 0;
-  return next_idx;
-}
-
 static void rx_st22p_block_wake(struct st22p_rx_ctx* ctx) {
+  /* the frame enqueued before is seen by the waiter if we see no waiter */
+  rte_smp_mb();
+  if (!rte_atomic32_read(&ctx->block_waiters)) return;
   /* notify block */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
   mt_pthread_cond_signal(&ctx->block_wake_cond);
@@ -30,6 +25,8 @@ static void rx_st22p_block_wake(struct st22p_rx_ctx* ctx) {
 }
 
 static void rx_st22p_decode_block_wake(struct st22p_rx_ctx* ctx) {
+  rte_smp_mb();
+  if (!rte_atomic32_read(&ctx->decode_block_waiters)) return;
   /* notify block */
   mt_pthread_mutex_lock(&ctx->decode_block_wake_mutex);
   mt_pthread_cond_signal(&ctx->decode_block_wake_cond);
@@ -64,26 +61,21 @@ static void rx_st22p_notify_frame_available(struct st22p_rx_ctx* ctx) {
 }
 
 static struct st22p_rx_frame* rx_st22p_next_available(
-    struct st22p_rx_ctx* ctx, uint16_t idx_start, enum st22p_rx_frame_status desired) {
-  uint16_t idx = idx_start;
+    struct st22p_rx_ctx* ctx, enum st22p_rx_frame_status desired) {
   struct st22p_rx_frame* framebuff;
 
-  /* check ready frame from idx_start */
-  while (1) {
-    framebuff = &ctx->framebuffs[idx];
-    if (desired == framebuff->stat) {
-      /* find one desired */
-      return framebuff;
-    }
-    idx = rx_st22p_next_idx(ctx, idx);
-    if (idx == idx_start) {
-      /* loop all frames end */
-      break;
-    }
-  }
+  /* the oldest one in the desired status */
+  if (rte_ring_dequeue(ctx->frame_rings[desired], (void**)&framebuff) < 0) return NULL;
 
-  /* no any desired frame */
-  return NULL;
+  return framebuff;
+}
+
+static void rx_st22p_set_stat(struct st22p_rx_ctx* ctx, struct st22p_rx_frame* framebuff,
+                              enum st22p_rx_frame_status stat) {
+  /* set before the enqueue, the frame may be taken by others just after */
+  framebuff->stat = stat;
+  /* the ring has room for all frames, never full */
+  if (ctx->frame_rings[stat]) rte_ring_enqueue(ctx->frame_rings[stat], framebuff);
 }
 
 static int rx_st22p_frame_ready(void* priv, void* frame,
@@ -94,13 +86,10 @@ static int rx_st22p_frame_ready(void* priv, void* frame,
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      rx_st22p_next_available(ctx, ctx->framebuff_producer_idx, ST22P_RX_FRAME_FREE);
+  framebuff = rx_st22p_next_available(ctx, ST22P_RX_FRAME_FREE);
   /* not any free frame */
   if (!framebuff) {
     rte_atomic32_inc(&ctx->stat_busy);
-    mt_pthread_mutex_unlock(&ctx->lock);
     return -EBUSY;
   }
 
@@ -114,7 +103,7 @@ static int rx_st22p_frame_ready(void* priv, void* frame,
     if (ret < 0) {
       err("%s(%d), query_ext_frame for frame %u fail %d\n", __func__, ctx->idx,
           framebuff->idx, ret);
-      mt_pthread_mutex_unlock(&ctx->lock);
+      rx_st22p_set_stat(ctx, framebuff, ST22P_RX_FRAME_FREE);
       return ret;
     }
 
@@ -131,7 +120,7 @@ static int rx_st22p_frame_ready(void* priv, void* frame,
     if (ret < 0) {
       err("%s(%d), ext_frame check frame %u fail %d\n", __func__, ctx->idx,
           framebuff->idx, ret);
-      mt_pthread_mutex_unlock(&ctx->lock);
+      rx_st22p_set_stat(ctx, framebuff, ST22P_RX_FRAME_FREE);
       return ret;
     }
   }
@@ -158,19 +147,13 @@ static int rx_st22p_frame_ready(void* priv, void* frame,
   /* ask app to consume src frame directly for derive mode */
   if (ctx->derive) {
     framebuff->dst = framebuff->src;
-    framebuff->stat = ST22P_RX_FRAME_DECODED;
-    /* point to next */
-    ctx->framebuff_producer_idx = rx_st22p_next_idx(ctx, framebuff->idx);
-    mt_pthread_mutex_unlock(&ctx->lock);
+    rx_st22p_set_stat(ctx, framebuff, ST22P_RX_FRAME_DECODED);
     rx_st22p_notify_frame_available(ctx);
     return 0;
   }
-  framebuff->stat = ST22P_RX_FRAME_READY;
-  /* point to next */
-  ctx->framebuff_producer_idx = rx_st22p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
-
   dbg("%s(%d), frame %u succ\n", __func__, ctx->idx, framebuff->idx);
+  rx_st22p_set_stat(ctx, framebuff, ST22P_RX_FRAME_READY);
+
   rx_st22p_decode_notify_frame_ready(ctx);
 
   return 0;
@@ -187,12 +170,16 @@ static int rx_st22p_notify_event(void* priv, enum st_event event, void* args) {
 }
 
 static int rx_st22p_decode_get_block_wait(struct st22p_rx_ctx* ctx) {
+  rte_atomic32_inc(&ctx->decode_block_waiters);
   /* wait on the block cond */
   mt_pthread_mutex_lock(&ctx->decode_block_wake_mutex);
-  mt_pthread_cond_timedwait_ns(&ctx->decode_block_wake_cond,
-                               &ctx->decode_block_wake_mutex,
-                               ctx->decode_block_timeout_ns);
+  /* check again as the wake skips the signal if it sees no waiter */
+  if (!ctx->ready || rte_ring_empty(ctx->frame_rings[ST22P_RX_FRAME_READY]))
+    mt_pthread_cond_timedwait_ns(&ctx->decode_block_wake_cond,
+                                 &ctx->decode_block_wake_mutex,
+                                 ctx->decode_block_timeout_ns);
   mt_pthread_mutex_unlock(&ctx->decode_block_wake_mutex);
+  rte_atomic32_dec(&ctx->decode_block_waiters);
   return 0;
 }
 
@@ -230,28 +217,19 @@ static struct st22_decode_frame_meta* rx_st22p_decode_get_frame(void* priv) {
 
   ctx->stat_decode_get_frame_try++;
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      rx_st22p_next_available(ctx, ctx->framebuff_decode_idx, ST22P_RX_FRAME_READY);
+  framebuff = rx_st22p_next_available(ctx, ST22P_RX_FRAME_READY);
   if (!framebuff && ctx->decode_block_get) { /* wait here for block mode */
-    mt_pthread_mutex_unlock(&ctx->lock);
     rx_st22p_decode_get_block_wait(ctx);
     /* get again */
-    mt_pthread_mutex_lock(&ctx->lock);
-    framebuff =
-        rx_st22p_next_available(ctx, ctx->framebuff_decode_idx, ST22P_RX_FRAME_READY);
+    framebuff = rx_st22p_next_available(ctx, ST22P_RX_FRAME_READY);
   }
   /* not any ready frame */
   if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
     dbg("%s(%d), no ready frame\n", __func__, idx);
     return NULL;
   }
 
-  framebuff->stat = ST22P_RX_FRAME_IN_DECODING;
-  /* point to next */
-  ctx->framebuff_decode_idx = rx_st22p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  rx_st22p_set_stat(ctx, framebuff, ST22P_RX_FRAME_IN_DECODING);
 
   ctx->stat_decode_get_frame_succ++;
   struct st22_decode_frame_meta* frame = &framebuff->decode_frame;
@@ -284,10 +262,10 @@ static int rx_st22p_decode_put_frame(void* priv, struct st22_decode_frame_meta*
   if (result < 0) {
     /* free the frame */
     st22_rx_put_framebuff(ctx->transport, framebuff->src.addr[0]);
-    framebuff->stat = ST22P_RX_FRAME_FREE;
+    rx_st22p_set_stat(ctx, framebuff, ST22P_RX_FRAME_FREE);
     rte_atomic32_inc(&ctx->stat_decode_fail);
   } else {
-    framebuff->stat = ST22P_RX_FRAME_DECODED;
+    rx_st22p_set_stat(ctx, framebuff, ST22P_RX_FRAME_DECODED);
     rx_st22p_notify_frame_available(ctx);
   }
 
@@ -298,17 +276,13 @@ static int rx_st22p_decode_put_frame(void* priv, struct st22_decode_frame_meta*
 
 static int rx_st22p_decode_dump(void* priv) {
   struct st22p_rx_ctx* ctx = priv;
-  struct st22p_rx_frame* framebuff = ctx->framebuffs;
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  uint16_t producer_idx = ctx->framebuff_producer_idx;
-  uint16_t decode_idx = ctx->framebuff_decode_idx;
-  uint16_t consumer_idx = ctx->framebuff_consumer_idx;
-  notice("RX_ST22P(%s), p(%d:%s) d(%d:%s) c(%d:%s)\n", ctx->ops_name, producer_idx,
-         rx_st22p_stat_name(framebuff[producer_idx].stat), decode_idx,
-         rx_st22p_stat_name(framebuff[decode_idx].stat), consumer_idx,
-         rx_st22p_stat_name(framebuff[consumer_idx].stat));
+  notice("RX_ST22P(%s), free %u ready %u decoded %u\n", ctx->ops_name,
+         rte_ring_count(ctx->frame_rings[ST22P_RX_FRAME_FREE]),
+         rte_ring_count(ctx->frame_rings[ST22P_RX_FRAME_READY]),
+         rte_ring_count(ctx->frame_rings[ST22P_RX_FRAME_DECODED]));
 
   int decode_fail = rte_atomic32_read(&ctx->stat_decode_fail);
   rte_atomic32_set(&ctx->stat_decode_fail, 0);
@@ -323,10 +297,9 @@ static int rx_st22p_decode_dump(void* priv) {
   }
 
   notice("RX_ST22P(%s), frame get try %d succ %d, put %d\n", ctx->ops_name,
-         ctx->stat_get_frame_try, ctx->stat_get_frame_succ, ctx->stat_put_frame);
-  ctx->stat_get_frame_try = 0;
-  ctx->stat_get_frame_succ = 0;
-  ctx->stat_put_frame = 0;
+         mt_atomic32_read_clear(&ctx->stat_get_frame_try),
+         mt_atomic32_read_clear(&ctx->stat_get_frame_succ),
+         mt_atomic32_read_clear(&ctx->stat_put_frame));
 
   notice("TX_ST22P(%s), decoder get try %d succ %d, put %d\n", ctx->ops_name,
          ctx->stat_decode_get_frame_try, ctx->stat_decode_get_frame_succ,
@@ -524,13 +497,63 @@ static int rx_st22p_get_decoder(struct mtl_main_impl* impl, struct st22p_rx_ctx*
   return 0;
 }
 
+static int rx_st22p_init_ring(struct st22p_rx_ctx* ctx, enum st22p_rx_frame_status stat,
+                              unsigned int flags) {
+  char ring_name[32];
+  struct rte_ring* ring;
+
+  snprintf(ring_name, sizeof(ring_name), "%sS%d_%s", ST22P_RX_PREFIX, ctx->idx,
+           rx_st22p_stat_name(stat));
+  ring = rte_ring_create(ring_name, ctx->framebuff_cnt, ctx->socket_id,
+                         flags | RING_F_EXACT_SZ);
+  if (!ring) {
+    err("%s(%d), rte_ring_create %s fail\n", __func__, ctx->idx, ring_name);
+    return -ENOMEM;
+  }
+  ctx->frame_rings[stat] = ring;
+  return 0;
+}
+
+static int rx_st22p_uinit_rings(struct st22p_rx_ctx* ctx) {
+  for (int stat = 0; stat < ST22P_RX_FRAME_STATUS_MAX; stat++) {
+    if (ctx->frame_rings[stat]) {
+      rte_ring_free(ctx->frame_rings[stat]);
+      ctx->frame_rings[stat] = NULL;
+    }
+  }
+
+  return 0;
+}
+
+static int rx_st22p_init_rings(struct st22p_rx_ctx* ctx) {
+  int ret;
+
+  /* only the transport tasklet gets the free frames and puts the ready frames */
+  ret = rx_st22p_init_ring(ctx, ST22P_RX_FRAME_FREE, RING_F_SC_DEQ);
+  if (ret < 0) return ret;
+  ret = rx_st22p_init_ring(ctx, ST22P_RX_FRAME_READY, RING_F_SP_ENQ);
+  if (ret < 0) return ret;
+  /* decoded frames are put by the decoder and transport threads */
+  ret = rx_st22p_init_ring(ctx, ST22P_RX_FRAME_DECODED, 0);
+  if (ret < 0) return ret;
+
+  for (uint16_t i = 0; i < ctx->framebuff_cnt; i++)
+    rx_st22p_set_stat(ctx, &ctx->framebuffs[i], ST22P_RX_FRAME_FREE);
+
+  return 0;
+}
+
 static int rx_st22p_get_block_wait(struct st22p_rx_ctx* ctx) {
   dbg("%s(%d), start\n", __func__, ctx->idx);
+  rte_atomic32_inc(&ctx->block_waiters);
   /* wait on the block cond */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
-  mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
-                               ctx->block_timeout_ns);
+  /* check again as the wake skips the signal if it sees no waiter */
+  if (rte_ring_empty(ctx->frame_rings[ST22P_RX_FRAME_DECODED]))
+    mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
+                                 ctx->block_timeout_ns);
   mt_pthread_mutex_unlock(&ctx->block_wake_mutex);
+  rte_atomic32_dec(&ctx->block_waiters);
   dbg("%s(%d), end\n", __func__, ctx->idx);
   return 0;
 }
@@ -578,32 +601,21 @@ struct st_frame* st22p_rx_get_frame(st22p_rx_handle handle) {
 
   if (!ctx->ready) return NULL; /* not ready */
 
-  ctx->stat_get_frame_try++;
+  rte_atomic32_inc(&ctx->stat_get_frame_try);
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      rx_st22p_next_available(ctx, ctx->framebuff_consumer_idx, ST22P_RX_FRAME_DECODED);
+  framebuff = rx_st22p_next_available(ctx, ST22P_RX_FRAME_DECODED);
   if (!framebuff && ctx->block_get) {
-    mt_pthread_mutex_unlock(&ctx->lock);
     rx_st22p_get_block_wait(ctx);
     /* get again */
-    mt_pthread_mutex_lock(&ctx->lock);
-    framebuff =
-        rx_st22p_next_available(ctx, ctx->framebuff_consumer_idx, ST22P_RX_FRAME_DECODED);
+    framebuff = rx_st22p_next_available(ctx, ST22P_RX_FRAME_DECODED);
   }
   /* not any decoded frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return NULL;
-  }
+  if (!framebuff) return NULL;
 
-  framebuff->stat = ST22P_RX_FRAME_IN_USER;
-  /* point to next */
-  ctx->framebuff_consumer_idx = rx_st22p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  rx_st22p_set_stat(ctx, framebuff, ST22P_RX_FRAME_IN_USER);
 
   dbg("%s(%d), frame %u succ\n", __func__, idx, framebuff->idx);
-  ctx->stat_get_frame_succ++;
+  rte_atomic32_inc(&ctx->stat_get_frame_succ);
   struct st_frame* frame = &framebuff->dst;
   MT_USDT_ST22P_RX_FRAME_GET(idx, framebuff->idx, frame->addr[0], frame->data_size);
   /* check if dump USDT enabled */
@@ -638,8 +650,8 @@ int st22p_rx_put_frame(st22p_rx_handle handle, struct st_frame* frame) {
 
   /* free the frame */
   st22_rx_put_framebuff(ctx->transport, framebuff->src.addr[0]);
-  framebuff->stat = ST22P_RX_FRAME_FREE;
-  ctx->stat_put_frame++;
+  rx_st22p_set_stat(ctx, framebuff, ST22P_RX_FRAME_FREE);
+  rte_atomic32_inc(&ctx->stat_put_frame);
   dbg("%s(%d), frame %u succ\n", __func__, idx, consumer_idx);
   MT_USDT_ST22P_RX_FRAME_PUT(idx, framebuff->idx, frame->addr[0]);
 
@@ -729,15 +741,16 @@ st22p_rx_handle st22p_rx_create(mtl_handle mt, struct st22p_rx_ops* ops) {
   }
   rte_atomic32_set(&ctx->stat_decode_fail, 0);
   rte_atomic32_set(&ctx->stat_busy, 0);
-  mt_pthread_mutex_init(&ctx->lock, NULL);
 
   mt_pthread_mutex_init(&ctx->decode_block_wake_mutex, NULL);
   mt_pthread_cond_wait_init(&ctx->decode_block_wake_cond);
   ctx->decode_block_timeout_ns = NS_PER_S;
+  rte_atomic32_set(&ctx->decode_block_waiters, 0);
 
   mt_pthread_mutex_init(&ctx->block_wake_mutex, NULL);
   mt_pthread_cond_wait_init(&ctx->block_wake_cond);
   ctx->block_timeout_ns = NS_PER_S;
+  rte_atomic32_set(&ctx->block_waiters, 0);
   if (ops->flags & ST22P_RX_FLAG_BLOCK_GET) ctx->block_get = true;
 
   /* copy ops */
@@ -766,6 +779,13 @@ st22p_rx_handle st22p_rx_create(mtl_handle mt, struct st22p_rx_ops* ops) {
     return NULL;
   }
 
+  ret = rx_st22p_init_rings(ctx);
+  if (ret < 0) {
+    err("%s(%d), init rings fail %d\n", __func__, idx, ret);
+    st22p_rx_free(ctx);
+    return NULL;
+  }
+
   /* crete transport handle */
   ret = rx_st22p_create_transport(impl, ctx, ops);
   if (ret < 0) {
@@ -804,9 +824,9 @@ int st22p_rx_free(st22p_rx_handle handle) {
     st22_rx_free(ctx->transport);
     ctx->transport = NULL;
   }
+  rx_st22p_uinit_rings(ctx);
   rx_st22p_uinit_dst_fbs(ctx);
 
-  mt_pthread_mutex_destroy(&ctx->lock);
   mt_pthread_mutex_destroy(&ctx->block_wake_mutex);
   mt_pthread_cond_destroy(&ctx->block_wake_cond);
   mt_pthread_mutex_destroy(&ctx->decode_block_wake_mutex);
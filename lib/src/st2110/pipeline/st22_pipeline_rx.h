@@ -8,6 +8,8 @@
 #include "../st_main.h"
 #include "st_plugin.h"
 
+#define ST22P_RX_PREFIX "R22P_"
+
 enum st22p_rx_frame_status {
   ST22P_RX_FRAME_FREE = 0,
   ST22P_RX_FRAME_READY,       /* get from transport */
@@ -37,17 +39,16 @@ struct st22p_rx_ctx {
 
   st22_rx_handle transport;
   uint16_t framebuff_cnt;
-  uint16_t framebuff_producer_idx;
-  uint16_t framebuff_decode_idx;
-  uint16_t framebuff_consumer_idx;
   struct st22p_rx_frame* framebuffs;
-  pthread_mutex_t lock;
+  /* lock-free fifo of the frames for free, ready and decoded, NULL for others */
+  struct rte_ring* frame_rings[ST22P_RX_FRAME_STATUS_MAX];
 
   /* for ST22P_RX_FLAG_BLOCK_GET */
   bool block_get;
   pthread_cond_t block_wake_cond;
   pthread_mutex_t block_wake_mutex;
   uint64_t block_timeout_ns;
+  rte_atomic32_t block_waiters; /* the wake skips the cond signal if no waiter */
 
   struct st22_decode_session_impl* decode_impl;
   /* for ST22_DECODER_RESP_FLAG_BLOCK_GET */
@@ -55,6 +56,7 @@ struct st22p_rx_ctx {
   pthread_cond_t decode_block_wake_cond;
   pthread_mutex_t decode_block_wake_mutex;
   uint64_t decode_block_timeout_ns;
+  rte_atomic32_t decode_block_waiters;
 
   bool ready;
   bool derive; /* output_fmt == transport_fmt */
@@ -67,9 +69,9 @@ struct st22p_rx_ctx {
   rte_atomic32_t stat_decode_fail;
   rte_atomic32_t stat_busy;
   /* get frame stat */
-  int stat_get_frame_try;
-  int stat_get_frame_succ;
-  int stat_put_frame;
+  rte_atomic32_t stat_get_frame_try;
+  rte_atomic32_t stat_get_frame_succ;
+  rte_atomic32_t stat_put_frame;
   /* get frame stat */
   int stat_decode_get_frame_try;
   int stat_decode_get_frame_succ;
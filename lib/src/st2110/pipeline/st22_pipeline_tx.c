@@ -19,15 +19,10 @@ static inline struct st_frame* tx_st22p_user_frame(struct st22p_tx_ctx* ctx,
   return ctx->derive ? &framebuff->dst : &framebuff->src;
 }
 
-static uint16_t tx_st22p_next_idx(struct st22p_tx_ctx* ctx, uint16_t idx) {
-  /* point to next */
-  uint16_t next_idx = idx;
-  next_idx++;
-  if (next_idx >= ctx->framebuff_cnt) next_idx = 0;
-  return next_idx;
-}
-
 static void tx_st22p_block_wake(struct st22p_tx_ctx* ctx) {
+  /* the frame enqueued before is seen by the waiter if we see no waiter */
+  rte_smp_mb();
+  if (!rte_atomic32_read(&ctx->block_waiters)) return;
   /* notify block */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
   mt_pthread_cond_signal(&ctx->block_wake_cond);
@@ -46,6 +41,8 @@ static void tx_st22p_notify_frame_available(struct st22p_tx_ctx* ctx) {
 }
 
 static void tx_st22p_encode_block_wake(struct st22p_tx_ctx* ctx) {
+  rte_smp_mb();
+  if (!rte_atomic32_read(&ctx->encode_block_waiters)) return;
   /* notify block */
   mt_pthread_mutex_lock(&ctx->encode_block_wake_mutex);
   mt_pthread_cond_signal(&ctx->encode_block_wake_cond);
@@ -69,26 +66,21 @@ static void tx_st22p_encode_notify_frame_ready(struct st22p_tx_ctx* ctx) {
 }
 
 static struct st22p_tx_frame* tx_st22p_next_available(
-    struct st22p_tx_ctx* ctx, uint16_t idx_start, enum st22p_tx_frame_status desired) {
-  uint16_t idx = idx_start;
+    struct st22p_tx_ctx* ctx, enum st22p_tx_frame_status desired) {
   struct st22p_tx_frame* framebuff;
 
-  /* check ready frame from idx_start */
-  while (1) {
-    framebuff = &ctx->framebuffs[idx];
-    if (desired == framebuff->stat) {
-      /* find one desired */
-      return framebuff;
-    }
-    idx = tx_st22p_next_idx(ctx, idx);
-    if (idx == idx_start) {
-      /* loop all frames end */
-      break;
-    }
-  }
+  /* the oldest one in the desired status */
+  if (rte_ring_dequeue(ctx->frame_rings[desired], (void**)&framebuff) < 0) return NULL;
+
+  return framebuff;
+}
 
-  /* no any desired frame */
-  return NULL;
+static void tx_st22p_set_stat(struct st22p_tx_ctx* ctx, struct st22p_tx_frame* framebuff,
+                              enum st22p_tx_frame_status stat) {
+  /* set before the enqueue, the frame may be taken by others just after */
+  framebuff->stat = stat;
+  /* the ring has room for all frames, never full */
+  if (ctx->frame_rings[stat]) rte_ring_enqueue(ctx->frame_rings[stat], framebuff);
 }
 
 static int tx_st22p_next_frame(void* priv, uint16_t* next_frame_idx,
@@ -98,16 +90,11 @@ static int tx_st22p_next_frame(void* priv, uint16_t* next_frame_idx,
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st22p_next_available(ctx, ctx->framebuff_consumer_idx, ST22P_TX_FRAME_ENCODED);
+  framebuff = tx_st22p_next_available(ctx, ST22P_TX_FRAME_ENCODED);
   /* not any encoded frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return -EBUSY;
-  }
+  if (!framebuff) return -EBUSY;
 
-  framebuff->stat = ST22P_TX_FRAME_IN_TRANSMITTING;
+  tx_st22p_set_stat(ctx, framebuff, ST22P_TX_FRAME_IN_TRANSMITTING);
   *next_frame_idx = framebuff->idx;
 
   struct st_frame* frame = tx_st22p_user_frame(ctx, framebuff);
@@ -119,9 +106,6 @@ static int tx_st22p_next_frame(void* priv, uint16_t* next_frame_idx,
         framebuff->idx, meta->timestamp);
   }
   meta->codestream_size = framebuff->dst.data_size;
-  /* point to next */
-  ctx->framebuff_consumer_idx = tx_st22p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
   dbg("%s(%d), frame %u succ\n", __func__, ctx->idx, framebuff->idx);
   MT_USDT_ST22P_TX_FRAME_NEXT(ctx->idx, framebuff->idx);
   return 0;
@@ -133,23 +117,22 @@ static int tx_st22p_frame_done(void* priv, uint16_t frame_idx,
   int ret;
   struct st22p_tx_frame* framebuff = &ctx->framebuffs[frame_idx];
 
-  mt_pthread_mutex_lock(&ctx->lock);
+  /* update the meta before the frame is free for the app */
+  framebuff->src.tfmt = meta->tfmt;
+  framebuff->dst.tfmt = meta->tfmt;
+  framebuff->src.timestamp = meta->timestamp;
+  framebuff->dst.timestamp = meta->timestamp;
+  framebuff->src.rtp_timestamp = framebuff->dst.rtp_timestamp = meta->rtp_timestamp;
+
   if (ST22P_TX_FRAME_IN_TRANSMITTING == framebuff->stat) {
     ret = 0;
-    framebuff->stat = ST22P_TX_FRAME_FREE;
+    tx_st22p_set_stat(ctx, framebuff, ST22P_TX_FRAME_FREE);
     dbg("%s(%d), done_idx %u\n", __func__, ctx->idx, frame_idx);
   } else {
     ret = -EIO;
     err("%s(%d), err status %d for frame %u\n", __func__, ctx->idx, framebuff->stat,
         frame_idx);
   }
-  mt_pthread_mutex_unlock(&ctx->lock);
-
-  framebuff->src.tfmt = meta->tfmt;
-  framebuff->dst.tfmt = meta->tfmt;
-  framebuff->src.timestamp = meta->timestamp;
-  framebuff->dst.timestamp = meta->timestamp;
-  framebuff->src.rtp_timestamp = framebuff->dst.rtp_timestamp = meta->rtp_timestamp;
 
   if (ctx->ops.notify_frame_done) { /* notify app which frame done */
     struct st_frame* frame = tx_st22p_user_frame(ctx, framebuff);
@@ -174,12 +157,16 @@ static int tx_st22p_notify_event(void* priv, enum st_event event, void* args) {
 }
 
 static int tx_st22p_encode_get_block_wait(struct st22p_tx_ctx* ctx) {
+  rte_atomic32_inc(&ctx->encode_block_waiters);
   /* wait on the block cond */
   mt_pthread_mutex_lock(&ctx->encode_block_wake_mutex);
-  mt_pthread_cond_timedwait_ns(&ctx->encode_block_wake_cond,
-                               &ctx->encode_block_wake_mutex,
-                               ctx->encode_block_timeout_ns);
+  /* check again as the wake skips the signal if it sees no waiter */
+  if (!ctx->ready || rte_ring_empty(ctx->frame_rings[ST22P_TX_FRAME_READY]))
+    mt_pthread_cond_timedwait_ns(&ctx->encode_block_wake_cond,
+                                 &ctx->encode_block_wake_mutex,
+                                 ctx->encode_block_timeout_ns);
   mt_pthread_mutex_unlock(&ctx->encode_block_wake_mutex);
+  rte_atomic32_dec(&ctx->encode_block_waiters);
   return 0;
 }
 
@@ -217,28 +204,19 @@ static struct st22_encode_frame_meta* tx_st22p_encode_get_frame(void* priv) {
 
   ctx->stat_encode_get_frame_try++;
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st22p_next_available(ctx, ctx->framebuff_encode_idx, ST22P_TX_FRAME_READY);
+  framebuff = tx_st22p_next_available(ctx, ST22P_TX_FRAME_READY);
   if (!framebuff && ctx->encode_block_get) { /* wait here for block mode */
-    mt_pthread_mutex_unlock(&ctx->lock);
     tx_st22p_encode_get_block_wait(ctx);
     /* get again */
-    mt_pthread_mutex_lock(&ctx->lock);
-    framebuff =
-        tx_st22p_next_available(ctx, ctx->framebuff_encode_idx, ST22P_TX_FRAME_READY);
+    framebuff = tx_st22p_next_available(ctx, ST22P_TX_FRAME_READY);
   }
   /* not any free frame */
   if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
     dbg("%s(%d), no ready frame\n", __func__, idx);
     return NULL;
   }
 
-  framebuff->stat = ST22P_TX_FRAME_IN_ENCODING;
-  /* point to next */
-  ctx->framebuff_encode_idx = tx_st22p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  tx_st22p_set_stat(ctx, framebuff, ST22P_TX_FRAME_IN_ENCODING);
 
   ctx->stat_encode_get_frame_succ++;
   dbg("%s(%d), frame %u succ\n", __func__, idx, framebuff->idx);
@@ -279,11 +257,11 @@ static int tx_st22p_encode_put_frame(void* priv, struct st22_encode_frame_meta*
          ", allowed min %u max %" PRIu64 "\n",
          __func__, idx, encode_idx, result, data_size, ST22_ENCODE_MIN_FRAME_SZ,
          max_size);
-    framebuff->stat = ST22P_TX_FRAME_FREE;
+    tx_st22p_set_stat(ctx, framebuff, ST22P_TX_FRAME_FREE);
     tx_st22p_notify_frame_available(ctx);
     rte_atomic32_inc(&ctx->stat_encode_fail);
   } else {
-    framebuff->stat = ST22P_TX_FRAME_ENCODED;
+    tx_st22p_set_stat(ctx, framebuff, ST22P_TX_FRAME_ENCODED);
   }
 
   MT_USDT_ST22P_TX_ENCODE_PUT(idx, framebuff->idx, frame->src->addr[0],
@@ -293,17 +271,13 @@ static int tx_st22p_encode_put_frame(void* priv, struct st22_encode_frame_meta*
 
 static int tx_st22p_encode_dump(void* priv) {
   struct st22p_tx_ctx* ctx = priv;
-  struct st22p_tx_frame* framebuff = ctx->framebuffs;
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  uint16_t producer_idx = ctx->framebuff_producer_idx;
-  uint16_t encode_idx = ctx->framebuff_encode_idx;
-  uint16_t consumer_idx = ctx->framebuff_consumer_idx;
-  notice("TX_ST22P(%s), p(%d:%s) e(%d:%s) c(%d:%s)\n", ctx->ops_name, producer_idx,
-         tx_st22p_stat_name(framebuff[producer_idx].stat), encode_idx,
-         tx_st22p_stat_name(framebuff[encode_idx].stat), consumer_idx,
-         tx_st22p_stat_name(framebuff[consumer_idx].stat));
+  notice("TX_ST22P(%s), free %u ready %u encoded %u\n", ctx->ops_name,
+         rte_ring_count(ctx->frame_rings[ST22P_TX_FRAME_FREE]),
+         rte_ring_count(ctx->frame_rings[ST22P_TX_FRAME_READY]),
+         rte_ring_count(ctx->frame_rings[ST22P_TX_FRAME_ENCODED]));
 
   int encode_fail = rte_atomic32_read(&ctx->stat_encode_fail);
   rte_atomic32_set(&ctx->stat_encode_fail, 0);
@@ -312,10 +286,9 @@ static int tx_st22p_encode_dump(void* priv) {
   }
 
   notice("TX_ST22P(%s), frame get try %d succ %d, put %d\n", ctx->ops_name,
-         ctx->stat_get_frame_try, ctx->stat_get_frame_succ, ctx->stat_put_frame);
-  ctx->stat_get_frame_try = 0;
-  ctx->stat_get_frame_succ = 0;
-  ctx->stat_put_frame = 0;
+         mt_atomic32_read_clear(&ctx->stat_get_frame_try),
+         mt_atomic32_read_clear(&ctx->stat_get_frame_succ),
+         mt_atomic32_read_clear(&ctx->stat_put_frame));
 
   notice("TX_ST22P(%s), encoder get try %d succ %d, put %d\n", ctx->ops_name,
          ctx->stat_encode_get_frame_try, ctx->stat_encode_get_frame_succ,
@@ -545,12 +518,62 @@ static int tx_st22p_get_encoder(struct mtl_main_impl* impl, struct st22p_tx_ctx*
   return 0;
 }
 
+static int tx_st22p_init_ring(struct st22p_tx_ctx* ctx, enum st22p_tx_frame_status stat,
+                              unsigned int flags) {
+  char ring_name[32];
+  struct rte_ring* ring;
+
+  snprintf(ring_name, sizeof(ring_name), "%sS%d_%s", ST22P_TX_PREFIX, ctx->idx,
+           tx_st22p_stat_name(stat));
+  ring = rte_ring_create(ring_name, ctx->framebuff_cnt, ctx->socket_id,
+                         flags | RING_F_EXACT_SZ);
+  if (!ring) {
+    err("%s(%d), rte_ring_create %s fail\n", __func__, ctx->idx, ring_name);
+    return -ENOMEM;
+  }
+  ctx->frame_rings[stat] = ring;
+  return 0;
+}
+
+static int tx_st22p_uinit_rings(struct st22p_tx_ctx* ctx) {
+  for (int stat = 0; stat < ST22P_TX_FRAME_STATUS_MAX; stat++) {
+    if (ctx->frame_rings[stat]) {
+      rte_ring_free(ctx->frame_rings[stat]);
+      ctx->frame_rings[stat] = NULL;
+    }
+  }
+
+  return 0;
+}
+
+static int tx_st22p_init_rings(struct st22p_tx_ctx* ctx) {
+  int ret;
+
+  /* free and ready frames are put by the app, encoder and transport threads */
+  ret = tx_st22p_init_ring(ctx, ST22P_TX_FRAME_FREE, 0);
+  if (ret < 0) return ret;
+  ret = tx_st22p_init_ring(ctx, ST22P_TX_FRAME_READY, 0);
+  if (ret < 0) return ret;
+  /* only the transport tasklet gets the encoded frames */
+  ret = tx_st22p_init_ring(ctx, ST22P_TX_FRAME_ENCODED, RING_F_SC_DEQ);
+  if (ret < 0) return ret;
+
+  for (uint16_t i = 0; i < ctx->framebuff_cnt; i++)
+    tx_st22p_set_stat(ctx, &ctx->framebuffs[i], ST22P_TX_FRAME_FREE);
+
+  return 0;
+}
+
 static int tx_st22p_get_block_wait(struct st22p_tx_ctx* ctx) {
+  rte_atomic32_inc(&ctx->block_waiters);
   /* wait on the block cond */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
-  mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
-                               ctx->block_timeout_ns);
+  /* check again as the wake skips the signal if it sees no waiter */
+  if (rte_ring_empty(ctx->frame_rings[ST22P_TX_FRAME_FREE]))
+    mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
+                                 ctx->block_timeout_ns);
   mt_pthread_mutex_unlock(&ctx->block_wake_mutex);
+  rte_atomic32_dec(&ctx->block_waiters);
   return 0;
 }
 
@@ -627,36 +650,25 @@ struct st_frame* st22p_tx_get_frame(st22p_tx_handle handle) {
 
   if (!ctx->ready) return NULL; /* not ready */
 
-  ctx->stat_get_frame_try++;
+  rte_atomic32_inc(&ctx->stat_get_frame_try);
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st22p_next_available(ctx, ctx->framebuff_producer_idx, ST22P_TX_FRAME_FREE);
+  framebuff = tx_st22p_next_available(ctx, ST22P_TX_FRAME_FREE);
   if (!framebuff && ctx->block_get) {
-    mt_pthread_mutex_unlock(&ctx->lock);
     tx_st22p_get_block_wait(ctx);
     /* get again */
-    mt_pthread_mutex_lock(&ctx->lock);
-    framebuff =
-        tx_st22p_next_available(ctx, ctx->framebuff_producer_idx, ST22P_TX_FRAME_FREE);
+    framebuff = tx_st22p_next_available(ctx, ST22P_TX_FRAME_FREE);
   }
   /* not any free frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return NULL;
-  }
+  if (!framebuff) return NULL;
 
-  framebuff->stat = ST22P_TX_FRAME_IN_USER;
-  /* point to next */
-  ctx->framebuff_producer_idx = tx_st22p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  tx_st22p_set_stat(ctx, framebuff, ST22P_TX_FRAME_IN_USER);
 
   dbg("%s(%d), frame %u succ\n", __func__, idx, framebuff->idx);
   if (ctx->ops.interlaced) { /* init second_field but user still can customize */
     framebuff->dst.second_field = framebuff->src.second_field = ctx->second_field;
     ctx->second_field = ctx->second_field ? false : true;
   }
-  ctx->stat_get_frame_succ++;
+  rte_atomic32_inc(&ctx->stat_get_frame_succ);
   struct st_frame* frame = tx_st22p_user_frame(ctx, framebuff);
   dbg("%s(%d), frame %u addr %p\n", __func__, idx, framebuff->idx, frame->addr[0]);
   MT_USDT_ST22P_TX_FRAME_GET(idx, framebuff->idx, frame->addr[0]);
@@ -689,16 +701,13 @@ int st22p_tx_put_frame(st22p_tx_handle handle, struct st_frame* frame) {
     framebuff->dst.second_field = framebuff->src.second_field = frame->second_field;
   }
 
-  if (ctx->derive) {
-    framebuff->stat = ST22P_TX_FRAME_ENCODED;
-  } else {
-    framebuff->stat = ST22P_TX_FRAME_READY;
-    tx_st22p_encode_notify_frame_ready(ctx);
-  }
-  ctx->stat_put_frame++;
+  enum st22p_tx_frame_status stat =
+      ctx->derive ? ST22P_TX_FRAME_ENCODED : ST22P_TX_FRAME_READY;
+  tx_st22p_set_stat(ctx, framebuff, stat);
+  if (!ctx->derive) tx_st22p_encode_notify_frame_ready(ctx);
+  rte_atomic32_inc(&ctx->stat_put_frame);
 
-  MT_USDT_ST22P_TX_FRAME_PUT(idx, framebuff->idx, frame->addr[0], framebuff->stat,
-                             frame->data_size);
+  MT_USDT_ST22P_TX_FRAME_PUT(idx, producer_idx, frame->addr[0], stat, frame->data_size);
   /* check if dump USDT enabled */
   if (!ctx->derive && MT_USDT_ST22P_TX_FRAME_DUMP_ENABLED()) {
     int period = st_frame_rate(ctx->ops.fps) * 5; /* dump every 5s now */
@@ -764,9 +773,9 @@ int st22p_tx_put_ext_frame(st22p_tx_handle handle, struct st_frame* frame,
     framebuff->dst.second_field = framebuff->src.second_field = frame->second_field;
   }
 
-  framebuff->stat = ST22P_TX_FRAME_READY;
+  tx_st22p_set_stat(ctx, framebuff, ST22P_TX_FRAME_READY);
   tx_st22p_encode_notify_frame_ready(ctx);
-  ctx->stat_put_frame++;
+  rte_atomic32_inc(&ctx->stat_put_frame);
   dbg("%s(%d), frame %u succ\n", __func__, idx, producer_idx);
 
   return 0;
@@ -844,15 +853,16 @@ st22p_tx_handle st22p_tx_create(mtl_handle mt, struct st22p_tx_ops* ops) {
   ctx->type = MT_ST22_HANDLE_PIPELINE_TX;
   ctx->src_size = src_size;
   rte_atomic32_set(&ctx->stat_encode_fail, 0);
-  mt_pthread_mutex_init(&ctx->lock, NULL);
 
   mt_pthread_mutex_init(&ctx->encode_block_wake_mutex, NULL);
   mt_pthread_cond_wait_init(&ctx->encode_block_wake_cond);
   ctx->encode_block_timeout_ns = NS_PER_S; /* default to 1s */
+  rte_atomic32_set(&ctx->encode_block_waiters, 0);
 
   mt_pthread_mutex_init(&ctx->block_wake_mutex, NULL);
   mt_pthread_cond_wait_init(&ctx->block_wake_cond);
   ctx->block_timeout_ns = NS_PER_S; /* default to 1s */
+  rte_atomic32_set(&ctx->block_waiters, 0);
   if (ops->flags & ST22P_TX_FLAG_BLOCK_GET) ctx->block_get = true;
 
   /* copy ops */
@@ -881,6 +891,13 @@ st22p_tx_handle st22p_tx_create(mtl_handle mt, struct st22p_tx_ops* ops) {
     return NULL;
   }
 
+  ret = tx_st22p_init_rings(ctx);
+  if (ret < 0) {
+    err("%s(%d), init rings fail %d\n", __func__, idx, ret);
+    st22p_tx_free(ctx);
+    return NULL;
+  }
+
   /* crete transport handle */
   ret = tx_st22p_create_transport(impl, ctx, ops);
   if (ret < 0) {
@@ -925,9 +942,9 @@ int st22p_tx_free(st22p_tx_handle handle) {
     st22_tx_free(ctx->transport);
     ctx->transport = NULL;
   }
+  tx_st22p_uinit_rings(ctx);
   tx_st22p_uinit_src_fbs(ctx);
 
-  mt_pthread_mutex_destroy(&ctx->lock);
   mt_pthread_mutex_destroy(&ctx->block_wake_mutex);
   mt_pthread_cond_destroy(&ctx->block_wake_cond);
   mt_pthread_mutex_destroy(&ctx->encode_block_wake_mutex);
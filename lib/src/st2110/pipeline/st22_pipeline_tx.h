@@ -8,6 +8,8 @@
 #include "../st_main.h"
 #include "st_plugin.h"
 
+#define ST22P_TX_PREFIX "T22P_"
+
 enum st22p_tx_frame_status {
   ST22P_TX_FRAME_FREE = 0,
   ST22P_TX_FRAME_IN_USER,
@@ -38,17 +40,16 @@ struct st22p_tx_ctx {
 
   st22_tx_handle transport;
   uint16_t framebuff_cnt;
-  uint16_t framebuff_producer_idx;
-  uint16_t framebuff_encode_idx;
-  uint16_t framebuff_consumer_idx;
   struct st22p_tx_frame* framebuffs;
-  pthread_mutex_t lock; /* protect framebuffs */
+  /* lock-free fifo of the frames for free, ready and encoded, NULL for others */
+  struct rte_ring* frame_rings[ST22P_TX_FRAME_STATUS_MAX];
 
   /* for ST22P_TX_FLAG_BLOCK_GET */
   bool block_get;
   pthread_cond_t block_wake_cond;
   pthread_mutex_t block_wake_mutex;
   uint64_t block_timeout_ns;
+  rte_atomic32_t block_waiters; /* the wake skips the cond signal if no waiter */
 
   struct st22_encode_session_impl* encode_impl;
   /* for ST22_ENCODER_RESP_FLAG_BLOCK_GET */
@@ -56,6 +57,7 @@ struct st22p_tx_ctx {
   pthread_cond_t encode_block_wake_cond;
   pthread_mutex_t encode_block_wake_mutex;
   uint64_t encode_block_timeout_ns;
+  rte_atomic32_t encode_block_waiters;
 
   bool ready;
   bool derive; /* input_fmt == transport_fmt */
@@ -67,9 +69,9 @@ struct st22p_tx_ctx {
 
   rte_atomic32_t stat_encode_fail;
   /* get frame stat */
-  int stat_get_frame_try;
-  int stat_get_frame_succ;
-  int stat_put_frame;
+  rte_atomic32_t stat_get_frame_try;
+  rte_atomic32_t stat_get_frame_succ;
+  rte_atomic32_t stat_put_frame;
   /* get frame stat */
   int stat_encode_get_frame_try;
   int stat_encode_get_frame_succ;
@@ -17,15 +17,10 @@ static const char* rx_st30p_stat_name(enum st30p_rx_frame_status stat) {
   return st30p_rx_frame_stat_name[stat];
 }
 
-static uint16_t rx_st30p_next_idx(struct st30p_rx_ctx* ctx, uint16_t idx) {
-  /* point to next */
-  uint16_t next_idx = idx;
-  next_idx++;
-  if (next_idx >= ctx->framebuff_cnt) next_idx = 0;
-  return next_idx;
-}
-
 static void rx_st30p_block_wake(struct st30p_rx_ctx* ctx) {
+  /* the frame enqueued before is seen by the waiter if we see no waiter */
+  rte_smp_mb();
+  if (!rte_atomic32_read(&ctx->block_waiters)) return;
   /* notify block */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
   mt_pthread_cond_signal(&ctx->block_wake_cond);
@@ -44,26 +39,21 @@ static void rx_st30p_notify_frame_available(struct st30p_rx_ctx* ctx) {
 }
 
 static struct st30p_rx_frame* rx_st30p_next_available(
-    struct st30p_rx_ctx* ctx, uint16_t idx_start, enum st30p_rx_frame_status desired) {
-  uint16_t idx = idx_start;
+    struct st30p_rx_ctx* ctx, enum st30p_rx_frame_status desired) {
   struct st30p_rx_frame* framebuff;
 
-  /* check ready frame from idx_start */
-  while (1) {
-    framebuff = &ctx->framebuffs[idx];
-    if (desired == framebuff->stat) {
-      /* find one desired */
-      return framebuff;
-    }
-    idx = rx_st30p_next_idx(ctx, idx);
-    if (idx == idx_start) {
-      /* loop all frames end */
-      break;
-    }
-  }
+  /* the oldest one in the desired status */
+  if (rte_ring_dequeue(ctx->frame_rings[desired], (void**)&framebuff) < 0) return NULL;
 
-  /* no any desired frame */
-  return NULL;
+  return framebuff;
+}
+
+static void rx_st30p_set_stat(struct st30p_rx_ctx* ctx, struct st30p_rx_frame* framebuff,
+                              enum st30p_rx_frame_status stat) {
+  /* set before the enqueue, the frame may be taken by others just after */
+  framebuff->stat = stat;
+  /* the ring has room for all frames, never full */
+  if (ctx->frame_rings[stat]) rte_ring_enqueue(ctx->frame_rings[stat], framebuff);
 }
 
 static int rx_st30p_frame_ready(void* priv, void* addr, struct st30_rx_frame_meta* meta) {
@@ -72,14 +62,11 @@ static int rx_st30p_frame_ready(void* priv, void* addr, struct st30_rx_frame_met
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      rx_st30p_next_available(ctx, ctx->framebuff_producer_idx, ST30P_RX_FRAME_FREE);
+  framebuff = rx_st30p_next_available(ctx, ST30P_RX_FRAME_FREE);
 
   /* not any free frame */
   if (!framebuff) {
     ctx->stat_busy++;
-    mt_pthread_mutex_unlock(&ctx->lock);
     return -EBUSY;
   }
 
@@ -89,10 +76,7 @@ static int rx_st30p_frame_ready(void* priv, void* addr, struct st30_rx_frame_met
   frame->tfmt = meta->tfmt;
   frame->timestamp = meta->timestamp;
   frame->rtp_timestamp = meta->rtp_timestamp;
-  framebuff->stat = ST30P_RX_FRAME_READY;
-  /* point to next */
-  ctx->framebuff_producer_idx = rx_st30p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  rx_st30p_set_stat(ctx, framebuff, ST30P_RX_FRAME_READY);
 
   dbg("%s(%d), frame %u(%p) succ\n", __func__, ctx->idx, framebuff->idx, frame->addr);
   /* notify app to a ready frame */
@@ -191,23 +175,62 @@ static int rx_st30p_init_fbs(struct st30p_rx_ctx* ctx, struct st30p_rx_ops* ops)
   return 0;
 }
 
+static int rx_st30p_init_ring(struct st30p_rx_ctx* ctx, enum st30p_rx_frame_status stat,
+                              unsigned int flags) {
+  char ring_name[32];
+  struct rte_ring* ring;
+
+  snprintf(ring_name, sizeof(ring_name), "%sS%d_%s", ST30P_RX_PREFIX, ctx->idx,
+           rx_st30p_stat_name(stat));
+  ring = rte_ring_create(ring_name, ctx->framebuff_cnt, ctx->socket_id,
+                         flags | RING_F_EXACT_SZ);
+  if (!ring) {
+    err("%s(%d), rte_ring_create %s fail\n", __func__, ctx->idx, ring_name);
+    return -ENOMEM;
+  }
+  ctx->frame_rings[stat] = ring;
+  return 0;
+}
+
+static int rx_st30p_uinit_rings(struct st30p_rx_ctx* ctx) {
+  for (int stat = 0; stat < ST30P_RX_FRAME_STATUS_MAX; stat++) {
+    if (ctx->frame_rings[stat]) {
+      rte_ring_free(ctx->frame_rings[stat]);
+      ctx->frame_rings[stat] = NULL;
+    }
+  }
+
+  return 0;
+}
+
+static int rx_st30p_init_rings(struct st30p_rx_ctx* ctx) {
+  int ret;
+
+  /* only the transport tasklet gets the free frames and puts the ready frames */
+  ret = rx_st30p_init_ring(ctx, ST30P_RX_FRAME_FREE, RING_F_SC_DEQ);
+  if (ret < 0) return ret;
+  ret = rx_st30p_init_ring(ctx, ST30P_RX_FRAME_READY, RING_F_SP_ENQ);
+  if (ret < 0) return ret;
+
+  for (uint16_t i = 0; i < ctx->framebuff_cnt; i++)
+    rx_st30p_set_stat(ctx, &ctx->framebuffs[i], ST30P_RX_FRAME_FREE);
+
+  return 0;
+}
+
 static int rx_st30p_stat(void* priv) {
   struct st30p_rx_ctx* ctx = priv;
-  struct st30p_rx_frame* framebuff = ctx->framebuffs;
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  uint16_t producer_idx = ctx->framebuff_producer_idx;
-  uint16_t consumer_idx = ctx->framebuff_consumer_idx;
-  notice("RX_st30p(%d,%s), p(%d:%s) c(%d:%s)\n", ctx->idx, ctx->ops_name, producer_idx,
-         rx_st30p_stat_name(framebuff[producer_idx].stat), consumer_idx,
-         rx_st30p_stat_name(framebuff[consumer_idx].stat));
+  notice("RX_st30p(%d,%s), free %u ready %u\n", ctx->idx, ctx->ops_name,
+         rte_ring_count(ctx->frame_rings[ST30P_RX_FRAME_FREE]),
+         rte_ring_count(ctx->frame_rings[ST30P_RX_FRAME_READY]));
 
   notice("RX_st30p(%d), frame get try %d succ %d, put %d\n", ctx->idx,
-         ctx->stat_get_frame_try, ctx->stat_get_frame_succ, ctx->stat_put_frame);
-  ctx->stat_get_frame_try = 0;
-  ctx->stat_get_frame_succ = 0;
-  ctx->stat_put_frame = 0;
+         mt_atomic32_read_clear(&ctx->stat_get_frame_try),
+         mt_atomic32_read_clear(&ctx->stat_get_frame_succ),
+         mt_atomic32_read_clear(&ctx->stat_put_frame));
 
   if (ctx->stat_busy) {
     warn("RX_st30p(%d), stat_busy %d in rx frame ready\n", ctx->idx, ctx->stat_busy);
@@ -219,11 +242,15 @@ static int rx_st30p_stat(void* priv) {
 
 static int rx_st30p_get_block_wait(struct st30p_rx_ctx* ctx) {
   dbg("%s(%d), start\n", __func__, ctx->idx);
+  rte_atomic32_inc(&ctx->block_waiters);
   /* wait on the block cond */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
-  mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
-                               ctx->block_timeout_ns);
+  /* check again as the wake skips the signal if it sees no waiter */
+  if (rte_ring_empty(ctx->frame_rings[ST30P_RX_FRAME_READY]))
+    mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
+                                 ctx->block_timeout_ns);
   mt_pthread_mutex_unlock(&ctx->block_wake_mutex);
+  rte_atomic32_dec(&ctx->block_waiters);
   dbg("%s(%d), end\n", __func__, ctx->idx);
   return 0;
 }
@@ -288,33 +315,21 @@ struct st30_frame* st30p_rx_get_frame(st30p_rx_handle handle) {
 
   if (!ctx->ready) return NULL; /* not ready */
 
-  ctx->stat_get_frame_try++;
-
-  mt_pthread_mutex_lock(&ctx->lock);
+  rte_atomic32_inc(&ctx->stat_get_frame_try);
 
-  framebuff =
-      rx_st30p_next_available(ctx, ctx->framebuff_consumer_idx, ST30P_RX_FRAME_READY);
+  framebuff = rx_st30p_next_available(ctx, ST30P_RX_FRAME_READY);
   if (!framebuff && ctx->block_get) { /* wait here */
-    mt_pthread_mutex_unlock(&ctx->lock);
     rx_st30p_get_block_wait(ctx);
     /* get again */
-    mt_pthread_mutex_lock(&ctx->lock);
-    framebuff =
-        rx_st30p_next_available(ctx, ctx->framebuff_consumer_idx, ST30P_RX_FRAME_READY);
+    framebuff = rx_st30p_next_available(ctx, ST30P_RX_FRAME_READY);
   }
   /* not any converted frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return NULL;
-  }
+  if (!framebuff) return NULL;
 
-  framebuff->stat = ST30P_RX_FRAME_IN_USER;
-  /* point to next */
-  ctx->framebuff_consumer_idx = rx_st30p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  rx_st30p_set_stat(ctx, framebuff, ST30P_RX_FRAME_IN_USER);
 
   frame = &framebuff->frame;
-  ctx->stat_get_frame_succ++;
+  rte_atomic32_inc(&ctx->stat_get_frame_succ);
   MT_USDT_ST30P_RX_FRAME_GET(idx, framebuff->idx, frame->addr);
   dbg("%s(%d), frame %u(%p) succ\n", __func__, idx, framebuff->idx, frame->addr);
   /* check if dump USDT enabled */
@@ -345,8 +360,8 @@ int st30p_rx_put_frame(st30p_rx_handle handle, struct st30_frame* frame) {
 
   /* free the frame */
   st30_rx_put_framebuff(ctx->transport, frame->addr);
-  framebuff->stat = ST30P_RX_FRAME_FREE;
-  ctx->stat_put_frame++;
+  rx_st30p_set_stat(ctx, framebuff, ST30P_RX_FRAME_FREE);
+  rte_atomic32_inc(&ctx->stat_put_frame);
 
   MT_USDT_ST30P_RX_FRAME_PUT(idx, framebuff->idx, frame->addr);
   dbg("%s(%d), frame %u(%p) succ\n", __func__, idx, consumer_idx, frame->addr);
@@ -372,10 +387,10 @@ int st30p_rx_free(st30p_rx_handle handle) {
     st30_rx_free(ctx->transport);
     ctx->transport = NULL;
   }
+  rx_st30p_uinit_rings(ctx);
   rx_st30p_uinit_fbs(ctx);
   rx_st30p_usdt_dump_close(ctx);
 
-  mt_pthread_mutex_destroy(&ctx->lock);
   mt_pthread_mutex_destroy(&ctx->block_wake_mutex);
   mt_pthread_cond_destroy(&ctx->block_wake_cond);
   notice("%s(%d), succ\n", __func__, ctx->idx);
@@ -426,10 +441,10 @@ st30p_rx_handle st30p_rx_create(mtl_handle mt, struct st30p_rx_ops* ops) {
   ctx->type = MT_ST30_HANDLE_PIPELINE_RX;
   ctx->usdt_dump_fd = -1;
 
-  mt_pthread_mutex_init(&ctx->lock, NULL);
   mt_pthread_mutex_init(&ctx->block_wake_mutex, NULL);
   mt_pthread_cond_wait_init(&ctx->block_wake_cond);
   ctx->block_timeout_ns = NS_PER_S;
+  rte_atomic32_set(&ctx->block_waiters, 0);
   if (ops->flags & ST30P_RX_FLAG_BLOCK_GET) ctx->block_get = true;
 
   /* copy ops */
@@ -449,6 +464,13 @@ st30p_rx_handle st30p_rx_create(mtl_handle mt, struct st30p_rx_ops* ops) {
     return NULL;
   }
 
+  ret = rx_st30p_init_rings(ctx);
+  if (ret < 0) {
+    err("%s(%d), init rings fail %d\n", __func__, idx, ret);
+    st30p_rx_free(ctx);
+    return NULL;
+  }
+
   /* crete transport handle */
   ret = rx_st30p_create_transport(impl, ctx, ops);
   if (ret < 0) {
@@ -8,6 +8,8 @@
 #include "../st_main.h"
 #include "st30_pipeline_api.h"
 
+#define ST30P_RX_PREFIX "R30P_"
+
 enum st30p_rx_frame_status {
   ST30P_RX_FRAME_FREE = 0,
   ST30P_RX_FRAME_READY,   /* get from transport */
@@ -32,10 +34,9 @@ struct st30p_rx_ctx {
 
   st30_rx_handle transport;
   uint16_t framebuff_cnt;
-  uint16_t framebuff_producer_idx;
-  uint16_t framebuff_consumer_idx;
   struct st30p_rx_frame* framebuffs;
-  pthread_mutex_t lock;
+  /* lock-free fifo of the frames for free and ready, NULL for others */
+  struct rte_ring* frame_rings[ST30P_RX_FRAME_STATUS_MAX];
   bool ready;
 
   /* usdt dump */
@@ -49,11 +50,12 @@ struct st30p_rx_ctx {
   pthread_cond_t block_wake_cond;
   pthread_mutex_t block_wake_mutex;
   uint64_t block_timeout_ns;
+  rte_atomic32_t block_waiters; /* the wake skips the cond signal if no waiter */
 
   /* get frame stat */
-  int stat_get_frame_try;
-  int stat_get_frame_succ;
-  int stat_put_frame;
+  rte_atomic32_t stat_get_frame_try;
+  rte_atomic32_t stat_get_frame_succ;
+  rte_atomic32_t stat_put_frame;
   int stat_busy;
 };
 
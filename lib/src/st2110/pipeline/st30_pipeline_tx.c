@@ -18,15 +18,10 @@ static const char* tx_st30p_stat_name(enum st30p_tx_frame_status stat) {
   return st30p_tx_frame_stat_name[stat];
 }
 
-static uint16_t tx_st30p_next_idx(struct st30p_tx_ctx* ctx, uint16_t idx) {
-  /* point to next */
-  uint16_t next_idx = idx;
-  next_idx++;
-  if (next_idx >= ctx->framebuff_cnt) next_idx = 0;
-  return next_idx;
-}
-
 static void tx_st30p_block_wake(struct st30p_tx_ctx* ctx) {
+  /* the frame enqueued before is seen by the waiter if we see no waiter */
+  rte_smp_mb();
+  if (!rte_atomic32_read(&ctx->block_waiters)) return;
   /* notify block */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
   mt_pthread_cond_signal(&ctx->block_wake_cond);
@@ -45,26 +40,21 @@ static void tx_st30p_notify_frame_available(struct st30p_tx_ctx* ctx) {
 }
 
 static struct st30p_tx_frame* tx_st30p_next_available(
-    struct st30p_tx_ctx* ctx, uint16_t idx_start, enum st30p_tx_frame_status desired) {
-  uint16_t idx = idx_start;
+    struct st30p_tx_ctx* ctx, enum st30p_tx_frame_status desired) {
   struct st30p_tx_frame* framebuff;
 
-  /* check ready frame from idx_start */
-  while (1) {
-    framebuff = &ctx->framebuffs[idx];
-    if (desired == framebuff->stat) {
-      /* find one desired */
-      return framebuff;
-    }
-    idx = tx_st30p_next_idx(ctx, idx);
-    if (idx == idx_start) {
-      /* loop all frames end */
-      break;
-    }
-  }
+  /* the oldest one in the desired status */
+  if (rte_ring_dequeue(ctx->frame_rings[desired], (void**)&framebuff) < 0) return NULL;
+
+  return framebuff;
+}
 
-  /* no any desired frame */
-  return NULL;
+static void tx_st30p_set_stat(struct st30p_tx_ctx* ctx, struct st30p_tx_frame* framebuff,
+                              enum st30p_tx_frame_status stat) {
+  /* set before the enqueue, the frame may be taken by others just after */
+  framebuff->stat = stat;
+  /* the ring has room for all frames, never full */
+  if (ctx->frame_rings[stat]) rte_ring_enqueue(ctx->frame_rings[stat], framebuff);
 }
 
 static int tx_st30p_next_frame(void* priv, uint16_t* next_frame_idx,
@@ -75,20 +65,12 @@ static int tx_st30p_next_frame(void* priv, uint16_t* next_frame_idx,
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st30p_next_available(ctx, ctx->framebuff_consumer_idx, ST30P_TX_FRAME_READY);
+  framebuff = tx_st30p_next_available(ctx, ST30P_TX_FRAME_READY);
   /* not any converted frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return -EBUSY;
-  }
+  if (!framebuff) return -EBUSY;
 
-  framebuff->stat = ST30P_TX_FRAME_IN_TRANSMITTING;
+  tx_st30p_set_stat(ctx, framebuff, ST30P_TX_FRAME_IN_TRANSMITTING);
   *next_frame_idx = framebuff->idx;
-  /* point to next */
-  ctx->framebuff_consumer_idx = tx_st30p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
   dbg("%s(%d), frame %u succ\n", __func__, ctx->idx, framebuff->idx);
   MT_USDT_ST30P_TX_FRAME_NEXT(ctx->idx, framebuff->idx);
   return 0;
@@ -100,23 +82,22 @@ static int tx_st30p_frame_done(void* priv, uint16_t frame_idx,
   int ret;
   struct st30p_tx_frame* framebuff = &ctx->framebuffs[frame_idx];
 
-  mt_pthread_mutex_lock(&ctx->lock);
+  /* update the meta before the frame is free for the app */
+  struct st30_frame* frame = &framebuff->frame;
+  frame->tfmt = meta->tfmt;
+  frame->timestamp = meta->timestamp;
+  frame->epoch = meta->epoch;
+  frame->rtp_timestamp = meta->rtp_timestamp;
+
   if (ST30P_TX_FRAME_IN_TRANSMITTING == framebuff->stat) {
     ret = 0;
-    framebuff->stat = ST30P_TX_FRAME_FREE;
+    tx_st30p_set_stat(ctx, framebuff, ST30P_TX_FRAME_FREE);
     dbg("%s(%d), done_idx %u\n", __func__, ctx->idx, frame_idx);
   } else {
     ret = -EIO;
     err("%s(%d), err status %d for frame %u\n", __func__, ctx->idx, framebuff->stat,
         frame_idx);
   }
-  mt_pthread_mutex_unlock(&ctx->lock);
-
-  struct st30_frame* frame = &framebuff->frame;
-  frame->tfmt = meta->tfmt;
-  frame->timestamp = meta->timestamp;
-  frame->epoch = meta->epoch;
-  frame->rtp_timestamp = meta->rtp_timestamp;
 
   if (ctx->ops.notify_frame_done) { /* notify app which frame done */
     ctx->ops.notify_frame_done(ctx->ops.priv, frame);
@@ -245,34 +226,78 @@ static int tx_st30p_init_fbs(struct st30p_tx_ctx* ctx, struct st30p_tx_ops* ops)
   return 0;
 }
 
+static int tx_st30p_init_ring(struct st30p_tx_ctx* ctx, enum st30p_tx_frame_status stat,
+                              unsigned int flags) {
+  char ring_name[32];
+  struct rte_ring* ring;
+
+  snprintf(ring_name, sizeof(ring_name), "%sS%d_%s", ST30P_TX_PREFIX, ctx->idx,
+           tx_st30p_stat_name(stat));
+  ring = rte_ring_create(ring_name, ctx->framebuff_cnt, ctx->socket_id,
+                         flags | RING_F_EXACT_SZ);
+  if (!ring) {
+    err("%s(%d), rte_ring_create %s fail\n", __func__, ctx->idx, ring_name);
+    return -ENOMEM;
+  }
+  ctx->frame_rings[stat] = ring;
+  return 0;
+}
+
+static int tx_st30p_uinit_rings(struct st30p_tx_ctx* ctx) {
+  for (int stat = 0; stat < ST30P_TX_FRAME_STATUS_MAX; stat++) {
+    if (ctx->frame_rings[stat]) {
+      rte_ring_free(ctx->frame_rings[stat]);
+      ctx->frame_rings[stat] = NULL;
+    }
+  }
+
+  return 0;
+}
+
+static int tx_st30p_init_rings(struct st30p_tx_ctx* ctx) {
+  int ret;
+
+  /* only the transport tasklet puts the free frames and gets the ready frames */
+  ret = tx_st30p_init_ring(ctx, ST30P_TX_FRAME_FREE, RING_F_SP_ENQ);
+  if (ret < 0) return ret;
+  ret = tx_st30p_init_ring(ctx, ST30P_TX_FRAME_READY, RING_F_SC_DEQ);
+  if (ret < 0) return ret;
+
+  /* no transport yet, safe for the single producer */
+  for (uint16_t i = 0; i < ctx->framebuff_cnt; i++)
+    tx_st30p_set_stat(ctx, &ctx->framebuffs[i], ST30P_TX_FRAME_FREE);
+
+  return 0;
+}
+
 static int tx_st30p_stat(void* priv) {
   struct st30p_tx_ctx* ctx = priv;
-  struct st30p_tx_frame* framebuff = ctx->framebuffs;
 
   if (!ctx->ready) return -EBUSY; /* not ready */
 
-  uint16_t producer_idx = ctx->framebuff_producer_idx;
-  uint16_t consumer_idx = ctx->framebuff_consumer_idx;
-  notice("TX_st30p(%d,%s), p(%d:%s) c(%d:%s)\n", ctx->idx, ctx->ops_name, producer_idx,
-         tx_st30p_stat_name(framebuff[producer_idx].stat), consumer_idx,
-         tx_st30p_stat_name(framebuff[consumer_idx].stat));
+  notice("TX_st30p(%d,%s), free %u ready %u\n", ctx->idx, ctx->ops_name,
+         rte_ring_count(ctx->frame_rings[ST30P_TX_FRAME_FREE]),
+         rte_ring_count(ctx->frame_rings[ST30P_TX_FRAME_READY]));
 
   notice("TX_st30p(%d), frame get try %d succ %d, put %d\n", ctx->idx,
-         ctx->stat_get_frame_try, ctx->stat_get_frame_succ, ctx->stat_put_frame);
-  ctx->stat_get_frame_try = 0;
-  ctx->stat_get_frame_succ = 0;
-  ctx->stat_put_frame = 0;
+         mt_atomic32_read_clear(&ctx->stat_get_frame_try),
+         mt_atomic32_read_clear(&ctx->stat_get_frame_succ),
+         mt_atomic32_read_clear(&ctx->stat_put_frame));
 
   return 0;
 }
 
 static int tx_st30p_get_block_wait(struct st30p_tx_ctx* ctx) {
   dbg("%s(%d), start\n", __func__, ctx->idx);
+  rte_atomic32_inc(&ctx->block_waiters);
   /* wait on the block cond */
   mt_pthread_mutex_lock(&ctx->block_wake_mutex);
-  mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
-                               ctx->block_timeout_ns);
+  /* check again as the wake skips the signal if it sees no waiter */
+  if (rte_ring_empty(ctx->frame_rings[ST30P_TX_FRAME_FREE]))
+    mt_pthread_cond_timedwait_ns(&ctx->block_wake_cond, &ctx->block_wake_mutex,
+                                 ctx->block_timeout_ns);
   mt_pthread_mutex_unlock(&ctx->block_wake_mutex);
+  rte_atomic32_dec(&ctx->block_waiters);
   dbg("%s(%d), end\n", __func__, ctx->idx);
   return 0;
 }
@@ -371,32 +396,21 @@ struct st30_frame* st30p_tx_get_frame(st30p_tx_handle handle) {
 
   if (!ctx->ready) return NULL; /* not ready */
 
-  ctx->stat_get_frame_try++;
+  rte_atomic32_inc(&ctx->stat_get_frame_try);
 
-  mt_pthread_mutex_lock(&ctx->lock);
-  framebuff =
-      tx_st30p_next_available(ctx, ctx->framebuff_producer_idx, ST30P_TX_FRAME_FREE);
+  framebuff = tx_st30p_next_available(ctx, ST30P_TX_FRAME_FREE);
   if (!framebuff && ctx->block_get) { /* wait here */
-    mt_pthread_mutex_unlock(&ctx->lock);
     tx_st30p_get_block_wait(ctx);
     /* get again */
-    mt_pthread_mutex_lock(&ctx->lock);
-    framebuff =
-        tx_st30p_next_available(ctx, ctx->framebuff_producer_idx, ST30P_TX_FRAME_FREE);
+    framebuff = tx_st30p_next_available(ctx, ST30P_TX_FRAME_FREE);
   }
   /* not any free frame */
-  if (!framebuff) {
-    mt_pthread_mutex_unlock(&ctx->lock);
-    return NULL;
-  }
+  if (!framebuff) return NULL;
 
-  framebuff->stat = ST30P_TX_FRAME_IN_USER;
-  /* point to next */
-  ctx->framebuff_producer_idx = tx_st30p_next_idx(ctx, framebuff->idx);
-  mt_pthread_mutex_unlock(&ctx->lock);
+  tx_st30p_set_stat(ctx, framebuff, ST30P_TX_FRAME_IN_USER);
 
   struct st30_frame* frame = &framebuff->frame;
-  ctx->stat_get_frame_succ++;
+  rte_atomic32_inc(&ctx->stat_get_frame_succ);
   MT_USDT_ST30P_TX_FRAME_GET(idx, framebuff->idx, frame->addr);
   dbg("%s(%d), frame %u(%p) succ\n", __func__, idx, framebuff->idx, frame->addr);
   /* check if dump USDT enabled */
@@ -425,8 +439,8 @@ int st30p_tx_put_frame(st30p_tx_handle handle, struct st30_frame* frame) {
     return -EIO;
   }
 
-  framebuff->stat = ST30P_TX_FRAME_READY;
-  ctx->stat_put_frame++;
+  tx_st30p_set_stat(ctx, framebuff, ST30P_TX_FRAME_READY);
+  rte_atomic32_inc(&ctx->stat_put_frame);
   MT_USDT_ST30P_TX_FRAME_PUT(idx, framebuff->idx, frame->addr);
   dbg("%s(%d), frame %u(%p) succ\n", __func__, idx, producer_idx, frame->addr);
   return 0;
@@ -455,11 +469,11 @@ int st30p_tx_free(st30p_tx_handle handle) {
     st30_tx_free(ctx->transport);
     ctx->transport = NULL;
   }
+  tx_st30p_uinit_rings(ctx);
   tx_st30p_uinit_fbs(ctx);
 
   tx_st30p_usdt_dump_close(ctx);
 
-  mt_pthread_mutex_destroy(&ctx->lock);
   mt_pthread_mutex_destroy(&ctx->block_wake_mutex);
   mt_pthread_cond_destroy(&ctx->block_wake_cond);
   notice("%s(%d), succ\n", __func__, ctx->idx);
@@ -509,11 +523,11 @@ st30p_tx_handle st30p_tx_create(mtl_handle mt, struct st30p_tx_ops* ops) {
   ctx->impl = impl;
   ctx->type = MT_ST30_HANDLE_PIPELINE_TX;
   ctx->usdt_dump_fd = -1;
-  mt_pthread_mutex_init(&ctx->lock, NULL);
 
   mt_pthread_mutex_init(&ctx->block_wake_mutex, NULL);
   mt_pthread_cond_wait_init(&ctx->block_wake_cond);
   ctx->block_timeout_ns = NS_PER_S;
+  rte_atomic32_set(&ctx->block_waiters, 0);
   if (ops->flags & ST30P_TX_FLAG_BLOCK_GET) {
     ctx->block_get = true;
   }
@@ -535,6 +549,13 @@ st30p_tx_handle st30p_tx_create(mtl_handle mt, struct st30p_tx_ops* ops) {
     return NULL;
   }
 
+  ret = tx_st30p_init_rings(ctx);
+  if (ret < 0) {
+    err("%s(%d), init rings fail %d\n", __func__, idx, ret);
+    st30p_tx_free(ctx);
+    return NULL;
+  }
+
   /* crete transport handle */
   ret = tx_st30p_create_transport(impl, ctx, ops);
   if (ret < 0) {
@@ -0,0 +1,255 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2024 Intel Corporation
+ */
+
+#include "st_convert_pool.h"
+
+#include "../../mt_log.h"
+
+static int cvt_worker_func(void* args) {
+  struct st_convert_worker* w = args;
+  struct st_convert_pool* pool = w->parent;
+
+  uint64_t idle_start = mt_get_tsc(pool->parent);
+
+  info("%s(%s,%d), start on lcore %u\n", __func__, pool->name, w->idx, w->lcore);
+  while (rte_atomic32_read(&w->active)) {
+    int32_t seq = rte_atomic32_read(&w->job_seq);
+    if (seq == rte_atomic32_read(&w->done_seq)) {
+      /* spin for the bands of a busy session, back off to sleep when idle */
+      if ((mt_get_tsc(pool->parent) - idle_start) >
+          ST_CONVERT_POOL_IDLE_SPIN_US * NS_PER_US) {
+        mt_sleep_us(ST_CONVERT_POOL_IDLE_SLEEP_US);
+        w->stat_sleeps++;
+      } else {
+        rte_pause();
+      }
+      continue;
+    }
+
+    rte_smp_rmb(); /* the band is ready before the seq */
+    uint64_t start = mt_get_tsc(pool->parent);
+    w->result = st_frame_converter_convert(pool->converter, &w->src, &w->dst);
+    w->stat_busy_ns += mt_get_tsc(pool->parent) - start;
+    w->stat_bands++;
+    w->stat_lines += w->dst.height;
+    if (w->result < 0) w->stat_fail++;
+    rte_smp_wmb(); /* the result is ready before the seq */
+    rte_atomic32_set(&w->done_seq, seq);
+    idle_start = mt_get_tsc(pool->parent);
+  }
+
+  rte_atomic32_set(&w->stopped, 1);
+  info("%s(%s,%d), end\n", __func__, pool->name, w->idx);
+  return 0;
+}
+
+static int cvt_worker_uinit(struct st_convert_pool* pool, struct st_convert_worker* w) {
+  if (rte_atomic32_read(&w->active)) {
+    rte_atomic32_set(&w->active, 0);
+    while (rte_atomic32_read(&w->stopped) == 0) {
+      mt_sleep_ms(1);
+    }
+  }
+
+  if (w->has_lcore) {
+    rte_eal_wait_lcore(w->lcore);
+    mt_sch_put_lcore(pool->parent, w->lcore);
+    w->has_lcore = false;
+  }
+
+  return 0;
+}
+
+static int cvt_worker_init(struct st_convert_pool* pool, struct st_convert_worker* w) {
+  struct mtl_main_impl* impl = pool->parent;
+  int ret;
+
+  ret = mt_sch_get_lcore(impl, &w->lcore, MT_LCORE_TYPE_CONVERT, pool->socket_id);
+  if (ret < 0) {
+    err("%s(%s,%d), get lcore fail %d\n", __func__, pool->name, w->idx, ret);
+    return ret;
+  }
+  w->has_lcore = true;
+
+  rte_atomic32_set(&w->active, 1);
+  ret = rte_eal_remote_launch(cvt_worker_func, w, w->lcore);
+  if (ret < 0) {
+    err("%s(%s,%d), launch lcore fail %d\n", __func__, pool->name, w->idx, ret);
+    rte_atomic32_set(&w->active, 0);
+    cvt_worker_uinit(pool, w);
+    return ret;
+  }
+
+  return 0;
+}
+
+/* the lines shift of the plane to the frame lines */
+static inline int cvt_plane_lines_shift(enum st_frame_fmt fmt, uint8_t plane) {
+  if (plane && st_frame_fmt_get_sampling(fmt) == ST_FRAME_SAMPLING_420) return 1;
+  return 0;
+}
+
+static bool cvt_band_supported(struct st_frame* src, struct st_frame* dst) {
+  /* the packed 420 fmt carry two lines in one pgroup line */
+  if (st_frame_fmt_get_sampling(src->fmt) == ST_FRAME_SAMPLING_420 &&
+      st_frame_fmt_planes(src->fmt) == 1)
+    return false;
+  if (st_frame_fmt_get_sampling(dst->fmt) == ST_FRAME_SAMPLING_420 &&
+      st_frame_fmt_planes(dst->fmt) == 1)
+    return false;
+  return true;
+}
+
+/* build the sub frame for lines [start, start + lines) */
+static void cvt_band_frame(struct st_frame* band, struct st_frame* frame, uint32_t start,
+                           uint32_t lines) {
+  uint8_t planes = st_frame_fmt_planes(frame->fmt);
+
+  *band = *frame;
+  band->height = lines;
+  band->interlaced = false; /* the data height of the band */
+  for (uint8_t plane = 0; plane < planes; plane++) {
+    int shift = cvt_plane_lines_shift(frame->fmt, plane);
+    size_t offset = frame->linesize[plane] * (start >> shift);
+    band->addr[plane] = (uint8_t*)frame->addr[plane] + offset;
+    band->iova[plane] = frame->iova[plane] + offset;
+  }
+}
+
+int st_convert_pool_convert(struct st_convert_pool* pool,
+                            struct st_frame_converter* converter, struct st_frame* src,
+                            struct st_frame* dst) {
+  int workers_cnt = pool->workers_cnt;
+  uint32_t h = st_frame_data_height(dst);
+  int bands = workers_cnt + 1; /* the caller convert the last band */
+  uint32_t band_lines = h / bands;
+  int ret = 0;
+
+  band_lines -= band_lines % ST_CONVERT_POOL_BAND_ALIGN;
+  if (!band_lines || !cvt_band_supported(src, dst)) {
+    rte_atomic32_inc(&pool->stat_fallback);
+    return st_frame_converter_convert(converter, src, dst);
+  }
+  if (!rte_atomic32_test_and_set(&pool->in_use)) {
+    /* the workers are busy with the frame of another caller */
+    rte_atomic32_inc(&pool->stat_busy);
+    return st_frame_converter_convert(converter, src, dst);
+  }
+
+  pool->converter = converter;
+  for (int i = 0; i < workers_cnt; i++) {
+    struct st_convert_worker* w = &pool->workers[i];
+    cvt_band_frame(&w->src, src, band_lines * i, band_lines);
+    cvt_band_frame(&w->dst, dst, band_lines * i, band_lines);
+    rte_smp_wmb(); /* the band is ready before the seq */
+    rte_atomic32_inc(&w->job_seq);
+  }
+
+  /* the left lines on the caller */
+  struct st_frame last_src, last_dst;
+  uint32_t last_start = band_lines * workers_cnt;
+  cvt_band_frame(&last_src, src, last_start, h - last_start);
+  cvt_band_frame(&last_dst, dst, last_start, h - last_start);
+  ret = st_frame_converter_convert(converter, &last_src, &last_dst);
+
+  /* wait all workers, the frame done in order as the caller is blocked */
+  for (int i = 0; i < workers_cnt; i++) {
+    struct st_convert_worker* w = &pool->workers[i];
+    while (rte_atomic32_read(&w->done_seq) != rte_atomic32_read(&w->job_seq)) {
+      rte_pause();
+    }
+    rte_smp_rmb();
+    if (w->result < 0) ret = w->result;
+  }
+
+  rte_atomic32_clear(&pool->in_use);
+  rte_atomic32_inc(&pool->stat_frames);
+  return ret;
+}
+
+int st_convert_pool_dump(struct st_convert_pool* pool) {
+  int frames = mt_atomic32_read_clear(&pool->stat_frames);
+  int fallback = mt_atomic32_read_clear(&pool->stat_fallback);
+  int busy = mt_atomic32_read_clear(&pool->stat_busy);
+  if (frames || fallback || busy) {
+    notice("%s(%s), frames %d fallback %d busy %d\n", __func__, pool->name, frames,
+           fallback, busy);
+  }
+
+  for (int i = 0; i < pool->workers_cnt; i++) {
+    struct st_convert_worker* w = &pool->workers[i];
+    /* snapshot, the worker keeps writing the counters */
+    uint32_t bands_total = w->stat_bands;
+    uint32_t lines_total = w->stat_lines;
+    uint32_t fail_total = w->stat_fail;
+    uint64_t busy_ns_total = w->stat_busy_ns;
+    uint32_t sleeps_total = w->stat_sleeps;
+    uint32_t bands = bands_total - w->last_bands;
+
+    if (bands) {
+      notice("%s(%s,%d), lcore %u bands %u lines %u avg %" PRIu64
+             "us fail %u sleeps %u\n",
+             __func__, pool->name, i, w->lcore, bands, lines_total - w->last_lines,
+             (busy_ns_total - w->last_busy_ns) / bands / NS_PER_US,
+             fail_total - w->last_fail, sleeps_total - w->last_sleeps);
+    }
+    w->last_bands = bands_total;
+    w->last_lines = lines_total;
+    w->last_fail = fail_total;
+    w->last_busy_ns = busy_ns_total;
+    w->last_sleeps = sleeps_total;
+  }
+
+  return 0;
+}
+
+int st_convert_pool_free(struct st_convert_pool* pool) {
+  for (int i = 0; i < pool->workers_cnt; i++) {
+    cvt_worker_uinit(pool, &pool->workers[i]);
+  }
+  mt_rte_free(pool);
+  return 0;
+}
+
+struct st_convert_pool* st_convert_pool_create(struct mtl_main_impl* impl,
+                                               const char* name, int workers,
+                                               int socket_id) {
+  struct st_convert_pool* pool;
+  int ret;
+
+  if (workers < 1 || workers > ST_CONVERT_POOL_WORKERS_MAX) {
+    err("%s(%s), invalid workers %d, max %d\n", __func__, name, workers,
+        ST_CONVERT_POOL_WORKERS_MAX);
+    return NULL;
+  }
+
+  pool = mt_rte_zmalloc_socket(sizeof(*pool), socket_id);
+  if (!pool) {
+    err("%s(%s), pool malloc fail\n", __func__, name);
+    return NULL;
+  }
+  pool->parent = impl;
+  pool->socket_id = socket_id;
+  rte_atomic32_set(&pool->in_use, 0);
+  rte_atomic32_set(&pool->stat_frames, 0);
+  rte_atomic32_set(&pool->stat_fallback, 0);
+  rte_atomic32_set(&pool->stat_busy, 0);
+  snprintf(pool->name, sizeof(pool->name), "%s", name);
+
+  for (int i = 0; i < workers; i++) {
+    struct st_convert_worker* w = &pool->workers[i];
+    w->parent = pool;
+    w->idx = i;
+    ret = cvt_worker_init(pool, w);
+    if (ret < 0) {
+      err("%s(%s), worker %d init fail %d\n", __func__, name, i, ret);
+      st_convert_pool_free(pool);
+      return NULL;
+    }
+    pool->workers_cnt++;
+  }
+
+  info("%s(%s), %d workers\n", __func__, name, workers);
+  return pool;
+}
@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2024 Intel Corporation
+ */
+
+#ifndef _ST_LIB_PIPELINE_CONVERT_POOL_HEAD_H_
+#define _ST_LIB_PIPELINE_CONVERT_POOL_HEAD_H_
+
+#include "../st_main.h"
+
+#define ST_CONVERT_POOL_WORKERS_MAX (16)
+/* min lines for one band, also the band alignment */
+#define ST_CONVERT_POOL_BAND_ALIGN (2)
+/* the worker sleeps between the job checks once idle for this time */
+#define ST_CONVERT_POOL_IDLE_SPIN_US (1000)
+#define ST_CONVERT_POOL_IDLE_SLEEP_US (50)
+
+struct st_convert_pool;
+
+struct st_convert_worker {
+  struct st_convert_pool* parent;
+  int idx;
+  unsigned int lcore;
+  bool has_lcore;
+  rte_atomic32_t active;
+  rte_atomic32_t stopped;
+
+  /* the band to convert, valid once job_seq != done_seq */
+  struct st_frame src;
+  struct st_frame dst;
+  int result;
+  rte_atomic32_t job_seq;  /* increased by the caller to post one band */
+  rte_atomic32_t done_seq; /* updated by the worker after the band is done */
+
+  /* only written by the worker, never reset, the dump prints the delta to last_* */
+  uint32_t stat_bands;
+  uint32_t stat_lines;
+  uint32_t stat_fail;
+  uint64_t stat_busy_ns;
+  uint32_t stat_sleeps;
+  /* the snapshot of the last dump, only touched by the stat thread */
+  uint32_t last_bands;
+  uint32_t last_lines;
+  uint32_t last_fail;
+  uint64_t last_busy_ns;
+  uint32_t last_sleeps;
+};
+
+/* split the convert of one frame into line bands on pinned lcores */
+struct st_convert_pool {
+  struct mtl_main_impl* parent;
+  char name[ST_MAX_NAME_LEN];
+  int socket_id;
+  struct st_frame_converter* converter; /* the converter for current frame */
+
+  int workers_cnt;
+  struct st_convert_worker workers[ST_CONVERT_POOL_WORKERS_MAX];
+  /* one frame on the workers at a time, others are converted by the caller only */
+  rte_atomic32_t in_use;
+
+  rte_atomic32_t stat_frames;
+  rte_atomic32_t stat_fallback; /* converted by the caller only */
+  rte_atomic32_t stat_busy;     /* the pool was in use by another caller */
+};
+
+struct st_convert_pool* st_convert_pool_create(struct mtl_main_impl* impl,
+                                               const char* name, int workers,
+                                               int socket_id);
+int st_convert_pool_free(struct st_convert_pool* pool);
+/*
+ * Convert the frame with all workers and the caller, return after all bands done.
+ * The workers take one frame at a time. A call made while another one is on the
+ * workers is not queued, it converts the whole frame on its own caller thread.
+ */
+int st_convert_pool_convert(struct st_convert_pool* pool,
+                            struct st_frame_converter* converter, struct st_frame* src,
+                            struct st_frame* dst);
+int st_convert_pool_dump(struct st_convert_pool* pool);
+
+#endif
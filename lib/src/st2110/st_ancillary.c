@@ -3,6 +3,15 @@
  */
 
 #include "../mt_log.h"
+#include "st_main.h"
+
+#ifdef MTL_HAS_AVX2
+#include "st_avx2.h"
+#endif
+
+#ifdef MTL_HAS_AVX512
+#include "st_avx512.h"
+#endif
 
 typedef union anc_udw_10_6e {
   struct {
@@ -173,9 +182,161 @@ void st40_set_udw(uint32_t idx, uint16_t udw, uint8_t* data) {
   set_10bit_udw(idx, udw, data);
 }
 
-uint16_t st40_calc_checksum(uint32_t data_num, uint8_t* data) {
+/* every 4 udws occupy 5 bytes, the simd path start from a byte aligned udw */
+static inline bool udw_byte_aligned(uint32_t idx) {
+  return !(idx & 0x3);
+}
+
+static inline uint8_t* udw_byte_addr(uint32_t idx, uint8_t* data) {
+  return data + idx * 10 / 8;
+}
+
+static uint32_t udws_unpack_simd(uint8_t* data, uint16_t* udws, uint32_t num,
+                                 enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  uint32_t done = 0;
+
+  MTL_MAY_UNUSED(cpu_level);
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    done = st40_udws_unpack_avx512(data, udws, num);
+    if (done == num) return done;
+    data += done * 10 / 8;
+    udws += done;
+    num -= done;
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    done += st40_udws_unpack_avx2(data, udws, num);
+  }
+#endif
+
+  return done;
+}
+
+static uint32_t udws_pack_simd(const uint16_t* udws, const uint8_t* words, uint8_t* data,
+                               uint32_t num, enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  uint32_t done = 0, cur;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(cur);
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    if (words)
+      cur = st40_udws_pack_parity_avx512(words, data, num);
+    else
+      cur = st40_udws_pack_avx512(udws, data, num);
+    done += cur;
+    if (done == num) return done;
+    data += cur * 10 / 8;
+    if (words)
+      words += cur;
+    else
+      udws += cur;
+    num -= cur;
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    if (words)
+      done += st40_udws_pack_parity_avx2(words, data, num);
+    else
+      done += st40_udws_pack_avx2(udws, data, num);
+  }
+#endif
+
+  return done;
+}
+
+static uint32_t udws_sum_simd(uint8_t* data, uint32_t num, uint16_t* sum,
+                              enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  uint32_t done = 0;
+  uint16_t cur_sum = 0;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(cur_sum);
+  *sum = 0;
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    done = st40_udws_sum_avx512(data, num, &cur_sum);
+    *sum += cur_sum;
+    if (done == num) return done;
+    data += done * 10 / 8;
+    num -= done;
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    done += st40_udws_sum_avx2(data, num, &cur_sum);
+    *sum += cur_sum;
+  }
+#endif
+
+  return done;
+}
+
+int st40_get_udws_simd(uint32_t idx, uint32_t num, uint8_t* data, uint16_t* udws,
+                       enum mtl_simd_level level) {
+  uint32_t i = 0;
+
+  /* head until byte aligned */
+  for (; (i < num) && !udw_byte_aligned(idx + i); i++)
+    udws[i] = get_10bit_udw(idx + i, data);
+  if (i < num)
+    i += udws_unpack_simd(udw_byte_addr(idx + i, data), udws + i, num - i, level);
+  /* the tail */
+  for (; i < num; i++) udws[i] = get_10bit_udw(idx + i, data);
+
+  return 0;
+}
+
+int st40_set_udws_simd(uint32_t idx, uint32_t num, uint16_t* udws, uint8_t* data,
+                       enum mtl_simd_level level) {
+  uint32_t i = 0;
+
+  for (; (i < num) && !udw_byte_aligned(idx + i); i++)
+    set_10bit_udw(idx + i, udws[i], data);
+  if (i < num)
+    i += udws_pack_simd(udws + i, NULL, udw_byte_addr(idx + i, data), num - i, level);
+  for (; i < num; i++) set_10bit_udw(idx + i, udws[i], data);
+
+  return 0;
+}
+
+int st40_set_udws_parity_simd(uint32_t idx, uint32_t num, uint8_t* words, uint8_t* data,
+                              enum mtl_simd_level level) {
+  uint32_t i = 0;
+
+  for (; (i < num) && !udw_byte_aligned(idx + i); i++)
+    set_10bit_udw(idx + i, st40_add_parity_bits(words[i]), data);
+  if (i < num)
+    i += udws_pack_simd(NULL, words + i, udw_byte_addr(idx + i, data), num - i, level);
+  for (; i < num; i++) set_10bit_udw(idx + i, st40_add_parity_bits(words[i]), data);
+
+  return 0;
+}
+
+uint16_t st40_calc_checksum_simd(uint32_t data_num, uint8_t* data,
+                                 enum mtl_simd_level level) {
   uint16_t chks = 0, udw;
-  for (uint32_t i = 0; i < data_num; i++) {
+  uint32_t i = udws_sum_simd(data, data_num, &chks, level);
+
+  for (; i < data_num; i++) {
     udw = get_10bit_udw(i, data);
     chks += udw;
   }
@@ -185,6 +346,10 @@ uint16_t st40_calc_checksum(uint32_t data_num, uint8_t* data) {
   return chks;
 }
 
+uint16_t st40_calc_checksum(uint32_t data_num, uint8_t* data) {
+  return st40_calc_checksum_simd(data_num, data, MTL_SIMD_LEVEL_MAX);
+}
+
 uint16_t st40_add_parity_bits(uint16_t val) {
   return get_parity_bits(val) | (val & 0xFF);
 }
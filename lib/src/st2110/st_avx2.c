@@ -9,6 +9,214 @@
 
 #ifdef MTL_HAS_AVX2
 MT_TARGET_CODE_START_AVX2
+/* begin rfc4175 sample helpers, each 128 bit lane handle 8 samples in 16 bits */
+static uint8_t be10_unpack_shuffle_tbl[16] = {
+    1, 0, 2, 1, 3, 2, 4, 3, /* sample 0 ~ 3 from byte 0 ~ 4 */
+    6, 5, 7, 6, 8, 7, 9, 8, /* sample 4 ~ 7 from byte 5 ~ 9 */
+};
+
+/* shift left by the bit offset of the sample inside the 16 bits */
+static uint16_t be10_unpack_mul_tbl[8] = {1, 4, 16, 64, 1, 4, 16, 64};
+
+static uint8_t be10_pack_hi_shuffle_tbl[16] = {
+    1, 3, 5, 7, 0x80, 9, 11, 13, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+static uint8_t be10_pack_lo_shuffle_tbl[16] = {
+    0x80, 0, 2, 4, 6, 0x80, 8, 10, 12, 14, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+static uint16_t be10_pack_mul_tbl[8] = {64, 16, 4, 1, 64, 16, 4, 1};
+
+static uint8_t be12_unpack_shuffle_tbl[16] = {
+    1, 0, 2, 1, 4,  3, 5,  4,  /* sample 0 ~ 3 from byte 0 ~ 5 */
+    7, 6, 8, 7, 10, 9, 11, 10, /* sample 4 ~ 7 from byte 6 ~ 11 */
+};
+
+static uint8_t le12_unpack_shuffle_tbl[16] = {
+    0, 1, 1, 2, 3, 4,  4,  5,  /* sample 0 ~ 3 from byte 0 ~ 5 */
+    6, 7, 7, 8, 9, 10, 10, 11, /* sample 4 ~ 7 from byte 6 ~ 11 */
+};
+
+static uint16_t be12_unpack_mul_tbl[8] = {1, 16, 1, 16, 1, 16, 1, 16};
+
+static uint16_t le12_unpack_mul_tbl[8] = {16, 1, 16, 1, 16, 1, 16, 1};
+
+/* the 24 bits of two samples in each 32 bits */
+static uint8_t be12_pack_shuffle_tbl[16] = {
+    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 0x80, 0x80, 0x80, 0x80,
+};
+
+static uint8_t le12_pack_shuffle_tbl[16] = {
+    0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0x80, 0x80, 0x80, 0x80,
+};
+
+/* Cb Y0 Cr Y1 Cb Y2 Cr Y3 to Y0 Y1 Y2 Y3 Cb Cb Cr Cr */
+static uint8_t yuv422_split_shuffle_tbl[16] = {
+    2, 3, 6, 7, 10, 11, 14, 15, 0, 1, 8, 9, 4, 5, 12, 13,
+};
+
+/* Cb Cr Y0 Y1 to Cb Y0 Cr Y1 */
+static uint8_t yuv422_merge_shuffle_tbl[16] = {
+    0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15,
+};
+
+/* Cb Y0 Cr Y1 to Y0 Cb Y1 Cr, also the reverse */
+static uint8_t yuv422_swap_shuffle_tbl[16] = {
+    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+};
+
+static inline __m256i broadcast_tbl_avx2(const void* tbl) {
+  return _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i*)tbl));
+}
+
+static inline __m256i unpack_16_avx2(const uint8_t* data, int lane1_offset,
+                                     const void* shuffle_tbl, const void* mul_tbl,
+                                     int shift) {
+  __m256i input = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128((__m128i*)data)),
+      _mm_loadu_si128((__m128i*)(data + lane1_offset)), 1);
+  __m256i sample = _mm256_shuffle_epi8(input, broadcast_tbl_avx2(shuffle_tbl));
+  sample = _mm256_mullo_epi16(sample, broadcast_tbl_avx2(mul_tbl));
+  return _mm256_srli_epi16(sample, shift);
+}
+
+/* the 16 samples of 20 bytes, the load touch 26 bytes */
+static inline __m256i be10_unpack_16_avx2(const uint8_t* data) {
+  return unpack_16_avx2(data, 10, be10_unpack_shuffle_tbl, be10_unpack_mul_tbl, 6);
+}
+
+/* the 16 samples of 24 bytes, the load touch 28 bytes */
+static inline __m256i be12_unpack_16_avx2(const uint8_t* data) {
+  return unpack_16_avx2(data, 12, be12_unpack_shuffle_tbl, be12_unpack_mul_tbl, 4);
+}
+
+static inline __m256i le12_unpack_16_avx2(const uint8_t* data) {
+  return unpack_16_avx2(data, 12, le12_unpack_shuffle_tbl, le12_unpack_mul_tbl, 4);
+}
+
+/* the store write 6 more bytes after the 20 bytes, caller should reserve it */
+static inline void be10_pack_16_avx2(__m256i sample, uint8_t* data) {
+  sample = _mm256_and_si256(sample, _mm256_set1_epi16(0x3ff));
+  sample = _mm256_mullo_epi16(sample, broadcast_tbl_avx2(be10_pack_mul_tbl));
+  __m256i hi = _mm256_shuffle_epi8(sample, broadcast_tbl_avx2(be10_pack_hi_shuffle_tbl));
+  __m256i lo = _mm256_shuffle_epi8(sample, broadcast_tbl_avx2(be10_pack_lo_shuffle_tbl));
+  __m256i out = _mm256_or_si256(hi, lo);
+  _mm_storeu_si128((__m128i*)data, _mm256_castsi256_si128(out));
+  _mm_storeu_si128((__m128i*)(data + 10), _mm256_extracti128_si256(out, 1));
+}
+
+/* the store write 4 more bytes after the 24 bytes, caller should reserve it */
+static inline void pack12_16_avx2(__m256i sample, uint8_t* data, int32_t madd,
+                                  const void* shuffle_tbl) {
+  sample = _mm256_and_si256(sample, _mm256_set1_epi16(0xfff));
+  sample = _mm256_madd_epi16(sample, _mm256_set1_epi32(madd));
+  __m256i out = _mm256_shuffle_epi8(sample, broadcast_tbl_avx2(shuffle_tbl));
+  _mm_storeu_si128((__m128i*)data, _mm256_castsi256_si128(out));
+  _mm_storeu_si128((__m128i*)(data + 12), _mm256_extracti128_si256(out, 1));
+}
+
+static inline void be12_pack_16_avx2(__m256i sample, uint8_t* data) {
+  pack12_16_avx2(sample, data, 0x00011000, be12_pack_shuffle_tbl);
+}
+
+static inline void le12_pack_16_avx2(__m256i sample, uint8_t* data) {
+  pack12_16_avx2(sample, data, 0x10000001, le12_pack_shuffle_tbl);
+}
+
+/* 16 samples of Cb Y0 Cr Y1 to 8 y, 4 b and 4 r */
+static inline void yuv422_split_16_avx2(__m256i sample, uint16_t* y, uint16_t* b,
+                                        uint16_t* r) {
+  sample = _mm256_shuffle_epi8(sample, broadcast_tbl_avx2(yuv422_split_shuffle_tbl));
+  sample = _mm256_permute4x64_epi64(sample, 0xD8);
+  _mm_storeu_si128((__m128i*)y, _mm256_castsi256_si128(sample));
+  __m128i cbcr = _mm_shuffle_epi32(_mm256_extracti128_si256(sample, 1), 0xD8);
+  _mm_storel_epi64((__m128i*)b, cbcr);
+  _mm_storel_epi64((__m128i*)r, _mm_unpackhi_epi64(cbcr, cbcr));
+}
+
+/* 8 y, 4 b and 4 r to 16 samples of Cb Y0 Cr Y1 */
+static inline __m256i yuv422_merge_16_avx2(uint16_t* y, uint16_t* b, uint16_t* r) {
+  __m128i y8 = _mm_loadu_si128((__m128i*)y);
+  __m128i cbcr = _mm_unpacklo_epi16(_mm_loadl_epi64((__m128i*)b),
+                                    _mm_loadl_epi64((__m128i*)r));
+  __m256i sample = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_unpacklo_epi32(cbcr, y8)), _mm_unpackhi_epi32(cbcr, y8),
+      1);
+  return _mm256_shuffle_epi8(sample, broadcast_tbl_avx2(yuv422_merge_shuffle_tbl));
+}
+/* Cb_R Y_G Cr_B of 8 pixels in each lane to the 8 samples of one component */
+static uint8_t yuv444_split_shuffle_tbl[3][16] = {
+    {0, 1, 6, 7, 12, 13, 2, 3, 8, 9, 14, 15, 4, 5, 10, 11},
+    {2, 3, 8, 9, 14, 15, 4, 5, 10, 11, 0, 1, 6, 7, 12, 13},
+    {4, 5, 10, 11, 0, 1, 6, 7, 12, 13, 2, 3, 8, 9, 14, 15},
+};
+
+/* the 8 samples of each component to Cb_R Y_G Cr_B, one table for each lane input */
+static uint8_t yuv444_merge_shuffle_tbl[3][16] = {
+    {0, 1, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3, 4, 5, 4, 5},
+    {4, 5, 6, 7, 6, 7, 6, 7, 8, 9, 8, 9, 8, 9, 10, 11},
+    {10, 11, 10, 11, 12, 13, 12, 13, 12, 13, 14, 15, 14, 15, 14, 15},
+};
+
+/* 48 samples of Cb_R Y_G Cr_B to 16 samples of each component */
+static inline void yuv444_split_48_avx2(__m256i s0, __m256i s1, __m256i s2,
+                                        uint16_t* b_r, uint16_t* y_g, uint16_t* r_b) {
+  /* each lane with the 24 samples of 8 pixels */
+  __m256i v0 = _mm256_permute2x128_si256(s0, s1, 0x30);
+  __m256i v1 = _mm256_permute2x128_si256(s0, s2, 0x21);
+  __m256i v2 = _mm256_permute2x128_si256(s1, s2, 0x30);
+  __m256i shuffle, out;
+
+  shuffle = broadcast_tbl_avx2(yuv444_split_shuffle_tbl[0]);
+  out = _mm256_blend_epi16(_mm256_shuffle_epi8(v0, shuffle),
+                           _mm256_shuffle_epi8(v1, shuffle), 0x38);
+  out = _mm256_blend_epi16(out, _mm256_shuffle_epi8(v2, shuffle), 0xC0);
+  _mm256_storeu_si256((__m256i*)b_r, out);
+
+  shuffle = broadcast_tbl_avx2(yuv444_split_shuffle_tbl[1]);
+  out = _mm256_blend_epi16(_mm256_shuffle_epi8(v0, shuffle),
+                           _mm256_shuffle_epi8(v1, shuffle), 0x18);
+  out = _mm256_blend_epi16(out, _mm256_shuffle_epi8(v2, shuffle), 0xE0);
+  _mm256_storeu_si256((__m256i*)y_g, out);
+
+  shuffle = broadcast_tbl_avx2(yuv444_split_shuffle_tbl[2]);
+  out = _mm256_blend_epi16(_mm256_shuffle_epi8(v0, shuffle),
+                           _mm256_shuffle_epi8(v1, shuffle), 0x1C);
+  out = _mm256_blend_epi16(out, _mm256_shuffle_epi8(v2, shuffle), 0xE0);
+  _mm256_storeu_si256((__m256i*)r_b, out);
+}
+
+/* 16 samples of each component to 48 samples of Cb_R Y_G Cr_B */
+static inline void yuv444_merge_48_avx2(uint16_t* b_r, uint16_t* y_g, uint16_t* r_b,
+                                        __m256i* s) {
+  __m256i c0 = _mm256_loadu_si256((__m256i*)b_r);
+  __m256i c1 = _mm256_loadu_si256((__m256i*)y_g);
+  __m256i c2 = _mm256_loadu_si256((__m256i*)r_b);
+  __m256i shuffle, v0, v1, v2;
+
+  shuffle = broadcast_tbl_avx2(yuv444_merge_shuffle_tbl[0]);
+  v0 = _mm256_blend_epi16(_mm256_shuffle_epi8(c0, shuffle),
+                          _mm256_shuffle_epi8(c1, shuffle), 0x92);
+  v0 = _mm256_blend_epi16(v0, _mm256_shuffle_epi8(c2, shuffle), 0x24);
+
+  shuffle = broadcast_tbl_avx2(yuv444_merge_shuffle_tbl[1]);
+  v1 = _mm256_blend_epi16(_mm256_shuffle_epi8(c0, shuffle),
+                          _mm256_shuffle_epi8(c1, shuffle), 0x24);
+  v1 = _mm256_blend_epi16(v1, _mm256_shuffle_epi8(c2, shuffle), 0x49);
+
+  shuffle = broadcast_tbl_avx2(yuv444_merge_shuffle_tbl[2]);
+  v2 = _mm256_blend_epi16(_mm256_shuffle_epi8(c0, shuffle),
+                          _mm256_shuffle_epi8(c1, shuffle), 0x49);
+  v2 = _mm256_blend_epi16(v2, _mm256_shuffle_epi8(c2, shuffle), 0x92);
+
+  /* each lane with the 24 samples of 8 pixels back to the 48 samples */
+  s[0] = _mm256_permute2x128_si256(v0, v1, 0x20);
+  s[1] = _mm256_permute2x128_si256(v2, v0, 0x30);
+  s[2] = _mm256_permute2x128_si256(v1, v2, 0x31);
+}
+/* end rfc4175 sample helpers */
+
 /* begin st20_rfc4175_422be10_to_422le10_avx2 */
 static uint8_t rfc4175_b2l_shuffle_l0_tbl[16] = {
     1,  0,  3,  2,    /* 4 bytes from pg0 */
@@ -215,5 +423,1140 @@ int st20_rfc4175_422le10_to_422be10_avx2(struct st20_rfc4175_422_10_pg2_le* pg_l
   return 0;
 }
 /* end st20_rfc4175_422le10_to_422be10_avx2 */
+
+/* begin st20_rfc4175_422be10_to_yuv422p10le_avx2 */
+int st20_rfc4175_422be10_to_yuv422p10le_avx2(struct st20_rfc4175_422_10_pg2_be* pg,
+                                             uint16_t* y, uint16_t* b, uint16_t* r,
+                                             uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+
+  /* 4 pgs each loop, the load touch 2 more pgs */
+  while (pg_cnt >= 6) {
+    yuv422_split_16_avx2(be10_unpack_16_avx2(be), y, b, r);
+    be += 20;
+    y += 8;
+    b += 4;
+    r += 4;
+    pg_cnt -= 4;
+  }
+
+  /* the tail with a local copy */
+  while (pg_cnt) {
+    uint32_t cnt = RTE_MIN(pg_cnt, 4);
+    uint8_t src[32] = {0};
+    uint16_t dst_y[8], dst_b[4], dst_r[4];
+
+    rte_memcpy(src, be, cnt * 5);
+    yuv422_split_16_avx2(be10_unpack_16_avx2(src), dst_y, dst_b, dst_r);
+    rte_memcpy(y, dst_y, cnt * 4);
+    rte_memcpy(b, dst_b, cnt * 2);
+    rte_memcpy(r, dst_r, cnt * 2);
+    be += cnt * 5;
+    y += cnt * 2;
+    b += cnt;
+    r += cnt;
+    pg_cnt -= cnt;
+  }
+
+  return 0;
+}
+/* end st20_rfc4175_422be10_to_yuv422p10le_avx2 */
+
+/* begin st20_yuv422p10le_to_rfc4175_422be10_avx2 */
+int st20_yuv422p10le_to_rfc4175_422be10_avx2(uint16_t* y, uint16_t* b, uint16_t* r,
+                                             struct st20_rfc4175_422_10_pg2_be* pg,
+                                             uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+
+  /* 4 pgs each loop, the store touch 2 more pgs */
+  while (pg_cnt >= 6) {
+    be10_pack_16_avx2(yuv422_merge_16_avx2(y, b, r), be);
+    be += 20;
+    y += 8;
+    b += 4;
+    r += 4;
+    pg_cnt -= 4;
+  }
+
+  while (pg_cnt) {
+    uint32_t cnt = RTE_MIN(pg_cnt, 4);
+    uint16_t src_y[8] = {0}, src_b[4] = {0}, src_r[4] = {0};
+    uint8_t dst[32];
+
+    rte_memcpy(src_y, y, cnt * 4);
+    rte_memcpy(src_b, b, cnt * 2);
+    rte_memcpy(src_r, r, cnt * 2);
+    be10_pack_16_avx2(yuv422_merge_16_avx2(src_y, src_b, src_r), dst);
+    rte_memcpy(be, dst, cnt * 5);
+    be += cnt * 5;
+    y += cnt * 2;
+    b += cnt;
+    r += cnt;
+    pg_cnt -= cnt;
+  }
+
+  return 0;
+}
+/* end st20_yuv422p10le_to_rfc4175_422be10_avx2 */
+
+/* begin st20_rfc4175_422be10_to_422le8_avx2 */
+static inline void rfc4175_422be10_to_422le8_32_avx2(uint8_t* be, uint8_t* le8) {
+  __m256i sample0 = _mm256_srli_epi16(be10_unpack_16_avx2(be), 2);
+  __m256i sample1 = _mm256_srli_epi16(be10_unpack_16_avx2(be + 20), 2);
+  __m256i result = _mm256_packus_epi16(sample0, sample1);
+  _mm256_storeu_si256((__m256i*)le8, _mm256_permute4x64_epi64(result, 0xD8));
+}
+
+int st20_rfc4175_422be10_to_422le8_avx2(struct st20_rfc4175_422_10_pg2_be* pg_10,
+                                        struct st20_rfc4175_422_8_pg2_le* pg_8,
+                                        uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg_10;
+  uint8_t* le8 = (uint8_t*)pg_8;
+  uint32_t pg_cnt = w * h / 2;
+
+  /* 8 pgs each loop, the load touch 2 more pgs */
+  while (pg_cnt >= 10) {
+    rfc4175_422be10_to_422le8_32_avx2(be, le8);
+    be += 40;
+    le8 += 32;
+    pg_cnt -= 8;
+  }
+
+  while (pg_cnt) {
+    uint32_t cnt = RTE_MIN(pg_cnt, 8);
+    uint8_t src[48] = {0};
+    uint8_t dst[32];
+
+    rte_memcpy(src, be, cnt * 5);
+    rfc4175_422be10_to_422le8_32_avx2(src, dst);
+    rte_memcpy(le8, dst, cnt * 4);
+    be += cnt * 5;
+    le8 += cnt * 4;
+    pg_cnt -= cnt;
+  }
+
+  return 0;
+}
+/* end st20_rfc4175_422be10_to_422le8_avx2 */
+
+/* begin st20_rfc4175_422be10_to_yuv422p8_avx2 */
+static uint32_t yuv422p8_split_perm_tbl[8] = {0, 2, 4, 6, 1, 3, 5, 7};
+
+/* Cb Cb Cr Cr to 4 Cb and 4 Cr */
+static uint8_t yuv422p8_cbcr_shuffle_tbl[16] = {
+    0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+};
+
+/* 16 pixels each time, skip the chroma if b is NULL */
+static inline void rfc4175_422be10_to_p8_32_avx2(uint8_t* be, uint8_t* y, uint8_t* b,
+                                                 uint8_t* r) {
+  __m256i split = broadcast_tbl_avx2(yuv422_split_shuffle_tbl);
+  __m256i sample0 = _mm256_srli_epi16(be10_unpack_16_avx2(be), 2);
+  __m256i sample1 = _mm256_srli_epi16(be10_unpack_16_avx2(be + 20), 2);
+  sample0 = _mm256_shuffle_epi8(sample0, split);
+  sample1 = _mm256_shuffle_epi8(sample1, split);
+  /* each 64 bits: 4 y, 2 b and 2 r of 4 pixels */
+  __m256i result = _mm256_packus_epi16(sample0, sample1);
+  result = _mm256_permute4x64_epi64(result, 0xD8);
+  result = _mm256_permutevar8x32_epi32(
+      result, _mm256_loadu_si256((__m256i*)yuv422p8_split_perm_tbl));
+  _mm_storeu_si128((__m128i*)y, _mm256_castsi256_si128(result));
+  if (!b) return;
+  __m128i cbcr = _mm_shuffle_epi8(_mm256_extracti128_si256(result, 1),
+                                  _mm_loadu_si128((__m128i*)yuv422p8_cbcr_shuffle_tbl));
+  _mm_storel_epi64((__m128i*)b, cbcr);
+  _mm_storel_epi64((__m128i*)r, _mm_unpackhi_epi64(cbcr, cbcr));
+}
+
+static void rfc4175_422be10_to_p8_avx2(uint8_t* be, uint8_t* y, uint8_t* b, uint8_t* r,
+                                       uint32_t pg_cnt) {
+  /* 8 pgs each loop, the load touch 2 more pgs */
+  while (pg_cnt >= 10) {
+    rfc4175_422be10_to_p8_32_avx2(be, y, b, r);
+    be += 40;
+    y += 16;
+    if (b) {
+      b += 8;
+      r += 8;
+    }
+    pg_cnt -= 8;
+  }
+
+  while (pg_cnt) {
+    uint32_t cnt = RTE_MIN(pg_cnt, 8);
+    uint8_t src[48] = {0};
+    uint8_t dst_y[16], dst_b[8], dst_r[8];
+
+    rte_memcpy(src, be, cnt * 5);
+    rfc4175_422be10_to_p8_32_avx2(src, dst_y, b ? dst_b : NULL, dst_r);
+    rte_memcpy(y, dst_y, cnt * 2);
+    if (b) {
+      rte_memcpy(b, dst_b, cnt);
+      rte_memcpy(r, dst_r, cnt);
+      b += cnt;
+      r += cnt;
+    }
+    be += cnt * 5;
+    y += cnt * 2;
+    pg_cnt -= cnt;
+  }
+}
+
+int st20_rfc4175_422be10_to_yuv422p8_avx2(struct st20_rfc4175_422_10_pg2_be* pg,
+                                          uint8_t* y, uint8_t* b, uint8_t* r, uint32_t w,
+                                          uint32_t h) {
+  rfc4175_422be10_to_p8_avx2((uint8_t*)pg, y, b, r, w * h / 2);
+  return 0;
+}
+/* end st20_rfc4175_422be10_to_yuv422p8_avx2 */
+
+/* begin st20_rfc4175_422be10_to_yuv420p8_avx2 */
+int st20_rfc4175_422be10_to_yuv420p8_avx2(struct st20_rfc4175_422_10_pg2_be* pg,
+                                          uint8_t* y, uint8_t* b, uint8_t* r, uint32_t w,
+                                          uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t line_pg_cnt = w / 2;
+
+  for (uint32_t i = 0; i < (h / 2); i++) { /* 2 lines each loop */
+    /* first line */
+    rfc4175_422be10_to_p8_avx2(be, y, b, r, line_pg_cnt);
+    be += line_pg_cnt * 5;
+    y += w;
+    b += line_pg_cnt;
+    r += line_pg_cnt;
+    /* second line, no u and v */
+    rfc4175_422be10_to_p8_avx2(be, y, NULL, NULL, line_pg_cnt);
+    be += line_pg_cnt * 5;
+    y += w;
+  }
+
+  return 0;
+}
+/* end st20_rfc4175_422be10_to_yuv420p8_avx2 */
+
+/* begin v210 avx2, each 128 bit lane of v210 has 12 samples in 4 dwords */
+/* the first two samples of each dword as 16 bits pair, then the third one */
+static uint8_t rfc4175_be10_v210_shuffle0_tbl[16] = {
+    1, 0, 2, 1, 4, 3, 6, 5, 8, 7, 9, 8, 12, 11, 13, 12,
+};
+
+static uint16_t rfc4175_be10_v210_mul0_tbl[8] = {1, 4, 64, 1, 16, 64, 4, 16};
+
+static uint8_t rfc4175_be10_v210_shuffle1_tbl[16] = {
+    3, 2, 0x80, 0x80, 7, 6, 0x80, 0x80, 11, 10, 0x80, 0x80, 14, 13, 0x80, 0x80,
+};
+
+static uint16_t rfc4175_be10_v210_mul1_tbl[8] = {16, 0, 4, 0, 1, 0, 64, 0};
+
+static uint8_t rfc4175_le10_v210_shuffle0_tbl[16] = {
+    0, 1, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 11, 12, 12, 13,
+};
+
+static uint16_t rfc4175_le10_v210_mul0_tbl[8] = {64, 16, 1, 64, 4, 1, 16, 4};
+
+static uint8_t rfc4175_le10_v210_shuffle1_tbl[16] = {
+    2, 3, 0x80, 0x80, 6, 7, 0x80, 0x80, 10, 11, 0x80, 0x80, 13, 14, 0x80, 0x80,
+};
+
+static uint16_t rfc4175_le10_v210_mul1_tbl[8] = {4, 0, 16, 0, 64, 0, 1, 0};
+
+/* 6 pgs(30 bytes) to 32 bytes v210, the load touch 31 bytes */
+static inline void rfc4175_10_to_v210_32_avx2(uint8_t* pg, uint8_t* v210,
+                                              const void* shuffle0, const void* mul0,
+                                              const void* shuffle1, const void* mul1) {
+  __m256i pair = unpack_16_avx2(pg, 15, shuffle0, mul0, 6);
+  __m256i third = unpack_16_avx2(pg, 15, shuffle1, mul1, 6);
+  __m256i result = _mm256_madd_epi16(pair, _mm256_set1_epi32(0x04000001));
+  result = _mm256_or_si256(result, _mm256_slli_epi32(third, 20));
+  _mm256_storeu_si256((__m256i*)v210, result);
+}
+
+static int rfc4175_10_to_v210_avx2(uint8_t* pg, uint8_t* v210, uint32_t w, uint32_t h,
+                                   bool be) {
+  uint32_t pg_cnt = w * h / 2;
+  const void* shuffle0 = rfc4175_le10_v210_shuffle0_tbl;
+  const void* mul0 = rfc4175_le10_v210_mul0_tbl;
+  const void* shuffle1 = rfc4175_le10_v210_shuffle1_tbl;
+  const void* mul1 = rfc4175_le10_v210_mul1_tbl;
+
+  if (be) {
+    shuffle0 = rfc4175_be10_v210_shuffle0_tbl;
+    mul0 = rfc4175_be10_v210_mul0_tbl;
+    shuffle1 = rfc4175_be10_v210_shuffle1_tbl;
+    mul1 = rfc4175_be10_v210_mul1_tbl;
+  }
+
+  if (pg_cnt % 3 != 0) {
+    err("%s, invalid pg_cnt %u, pixel group number must be multiple of 3!\n", __func__,
+        pg_cnt);
+    return -EINVAL;
+  }
+
+  /* 6 pgs each loop, the load touch 1 more byte */
+  while (pg_cnt >= 7) {
+    rfc4175_10_to_v210_32_avx2(pg, v210, shuffle0, mul0, shuffle1, mul1);
+    pg += 30;
+    v210 += 32;
+    pg_cnt -= 6;
+  }
+
+  if (pg_cnt) { /* 3 or 6 pgs */
+    uint8_t src[32] = {0};
+    uint8_t dst[32];
+
+    rte_memcpy(src, pg, pg_cnt * 5);
+    rfc4175_10_to_v210_32_avx2(src, dst, shuffle0, mul0, shuffle1, mul1);
+    rte_memcpy(v210, dst, pg_cnt / 3 * 16);
+  }
+
+  return 0;
+}
+
+int st20_rfc4175_422be10_to_v210_avx2(struct st20_rfc4175_422_10_pg2_be* pg_be,
+                                      uint8_t* pg_v210, uint32_t w, uint32_t h) {
+  return rfc4175_10_to_v210_avx2((uint8_t*)pg_be, pg_v210, w, h, true);
+}
+
+int st20_rfc4175_422le10_to_v210_avx2(uint8_t* pg_le, uint8_t* pg_v210, uint32_t w,
+                                      uint32_t h) {
+  return rfc4175_10_to_v210_avx2(pg_le, pg_v210, w, h, false);
+}
+
+/* the v210 samples of the windows at byte 0, 10 and 16 of 2 v210 blocks */
+static uint8_t v210_unpack_shuffle0_tbl[16] = {
+    0, 1, 1, 2, 2, 3, 4, 5, 5, 6, 6, 7, 8, 9, 9, 10,
+};
+
+static uint16_t v210_unpack_mul0_tbl[8] = {64, 16, 4, 64, 16, 4, 64, 16};
+
+static uint8_t v210_unpack_shuffle1_tbl[16] = {
+    0, 1, 2, 3, 3, 4, 4, 5, 6, 7, 7, 8, 8, 9, 10, 11,
+};
+
+static uint16_t v210_unpack_mul1_tbl[8] = {4, 64, 16, 4, 64, 16, 4, 64};
+
+static uint8_t v210_unpack_shuffle2_tbl[16] = {
+    5, 6, 6, 7, 8, 9, 9, 10, 10, 11, 12, 13, 13, 14, 14, 15,
+};
+
+static uint16_t v210_unpack_mul2_tbl[8] = {16, 4, 64, 16, 4, 64, 16, 4};
+
+static inline __m256i v210_unpack_16_avx2(uint8_t* v210, int offset0, int offset1,
+                                          const void* shuffle0, const void* mul0,
+                                          const void* shuffle1, const void* mul1) {
+  __m256i input = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128((__m128i*)(v210 + offset0))),
+      _mm_loadu_si128((__m128i*)(v210 + offset1)), 1);
+  __m256i shuffle = _mm256_inserti128_si256(
+      broadcast_tbl_avx2(shuffle0), _mm_loadu_si128((__m128i*)shuffle1), 1);
+  __m256i mul = _mm256_inserti128_si256(broadcast_tbl_avx2(mul0),
+                                        _mm_loadu_si128((__m128i*)mul1), 1);
+  __m256i sample = _mm256_shuffle_epi8(input, shuffle);
+  sample = _mm256_mullo_epi16(sample, mul);
+  return _mm256_srli_epi16(sample, 6);
+}
+
+/* 4 v210 blocks(64 bytes) to 12 pgs(60 bytes), the store touch 66 bytes */
+static inline void v210_to_rfc4175_422be10_64_avx2(uint8_t* v210, uint8_t* be) {
+  __m256i sample0 = v210_unpack_16_avx2(v210, 0, 10, v210_unpack_shuffle0_tbl,
+                                        v210_unpack_mul0_tbl, v210_unpack_shuffle1_tbl,
+                                        v210_unpack_mul1_tbl);
+  __m256i sample1 = v210_unpack_16_avx2(v210, 16, 32, v210_unpack_shuffle2_tbl,
+                                        v210_unpack_mul2_tbl, v210_unpack_shuffle0_tbl,
+                                        v210_unpack_mul0_tbl);
+  __m256i sample2 = v210_unpack_16_avx2(v210, 42, 48, v210_unpack_shuffle1_tbl,
+                                        v210_unpack_mul1_tbl, v210_unpack_shuffle2_tbl,
+                                        v210_unpack_mul2_tbl);
+  be10_pack_16_avx2(sample0, be);
+  be10_pack_16_avx2(sample1, be + 20);
+  be10_pack_16_avx2(sample2, be + 40);
+}
+
+int st20_v210_to_rfc4175_422be10_avx2(uint8_t* pg_v210,
+                                      struct st20_rfc4175_422_10_pg2_be* pg_be,
+                                      uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg_be;
+  uint32_t pg_cnt = w * h / 2;
+
+  if (pg_cnt % 3 != 0) {
+    err("%s, invalid pg_cnt %u, pixel group number must be multiple of 3!\n", __func__,
+        pg_cnt);
+    return -EINVAL;
+  }
+
+  /* 4 v210 blocks each loop, the store touch 2 more pgs */
+  uint32_t blocks = pg_cnt / 3;
+  while (blocks >= 5) {
+    v210_to_rfc4175_422be10_64_avx2(pg_v210, be);
+    pg_v210 += 64;
+    be += 60;
+    blocks -= 4;
+  }
+
+  while (blocks) {
+    uint32_t cnt = RTE_MIN(blocks, 4);
+    uint8_t src[64] = {0};
+    uint8_t dst[80];
+
+    rte_memcpy(src, pg_v210, cnt * 16);
+    v210_to_rfc4175_422be10_64_avx2(src, dst);
+    rte_memcpy(be, dst, cnt * 15);
+    pg_v210 += cnt * 16;
+    be += cnt * 15;
+    blocks -= cnt;
+  }
+
+  return 0;
+}
+/* end v210 avx2 */
+
+/* begin st20_rfc4175_422be10_to_y210_avx2 */
+int st20_rfc4175_422be10_to_y210_avx2(struct st20_rfc4175_422_10_pg2_be* pg_be,
+                                      uint16_t* pg_y210, uint32_t w, uint32_t h) {
+  __m256i swap = broadcast_tbl_avx2(yuv422_swap_shuffle_tbl);
+  uint8_t* be = (uint8_t*)pg_be;
+  uint32_t pg_cnt = w * h / 2;
+
+  /* 4 pgs each loop, the load touch 2 more pgs */
+  while (pg_cnt >= 6) {
+    __m256i sample = _mm256_shuffle_epi8(be10_unpack_16_avx2(be), swap);
+    _mm256_storeu_si256((__m256i*)pg_y210, _mm256_slli_epi16(sample, 6));
+    be += 20;
+    pg_y210 += 16;
+    pg_cnt -= 4;
+  }
+
+  while (pg_cnt) {
+    uint32_t cnt = RTE_MIN(pg_cnt, 4);
+    uint8_t src[32] = {0};
+    uint16_t dst[16];
+
+    rte_memcpy(src, be, cnt * 5);
+    __m256i sample = _mm256_shuffle_epi8(be10_unpack_16_avx2(src), swap);
+    _mm256_storeu_si256((__m256i*)dst, _mm256_slli_epi16(sample, 6));
+    rte_memcpy(pg_y210, dst, cnt * 8);
+    be += cnt * 5;
+    pg_y210 += cnt * 4;
+    pg_cnt -= cnt;
+  }
+
+  return 0;
+}
+/* end st20_rfc4175_422be10_to_y210_avx2 */
+
+/* begin st20_y210_to_rfc4175_422be10_avx2 */
+int st20_y210_to_rfc4175_422be10_avx2(uint16_t* pg_y210,
+                                      struct st20_rfc4175_422_10_pg2_be* pg_be,
+                                      uint32_t w, uint32_t h) {
+  __m256i swap = broadcast_tbl_avx2(yuv422_swap_shuffle_tbl);
+  uint8_t* be = (uint8_t*)pg_be;
+  uint32_t pg_cnt = w * h / 2;
+
+  /* 4 pgs each loop, the store touch 2 more pgs */
+  while (pg_cnt >= 6) {
+    __m256i sample = _mm256_srli_epi16(_mm256_loadu_si256((__m256i*)pg_y210), 6);
+    be10_pack_16_avx2(_mm256_shuffle_epi8(sample, swap), be);
+    pg_y210 += 16;
+    be += 20;
+    pg_cnt -= 4;
+  }
+
+  while (pg_cnt) {
+    uint32_t cnt = RTE_MIN(pg_cnt, 4);
+    uint16_t src[16] = {0};
+    uint8_t dst[32];
+
+    rte_memcpy(src, pg_y210, cnt * 8);
+    __m256i sample = _mm256_srli_epi16(_mm256_loadu_si256((__m256i*)src), 6);
+    be10_pack_16_avx2(_mm256_shuffle_epi8(sample, swap), dst);
+    rte_memcpy(be, dst, cnt * 5);
+    pg_y210 += cnt * 4;
+    be += cnt * 5;
+    pg_cnt -= cnt;
+  }
+
+  return 0;
+}
+/* end st20_y210_to_rfc4175_422be10_avx2 */
+
+/* begin 422 12bit avx2 */
+int st20_rfc4175_422be12_to_422le12_avx2(struct st20_rfc4175_422_12_pg2_be* pg_be,
+                                         struct st20_rfc4175_422_12_pg2_le* pg_le,
+                                         uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg_be;
+  uint8_t* le = (uint8_t*)pg_le;
+  uint32_t pg_cnt = w * h / 2;
+
+  /* 4 pgs each loop, the load and store touch 1 more pg */
+  while (pg_cnt >= 5) {
+    le12_pack_16_avx2(be12_unpack_16_avx2(be), le);
+    be += 24;
+    le += 24;
+    pg_cnt -= 4;
+  }
+
+  if (pg_cnt) {
+    uint8_t src[32] = {0};
+    uint8_t dst[32];
+
+    rte_memcpy(src, be, pg_cnt * 6);
+    le12_pack_16_avx2(be12_unpack_16_avx2(src), dst);
+    rte_memcpy(le, dst, pg_cnt * 6);
+  }
+
+  return 0;
+}
+
+int st20_rfc4175_422le12_to_422be12_avx2(struct st20_rfc4175_422_12_pg2_le* pg_le,
+                                         struct st20_rfc4175_422_12_pg2_be* pg_be,
+                                         uint32_t w, uint32_t h) {
+  uint8_t* le = (uint8_t*)pg_le;
+  uint8_t* be = (uint8_t*)pg_be;
+  uint32_t pg_cnt = w * h / 2;
+
+  while (pg_cnt >= 5) {
+    be12_pack_16_avx2(le12_unpack_16_avx2(le), be);
+    le += 24;
+    be += 24;
+    pg_cnt -= 4;
+  }
+
+  if (pg_cnt) {
+    uint8_t src[32] = {0};
+    uint8_t dst[32];
+
+    rte_memcpy(src, le, pg_cnt * 6);
+    be12_pack_16_avx2(le12_unpack_16_avx2(src), dst);
+    rte_memcpy(be, dst, pg_cnt * 6);
+  }
+
+  return 0;
+}
+
+int st20_rfc4175_422be12_to_yuv422p12le_avx2(struct st20_rfc4175_422_12_pg2_be* pg,
+                                             uint16_t* y, uint16_t* b, uint16_t* r,
+                                             uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+
+  while (pg_cnt >= 5) {
+    yuv422_split_16_avx2(be12_unpack_16_avx2(be), y, b, r);
+    be += 24;
+    y += 8;
+    b += 4;
+    r += 4;
+    pg_cnt -= 4;
+  }
+
+  if (pg_cnt) {
+    uint8_t src[32] = {0};
+    uint16_t dst_y[8], dst_b[4], dst_r[4];
+
+    rte_memcpy(src, be, pg_cnt * 6);
+    yuv422_split_16_avx2(be12_unpack_16_avx2(src), dst_y, dst_b, dst_r);
+    rte_memcpy(y, dst_y, pg_cnt * 4);
+    rte_memcpy(b, dst_b, pg_cnt * 2);
+    rte_memcpy(r, dst_r, pg_cnt * 2);
+  }
+
+  return 0;
+}
+
+int st20_yuv422p12le_to_rfc4175_422be12_avx2(uint16_t* y, uint16_t* b, uint16_t* r,
+                                             struct st20_rfc4175_422_12_pg2_be* pg,
+                                             uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+
+  while (pg_cnt >= 5) {
+    be12_pack_16_avx2(yuv422_merge_16_avx2(y, b, r), be);
+    be += 24;
+    y += 8;
+    b += 4;
+    r += 4;
+    pg_cnt -= 4;
+  }
+
+  if (pg_cnt) {
+    uint16_t src_y[8] = {0}, src_b[4] = {0}, src_r[4] = {0};
+    uint8_t dst[32];
+
+    rte_memcpy(src_y, y, pg_cnt * 4);
+    rte_memcpy(src_b, b, pg_cnt * 2);
+    rte_memcpy(src_r, r, pg_cnt * 2);
+    be12_pack_16_avx2(yuv422_merge_16_avx2(src_y, src_b, src_r), dst);
+    rte_memcpy(be, dst, pg_cnt * 6);
+  }
+
+  return 0;
+}
+/* end 422 12bit avx2 */
+
+/* begin 444 avx2, each loop with 16 pixels of 48 samples */
+int st20_rfc4175_444be10_to_444p10le_avx2(struct st20_rfc4175_444_10_pg4_be* pg,
+                                          uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                          uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 4;
+
+  /* 4 pgs each loop, the load touch 1 more pg */
+  while (pg_cnt >= 5) {
+    yuv444_split_48_avx2(be10_unpack_16_avx2(be), be10_unpack_16_avx2(be + 20),
+                         be10_unpack_16_avx2(be + 40), b_r, y_g, r_b);
+    be += 60;
+    y_g += 16;
+    b_r += 16;
+    r_b += 16;
+    pg_cnt -= 4;
+  }
+
+  if (pg_cnt) {
+    uint8_t src[80] = {0};
+    uint16_t dst_y_g[16], dst_b_r[16], dst_r_b[16];
+
+    rte_memcpy(src, be, pg_cnt * 15);
+    yuv444_split_48_avx2(be10_unpack_16_avx2(src), be10_unpack_16_avx2(src + 20),
+                         be10_unpack_16_avx2(src + 40), dst_b_r, dst_y_g, dst_r_b);
+    rte_memcpy(y_g, dst_y_g, pg_cnt * 8);
+    rte_memcpy(b_r, dst_b_r, pg_cnt * 8);
+    rte_memcpy(r_b, dst_r_b, pg_cnt * 8);
+  }
+
+  return 0;
+}
+
+int st20_444p10le_to_rfc4175_444be10_avx2(uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                          struct st20_rfc4175_444_10_pg4_be* pg,
+                                          uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 4;
+  __m256i s[3];
+
+  /* 4 pgs each loop, the store touch 1 more pg */
+  while (pg_cnt >= 5) {
+    yuv444_merge_48_avx2(b_r, y_g, r_b, s);
+    be10_pack_16_avx2(s[0], be);
+    be10_pack_16_avx2(s[1], be + 20);
+    be10_pack_16_avx2(s[2], be + 40);
+    be += 60;
+    y_g += 16;
+    b_r += 16;
+    r_b += 16;
+    pg_cnt -= 4;
+  }
+
+  if (pg_cnt) {
+    uint16_t src_y_g[16] = {0}, src_b_r[16] = {0}, src_r_b[16] = {0};
+    uint8_t dst[80];
+
+    rte_memcpy(src_y_g, y_g, pg_cnt * 8);
+    rte_memcpy(src_b_r, b_r, pg_cnt * 8);
+    rte_memcpy(src_r_b, r_b, pg_cnt * 8);
+    yuv444_merge_48_avx2(src_b_r, src_y_g, src_r_b, s);
+    be10_pack_16_avx2(s[0], dst);
+    be10_pack_16_avx2(s[1], dst + 20);
+    be10_pack_16_avx2(s[2], dst + 40);
+    rte_memcpy(be, dst, pg_cnt * 15);
+  }
+
+  return 0;
+}
+
+int st20_rfc4175_444be12_to_444p12le_avx2(struct st20_rfc4175_444_12_pg2_be* pg,
+                                          uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                          uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+
+  /* 8 pgs each loop, the load touch 1 more pg */
+  while (pg_cnt >= 9) {
+    yuv444_split_48_avx2(be12_unpack_16_avx2(be), be12_unpack_16_avx2(be + 24),
+                         be12_unpack_16_avx2(be + 48), b_r, y_g, r_b);
+    be += 72;
+    y_g += 16;
+    b_r += 16;
+    r_b += 16;
+    pg_cnt -= 8;
+  }
+
+  if (pg_cnt) {
+    uint8_t src[80] = {0};
+    uint16_t dst_y_g[16], dst_b_r[16], dst_r_b[16];
+
+    rte_memcpy(src, be, pg_cnt * 9);
+    yuv444_split_48_avx2(be12_unpack_16_avx2(src), be12_unpack_16_avx2(src + 24),
+                         be12_unpack_16_avx2(src + 48), dst_b_r, dst_y_g, dst_r_b);
+    rte_memcpy(y_g, dst_y_g, pg_cnt * 4);
+    rte_memcpy(b_r, dst_b_r, pg_cnt * 4);
+    rte_memcpy(r_b, dst_r_b, pg_cnt * 4);
+  }
+
+  return 0;
+}
+
+int st20_444p12le_to_rfc4175_444be12_avx2(uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                          struct st20_rfc4175_444_12_pg2_be* pg,
+                                          uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+  __m256i s[3];
+
+  /* 8 pgs each loop, the store touch 1 more pg */
+  while (pg_cnt >= 9) {
+    yuv444_merge_48_avx2(b_r, y_g, r_b, s);
+    be12_pack_16_avx2(s[0], be);
+    be12_pack_16_avx2(s[1], be + 24);
+    be12_pack_16_avx2(s[2], be + 48);
+    be += 72;
+    y_g += 16;
+    b_r += 16;
+    r_b += 16;
+    pg_cnt -= 8;
+  }
+
+  if (pg_cnt) {
+    uint16_t src_y_g[16] = {0}, src_b_r[16] = {0}, src_r_b[16] = {0};
+    uint8_t dst[80];
+
+    rte_memcpy(src_y_g, y_g, pg_cnt * 4);
+    rte_memcpy(src_b_r, b_r, pg_cnt * 4);
+    rte_memcpy(src_r_b, r_b, pg_cnt * 4);
+    yuv444_merge_48_avx2(src_b_r, src_y_g, src_r_b, s);
+    be12_pack_16_avx2(s[0], dst);
+    be12_pack_16_avx2(s[1], dst + 24);
+    be12_pack_16_avx2(s[2], dst + 48);
+    rte_memcpy(be, dst, pg_cnt * 9);
+  }
+
+  return 0;
+}
+/* end 444 avx2 */
+
+/* begin rfc4175 422be10 rgb avx2, each loop with 8 pixels of 4 pgs */
+/* Cb Y0 Cr Y1 to the (Y, Cb) pair of each pixel */
+static uint8_t yuv422_ycb_shuffle_tbl[16] = {
+    2, 3, 0, 1, 6, 7, 0, 1, 10, 11, 8, 9, 14, 15, 8, 9,
+};
+
+/* Cb Y0 Cr Y1 to the (Y, Cr) pair of each pixel */
+static uint8_t yuv422_ycr_shuffle_tbl[16] = {
+    2, 3, 4, 5, 6, 7, 4, 5, 10, 11, 12, 13, 14, 15, 12, 13,
+};
+
+/* B0 ~ 3, G0 ~ 3, R0 ~ 3, A0 ~ 3 to the pixels */
+static uint8_t bgra_to_argb_shuffle_tbl[16] = {
+    12, 8, 4, 0, 13, 9, 5, 1, 14, 10, 6, 2, 15, 11, 7, 3,
+};
+
+static uint8_t bgra_to_bgra_shuffle_tbl[16] = {
+    0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+};
+
+static uint8_t bgra_to_rgb8_shuffle_tbl[16] = {
+    8, 4, 0, 9, 5, 1, 10, 6, 2, 11, 7, 3, 0x80, 0x80, 0x80, 0x80,
+};
+
+/* the pixels to the (R, G) pair and the (B, 0) pair of each pixel */
+static uint8_t argb_to_rg_shuffle_tbl[16] = {
+    1, 0x80, 2, 0x80, 5, 0x80, 6, 0x80, 9, 0x80, 10, 0x80, 13, 0x80, 14, 0x80,
+};
+
+static uint8_t argb_to_b_shuffle_tbl[16] = {
+    3, 0x80, 0x80, 0x80, 7, 0x80, 0x80, 0x80, 11, 0x80, 0x80, 0x80, 15, 0x80, 0x80, 0x80,
+};
+
+static uint8_t bgra_to_rg_shuffle_tbl[16] = {
+    2, 0x80, 1, 0x80, 6, 0x80, 5, 0x80, 10, 0x80, 9, 0x80, 14, 0x80, 13, 0x80,
+};
+
+static uint8_t bgra_to_b_shuffle_tbl[16] = {
+    0, 0x80, 0x80, 0x80, 4, 0x80, 0x80, 0x80, 8, 0x80, 0x80, 0x80, 12, 0x80, 0x80, 0x80,
+};
+
+static uint8_t rgb8_to_rg_shuffle_tbl[16] = {
+    0, 0x80, 1, 0x80, 3, 0x80, 4, 0x80, 6, 0x80, 7, 0x80, 9, 0x80, 10, 0x80,
+};
+
+static uint8_t rgb8_to_b_shuffle_tbl[16] = {
+    2, 0x80, 0x80, 0x80, 5, 0x80, 0x80, 0x80, 8, 0x80, 0x80, 0x80, 11, 0x80, 0x80, 0x80,
+};
+
+/* Cb0 Cb1 Cr0 Cr1 Y0 Y1 Y2 Y3 to Cb0 Y0 Cr0 Y1 Cb1 Y2 Cr1 Y3 */
+static uint8_t yuv422_from_rgb_shuffle_tbl[16] = {
+    0, 1, 8, 9, 4, 5, 10, 11, 2, 3, 12, 13, 6, 7, 14, 15,
+};
+
+static inline __m256i coeff_pair_avx2(int16_t lo, int16_t hi) {
+  return _mm256_set1_epi32((uint16_t)lo | ((uint32_t)(uint16_t)hi << 16));
+}
+
+struct rgb_coeffs_avx2 {
+  __m256i offset;
+  __m256i ycb_b, ycb_g, ycr_g, ycr_r;
+  __m256i rg_y, b_y, rg_cb, b_cb, rg_cr, b_cr;
+};
+
+static void rgb_coeffs_avx2_init(const struct st_color_coeffs* c,
+                                 struct rgb_coeffs_avx2* v) {
+  v->offset = _mm256_set1_epi32(((uint32_t)c->y_offset << 16) | 512);
+  v->ycb_b = coeff_pair_avx2(c->y, c->cb_b);
+  v->ycb_g = coeff_pair_avx2(c->y, c->cb_g);
+  v->ycr_g = coeff_pair_avx2(0, c->cr_g);
+  v->ycr_r = coeff_pair_avx2(c->y, c->cr_r);
+  v->rg_y = coeff_pair_avx2(c->r_y, c->g_y);
+  v->b_y = coeff_pair_avx2(c->b_y, 0);
+  v->rg_cb = coeff_pair_avx2(c->r_cb, c->g_cb);
+  v->b_cb = coeff_pair_avx2(c->b_cb, 0);
+  v->rg_cr = coeff_pair_avx2(c->r_cr, c->g_cr);
+  v->b_cr = coeff_pair_avx2(c->b_cr, 0);
+}
+
+static int rgb_shuffle_tbl_avx2(enum st_frame_fmt fmt, const void** to_rgb,
+                                const void** to_rg, const void** to_b) {
+  switch (fmt) {
+    case ST_FRAME_FMT_ARGB:
+      *to_rgb = bgra_to_argb_shuffle_tbl;
+      *to_rg = argb_to_rg_shuffle_tbl;
+      *to_b = argb_to_b_shuffle_tbl;
+      return 4;
+    case ST_FRAME_FMT_BGRA:
+      *to_rgb = bgra_to_bgra_shuffle_tbl;
+      *to_rg = bgra_to_rg_shuffle_tbl;
+      *to_b = bgra_to_b_shuffle_tbl;
+      return 4;
+    case ST_FRAME_FMT_RGB8:
+      *to_rgb = bgra_to_rgb8_shuffle_tbl;
+      *to_rg = rgb8_to_rg_shuffle_tbl;
+      *to_b = rgb8_to_b_shuffle_tbl;
+      return 3;
+    default:
+      return -EINVAL;
+  }
+}
+
+/* 16 samples of 8 pixels to B0 ~ 3, G0 ~ 3, R0 ~ 3, A0 ~ 3 in each lane */
+static inline __m256i yuv422_to_bgra_8_avx2(__m256i sample,
+                                            const struct rgb_coeffs_avx2* v) {
+  __m256i rnd = _mm256_set1_epi32(1 << 13);
+
+  sample = _mm256_sub_epi16(sample, v->offset);
+  __m256i ycb = _mm256_shuffle_epi8(sample, broadcast_tbl_avx2(yuv422_ycb_shuffle_tbl));
+  __m256i ycr = _mm256_shuffle_epi8(sample, broadcast_tbl_avx2(yuv422_ycr_shuffle_tbl));
+  __m256i b = _mm256_add_epi32(_mm256_madd_epi16(ycb, v->ycb_b), rnd);
+  __m256i g = _mm256_add_epi32(_mm256_madd_epi16(ycb, v->ycb_g), rnd);
+  g = _mm256_add_epi32(g, _mm256_madd_epi16(ycr, v->ycr_g));
+  __m256i r = _mm256_add_epi32(_mm256_madd_epi16(ycr, v->ycr_r), rnd);
+  __m256i bg = _mm256_packs_epi32(_mm256_srai_epi32(b, 14), _mm256_srai_epi32(g, 14));
+  __m256i ra = _mm256_packs_epi32(_mm256_srai_epi32(r, 14), _mm256_set1_epi32(0xff));
+  return _mm256_packus_epi16(bg, ra);
+}
+
+/* the (R, G) and (B, 0) pairs of 4 pixels in each lane to 16 samples */
+static inline __m256i rgb_to_yuv422_8_avx2(__m256i rg, __m256i b,
+                                           const struct rgb_coeffs_avx2* v,
+                                           __m256i y_base, __m256i c_base) {
+  __m256i y =
+      _mm256_add_epi32(_mm256_madd_epi16(rg, v->rg_y), _mm256_madd_epi16(b, v->b_y));
+  y = _mm256_srai_epi32(_mm256_add_epi32(y, y_base), 12);
+  __m256i cb = _mm256_add_epi32(_mm256_madd_epi16(rg, v->rg_cb),
+                                _mm256_madd_epi16(b, v->b_cb));
+  __m256i cr = _mm256_add_epi32(_mm256_madd_epi16(rg, v->rg_cr),
+                                _mm256_madd_epi16(b, v->b_cr));
+  /* the sum of the pixel pairs, Cb0 Cb1 Cr0 Cr1 in each lane */
+  __m256i c = _mm256_hadd_epi32(cb, cr);
+  c = _mm256_srai_epi32(_mm256_add_epi32(c, c_base), 13);
+  __m256i sample = _mm256_packs_epi32(c, y);
+  sample = _mm256_max_epi16(sample, _mm256_setzero_si256());
+  sample = _mm256_min_epi16(sample, _mm256_set1_epi16(0x3ff));
+  return _mm256_shuffle_epi8(sample, broadcast_tbl_avx2(yuv422_from_rgb_shuffle_tbl));
+}
+
+static inline void rgb_store_8_avx2(__m256i bgra, uint8_t* rgb, __m256i shuffle,
+                                    int pixel_size) {
+  __m256i out = _mm256_shuffle_epi8(bgra, shuffle);
+  if (pixel_size == 4) {
+    _mm256_storeu_si256((__m256i*)rgb, out);
+    return;
+  }
+  /* the 12 bytes of each lane */
+  out = _mm256_permutevar8x32_epi32(out, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+  _mm_storeu_si128((__m128i*)rgb, _mm256_castsi256_si128(out));
+  _mm_storel_epi64((__m128i*)(rgb + 16), _mm256_extracti128_si256(out, 1));
+}
+
+static inline __m256i rgb_load_8_avx2(const uint8_t* rgb, int pixel_size) {
+  if (pixel_size == 4) return _mm256_loadu_si256((__m256i*)rgb);
+  /* the 12 bytes of each lane */
+  __m256i in = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128((__m128i*)rgb)),
+      _mm_loadl_epi64((__m128i*)(rgb + 16)), 1);
+  return _mm256_permutevar8x32_epi32(in, _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6));
+}
+
+int st20_rfc4175_422be10_to_rgb_avx2(struct st20_rfc4175_422_10_pg2_be* pg, uint8_t* rgb,
+                                     enum st_frame_fmt fmt, uint32_t w, uint32_t h,
+                                     const struct st_color_coeffs* coeffs) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+  const void *to_rgb, *to_rg, *to_b;
+  struct rgb_coeffs_avx2 v;
+
+  int pixel_size = rgb_shuffle_tbl_avx2(fmt, &to_rgb, &to_rg, &to_b);
+  if (pixel_size < 0) return pixel_size;
+  __m256i shuffle = broadcast_tbl_avx2(to_rgb);
+  rgb_coeffs_avx2_init(coeffs, &v);
+
+  /* 4 pgs each loop, the load touch 2 more pgs */
+  while (pg_cnt >= 6) {
+    rgb_store_8_avx2(yuv422_to_bgra_8_avx2(be10_unpack_16_avx2(be), &v), rgb, shuffle,
+                     pixel_size);
+    be += 20;
+    rgb += pixel_size * 8;
+    pg_cnt -= 4;
+  }
+
+  /* the tail with a local copy */
+  while (pg_cnt) {
+    uint32_t cnt = RTE_MIN(pg_cnt, 4);
+    uint8_t src[32] = {0};
+    uint8_t dst[32];
+
+    rte_memcpy(src, be, cnt * 5);
+    rgb_store_8_avx2(yuv422_to_bgra_8_avx2(be10_unpack_16_avx2(src), &v), dst, shuffle,
+                     pixel_size);
+    rte_memcpy(rgb, dst, cnt * 2 * pixel_size);
+    be += cnt * 5;
+    rgb += cnt * 2 * pixel_size;
+    pg_cnt -= cnt;
+  }
+
+  return 0;
+}
+
+int st20_rgb_to_rfc4175_422be10_avx2(uint8_t* rgb, enum st_frame_fmt fmt,
+                                     struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                     uint32_t h, const struct st_color_coeffs* coeffs) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+  const void *to_rgb, *to_rg, *to_b;
+  struct rgb_coeffs_avx2 v;
+
+  int pixel_size = rgb_shuffle_tbl_avx2(fmt, &to_rgb, &to_rg, &to_b);
+  if (pixel_size < 0) return pixel_size;
+  __m256i rg_shuffle = broadcast_tbl_avx2(to_rg);
+  __m256i b_shuffle = broadcast_tbl_avx2(to_b);
+  __m256i y_base = _mm256_set1_epi32((coeffs->y_offset << 12) + (1 << 11));
+  __m256i c_base = _mm256_set1_epi32((512 << 13) + (1 << 12));
+  rgb_coeffs_avx2_init(coeffs, &v);
+
+  /* 4 pgs each loop, the store touch 2 more pgs */
+  while (pg_cnt >= 6) {
+    __m256i in = rgb_load_8_avx2(rgb, pixel_size);
+    __m256i rg = _mm256_shuffle_epi8(in, rg_shuffle);
+    __m256i b = _mm256_shuffle_epi8(in, b_shuffle);
+    be10_pack_16_avx2(rgb_to_yuv422_8_avx2(rg, b, &v, y_base, c_base), be);
+    rgb += pixel_size * 8;
+    be += 20;
+    pg_cnt -= 4;
+  }
+
+  while (pg_cnt) {
+    uint32_t cnt = RTE_MIN(pg_cnt, 4);
+    uint8_t src[32] = {0};
+    uint8_t dst[32];
+
+    rte_memcpy(src, rgb, cnt * 2 * pixel_size);
+    __m256i in = rgb_load_8_avx2(src, pixel_size);
+    __m256i rg = _mm256_shuffle_epi8(in, rg_shuffle);
+    __m256i b = _mm256_shuffle_epi8(in, b_shuffle);
+    be10_pack_16_avx2(rgb_to_yuv422_8_avx2(rg, b, &v, y_base, c_base), dst);
+    rte_memcpy(be, dst, cnt * 5);
+    rgb += cnt * 2 * pixel_size;
+    be += cnt * 5;
+    pg_cnt -= cnt;
+  }
+
+  return 0;
+}
+/* end rfc4175 422be10 rgb avx2 */
+
+/* begin scale avx2, the coeffs pair of two taps madd with two samples in one dword */
+uint32_t st_scale_h_avx2(const uint16_t* src, uint16_t* dst,
+                         const struct st_scale_filter* f, uint32_t x) {
+  const int32_t* coeffs = (const int32_t*)f->coeffs;
+  uint32_t w = f->dst_size;
+  uint32_t pairs = f->taps / 2;
+  __m256i round = _mm256_set1_epi32(1 << (ST_SCALE_COEFF_BITS - 1));
+  __m256i step = _mm256_set1_epi32(2);
+
+  /* 8 outputs each loop, the samples pair of each tap pair gathered as one dword */
+  while ((w - x) >= 8) {
+    __m256i idx = _mm256_loadu_si256((__m256i*)(f->start + x));
+    __m256i sum = round;
+    for (uint32_t p = 0; p < pairs; p++) {
+      __m256i sample = _mm256_i32gather_epi32((const int*)src, idx, 2);
+      __m256i coeff = _mm256_loadu_si256((__m256i*)(coeffs + p * w + x));
+      sum = _mm256_add_epi32(sum, _mm256_madd_epi16(sample, coeff));
+      idx = _mm256_add_epi32(idx, step);
+    }
+    sum = _mm256_srai_epi32(sum, ST_SCALE_COEFF_BITS);
+    __m128i out = _mm_packus_epi32(_mm256_castsi256_si128(sum),
+                                   _mm256_extracti128_si256(sum, 1));
+    _mm_storeu_si128((__m128i*)(dst + x), out);
+    x += 8;
+  }
+
+  return x;
+}
+
+uint32_t st_scale_v_avx2(uint16_t* const* lines, uint16_t* dst, uint32_t w,
+                         const struct st_scale_filter* f, uint32_t y, uint32_t x) {
+  const int32_t* coeffs = (const int32_t*)f->coeffs;
+  uint32_t pairs = f->taps / 2;
+  __m256i round = _mm256_set1_epi32(1 << (ST_SCALE_COEFF_BITS - 1));
+
+  /* 16 outputs each loop, the samples of two lines interleaved for the tap pair */
+  while ((w - x) >= 16) {
+    __m256i sum_lo = round;
+    __m256i sum_hi = round;
+    for (uint32_t p = 0; p < pairs; p++) {
+      __m256i coeff = _mm256_set1_epi32(coeffs[p * f->dst_size + y]);
+      __m256i l0 = _mm256_loadu_si256((__m256i*)(lines[p * 2] + x));
+      __m256i l1 = _mm256_loadu_si256((__m256i*)(lines[p * 2 + 1] + x));
+      __m256i lo = _mm256_unpacklo_epi16(l0, l1);
+      __m256i hi = _mm256_unpackhi_epi16(l0, l1);
+      sum_lo = _mm256_add_epi32(sum_lo, _mm256_madd_epi16(lo, coeff));
+      sum_hi = _mm256_add_epi32(sum_hi, _mm256_madd_epi16(hi, coeff));
+    }
+    sum_lo = _mm256_srai_epi32(sum_lo, ST_SCALE_COEFF_BITS);
+    sum_hi = _mm256_srai_epi32(sum_hi, ST_SCALE_COEFF_BITS);
+    /* the lo/hi unpack is per 128 bit lane, the pack restore the order */
+    _mm256_storeu_si256((__m256i*)(dst + x), _mm256_packus_epi32(sum_lo, sum_hi));
+    x += 16;
+  }
+
+  return x;
+}
+/* end scale avx2 */
+
+/* begin st_memcpy_stream_avx2 */
+void st_memcpy_stream_avx2(void* dst, const void* src, size_t n) {
+  uint8_t* d = dst;
+  const uint8_t* s = src;
+  size_t head = (32 - ((uintptr_t)d & 31)) & 31;
+
+  if (n < head + 32) {
+    memcpy(d, s, n);
+    return;
+  }
+
+  /* align the dst to 32 bytes for the stream store */
+  if (head) {
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    n -= head;
+  }
+
+  while (n >= 128) {
+    __m256i y0 = _mm256_loadu_si256((const __m256i*)(s + 0));
+    __m256i y1 = _mm256_loadu_si256((const __m256i*)(s + 32));
+    __m256i y2 = _mm256_loadu_si256((const __m256i*)(s + 64));
+    __m256i y3 = _mm256_loadu_si256((const __m256i*)(s + 96));
+    _mm256_stream_si256((__m256i*)(d + 0), y0);
+    _mm256_stream_si256((__m256i*)(d + 32), y1);
+    _mm256_stream_si256((__m256i*)(d + 64), y2);
+    _mm256_stream_si256((__m256i*)(d + 96), y3);
+    d += 128;
+    s += 128;
+    n -= 128;
+  }
+  while (n >= 32) {
+    _mm256_stream_si256((__m256i*)d, _mm256_loadu_si256((const __m256i*)s));
+    d += 32;
+    s += 32;
+    n -= 32;
+  }
+
+  if (n) memcpy(d, s, n);
+}
+/* end st_memcpy_stream_avx2 */
+
+/* begin st40 udw avx2, the udws share the be10 sample helpers */
+/* b9 is the inverse of b8, b8 is the even parity of b0 ~ b7 */
+static inline __m256i st40_udw_add_parity_avx2(__m256i val) {
+  val = _mm256_and_si256(val, _mm256_set1_epi16(0xff));
+  __m256i p = _mm256_xor_si256(val, _mm256_srli_epi16(val, 4));
+  p = _mm256_xor_si256(p, _mm256_srli_epi16(p, 2));
+  p = _mm256_xor_si256(p, _mm256_srli_epi16(p, 1));
+  p = _mm256_slli_epi16(_mm256_and_si256(p, _mm256_set1_epi16(0x1)), 8);
+  p = _mm256_or_si256(p, _mm256_slli_epi16(p, 1));
+  return _mm256_or_si256(val, _mm256_xor_si256(p, _mm256_set1_epi16(0x200)));
+}
+
+/*
+ * The 16 udws lane load/store touch 26 bytes, so only run while at least 21 udws left,
+ * the tail is handled by the caller with scalar.
+ */
+uint32_t st40_udws_unpack_avx2(const uint8_t* data, uint16_t* udws, uint32_t num) {
+  uint32_t i = 0;
+
+  while ((num - i) >= 21) {
+    __m256i udw = be10_unpack_16_avx2(data);
+    _mm256_storeu_si256((__m256i*)(udws + i), udw);
+    data += 20;
+    i += 16;
+  }
+
+  return i;
+}
+
+uint32_t st40_udws_pack_avx2(const uint16_t* udws, uint8_t* data, uint32_t num) {
+  uint32_t i = 0;
+
+  while ((num - i) >= 21) {
+    __m256i udw = _mm256_loadu_si256((__m256i*)(udws + i));
+    be10_pack_16_avx2(udw, data);
+    data += 20;
+    i += 16;
+  }
+
+  return i;
+}
+
+uint32_t st40_udws_pack_parity_avx2(const uint8_t* words, uint8_t* data, uint32_t num) {
+  uint32_t i = 0;
+
+  while ((num - i) >= 21) {
+    __m256i val = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(words + i)));
+    be10_pack_16_avx2(st40_udw_add_parity_avx2(val), data);
+    data += 20;
+    i += 16;
+  }
+
+  return i;
+}
+
+uint32_t st40_udws_sum_avx2(const uint8_t* data, uint32_t num, uint16_t* sum) {
+  uint32_t i = 0;
+  __m256i acc = _mm256_setzero_si256();
+  uint16_t lanes[16];
+
+  /* 16 bits add wrap is fine as the checksum only use the low 9 bits */
+  while ((num - i) >= 21) {
+    acc = _mm256_add_epi16(acc, be10_unpack_16_avx2(data));
+    data += 20;
+    i += 16;
+  }
+
+  _mm256_storeu_si256((__m256i*)lanes, acc);
+  uint16_t total = 0;
+  for (int j = 0; j < 16; j++) total += lanes[j];
+  *sum = total;
+  return i;
+}
+/* end st40 udw avx2 */
 MT_TARGET_CODE_STOP
 #endif
@@ -15,4 +15,100 @@ int st20_rfc4175_422le10_to_422be10_avx2(struct st20_rfc4175_422_10_pg2_le* pg_l
                                          struct st20_rfc4175_422_10_pg2_be* pg_be,
                                          uint32_t w, uint32_t h);
 
+int st20_rfc4175_422be10_to_yuv422p10le_avx2(struct st20_rfc4175_422_10_pg2_be* pg,
+                                             uint16_t* y, uint16_t* b, uint16_t* r,
+                                             uint32_t w, uint32_t h);
+
+int st20_yuv422p10le_to_rfc4175_422be10_avx2(uint16_t* y, uint16_t* b, uint16_t* r,
+                                             struct st20_rfc4175_422_10_pg2_be* pg,
+                                             uint32_t w, uint32_t h);
+
+int st20_rfc4175_422be10_to_422le8_avx2(struct st20_rfc4175_422_10_pg2_be* pg_10,
+                                        struct st20_rfc4175_422_8_pg2_le* pg_8,
+                                        uint32_t w, uint32_t h);
+
+int st20_rfc4175_422be10_to_yuv422p8_avx2(struct st20_rfc4175_422_10_pg2_be* pg,
+                                          uint8_t* y, uint8_t* b, uint8_t* r, uint32_t w,
+                                          uint32_t h);
+
+int st20_rfc4175_422be10_to_yuv420p8_avx2(struct st20_rfc4175_422_10_pg2_be* pg,
+                                          uint8_t* y, uint8_t* b, uint8_t* r, uint32_t w,
+                                          uint32_t h);
+
+int st20_rfc4175_422be10_to_v210_avx2(struct st20_rfc4175_422_10_pg2_be* pg_be,
+                                      uint8_t* pg_v210, uint32_t w, uint32_t h);
+
+int st20_rfc4175_422le10_to_v210_avx2(uint8_t* pg_le, uint8_t* pg_v210, uint32_t w,
+                                      uint32_t h);
+
+int st20_v210_to_rfc4175_422be10_avx2(uint8_t* pg_v210,
+                                      struct st20_rfc4175_422_10_pg2_be* pg_be,
+                                      uint32_t w, uint32_t h);
+
+int st20_rfc4175_422be10_to_y210_avx2(struct st20_rfc4175_422_10_pg2_be* pg_be,
+                                      uint16_t* pg_y210, uint32_t w, uint32_t h);
+
+int st20_y210_to_rfc4175_422be10_avx2(uint16_t* pg_y210,
+                                      struct st20_rfc4175_422_10_pg2_be* pg_be,
+                                      uint32_t w, uint32_t h);
+
+int st20_rfc4175_422be12_to_422le12_avx2(struct st20_rfc4175_422_12_pg2_be* pg_be,
+                                         struct st20_rfc4175_422_12_pg2_le* pg_le,
+                                         uint32_t w, uint32_t h);
+
+int st20_rfc4175_422le12_to_422be12_avx2(struct st20_rfc4175_422_12_pg2_le* pg_le,
+                                         struct st20_rfc4175_422_12_pg2_be* pg_be,
+                                         uint32_t w, uint32_t h);
+
+int st20_rfc4175_422be12_to_yuv422p12le_avx2(struct st20_rfc4175_422_12_pg2_be* pg,
+                                             uint16_t* y, uint16_t* b, uint16_t* r,
+                                             uint32_t w, uint32_t h);
+
+int st20_yuv422p12le_to_rfc4175_422be12_avx2(uint16_t* y, uint16_t* b, uint16_t* r,
+                                             struct st20_rfc4175_422_12_pg2_be* pg,
+                                             uint32_t w, uint32_t h);
+
+int st20_rfc4175_444be10_to_444p10le_avx2(struct st20_rfc4175_444_10_pg4_be* pg,
+                                          uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                          uint32_t w, uint32_t h);
+
+int st20_444p10le_to_rfc4175_444be10_avx2(uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                          struct st20_rfc4175_444_10_pg4_be* pg,
+                                          uint32_t w, uint32_t h);
+
+int st20_rfc4175_444be12_to_444p12le_avx2(struct st20_rfc4175_444_12_pg2_be* pg,
+                                          uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                          uint32_t w, uint32_t h);
+
+int st20_444p12le_to_rfc4175_444be12_avx2(uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                          struct st20_rfc4175_444_12_pg2_be* pg,
+                                          uint32_t w, uint32_t h);
+
+int st20_rfc4175_422be10_to_rgb_avx2(struct st20_rfc4175_422_10_pg2_be* pg, uint8_t* rgb,
+                                     enum st_frame_fmt fmt, uint32_t w, uint32_t h,
+                                     const struct st_color_coeffs* coeffs);
+
+int st20_rgb_to_rfc4175_422be10_avx2(uint8_t* rgb, enum st_frame_fmt fmt,
+                                     struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                     uint32_t h, const struct st_color_coeffs* coeffs);
+
+/* the scale kernels start from output x, return the outputs done */
+uint32_t st_scale_h_avx2(const uint16_t* src, uint16_t* dst,
+                         const struct st_scale_filter* f, uint32_t x);
+
+uint32_t st_scale_v_avx2(uint16_t* const* lines, uint16_t* dst, uint32_t w,
+                         const struct st_scale_filter* f, uint32_t y, uint32_t x);
+
+/* copy with non-temporal stores, caller should do a store fence before the data used */
+void st_memcpy_stream_avx2(void* dst, const void* src, size_t n);
+
+/* st40 udw kernels start at a byte aligned udw, return the number of udws handled */
+uint32_t st40_udws_unpack_avx2(const uint8_t* data, uint16_t* udws, uint32_t num);
+
+uint32_t st40_udws_pack_avx2(const uint16_t* udws, uint8_t* data, uint32_t num);
+
+uint32_t st40_udws_pack_parity_avx2(const uint8_t* words, uint8_t* data, uint32_t num);
+
+uint32_t st40_udws_sum_avx2(const uint8_t* data, uint32_t num, uint16_t* sum);
+
 #endif
\ No newline at end of file
@@ -2827,5 +2827,660 @@ int st20_rfc4175_422be12_to_yuv422p12le_avx512_dma(
   return 0;
 }
 /* end st20_rfc4175_422be12_to_yuv422p12le_avx512 */
+
+/* begin rfc4175 sample helpers, each 128 bit lane handle 8 samples in 16 bits */
+static uint8_t be10_unpack_shuffle_tbl_512[16] = {
+    1, 0, 2, 1, 3, 2, 4, 3, /* sample 0 ~ 3 from byte 0 ~ 4 */
+    6, 5, 7, 6, 8, 7, 9, 8, /* sample 4 ~ 7 from byte 5 ~ 9 */
+};
+
+static uint16_t be10_unpack_srlv_tbl_512[8] = {6, 4, 2, 0, 6, 4, 2, 0};
+
+static uint8_t be10_pack_hi_shuffle_tbl_512[16] = {
+    1, 3, 5, 7, 0x80, 9, 11, 13, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+static uint8_t be10_pack_lo_shuffle_tbl_512[16] = {
+    0x80, 0, 2, 4, 6, 0x80, 8, 10, 12, 14, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+static uint16_t be10_pack_sllv_tbl_512[8] = {6, 4, 2, 0, 6, 4, 2, 0};
+
+static uint8_t be12_unpack_shuffle_tbl_512[16] = {
+    1, 0, 2, 1, 4,  3, 5,  4,  /* sample 0 ~ 3 from byte 0 ~ 5 */
+    7, 6, 8, 7, 10, 9, 11, 10, /* sample 4 ~ 7 from byte 6 ~ 11 */
+};
+
+static uint16_t be12_unpack_srlv_tbl_512[8] = {4, 0, 4, 0, 4, 0, 4, 0};
+
+static uint8_t be12_pack_hi_shuffle_tbl_512[16] = {
+    1, 0, 2, 5, 4, 6, 9, 8, 10, 13, 12, 14, 0x80, 0x80, 0x80, 0x80,
+};
+
+static uint8_t be12_pack_lo_shuffle_tbl_512[16] = {
+    0x80, 3, 0x80, 0x80, 7, 0x80, 0x80, 11, 0x80, 0x80, 15, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+static uint16_t be12_pack_sllv_tbl_512[8] = {4, 0, 4, 0, 4, 0, 4, 0};
+
+static inline __m512i unpack_32_avx512(const uint8_t* data, int lane_bytes,
+                                       const void* shuffle_tbl, const void* srlv_tbl,
+                                       uint16_t mask) {
+  __m512i shuffle_mask = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)shuffle_tbl));
+  __m512i srlv_mask = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)srlv_tbl));
+  __mmask16 k = (1 << lane_bytes) - 1; /* each lane only load the bytes of 8 samples */
+
+  __m512i input = _mm512_castsi128_si512(_mm_maskz_loadu_epi8(k, data));
+  input = _mm512_inserti32x4(input, _mm_maskz_loadu_epi8(k, data + lane_bytes), 1);
+  input = _mm512_inserti32x4(input, _mm_maskz_loadu_epi8(k, data + lane_bytes * 2), 2);
+  input = _mm512_inserti32x4(input, _mm_maskz_loadu_epi8(k, data + lane_bytes * 3), 3);
+  __m512i sample = _mm512_shuffle_epi8(input, shuffle_mask);
+  sample = _mm512_srlv_epi16(sample, srlv_mask);
+  return _mm512_and_si512(sample, _mm512_set1_epi16(mask));
+}
+
+static inline void pack_32_avx512(__m512i sample, uint8_t* data, int lane_bytes,
+                                  const void* sllv_tbl, const void* hi_tbl,
+                                  const void* lo_tbl, uint16_t mask) {
+  __m512i sllv_mask = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)sllv_tbl));
+  __m512i hi_mask = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)hi_tbl));
+  __m512i lo_mask = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)lo_tbl));
+  __mmask16 k = (1 << lane_bytes) - 1; /* each lane only store the bytes of 8 samples */
+
+  sample = _mm512_and_si512(sample, _mm512_set1_epi16(mask));
+  sample = _mm512_sllv_epi16(sample, sllv_mask);
+  __m512i out = _mm512_or_si512(_mm512_shuffle_epi8(sample, hi_mask),
+                                _mm512_shuffle_epi8(sample, lo_mask));
+  _mm_mask_storeu_epi8(data, k, _mm512_castsi512_si128(out));
+  _mm_mask_storeu_epi8(data + lane_bytes, k, _mm512_extracti32x4_epi32(out, 1));
+  _mm_mask_storeu_epi8(data + lane_bytes * 2, k, _mm512_extracti32x4_epi32(out, 2));
+  _mm_mask_storeu_epi8(data + lane_bytes * 3, k, _mm512_extracti32x4_epi32(out, 3));
+}
+
+/* the 32 samples of 40 bytes */
+static inline __m512i be10_unpack_32_avx512(const uint8_t* data) {
+  return unpack_32_avx512(data, 10, be10_unpack_shuffle_tbl_512, be10_unpack_srlv_tbl_512,
+                          0x3ff);
+}
+
+static inline void be10_pack_32_avx512(__m512i sample, uint8_t* data) {
+  pack_32_avx512(sample, data, 10, be10_pack_sllv_tbl_512, be10_pack_hi_shuffle_tbl_512,
+                 be10_pack_lo_shuffle_tbl_512, 0x3ff);
+}
+
+/* the 32 samples of 48 bytes */
+static inline __m512i be12_unpack_32_avx512(const uint8_t* data) {
+  return unpack_32_avx512(data, 12, be12_unpack_shuffle_tbl_512, be12_unpack_srlv_tbl_512,
+                          0xfff);
+}
+
+static inline void be12_pack_32_avx512(__m512i sample, uint8_t* data) {
+  pack_32_avx512(sample, data, 12, be12_pack_sllv_tbl_512, be12_pack_hi_shuffle_tbl_512,
+                 be12_pack_lo_shuffle_tbl_512, 0xfff);
+}
+
+/* the index of each component from the 96 samples, the last of s2 with low 5 bits */
+static uint16_t yuv444_split_permute_tbl_512[32 * 3] = {
+    0,  3,  6,  9,  12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45, /* b_r 0 ~ 15 */
+    48, 51, 54, 57, 60, 63, 2,  5,  8,  11, 14, 17, 20, 23, 26, 29, /* b_r 16 ~ 31 */
+    1,  4,  7,  10, 13, 16, 19, 22, 25, 28, 31, 34, 37, 40, 43, 46, /* y_g 0 ~ 15 */
+    49, 52, 55, 58, 61, 0,  3,  6,  9,  12, 15, 18, 21, 24, 27, 30, /* y_g 16 ~ 31 */
+    2,  5,  8,  11, 14, 17, 20, 23, 26, 29, 32, 35, 38, 41, 44, 47, /* r_b 0 ~ 15 */
+    50, 53, 56, 59, 62, 1,  4,  7,  10, 13, 16, 19, 22, 25, 28, 31, /* r_b 16 ~ 31 */
+};
+
+/* the index of the 96 samples from b_r and y_g(32 + idx), r_b with the low 5 bits */
+static uint16_t yuv444_merge_permute_tbl_512[32 * 3] = {
+    0,  32, 0,  1,  33, 1,  2,  34, 2,  3,  35, 3,  4,  36, 4,  5,  /* s0 0 ~ 15 */
+    37, 5,  6,  38, 6,  7,  39, 7,  8,  40, 8,  9,  41, 9,  10, 42, /* s0 16 ~ 31 */
+    10, 11, 43, 11, 12, 44, 12, 13, 45, 13, 14, 46, 14, 15, 47, 15, /* s1 0 ~ 15 */
+    16, 48, 16, 17, 49, 17, 18, 50, 18, 19, 51, 19, 20, 52, 20, 21, /* s1 16 ~ 31 */
+    53, 21, 22, 54, 22, 23, 55, 23, 24, 56, 24, 25, 57, 25, 26, 58, /* s2 0 ~ 15 */
+    26, 27, 59, 27, 28, 60, 28, 29, 61, 29, 30, 62, 30, 31, 63, 31, /* s2 16 ~ 31 */
+};
+
+/* 96 samples of Cb_R Y_G Cr_B to 32 samples of each component */
+static inline void yuv444_split_96_avx512(__m512i s0, __m512i s1, __m512i s2,
+                                          uint16_t* b_r, uint16_t* y_g, uint16_t* r_b) {
+  /* the samples from s2 */
+  const __mmask32 k[3] = {0xffc00000, 0xffe00000, 0xffe00000};
+  uint16_t* dst[3] = {b_r, y_g, r_b};
+
+  for (int c = 0; c < 3; c++) {
+    __m512i idx = _mm512_loadu_si512(yuv444_split_permute_tbl_512 + c * 32);
+    __m512i out = _mm512_permutex2var_epi16(s0, idx, s1);
+    out = _mm512_mask_permutexvar_epi16(out, k[c], idx, s2);
+    _mm512_storeu_si512(dst[c], out);
+  }
+}
+
+/* 32 samples of each component to 96 samples of Cb_R Y_G Cr_B */
+static inline void yuv444_merge_96_avx512(uint16_t* b_r, uint16_t* y_g, uint16_t* r_b,
+                                          __m512i* s) {
+  /* the samples from r_b */
+  const __mmask32 k[3] = {0x24924924, 0x49249249, 0x92492492};
+  __m512i c0 = _mm512_loadu_si512(b_r);
+  __m512i c1 = _mm512_loadu_si512(y_g);
+  __m512i c2 = _mm512_loadu_si512(r_b);
+
+  for (int j = 0; j < 3; j++) {
+    __m512i idx = _mm512_loadu_si512(yuv444_merge_permute_tbl_512 + j * 32);
+    s[j] = _mm512_permutex2var_epi16(c0, idx, c1);
+    s[j] = _mm512_mask_permutexvar_epi16(s[j], k[j], idx, c2);
+  }
+}
+/* end rfc4175 sample helpers */
+
+/* begin 444 avx512, each loop with 32 pixels of 96 samples */
+int st20_rfc4175_444be10_to_444p10le_avx512(struct st20_rfc4175_444_10_pg4_be* pg,
+                                            uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                            uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 4;
+
+  while (pg_cnt >= 8) {
+    yuv444_split_96_avx512(be10_unpack_32_avx512(be), be10_unpack_32_avx512(be + 40),
+                           be10_unpack_32_avx512(be + 80), b_r, y_g, r_b);
+    be += 120;
+    y_g += 32;
+    b_r += 32;
+    r_b += 32;
+    pg_cnt -= 8;
+  }
+
+  if (pg_cnt) {
+    uint8_t src[120] = {0};
+    uint16_t dst_y_g[32], dst_b_r[32], dst_r_b[32];
+
+    rte_memcpy(src, be, pg_cnt * 15);
+    yuv444_split_96_avx512(be10_unpack_32_avx512(src), be10_unpack_32_avx512(src + 40),
+                           be10_unpack_32_avx512(src + 80), dst_b_r, dst_y_g, dst_r_b);
+    rte_memcpy(y_g, dst_y_g, pg_cnt * 8);
+    rte_memcpy(b_r, dst_b_r, pg_cnt * 8);
+    rte_memcpy(r_b, dst_r_b, pg_cnt * 8);
+  }
+
+  return 0;
+}
+
+int st20_444p10le_to_rfc4175_444be10_avx512(uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                            struct st20_rfc4175_444_10_pg4_be* pg,
+                                            uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 4;
+  __m512i s[3];
+
+  while (pg_cnt >= 8) {
+    yuv444_merge_96_avx512(b_r, y_g, r_b, s);
+    be10_pack_32_avx512(s[0], be);
+    be10_pack_32_avx512(s[1], be + 40);
+    be10_pack_32_avx512(s[2], be + 80);
+    be += 120;
+    y_g += 32;
+    b_r += 32;
+    r_b += 32;
+    pg_cnt -= 8;
+  }
+
+  if (pg_cnt) {
+    uint16_t src_y_g[32] = {0}, src_b_r[32] = {0}, src_r_b[32] = {0};
+    uint8_t dst[120];
+
+    rte_memcpy(src_y_g, y_g, pg_cnt * 8);
+    rte_memcpy(src_b_r, b_r, pg_cnt * 8);
+    rte_memcpy(src_r_b, r_b, pg_cnt * 8);
+    yuv444_merge_96_avx512(src_b_r, src_y_g, src_r_b, s);
+    be10_pack_32_avx512(s[0], dst);
+    be10_pack_32_avx512(s[1], dst + 40);
+    be10_pack_32_avx512(s[2], dst + 80);
+    rte_memcpy(be, dst, pg_cnt * 15);
+  }
+
+  return 0;
+}
+
+int st20_rfc4175_444be12_to_444p12le_avx512(struct st20_rfc4175_444_12_pg2_be* pg,
+                                            uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                            uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+
+  while (pg_cnt >= 16) {
+    yuv444_split_96_avx512(be12_unpack_32_avx512(be), be12_unpack_32_avx512(be + 48),
+                           be12_unpack_32_avx512(be + 96), b_r, y_g, r_b);
+    be += 144;
+    y_g += 32;
+    b_r += 32;
+    r_b += 32;
+    pg_cnt -= 16;
+  }
+
+  if (pg_cnt) {
+    uint8_t src[144] = {0};
+    uint16_t dst_y_g[32], dst_b_r[32], dst_r_b[32];
+
+    rte_memcpy(src, be, pg_cnt * 9);
+    yuv444_split_96_avx512(be12_unpack_32_avx512(src), be12_unpack_32_avx512(src + 48),
+                           be12_unpack_32_avx512(src + 96), dst_b_r, dst_y_g, dst_r_b);
+    rte_memcpy(y_g, dst_y_g, pg_cnt * 4);
+    rte_memcpy(b_r, dst_b_r, pg_cnt * 4);
+    rte_memcpy(r_b, dst_r_b, pg_cnt * 4);
+  }
+
+  return 0;
+}
+
+int st20_444p12le_to_rfc4175_444be12_avx512(uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                            struct st20_rfc4175_444_12_pg2_be* pg,
+                                            uint32_t w, uint32_t h) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+  __m512i s[3];
+
+  while (pg_cnt >= 16) {
+    yuv444_merge_96_avx512(b_r, y_g, r_b, s);
+    be12_pack_32_avx512(s[0], be);
+    be12_pack_32_avx512(s[1], be + 48);
+    be12_pack_32_avx512(s[2], be + 96);
+    be += 144;
+    y_g += 32;
+    b_r += 32;
+    r_b += 32;
+    pg_cnt -= 16;
+  }
+
+  if (pg_cnt) {
+    uint16_t src_y_g[32] = {0}, src_b_r[32] = {0}, src_r_b[32] = {0};
+    uint8_t dst[144];
+
+    rte_memcpy(src_y_g, y_g, pg_cnt * 4);
+    rte_memcpy(src_b_r, b_r, pg_cnt * 4);
+    rte_memcpy(src_r_b, r_b, pg_cnt * 4);
+    yuv444_merge_96_avx512(src_b_r, src_y_g, src_r_b, s);
+    be12_pack_32_avx512(s[0], dst);
+    be12_pack_32_avx512(s[1], dst + 48);
+    be12_pack_32_avx512(s[2], dst + 96);
+    rte_memcpy(be, dst, pg_cnt * 9);
+  }
+
+  return 0;
+}
+/* end 444 avx512 */
+
+/* begin rfc4175 422be10 rgb avx512, each loop with 16 pixels of 8 pgs */
+/* Cb Y0 Cr Y1 to the (Y, Cb) and (Y, Cr) pair of each pixel */
+static uint8_t yuv422_ycb_shuffle_tbl_512[16] = {
+    2, 3, 0, 1, 6, 7, 0, 1, 10, 11, 8, 9, 14, 15, 8, 9,
+};
+
+static uint8_t yuv422_ycr_shuffle_tbl_512[16] = {
+    2, 3, 4, 5, 6, 7, 4, 5, 10, 11, 12, 13, 14, 15, 12, 13,
+};
+
+/* B0 ~ 3, G0 ~ 3, R0 ~ 3, A0 ~ 3 to the pixels */
+static uint8_t bgra_to_argb_shuffle_tbl_512[16] = {
+    12, 8, 4, 0, 13, 9, 5, 1, 14, 10, 6, 2, 15, 11, 7, 3,
+};
+
+static uint8_t bgra_to_bgra_shuffle_tbl_512[16] = {
+    0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+};
+
+static uint8_t bgra_to_rgb8_shuffle_tbl_512[16] = {
+    8, 4, 0, 9, 5, 1, 10, 6, 2, 11, 7, 3, 0x80, 0x80, 0x80, 0x80,
+};
+
+/* the pixels to the (R, G) pair and the (B, 0) pair of each pixel */
+static uint8_t argb_to_rg_shuffle_tbl_512[16] = {
+    1, 0x80, 2, 0x80, 5, 0x80, 6, 0x80, 9, 0x80, 10, 0x80, 13, 0x80, 14, 0x80,
+};
+
+static uint8_t argb_to_b_shuffle_tbl_512[16] = {
+    3, 0x80, 0x80, 0x80, 7, 0x80, 0x80, 0x80, 11, 0x80, 0x80, 0x80, 15, 0x80, 0x80, 0x80,
+};
+
+static uint8_t bgra_to_rg_shuffle_tbl_512[16] = {
+    2, 0x80, 1, 0x80, 6, 0x80, 5, 0x80, 10, 0x80, 9, 0x80, 14, 0x80, 13, 0x80,
+};
+
+static uint8_t bgra_to_b_shuffle_tbl_512[16] = {
+    0, 0x80, 0x80, 0x80, 4, 0x80, 0x80, 0x80, 8, 0x80, 0x80, 0x80, 12, 0x80, 0x80, 0x80,
+};
+
+static uint8_t rgb8_to_rg_shuffle_tbl_512[16] = {
+    0, 0x80, 1, 0x80, 3, 0x80, 4, 0x80, 6, 0x80, 7, 0x80, 9, 0x80, 10, 0x80,
+};
+
+static uint8_t rgb8_to_b_shuffle_tbl_512[16] = {
+    2, 0x80, 0x80, 0x80, 5, 0x80, 0x80, 0x80, 8, 0x80, 0x80, 0x80, 11, 0x80, 0x80, 0x80,
+};
+
+/* Cb0 Cb1 Cr0 Cr1 Y0 Y1 Y2 Y3 to Cb0 Y0 Cr0 Y1 Cb1 Y2 Cr1 Y3 */
+static uint8_t yuv422_from_rgb_shuffle_tbl_512[16] = {
+    0, 1, 8, 9, 4, 5, 10, 11, 2, 3, 12, 13, 6, 7, 14, 15,
+};
+
+/* the 12 bytes of each lane for rgb8 */
+static uint32_t rgb8_store_permute_tbl_512[16] = {
+    0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15,
+};
+
+static uint32_t rgb8_load_permute_tbl_512[16] = {
+    0, 1, 2, 0, 3, 4, 5, 0, 6, 7, 8, 0, 9, 10, 11, 0,
+};
+
+static inline __m512i broadcast_tbl_avx512(const void* tbl) {
+  return _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)tbl));
+}
+
+static inline __m512i coeff_pair_avx512(int16_t lo, int16_t hi) {
+  return _mm512_set1_epi32((uint16_t)lo | ((uint32_t)(uint16_t)hi << 16));
+}
+
+struct rgb_coeffs_avx512 {
+  __m512i offset;
+  __m512i ycb_b, ycb_g, ycr_g, ycr_r;
+  __m512i rg_y, b_y, rg_cb, b_cb, rg_cr, b_cr;
+};
+
+static void rgb_coeffs_avx512_init(const struct st_color_coeffs* c,
+                                   struct rgb_coeffs_avx512* v) {
+  v->offset = _mm512_set1_epi32(((uint32_t)c->y_offset << 16) | 512);
+  v->ycb_b = coeff_pair_avx512(c->y, c->cb_b);
+  v->ycb_g = coeff_pair_avx512(c->y, c->cb_g);
+  v->ycr_g = coeff_pair_avx512(0, c->cr_g);
+  v->ycr_r = coeff_pair_avx512(c->y, c->cr_r);
+  v->rg_y = coeff_pair_avx512(c->r_y, c->g_y);
+  v->b_y = coeff_pair_avx512(c->b_y, 0);
+  v->rg_cb = coeff_pair_avx512(c->r_cb, c->g_cb);
+  v->b_cb = coeff_pair_avx512(c->b_cb, 0);
+  v->rg_cr = coeff_pair_avx512(c->r_cr, c->g_cr);
+  v->b_cr = coeff_pair_avx512(c->b_cr, 0);
+}
+
+static int rgb_shuffle_tbl_avx512(enum st_frame_fmt fmt, const void** to_rgb,
+                                  const void** to_rg, const void** to_b) {
+  switch (fmt) {
+    case ST_FRAME_FMT_ARGB:
+      *to_rgb = bgra_to_argb_shuffle_tbl_512;
+      *to_rg = argb_to_rg_shuffle_tbl_512;
+      *to_b = argb_to_b_shuffle_tbl_512;
+      return 4;
+    case ST_FRAME_FMT_BGRA:
+      *to_rgb = bgra_to_bgra_shuffle_tbl_512;
+      *to_rg = bgra_to_rg_shuffle_tbl_512;
+      *to_b = bgra_to_b_shuffle_tbl_512;
+      return 4;
+    case ST_FRAME_FMT_RGB8:
+      *to_rgb = bgra_to_rgb8_shuffle_tbl_512;
+      *to_rg = rgb8_to_rg_shuffle_tbl_512;
+      *to_b = rgb8_to_b_shuffle_tbl_512;
+      return 3;
+    default:
+      return -EINVAL;
+  }
+}
+
+/* 32 samples of 16 pixels to B0 ~ 3, G0 ~ 3, R0 ~ 3, A0 ~ 3 in each lane */
+static inline __m512i yuv422_to_bgra_16_avx512(__m512i sample,
+                                               const struct rgb_coeffs_avx512* v) {
+  __m512i rnd = _mm512_set1_epi32(1 << 13);
+
+  sample = _mm512_sub_epi16(sample, v->offset);
+  __m512i ycb =
+      _mm512_shuffle_epi8(sample, broadcast_tbl_avx512(yuv422_ycb_shuffle_tbl_512));
+  __m512i ycr =
+      _mm512_shuffle_epi8(sample, broadcast_tbl_avx512(yuv422_ycr_shuffle_tbl_512));
+  __m512i b = _mm512_add_epi32(_mm512_madd_epi16(ycb, v->ycb_b), rnd);
+  __m512i g = _mm512_add_epi32(_mm512_madd_epi16(ycb, v->ycb_g), rnd);
+  g = _mm512_add_epi32(g, _mm512_madd_epi16(ycr, v->ycr_g));
+  __m512i r = _mm512_add_epi32(_mm512_madd_epi16(ycr, v->ycr_r), rnd);
+  __m512i bg = _mm512_packs_epi32(_mm512_srai_epi32(b, 14), _mm512_srai_epi32(g, 14));
+  __m512i ra = _mm512_packs_epi32(_mm512_srai_epi32(r, 14), _mm512_set1_epi32(0xff));
+  return _mm512_packus_epi16(bg, ra);
+}
+
+/* the (R, G) and (B, 0) pairs of 4 pixels in each lane to 32 samples */
+static inline __m512i rgb_to_yuv422_16_avx512(__m512i rg, __m512i b,
+                                              const struct rgb_coeffs_avx512* v,
+                                              __m512i y_base, __m512i c_base) {
+  __m512i y =
+      _mm512_add_epi32(_mm512_madd_epi16(rg, v->rg_y), _mm512_madd_epi16(b, v->b_y));
+  y = _mm512_srai_epi32(_mm512_add_epi32(y, y_base), 12);
+  __m512 cb = _mm512_castsi512_ps(_mm512_add_epi32(_mm512_madd_epi16(rg, v->rg_cb),
+                                                   _mm512_madd_epi16(b, v->b_cb)));
+  __m512 cr = _mm512_castsi512_ps(_mm512_add_epi32(_mm512_madd_epi16(rg, v->rg_cr),
+                                                   _mm512_madd_epi16(b, v->b_cr)));
+  /* the sum of the pixel pairs, Cb0 Cb1 Cr0 Cr1 in each lane */
+  __m512i c = _mm512_add_epi32(_mm512_castps_si512(_mm512_shuffle_ps(cb, cr, 0x88)),
+                               _mm512_castps_si512(_mm512_shuffle_ps(cb, cr, 0xDD)));
+  c = _mm512_srai_epi32(_mm512_add_epi32(c, c_base), 13);
+  __m512i sample = _mm512_packs_epi32(c, y);
+  sample = _mm512_max_epi16(sample, _mm512_setzero_si512());
+  sample = _mm512_min_epi16(sample, _mm512_set1_epi16(0x3ff));
+  return _mm512_shuffle_epi8(sample,
+                             broadcast_tbl_avx512(yuv422_from_rgb_shuffle_tbl_512));
+}
+
+static inline void rgb_store_16_avx512(__m512i bgra, uint8_t* rgb, __m512i shuffle,
+                                       int pixel_size) {
+  __m512i out = _mm512_shuffle_epi8(bgra, shuffle);
+  if (pixel_size == 4) {
+    _mm512_storeu_si512(rgb, out);
+    return;
+  }
+  out = _mm512_permutexvar_epi32(_mm512_loadu_si512(rgb8_store_permute_tbl_512), out);
+  _mm512_mask_storeu_epi8(rgb, 0xffffffffffff, out);
+}
+
+static inline __m512i rgb_load_16_avx512(const uint8_t* rgb, int pixel_size) {
+  if (pixel_size == 4) return _mm512_loadu_si512(rgb);
+  __m512i in = _mm512_maskz_loadu_epi8(0xffffffffffff, rgb);
+  return _mm512_permutexvar_epi32(_mm512_loadu_si512(rgb8_load_permute_tbl_512), in);
+}
+
+int st20_rfc4175_422be10_to_rgb_avx512(struct st20_rfc4175_422_10_pg2_be* pg,
+                                       uint8_t* rgb, enum st_frame_fmt fmt, uint32_t w,
+                                       uint32_t h, const struct st_color_coeffs* coeffs) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+  const void *to_rgb, *to_rg, *to_b;
+  struct rgb_coeffs_avx512 v;
+
+  int pixel_size = rgb_shuffle_tbl_avx512(fmt, &to_rgb, &to_rg, &to_b);
+  if (pixel_size < 0) return pixel_size;
+  __m512i shuffle = broadcast_tbl_avx512(to_rgb);
+  rgb_coeffs_avx512_init(coeffs, &v);
+
+  while (pg_cnt >= 8) {
+    rgb_store_16_avx512(yuv422_to_bgra_16_avx512(be10_unpack_32_avx512(be), &v), rgb,
+                        shuffle, pixel_size);
+    be += 40;
+    rgb += pixel_size * 16;
+    pg_cnt -= 8;
+  }
+
+  if (pg_cnt) {
+    uint8_t src[40] = {0};
+    uint8_t dst[64];
+
+    rte_memcpy(src, be, pg_cnt * 5);
+    rgb_store_16_avx512(yuv422_to_bgra_16_avx512(be10_unpack_32_avx512(src), &v), dst,
+                        shuffle, pixel_size);
+    rte_memcpy(rgb, dst, pg_cnt * 2 * pixel_size);
+  }
+
+  return 0;
+}
+
+int st20_rgb_to_rfc4175_422be10_avx512(uint8_t* rgb, enum st_frame_fmt fmt,
+                                       struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                       uint32_t h, const struct st_color_coeffs* coeffs) {
+  uint8_t* be = (uint8_t*)pg;
+  uint32_t pg_cnt = w * h / 2;
+  const void *to_rgb, *to_rg, *to_b;
+  struct rgb_coeffs_avx512 v;
+
+  int pixel_size = rgb_shuffle_tbl_avx512(fmt, &to_rgb, &to_rg, &to_b);
+  if (pixel_size < 0) return pixel_size;
+  __m512i rg_shuffle = broadcast_tbl_avx512(to_rg);
+  __m512i b_shuffle = broadcast_tbl_avx512(to_b);
+  __m512i y_base = _mm512_set1_epi32((coeffs->y_offset << 12) + (1 << 11));
+  __m512i c_base = _mm512_set1_epi32((512 << 13) + (1 << 12));
+  rgb_coeffs_avx512_init(coeffs, &v);
+
+  while (pg_cnt >= 8) {
+    __m512i in = rgb_load_16_avx512(rgb, pixel_size);
+    __m512i rg = _mm512_shuffle_epi8(in, rg_shuffle);
+    __m512i b = _mm512_shuffle_epi8(in, b_shuffle);
+    be10_pack_32_avx512(rgb_to_yuv422_16_avx512(rg, b, &v, y_base, c_base), be);
+    rgb += pixel_size * 16;
+    be += 40;
+    pg_cnt -= 8;
+  }
+
+  if (pg_cnt) {
+    uint8_t src[64] = {0};
+    uint8_t dst[40];
+
+    rte_memcpy(src, rgb, pg_cnt * 2 * pixel_size);
+    __m512i in = rgb_load_16_avx512(src, pixel_size);
+    __m512i rg = _mm512_shuffle_epi8(in, rg_shuffle);
+    __m512i b = _mm512_shuffle_epi8(in, b_shuffle);
+    be10_pack_32_avx512(rgb_to_yuv422_16_avx512(rg, b, &v, y_base, c_base), dst);
+    rte_memcpy(be, dst, pg_cnt * 5);
+  }
+
+  return 0;
+}
+/* end rfc4175 422be10 rgb avx512 */
+
+/* begin scale avx512, the coeffs pair of two taps madd with two samples in one dword */
+uint32_t st_scale_h_avx512(const uint16_t* src, uint16_t* dst,
+                           const struct st_scale_filter* f, uint32_t x) {
+  const int32_t* coeffs = (const int32_t*)f->coeffs;
+  uint32_t w = f->dst_size;
+  uint32_t pairs = f->taps / 2;
+  __m512i round = _mm512_set1_epi32(1 << (ST_SCALE_COEFF_BITS - 1));
+  __m512i step = _mm512_set1_epi32(2);
+
+  /* 16 outputs each loop, the samples pair of each tap pair gathered as one dword */
+  while ((w - x) >= 16) {
+    __m512i idx = _mm512_loadu_si512((__m512i*)(f->start + x));
+    __m512i sum = round;
+    for (uint32_t p = 0; p < pairs; p++) {
+      __m512i sample = _mm512_i32gather_epi32(idx, (const int*)src, 2);
+      __m512i coeff = _mm512_loadu_si512((__m512i*)(coeffs + p * w + x));
+      sum = _mm512_add_epi32(sum, _mm512_madd_epi16(sample, coeff));
+      idx = _mm512_add_epi32(idx, step);
+    }
+    sum = _mm512_srai_epi32(sum, ST_SCALE_COEFF_BITS);
+    _mm256_storeu_si256((__m256i*)(dst + x), _mm512_cvtusepi32_epi16(sum));
+    x += 16;
+  }
+
+  return x;
+}
+
+uint32_t st_scale_v_avx512(uint16_t* const* lines, uint16_t* dst, uint32_t w,
+                           const struct st_scale_filter* f, uint32_t y, uint32_t x) {
+  const int32_t* coeffs = (const int32_t*)f->coeffs;
+  uint32_t pairs = f->taps / 2;
+  __m512i round = _mm512_set1_epi32(1 << (ST_SCALE_COEFF_BITS - 1));
+
+  /* 32 outputs each loop, the samples of two lines interleaved for the tap pair */
+  while ((w - x) >= 32) {
+    __m512i sum_lo = round;
+    __m512i sum_hi = round;
+    for (uint32_t p = 0; p < pairs; p++) {
+      __m512i coeff = _mm512_set1_epi32(coeffs[p * f->dst_size + y]);
+      __m512i l0 = _mm512_loadu_si512((__m512i*)(lines[p * 2] + x));
+      __m512i l1 = _mm512_loadu_si512((__m512i*)(lines[p * 2 + 1] + x));
+      __m512i lo = _mm512_unpacklo_epi16(l0, l1);
+      __m512i hi = _mm512_unpackhi_epi16(l0, l1);
+      sum_lo = _mm512_add_epi32(sum_lo, _mm512_madd_epi16(lo, coeff));
+      sum_hi = _mm512_add_epi32(sum_hi, _mm512_madd_epi16(hi, coeff));
+    }
+    sum_lo = _mm512_srai_epi32(sum_lo, ST_SCALE_COEFF_BITS);
+    sum_hi = _mm512_srai_epi32(sum_hi, ST_SCALE_COEFF_BITS);
+    /* the lo/hi unpack is per 128 bit lane, the pack restore the order */
+    _mm512_storeu_si512((__m512i*)(dst + x), _mm512_packus_epi32(sum_lo, sum_hi));
+    x += 32;
+  }
+
+  return x;
+}
+/* end scale avx512 */
+
+/* begin st40 udw avx512, the udws share the be10 sample helpers */
+/* b9 is the inverse of b8, b8 is the even parity of b0 ~ b7 */
+static inline __m512i st40_udw_add_parity_avx512(__m512i val) {
+  val = _mm512_and_si512(val, _mm512_set1_epi16(0xff));
+  __m512i p = _mm512_xor_si512(val, _mm512_srli_epi16(val, 4));
+  p = _mm512_xor_si512(p, _mm512_srli_epi16(p, 2));
+  p = _mm512_xor_si512(p, _mm512_srli_epi16(p, 1));
+  /* odd parity to 0x100, even to 0x200 */
+  __mmask32 odd = _mm512_test_epi16_mask(p, _mm512_set1_epi16(0x1));
+  __m512i parity = _mm512_mask_blend_epi16(odd, _mm512_set1_epi16(0x200),
+                                           _mm512_set1_epi16(0x100));
+  return _mm512_or_si512(val, parity);
+}
+
+uint32_t st40_udws_unpack_avx512(const uint8_t* data, uint16_t* udws, uint32_t num) {
+  uint32_t i = 0;
+
+  while ((num - i) >= 32) {
+    __m512i udw = be10_unpack_32_avx512(data);
+    _mm512_storeu_si512((__m512i*)(udws + i), udw);
+    data += 40;
+    i += 32;
+  }
+
+  return i;
+}
+
+uint32_t st40_udws_pack_avx512(const uint16_t* udws, uint8_t* data, uint32_t num) {
+  uint32_t i = 0;
+
+  while ((num - i) >= 32) {
+    __m512i udw = _mm512_loadu_si512((__m512i*)(udws + i));
+    be10_pack_32_avx512(udw, data);
+    data += 40;
+    i += 32;
+  }
+
+  return i;
+}
+
+uint32_t st40_udws_pack_parity_avx512(const uint8_t* words, uint8_t* data,
+                                      uint32_t num) {
+  uint32_t i = 0;
+
+  while ((num - i) >= 32) {
+    __m512i val = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(words + i)));
+    be10_pack_32_avx512(st40_udw_add_parity_avx512(val), data);
+    data += 40;
+    i += 32;
+  }
+
+  return i;
+}
+
+uint32_t st40_udws_sum_avx512(const uint8_t* data, uint32_t num, uint16_t* sum) {
+  uint32_t i = 0;
+  __m512i acc = _mm512_setzero_si512();
+
+  /* 10 bits udw can't overflow the 32 bits lane for any anc payload size */
+  while ((num - i) >= 32) {
+    __m512i udw = be10_unpack_32_avx512(data);
+    acc = _mm512_add_epi32(acc, _mm512_madd_epi16(udw, _mm512_set1_epi16(1)));
+    data += 40;
+    i += 32;
+  }
+
+  *sum = (uint16_t)_mm512_reduce_add_epi32(acc);
+  return i;
+}
+/* end st40 udw avx512 */
 MT_TARGET_CODE_STOP
 #endif
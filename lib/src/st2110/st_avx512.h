@@ -119,4 +119,45 @@ int st20_rfc4175_422be10_to_yuv420p8_avx512(struct st20_rfc4175_422_10_pg2_be* p
                                             uint8_t* y, uint8_t* b, uint8_t* r,
                                             uint32_t w, uint32_t h);
 
+int st20_rfc4175_444be10_to_444p10le_avx512(struct st20_rfc4175_444_10_pg4_be* pg,
+                                            uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                            uint32_t w, uint32_t h);
+
+int st20_444p10le_to_rfc4175_444be10_avx512(uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                            struct st20_rfc4175_444_10_pg4_be* pg,
+                                            uint32_t w, uint32_t h);
+
+int st20_rfc4175_444be12_to_444p12le_avx512(struct st20_rfc4175_444_12_pg2_be* pg,
+                                            uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                            uint32_t w, uint32_t h);
+
+int st20_444p12le_to_rfc4175_444be12_avx512(uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
+                                            struct st20_rfc4175_444_12_pg2_be* pg,
+                                            uint32_t w, uint32_t h);
+
+int st20_rfc4175_422be10_to_rgb_avx512(struct st20_rfc4175_422_10_pg2_be* pg,
+                                       uint8_t* rgb, enum st_frame_fmt fmt, uint32_t w,
+                                       uint32_t h, const struct st_color_coeffs* coeffs);
+
+int st20_rgb_to_rfc4175_422be10_avx512(uint8_t* rgb, enum st_frame_fmt fmt,
+                                       struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                       uint32_t h, const struct st_color_coeffs* coeffs);
+
+/* the scale kernels start from output x, return the outputs done */
+uint32_t st_scale_h_avx512(const uint16_t* src, uint16_t* dst,
+                           const struct st_scale_filter* f, uint32_t x);
+
+uint32_t st_scale_v_avx512(uint16_t* const* lines, uint16_t* dst, uint32_t w,
+                           const struct st_scale_filter* f, uint32_t y, uint32_t x);
+
+/* st40 udw kernels start at a byte aligned udw, return the number of udws handled */
+uint32_t st40_udws_unpack_avx512(const uint8_t* data, uint16_t* udws, uint32_t num);
+
+uint32_t st40_udws_pack_avx512(const uint16_t* udws, uint8_t* data, uint32_t num);
+
+uint32_t st40_udws_pack_parity_avx512(const uint8_t* words, uint8_t* data,
+                                      uint32_t num);
+
+uint32_t st40_udws_sum_avx512(const uint8_t* data, uint32_t num, uint16_t* sum);
+
 #endif
\ No newline at end of file
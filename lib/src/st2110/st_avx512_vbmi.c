@@ -1933,5 +1933,167 @@ int st20_rfc4175_422be12_to_yuv422p12le_avx512_vbmi_dma(
   return 0;
 }
 /* end st20_rfc4175_422be12_to_yuv422p12le_avx512_vbmi */
+
+/* begin 444 avx512_vbmi, the byte permute pick the 2 bytes of each sample */
+static uint8_t be10_to_444p_permute_tbl_512[64 * 3] = {
+    1,   0,   4,   3,   8,   7,   12,  11,  /* b_r 0 ~ 3 */
+    16,  15,  19,  18,  23,  22,  27,  26,  /* b_r 4 ~ 7 */
+    31,  30,  34,  33,  38,  37,  42,  41,  /* b_r 8 ~ 11 */
+    46,  45,  49,  48,  53,  52,  57,  56,  /* b_r 12 ~ 15 */
+    61,  60,  64,  63,  68,  67,  72,  71,  /* b_r 16 ~ 19 */
+    76,  75,  79,  78,  83,  82,  87,  86,  /* b_r 20 ~ 23 */
+    91,  90,  94,  93,  98,  97,  102, 101, /* b_r 24 ~ 27 */
+    106, 105, 109, 108, 113, 112, 117, 116, /* b_r 28 ~ 31 */
+    2,   1,   6,   5,   9,   8,   13,  12,  /* y_g 0 ~ 3 */
+    17,  16,  21,  20,  24,  23,  28,  27,  /* y_g 4 ~ 7 */
+    32,  31,  36,  35,  39,  38,  43,  42,  /* y_g 8 ~ 11 */
+    47,  46,  51,  50,  54,  53,  58,  57,  /* y_g 12 ~ 15 */
+    62,  61,  66,  65,  69,  68,  73,  72,  /* y_g 16 ~ 19 */
+    77,  76,  81,  80,  84,  83,  88,  87,  /* y_g 20 ~ 23 */
+    92,  91,  96,  95,  99,  98,  103, 102, /* y_g 24 ~ 27 */
+    107, 106, 111, 110, 114, 113, 118, 117, /* y_g 28 ~ 31 */
+    3,   2,   7,   6,   11,  10,  14,  13,  /* r_b 0 ~ 3 */
+    18,  17,  22,  21,  26,  25,  29,  28,  /* r_b 4 ~ 7 */
+    33,  32,  37,  36,  41,  40,  44,  43,  /* r_b 8 ~ 11 */
+    48,  47,  52,  51,  56,  55,  59,  58,  /* r_b 12 ~ 15 */
+    63,  62,  67,  66,  71,  70,  74,  73,  /* r_b 16 ~ 19 */
+    78,  77,  82,  81,  86,  85,  89,  88,  /* r_b 20 ~ 23 */
+    93,  92,  97,  96,  101, 100, 104, 103, /* r_b 24 ~ 27 */
+    108, 107, 112, 111, 116, 115, 119, 118, /* r_b 28 ~ 31 */
+};
+
+static uint16_t be10_to_444p_srlv_tbl_512[8 * 3] = {
+    6, 0, 2, 4, 6, 0, 2, 4, /* b_r */
+    4, 6, 0, 2, 4, 6, 0, 2, /* y_g */
+    2, 4, 6, 0, 2, 4, 6, 0, /* r_b */
+};
+
+int st20_rfc4175_444be10_to_444p10le_avx512_vbmi(struct st20_rfc4175_444_10_pg4_be* pg,
+                                                 uint16_t* y_g, uint16_t* b_r,
+                                                 uint16_t* r_b, uint32_t w, uint32_t h) {
+  __m512i permute[3], srlv[3];
+  __m512i and_mask = _mm512_set1_epi16(0x3ff);
+  __mmask64 k = 0xFFFFFFFFFFFFFF; /* the last 56 bytes of 8 pg groups */
+  uint16_t* dst[3] = {b_r, y_g, r_b};
+  uint8_t* be = (uint8_t*)pg;
+  int pg_cnt = w * h / 4;
+  dbg("%s, pg_cnt %d\n", __func__, pg_cnt);
+
+  for (int c = 0; c < 3; c++) {
+    permute[c] = _mm512_loadu_si512(be10_to_444p_permute_tbl_512 + c * 64);
+    srlv[c] = _mm512_broadcast_i32x4(
+        _mm_loadu_si128((__m128i*)(be10_to_444p_srlv_tbl_512 + c * 8)));
+  }
+
+  /* each batch handle 8 pg groups, 32 pixels in 120 bytes */
+  while (pg_cnt >= 8) {
+    __m512i input0 = _mm512_loadu_si512(be);
+    __m512i input1 = _mm512_maskz_loadu_epi8(k, be + 64);
+    for (int c = 0; c < 3; c++) {
+      __m512i sample = _mm512_permutex2var_epi8(input0, permute[c], input1);
+      sample = _mm512_and_si512(_mm512_srlv_epi16(sample, srlv[c]), and_mask);
+      _mm512_storeu_si512(dst[c], sample);
+      dst[c] += 32;
+    }
+    be += 120;
+    pg_cnt -= 8;
+  }
+
+  if (pg_cnt > 0) {
+    /* the tail, 7 pg groups at most in 105 bytes */
+    int bytes = pg_cnt * 15;
+    __mmask32 k_store = ((uint64_t)1 << (pg_cnt * 4)) - 1;
+    __m512i input0, input1;
+
+    if (bytes > 64) {
+      input0 = _mm512_loadu_si512(be);
+      input1 = _mm512_maskz_loadu_epi8(((uint64_t)1 << (bytes - 64)) - 1, be + 64);
+    } else {
+      input0 = _mm512_maskz_loadu_epi8(((uint64_t)1 << bytes) - 1, be);
+      input1 = _mm512_setzero_si512();
+    }
+    for (int c = 0; c < 3; c++) {
+      __m512i sample = _mm512_permutex2var_epi8(input0, permute[c], input1);
+      sample = _mm512_and_si512(_mm512_srlv_epi16(sample, srlv[c]), and_mask);
+      _mm512_mask_storeu_epi16(dst[c], k_store, sample);
+    }
+  }
+
+  return 0;
+}
+
+static uint8_t be12_to_444p_permute_tbl_512[64 * 2] = {
+    1,  0,  5,  4,  10, 9,  14, 13, /* b_r 0 ~ 3 */
+    19, 18, 23, 22, 28, 27, 32, 31, /* b_r 4 ~ 7 */
+    37, 36, 41, 40, 46, 45, 50, 49, /* b_r 8 ~ 11 */
+    55, 54, 59, 58, 64, 63, 68, 67, /* b_r 12 ~ 15 */
+    2,  1,  7,  6,  11, 10, 16, 15, /* y_g 0 ~ 3 */
+    20, 19, 25, 24, 29, 28, 34, 33, /* y_g 4 ~ 7 */
+    38, 37, 43, 42, 47, 46, 52, 51, /* y_g 8 ~ 11 */
+    56, 55, 61, 60, 65, 64, 70, 69, /* y_g 12 ~ 15 */
+    4,  3,  8,  7,  13, 12, 17, 16, /* r_b 0 ~ 3 */
+    22, 21, 26, 25, 31, 30, 35, 34, /* r_b 4 ~ 7 */
+    40, 39, 44, 43, 49, 48, 53, 52, /* r_b 8 ~ 11 */
+    58, 57, 62, 61, 67, 66, 71, 70, /* r_b 12 ~ 15 */
+    4,  3,  8,  7,  13, 12, 17, 16, /* r_b 0 ~ 3 */
+    22, 21, 26, 25, 31, 30, 35, 34, /* r_b 4 ~ 7 */
+    40, 39, 44, 43, 49, 48, 53, 52, /* r_b 8 ~ 11 */
+    58, 57, 62, 61, 67, 66, 71, 70, /* r_b 12 ~ 15 */
+};
+
+static uint16_t be12_to_444p_srlv_tbl_512[32 * 2] = {
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, /* b_r 0 ~ 15 */
+    0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, /* y_g 0 ~ 15 */
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, /* r_b 0 ~ 15 */
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, /* r_b 0 ~ 15 */
+};
+
+int st20_rfc4175_444be12_to_444p12le_avx512_vbmi(struct st20_rfc4175_444_12_pg2_be* pg,
+                                                 uint16_t* y_g, uint16_t* b_r,
+                                                 uint16_t* r_b, uint32_t w, uint32_t h) {
+  __m512i permute_br_yg = _mm512_loadu_si512(be12_to_444p_permute_tbl_512);
+  __m512i permute_rb = _mm512_loadu_si512(be12_to_444p_permute_tbl_512 + 64);
+  __m512i srlv_br_yg = _mm512_loadu_si512(be12_to_444p_srlv_tbl_512);
+  __m512i srlv_rb = _mm512_loadu_si512(be12_to_444p_srlv_tbl_512 + 32);
+  __m512i and_mask = _mm512_set1_epi16(0xfff);
+  __mmask64 k = 0xFF; /* the last 8 bytes of 8 pg groups */
+  uint8_t* be = (uint8_t*)pg;
+  int pg_cnt = w * h / 2;
+  dbg("%s, pg_cnt %d\n", __func__, pg_cnt);
+
+  /* each batch handle 8 pg groups, 16 pixels in 72 bytes */
+  while (pg_cnt > 0) {
+    __m512i input0, input1;
+    int cnt = RTE_MIN(pg_cnt, 8);
+
+    if (cnt == 8) {
+      input0 = _mm512_loadu_si512(be);
+      input1 = _mm512_maskz_loadu_epi8(k, be + 64);
+    } else {
+      /* the tail, 7 pg groups at most in 63 bytes */
+      input0 = _mm512_maskz_loadu_epi8(((uint64_t)1 << (cnt * 9)) - 1, be);
+      input1 = _mm512_setzero_si512();
+    }
+
+    __m512i br_yg = _mm512_permutex2var_epi8(input0, permute_br_yg, input1);
+    br_yg = _mm512_and_si512(_mm512_srlv_epi16(br_yg, srlv_br_yg), and_mask);
+    __m512i rb = _mm512_permutex2var_epi8(input0, permute_rb, input1);
+    rb = _mm512_and_si512(_mm512_srlv_epi16(rb, srlv_rb), and_mask);
+
+    __mmask16 k_store = (1 << (cnt * 2)) - 1;
+    _mm256_mask_storeu_epi16(b_r, k_store, _mm512_castsi512_si256(br_yg));
+    _mm256_mask_storeu_epi16(y_g, k_store, _mm512_extracti64x4_epi64(br_yg, 1));
+    _mm256_mask_storeu_epi16(r_b, k_store, _mm512_castsi512_si256(rb));
+
+    be += cnt * 9;
+    b_r += cnt * 2;
+    y_g += cnt * 2;
+    r_b += cnt * 2;
+    pg_cnt -= cnt;
+  }
+
+  return 0;
+}
+/* end 444 avx512_vbmi */
 MT_TARGET_CODE_STOP
 #endif
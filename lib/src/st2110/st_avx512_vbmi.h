@@ -75,6 +75,14 @@ int st20_rfc4175_422be12_to_yuv422p12le_avx512_vbmi_dma(
     struct mtl_dma_lender_dev* dma, struct st20_rfc4175_422_12_pg2_be* pg_be,
     mtl_iova_t pg_be_iova, uint16_t* y, uint16_t* b, uint16_t* r, uint32_t w, uint32_t h);
 
+int st20_rfc4175_444be10_to_444p10le_avx512_vbmi(struct st20_rfc4175_444_10_pg4_be* pg,
+                                                 uint16_t* y_g, uint16_t* b_r,
+                                                 uint16_t* r_b, uint32_t w, uint32_t h);
+
+int st20_rfc4175_444be12_to_444p12le_avx512_vbmi(struct st20_rfc4175_444_12_pg2_be* pg,
+                                                 uint16_t* y_g, uint16_t* b_r,
+                                                 uint16_t* r_b, uint32_t w, uint32_t h);
+
 int st20_downsample_rfc4175_422be10_wh_half_avx512_vbmi(uint8_t* pg_old, uint8_t* pg_new,
                                                         uint32_t w, uint32_t h,
                                                         uint32_t linesize_old,
@@ -38,7 +38,9 @@ static bool has_lines_padding(struct st_frame* src, struct st_frame* dst) {
 }
 
 static int convert_rfc4175_422be10_to_yuv422p10le(struct st_frame* src,
-                                                  struct st_frame* dst) {
+                                                  struct st_frame* dst,
+                                                  bool lines_padding,
+                                                  enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
   uint16_t* y = NULL;
@@ -46,46 +48,49 @@ static int convert_rfc4175_422be10_to_yuv422p10le(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = src->addr[0];
     y = dst->addr[0];
     b = dst->addr[1];
     r = dst->addr[2];
-    ret = st20_rfc4175_422be10_to_yuv422p10le(be10, y, b, r, dst->width, h);
+    ret = st20_rfc4175_422be10_to_yuv422p10le_simd(be10, y, b, r, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = src->addr[0] + src->linesize[0] * line;
       y = dst->addr[0] + dst->linesize[0] * line;
       b = dst->addr[1] + dst->linesize[1] * line;
       r = dst->addr[2] + dst->linesize[2] * line;
-      ret = st20_rfc4175_422be10_to_yuv422p10le(be10, y, b, r, dst->width, 1);
+      ret = st20_rfc4175_422be10_to_yuv422p10le_simd(be10, y, b, r, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_rfc4175_422be10_to_422le8(struct st_frame* src, struct st_frame* dst) {
+static int convert_rfc4175_422be10_to_422le8(struct st_frame* src, struct st_frame* dst,
+                                             bool lines_padding,
+                                             enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
   struct st20_rfc4175_422_8_pg2_le* le8 = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = src->addr[0];
     le8 = dst->addr[0];
-    ret = st20_rfc4175_422be10_to_422le8(be10, le8, dst->width, h);
+    ret = st20_rfc4175_422be10_to_422le8_simd(be10, le8, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = src->addr[0] + src->linesize[0] * line;
       le8 = dst->addr[0] + dst->linesize[0] * line;
-      ret = st20_rfc4175_422be10_to_422le8(be10, le8, dst->width, 1);
+      ret = st20_rfc4175_422be10_to_422le8_simd(be10, le8, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_rfc4175_422be10_to_yuv422p8(struct st_frame* src,
-                                               struct st_frame* dst) {
+static int convert_rfc4175_422be10_to_yuv422p8(struct st_frame* src, struct st_frame* dst,
+                                               bool lines_padding,
+                                               enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
   uint8_t* y = NULL;
@@ -93,26 +98,27 @@ static int convert_rfc4175_422be10_to_yuv422p8(struct st_frame* src,
   uint8_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = src->addr[0];
     y = dst->addr[0];
     b = dst->addr[1];
     r = dst->addr[2];
-    ret = st20_rfc4175_422be10_to_yuv422p8(be10, y, b, r, dst->width, h);
+    ret = st20_rfc4175_422be10_to_yuv422p8_simd(be10, y, b, r, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = src->addr[0] + src->linesize[0] * line;
       y = dst->addr[0] + dst->linesize[0] * line;
       b = dst->addr[1] + dst->linesize[1] * line;
       r = dst->addr[2] + dst->linesize[2] * line;
-      ret = st20_rfc4175_422be10_to_yuv422p8(be10, y, b, r, dst->width, 1);
+      ret = st20_rfc4175_422be10_to_yuv422p8_simd(be10, y, b, r, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_rfc4175_422be10_to_yuv420p8(struct st_frame* src,
-                                               struct st_frame* dst) {
+static int convert_rfc4175_422be10_to_yuv420p8(struct st_frame* src, struct st_frame* dst,
+                                               bool lines_padding,
+                                               enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
   uint8_t* y = NULL;
@@ -120,66 +126,72 @@ static int convert_rfc4175_422be10_to_yuv420p8(struct st_frame* src,
   uint8_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = src->addr[0];
     y = dst->addr[0];
     b = dst->addr[1];
     r = dst->addr[2];
-    ret = st20_rfc4175_422be10_to_yuv420p8(be10, y, b, r, dst->width, h);
+    ret = st20_rfc4175_422be10_to_yuv420p8_simd(be10, y, b, r, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = src->addr[0] + src->linesize[0] * line;
       y = dst->addr[0] + dst->linesize[0] * line;
       b = dst->addr[1] + dst->linesize[1] * line;
       r = dst->addr[2] + dst->linesize[2] * line;
-      ret = st20_rfc4175_422be10_to_yuv420p8(be10, y, b, r, dst->width, 1);
+      ret = st20_rfc4175_422be10_to_yuv420p8_simd(be10, y, b, r, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_rfc4175_422be10_to_v210(struct st_frame* src, struct st_frame* dst) {
+static int convert_rfc4175_422be10_to_v210(struct st_frame* src, struct st_frame* dst,
+                                           bool lines_padding,
+                                           enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
   uint8_t* v210 = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = src->addr[0];
     v210 = dst->addr[0];
-    ret = st20_rfc4175_422be10_to_v210(be10, v210, dst->width, h);
+    ret = st20_rfc4175_422be10_to_v210_simd(be10, v210, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = src->addr[0] + src->linesize[0] * line;
       v210 = dst->addr[0] + dst->linesize[0] * line;
-      ret = st20_rfc4175_422be10_to_v210(be10, v210, dst->width, 1);
+      ret = st20_rfc4175_422be10_to_v210_simd(be10, v210, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_rfc4175_422be10_to_y210(struct st_frame* src, struct st_frame* dst) {
+static int convert_rfc4175_422be10_to_y210(struct st_frame* src, struct st_frame* dst,
+                                           bool lines_padding,
+                                           enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
   uint16_t* y210 = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = src->addr[0];
     y210 = dst->addr[0];
-    ret = st20_rfc4175_422be10_to_y210(be10, y210, dst->width, h);
+    ret = st20_rfc4175_422be10_to_y210_simd(be10, y210, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = src->addr[0] + src->linesize[0] * line;
       y210 = dst->addr[0] + dst->linesize[0] * line;
-      ret = st20_rfc4175_422be10_to_y210(be10, y210, dst->width, 1);
+      ret = st20_rfc4175_422be10_to_y210_simd(be10, y210, dst->width, 1, level);
     }
   }
   return ret;
 }
 
 static int convert_rfc4175_422be12_to_yuv422p12le(struct st_frame* src,
-                                                  struct st_frame* dst) {
+                                                  struct st_frame* dst,
+                                                  bool lines_padding,
+                                                  enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_12_pg2_be* be12 = NULL;
   uint16_t* y = NULL;
@@ -187,26 +199,28 @@ static int convert_rfc4175_422be12_to_yuv422p12le(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be12 = src->addr[0];
     y = dst->addr[0];
     b = dst->addr[1];
     r = dst->addr[2];
-    ret = st20_rfc4175_422be12_to_yuv422p12le(be12, y, b, r, dst->width, h);
+    ret = st20_rfc4175_422be12_to_yuv422p12le_simd(be12, y, b, r, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be12 = src->addr[0] + src->linesize[0] * line;
       y = dst->addr[0] + dst->linesize[0] * line;
       b = dst->addr[1] + dst->linesize[1] * line;
       r = dst->addr[2] + dst->linesize[2] * line;
-      ret = st20_rfc4175_422be12_to_yuv422p12le(be12, y, b, r, dst->width, 1);
+      ret = st20_rfc4175_422be12_to_yuv422p12le_simd(be12, y, b, r, dst->width, 1, level);
     }
   }
   return ret;
 }
 
 static int convert_rfc4175_444be10_to_yuv444p10le(struct st_frame* src,
-                                                  struct st_frame* dst) {
+                                                  struct st_frame* dst,
+                                                  bool lines_padding,
+                                                  enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_444_10_pg4_be* be10 = NULL;
   uint16_t* y = NULL;
@@ -214,26 +228,27 @@ static int convert_rfc4175_444be10_to_yuv444p10le(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = src->addr[0];
     y = dst->addr[0];
     b = dst->addr[1];
     r = dst->addr[2];
-    ret = st20_rfc4175_444be10_to_yuv444p10le(be10, y, b, r, dst->width, h);
+    ret = st20_rfc4175_444be10_to_444p10le_simd(be10, y, b, r, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = src->addr[0] + src->linesize[0] * line;
       y = dst->addr[0] + dst->linesize[0] * line;
       b = dst->addr[1] + dst->linesize[1] * line;
       r = dst->addr[2] + dst->linesize[2] * line;
-      ret = st20_rfc4175_444be10_to_yuv444p10le(be10, y, b, r, dst->width, 1);
+      ret = st20_rfc4175_444be10_to_444p10le_simd(be10, y, b, r, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_rfc4175_444be10_to_gbrp10le(struct st_frame* src,
-                                               struct st_frame* dst) {
+static int convert_rfc4175_444be10_to_gbrp10le(struct st_frame* src, struct st_frame* dst,
+                                               bool lines_padding,
+                                               enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_444_10_pg4_be* be10 = NULL;
   uint16_t* g = NULL;
@@ -241,26 +256,28 @@ static int convert_rfc4175_444be10_to_gbrp10le(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = src->addr[0];
     g = dst->addr[0];
     b = dst->addr[1];
     r = dst->addr[2];
-    ret = st20_rfc4175_444be10_to_gbrp10le(be10, g, b, r, dst->width, h);
+    ret = st20_rfc4175_444be10_to_444p10le_simd(be10, g, r, b, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = src->addr[0] + src->linesize[0] * line;
       g = dst->addr[0] + dst->linesize[0] * line;
       b = dst->addr[1] + dst->linesize[1] * line;
       r = dst->addr[2] + dst->linesize[2] * line;
-      ret = st20_rfc4175_444be10_to_gbrp10le(be10, g, b, r, dst->width, 1);
+      ret = st20_rfc4175_444be10_to_444p10le_simd(be10, g, r, b, dst->width, 1, level);
     }
   }
   return ret;
 }
 
 static int convert_rfc4175_444be12_to_yuv444p12le(struct st_frame* src,
-                                                  struct st_frame* dst) {
+                                                  struct st_frame* dst,
+                                                  bool lines_padding,
+                                                  enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_444_12_pg2_be* be12 = NULL;
   uint16_t* y = NULL;
@@ -268,26 +285,27 @@ static int convert_rfc4175_444be12_to_yuv444p12le(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be12 = src->addr[0];
     y = dst->addr[0];
     b = dst->addr[1];
     r = dst->addr[2];
-    ret = st20_rfc4175_444be12_to_yuv444p12le(be12, y, b, r, dst->width, h);
+    ret = st20_rfc4175_444be12_to_444p12le_simd(be12, y, b, r, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be12 = src->addr[0] + src->linesize[0] * line;
       y = dst->addr[0] + dst->linesize[0] * line;
       b = dst->addr[1] + dst->linesize[1] * line;
       r = dst->addr[2] + dst->linesize[2] * line;
-      ret = st20_rfc4175_444be12_to_yuv444p12le(be12, y, b, r, dst->width, 1);
+      ret = st20_rfc4175_444be12_to_444p12le_simd(be12, y, b, r, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_rfc4175_444be12_to_gbrp12le(struct st_frame* src,
-                                               struct st_frame* dst) {
+static int convert_rfc4175_444be12_to_gbrp12le(struct st_frame* src, struct st_frame* dst,
+                                               bool lines_padding,
+                                               enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_444_12_pg2_be* be12 = NULL;
   uint16_t* g = NULL;
@@ -295,26 +313,28 @@ static int convert_rfc4175_444be12_to_gbrp12le(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be12 = src->addr[0];
     g = dst->addr[0];
     b = dst->addr[1];
     r = dst->addr[2];
-    ret = st20_rfc4175_444be12_to_gbrp12le(be12, g, b, r, dst->width, h);
+    ret = st20_rfc4175_444be12_to_444p12le_simd(be12, g, r, b, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be12 = src->addr[0] + src->linesize[0] * line;
       g = dst->addr[0] + dst->linesize[0] * line;
       b = dst->addr[1] + dst->linesize[1] * line;
       r = dst->addr[2] + dst->linesize[2] * line;
-      ret = st20_rfc4175_444be12_to_gbrp12le(be12, g, b, r, dst->width, 1);
+      ret = st20_rfc4175_444be12_to_444p12le_simd(be12, g, r, b, dst->width, 1, level);
     }
   }
   return ret;
 }
 
 static int convert_yuv422p10le_to_rfc4175_422be10(struct st_frame* src,
-                                                  struct st_frame* dst) {
+                                                  struct st_frame* dst,
+                                                  bool lines_padding,
+                                                  enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
   uint16_t* y = NULL;
@@ -322,66 +342,72 @@ static int convert_yuv422p10le_to_rfc4175_422be10(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     y = src->addr[0];
     b = src->addr[1];
     r = src->addr[2];
     be10 = dst->addr[0];
-    ret = st20_yuv422p10le_to_rfc4175_422be10(y, b, r, be10, dst->width, h);
+    ret = st20_yuv422p10le_to_rfc4175_422be10_simd(y, b, r, be10, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       y = src->addr[0] + src->linesize[0] * line;
       b = src->addr[1] + src->linesize[1] * line;
       r = src->addr[2] + src->linesize[2] * line;
       be10 = dst->addr[0] + dst->linesize[0] * line;
-      ret = st20_yuv422p10le_to_rfc4175_422be10(y, b, r, be10, dst->width, 1);
+      ret = st20_yuv422p10le_to_rfc4175_422be10_simd(y, b, r, be10, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_v210_to_rfc4175_422be10(struct st_frame* src, struct st_frame* dst) {
+static int convert_v210_to_rfc4175_422be10(struct st_frame* src, struct st_frame* dst,
+                                           bool lines_padding,
+                                           enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
   uint8_t* v210 = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     v210 = src->addr[0];
     be10 = dst->addr[0];
-    ret = st20_v210_to_rfc4175_422be10(v210, be10, dst->width, h);
+    ret = st20_v210_to_rfc4175_422be10_simd(v210, be10, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       v210 = src->addr[0] + src->linesize[0] * line;
       be10 = dst->addr[0] + dst->linesize[0] * line;
-      ret = st20_v210_to_rfc4175_422be10(v210, be10, dst->width, 1);
+      ret = st20_v210_to_rfc4175_422be10_simd(v210, be10, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_y210_to_rfc4175_422be10(struct st_frame* src, struct st_frame* dst) {
+static int convert_y210_to_rfc4175_422be10(struct st_frame* src, struct st_frame* dst,
+                                           bool lines_padding,
+                                           enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
   uint16_t* y210 = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     y210 = src->addr[0];
     be10 = dst->addr[0];
-    ret = st20_y210_to_rfc4175_422be10(y210, be10, dst->width, h);
+    ret = st20_y210_to_rfc4175_422be10_simd(y210, be10, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       y210 = src->addr[0] + src->linesize[0] * line;
       be10 = dst->addr[0] + dst->linesize[0] * line;
-      ret = st20_y210_to_rfc4175_422be10(y210, be10, dst->width, 1);
+      ret = st20_y210_to_rfc4175_422be10_simd(y210, be10, dst->width, 1, level);
     }
   }
   return ret;
 }
 
 static int convert_yuv422p12le_to_rfc4175_422be12(struct st_frame* src,
-                                                  struct st_frame* dst) {
+                                                  struct st_frame* dst,
+                                                  bool lines_padding,
+                                                  enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_422_12_pg2_be* be12 = NULL;
   uint16_t* y = NULL;
@@ -389,26 +415,28 @@ static int convert_yuv422p12le_to_rfc4175_422be12(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be12 = dst->addr[0];
     y = src->addr[0];
     b = src->addr[1];
     r = src->addr[2];
-    ret = st20_yuv422p12le_to_rfc4175_422be12(y, b, r, be12, dst->width, h);
+    ret = st20_yuv422p12le_to_rfc4175_422be12_simd(y, b, r, be12, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be12 = dst->addr[0] + dst->linesize[0] * line;
       y = src->addr[0] + src->linesize[0] * line;
       b = src->addr[1] + src->linesize[1] * line;
       r = src->addr[2] + src->linesize[2] * line;
-      ret = st20_yuv422p12le_to_rfc4175_422be12(y, b, r, be12, dst->width, 1);
+      ret = st20_yuv422p12le_to_rfc4175_422be12_simd(y, b, r, be12, dst->width, 1, level);
     }
   }
   return ret;
 }
 
 static int convert_yuv444p10le_to_rfc4175_444be10(struct st_frame* src,
-                                                  struct st_frame* dst) {
+                                                  struct st_frame* dst,
+                                                  bool lines_padding,
+                                                  enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_444_10_pg4_be* be10 = NULL;
   uint16_t* y = NULL;
@@ -416,26 +444,27 @@ static int convert_yuv444p10le_to_rfc4175_444be10(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = dst->addr[0];
     y = src->addr[0];
     b = src->addr[1];
     r = src->addr[2];
-    ret = st20_yuv444p10le_to_rfc4175_444be10(y, b, r, be10, dst->width, h);
+    ret = st20_444p10le_to_rfc4175_444be10_simd(y, b, r, be10, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = dst->addr[0] + dst->linesize[0] * line;
       y = src->addr[0] + src->linesize[0] * line;
       b = src->addr[1] + src->linesize[1] * line;
       r = src->addr[2] + src->linesize[2] * line;
-      ret = st20_yuv444p10le_to_rfc4175_444be10(y, b, r, be10, dst->width, 1);
+      ret = st20_444p10le_to_rfc4175_444be10_simd(y, b, r, be10, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_gbrp10le_to_rfc4175_444be10(struct st_frame* src,
-                                               struct st_frame* dst) {
+static int convert_gbrp10le_to_rfc4175_444be10(struct st_frame* src, struct st_frame* dst,
+                                               bool lines_padding,
+                                               enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_444_10_pg4_be* be10 = NULL;
   uint16_t* g = NULL;
@@ -443,26 +472,28 @@ static int convert_gbrp10le_to_rfc4175_444be10(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be10 = dst->addr[0];
     g = src->addr[0];
     b = src->addr[1];
     r = src->addr[2];
-    ret = st20_gbrp10le_to_rfc4175_444be10(g, b, r, be10, dst->width, h);
+    ret = st20_444p10le_to_rfc4175_444be10_simd(g, r, b, be10, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be10 = dst->addr[0] + dst->linesize[0] * line;
       g = src->addr[0] + src->linesize[0] * line;
       b = src->addr[1] + src->linesize[1] * line;
       r = src->addr[2] + src->linesize[2] * line;
-      ret = st20_gbrp10le_to_rfc4175_444be10(g, b, r, be10, dst->width, 1);
+      ret = st20_444p10le_to_rfc4175_444be10_simd(g, r, b, be10, dst->width, 1, level);
     }
   }
   return ret;
 }
 
 static int convert_yuv444p12le_to_rfc4175_444be12(struct st_frame* src,
-                                                  struct st_frame* dst) {
+                                                  struct st_frame* dst,
+                                                  bool lines_padding,
+                                                  enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_444_12_pg2_be* be12 = NULL;
   uint16_t* y = NULL;
@@ -470,26 +501,27 @@ static int convert_yuv444p12le_to_rfc4175_444be12(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be12 = dst->addr[0];
     y = src->addr[0];
     b = src->addr[1];
     r = src->addr[2];
-    ret = st20_yuv444p12le_to_rfc4175_444be12(y, b, r, be12, dst->width, h);
+    ret = st20_444p12le_to_rfc4175_444be12_simd(y, b, r, be12, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be12 = dst->addr[0] + dst->linesize[0] * line;
       y = src->addr[0] + src->linesize[0] * line;
       b = src->addr[1] + src->linesize[1] * line;
       r = src->addr[2] + src->linesize[2] * line;
-      ret = st20_yuv444p12le_to_rfc4175_444be12(y, b, r, be12, dst->width, 1);
+      ret = st20_444p12le_to_rfc4175_444be12_simd(y, b, r, be12, dst->width, 1, level);
     }
   }
   return ret;
 }
 
-static int convert_gbrp12le_to_rfc4175_444be12(struct st_frame* src,
-                                               struct st_frame* dst) {
+static int convert_gbrp12le_to_rfc4175_444be12(struct st_frame* src, struct st_frame* dst,
+                                               bool lines_padding,
+                                               enum mtl_simd_level level) {
   int ret = 0;
   struct st20_rfc4175_444_12_pg2_be* be12 = NULL;
   uint16_t* g = NULL;
@@ -497,19 +529,69 @@ static int convert_gbrp12le_to_rfc4175_444be12(struct st_frame* src,
   uint16_t* r = NULL;
   uint32_t h = st_frame_data_height(dst);
 
-  if (!has_lines_padding(src, dst)) {
+  if (!lines_padding) {
     be12 = dst->addr[0];
     g = src->addr[0];
     b = src->addr[1];
     r = src->addr[2];
-    ret = st20_gbrp12le_to_rfc4175_444be12(g, b, r, be12, dst->width, h);
+    ret = st20_444p12le_to_rfc4175_444be12_simd(g, r, b, be12, dst->width, h, level);
   } else {
     for (uint32_t line = 0; line < h; line++) {
       be12 = dst->addr[0] + dst->linesize[0] * line;
       g = src->addr[0] + src->linesize[0] * line;
       b = src->addr[1] + src->linesize[1] * line;
       r = src->addr[2] + src->linesize[2] * line;
-      ret = st20_gbrp12le_to_rfc4175_444be12(g, b, r, be12, dst->width, 1);
+      ret = st20_444p12le_to_rfc4175_444be12_simd(g, r, b, be12, dst->width, 1, level);
+    }
+  }
+  return ret;
+}
+
+static int convert_rfc4175_422be10_to_rgb(struct st_frame* src, struct st_frame* dst,
+                                          bool lines_padding, enum mtl_simd_level level,
+                                          enum st20_color_matrix matrix,
+                                          enum st20_color_range range) {
+  int ret = 0;
+  struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
+  uint8_t* rgb = NULL;
+  uint32_t h = st_frame_data_height(dst);
+
+  if (!lines_padding) {
+    be10 = src->addr[0];
+    rgb = dst->addr[0];
+    ret = st20_rfc4175_422be10_to_rgb_simd(be10, rgb, dst->fmt, dst->width, h, matrix,
+                                           range, level);
+  } else {
+    for (uint32_t line = 0; line < h; line++) {
+      be10 = src->addr[0] + src->linesize[0] * line;
+      rgb = dst->addr[0] + dst->linesize[0] * line;
+      ret = st20_rfc4175_422be10_to_rgb_simd(be10, rgb, dst->fmt, dst->width, 1, matrix,
+                                             range, level);
+    }
+  }
+  return ret;
+}
+
+static int convert_rgb_to_rfc4175_422be10(struct st_frame* src, struct st_frame* dst,
+                                          bool lines_padding, enum mtl_simd_level level,
+                                          enum st20_color_matrix matrix,
+                                          enum st20_color_range range) {
+  int ret = 0;
+  struct st20_rfc4175_422_10_pg2_be* be10 = NULL;
+  uint8_t* rgb = NULL;
+  uint32_t h = st_frame_data_height(dst);
+
+  if (!lines_padding) {
+    rgb = src->addr[0];
+    be10 = dst->addr[0];
+    ret = st20_rgb_to_rfc4175_422be10_simd(rgb, src->fmt, be10, dst->width, h, matrix,
+                                           range, level);
+  } else {
+    for (uint32_t line = 0; line < h; line++) {
+      rgb = src->addr[0] + src->linesize[0] * line;
+      be10 = dst->addr[0] + dst->linesize[0] * line;
+      ret = st20_rgb_to_rfc4175_422be10_simd(rgb, src->fmt, be10, dst->width, 1, matrix,
+                                             range, level);
     }
   }
   return ret;
@@ -519,97 +601,127 @@ static const struct st_frame_converter converters[] = {
     {
         .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
         .dst_fmt = ST_FRAME_FMT_YUV422PLANAR10LE,
-        .convert_func = convert_rfc4175_422be10_to_yuv422p10le,
+        .convert_kernel = convert_rfc4175_422be10_to_yuv422p10le,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
         .dst_fmt = ST_FRAME_FMT_UYVY,
-        .convert_func = convert_rfc4175_422be10_to_422le8,
+        .convert_kernel = convert_rfc4175_422be10_to_422le8,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
         .dst_fmt = ST_FRAME_FMT_YUV422PLANAR8,
-        .convert_func = convert_rfc4175_422be10_to_yuv422p8,
+        .convert_kernel = convert_rfc4175_422be10_to_yuv422p8,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
         .dst_fmt = ST_FRAME_FMT_YUV420PLANAR8,
-        .convert_func = convert_rfc4175_422be10_to_yuv420p8,
+        .convert_kernel = convert_rfc4175_422be10_to_yuv420p8,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
         .dst_fmt = ST_FRAME_FMT_V210,
-        .convert_func = convert_rfc4175_422be10_to_v210,
+        .convert_kernel = convert_rfc4175_422be10_to_v210,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
         .dst_fmt = ST_FRAME_FMT_Y210,
-        .convert_func = convert_rfc4175_422be10_to_y210,
+        .convert_kernel = convert_rfc4175_422be10_to_y210,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE12,
         .dst_fmt = ST_FRAME_FMT_YUV422PLANAR12LE,
-        .convert_func = convert_rfc4175_422be12_to_yuv422p12le,
+        .convert_kernel = convert_rfc4175_422be12_to_yuv422p12le,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV444RFC4175PG4BE10,
         .dst_fmt = ST_FRAME_FMT_YUV444PLANAR10LE,
-        .convert_func = convert_rfc4175_444be10_to_yuv444p10le,
+        .convert_kernel = convert_rfc4175_444be10_to_yuv444p10le,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV444RFC4175PG2BE12,
         .dst_fmt = ST_FRAME_FMT_YUV444PLANAR12LE,
-        .convert_func = convert_rfc4175_444be12_to_yuv444p12le,
+        .convert_kernel = convert_rfc4175_444be12_to_yuv444p12le,
     },
     {
         .src_fmt = ST_FRAME_FMT_RGBRFC4175PG4BE10,
         .dst_fmt = ST_FRAME_FMT_GBRPLANAR10LE,
-        .convert_func = convert_rfc4175_444be10_to_gbrp10le,
+        .convert_kernel = convert_rfc4175_444be10_to_gbrp10le,
     },
     {
         .src_fmt = ST_FRAME_FMT_RGBRFC4175PG2BE12,
         .dst_fmt = ST_FRAME_FMT_GBRPLANAR12LE,
-        .convert_func = convert_rfc4175_444be12_to_gbrp12le,
+        .convert_kernel = convert_rfc4175_444be12_to_gbrp12le,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV422PLANAR10LE,
         .dst_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
-        .convert_func = convert_yuv422p10le_to_rfc4175_422be10,
+        .convert_kernel = convert_yuv422p10le_to_rfc4175_422be10,
     },
     {
         .src_fmt = ST_FRAME_FMT_V210,
         .dst_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
-        .convert_func = convert_v210_to_rfc4175_422be10,
+        .convert_kernel = convert_v210_to_rfc4175_422be10,
     },
     {
         .src_fmt = ST_FRAME_FMT_Y210,
         .dst_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
-        .convert_func = convert_y210_to_rfc4175_422be10,
+        .convert_kernel = convert_y210_to_rfc4175_422be10,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV422PLANAR12LE,
         .dst_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE12,
-        .convert_func = convert_yuv422p12le_to_rfc4175_422be12,
+        .convert_kernel = convert_yuv422p12le_to_rfc4175_422be12,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV444PLANAR10LE,
         .dst_fmt = ST_FRAME_FMT_YUV444RFC4175PG4BE10,
-        .convert_func = convert_yuv444p10le_to_rfc4175_444be10,
+        .convert_kernel = convert_yuv444p10le_to_rfc4175_444be10,
     },
     {
         .src_fmt = ST_FRAME_FMT_YUV444PLANAR12LE,
         .dst_fmt = ST_FRAME_FMT_YUV444RFC4175PG2BE12,
-        .convert_func = convert_yuv444p12le_to_rfc4175_444be12,
+        .convert_kernel = convert_yuv444p12le_to_rfc4175_444be12,
     },
     {
         .src_fmt = ST_FRAME_FMT_GBRPLANAR10LE,
         .dst_fmt = ST_FRAME_FMT_RGBRFC4175PG4BE10,
-        .convert_func = convert_gbrp10le_to_rfc4175_444be10,
+        .convert_kernel = convert_gbrp10le_to_rfc4175_444be10,
     },
     {
         .src_fmt = ST_FRAME_FMT_GBRPLANAR12LE,
         .dst_fmt = ST_FRAME_FMT_RGBRFC4175PG2BE12,
-        .convert_func = convert_gbrp12le_to_rfc4175_444be12,
+        .convert_kernel = convert_gbrp12le_to_rfc4175_444be12,
+    },
+    {
+        .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
+        .dst_fmt = ST_FRAME_FMT_ARGB,
+        .convert_color_kernel = convert_rfc4175_422be10_to_rgb,
+    },
+    {
+        .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
+        .dst_fmt = ST_FRAME_FMT_BGRA,
+        .convert_color_kernel = convert_rfc4175_422be10_to_rgb,
+    },
+    {
+        .src_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
+        .dst_fmt = ST_FRAME_FMT_RGB8,
+        .convert_color_kernel = convert_rfc4175_422be10_to_rgb,
+    },
+    {
+        .src_fmt = ST_FRAME_FMT_ARGB,
+        .dst_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
+        .convert_color_kernel = convert_rgb_to_rfc4175_422be10,
+    },
+    {
+        .src_fmt = ST_FRAME_FMT_BGRA,
+        .dst_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
+        .convert_color_kernel = convert_rgb_to_rfc4175_422be10,
+    },
+    {
+        .src_fmt = ST_FRAME_FMT_RGB8,
+        .dst_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10,
+        .convert_color_kernel = convert_rgb_to_rfc4175_422be10,
     },
 };
 
@@ -624,7 +736,28 @@ int st_frame_convert(struct st_frame* src, struct st_frame* dst) {
     err("%s, get converter fail\n", __func__);
     return -EINVAL;
   }
-  return converter.convert_func(src, dst);
+  return st_frame_converter_convert(&converter, src, dst);
+}
+
+int st_frame_convert_color(struct st_frame* src, struct st_frame* dst,
+                           enum st20_color_matrix matrix, enum st20_color_range range) {
+  if (src->width != dst->width || src->height != dst->height) {
+    err("%s, width/height mismatch, source: %u x %u, dest: %u x %u\n", __func__,
+        src->width, src->height, dst->width, dst->height);
+    return -EINVAL;
+  }
+  if (matrix >= ST20_COLOR_MATRIX_MAX || range >= ST20_COLOR_RANGE_MAX) {
+    err("%s, invalid matrix %d or range %d\n", __func__, matrix, range);
+    return -EINVAL;
+  }
+  struct st_frame_converter converter;
+  if (st_frame_get_converter(src->fmt, dst->fmt, &converter) < 0) {
+    err("%s, get converter fail\n", __func__);
+    return -EINVAL;
+  }
+  converter.color_matrix = matrix;
+  converter.color_range = range;
+  return st_frame_converter_convert(&converter, src, dst);
 }
 
 static int field_frame_check(const struct st_frame* field, const struct st_frame* frame) {
@@ -716,13 +849,25 @@ int st_field_split(const struct st_frame* frame, struct st_frame* first,
   return 0;
 }
 
+static const struct st_frame_converter* converter_find(enum st_frame_fmt src_fmt,
+                                                      enum st_frame_fmt dst_fmt) {
+  for (int i = 0; i < MTL_ARRAY_SIZE(converters); i++) {
+    if (src_fmt == converters[i].src_fmt && dst_fmt == converters[i].dst_fmt)
+      return &converters[i];
+  }
+  return NULL;
+}
+
 int st_frame_get_converter(enum st_frame_fmt src_fmt, enum st_frame_fmt dst_fmt,
                            struct st_frame_converter* converter) {
-  for (int i = 0; i < MTL_ARRAY_SIZE(converters); i++) {
-    if (src_fmt == converters[i].src_fmt && dst_fmt == converters[i].dst_fmt) {
-      *converter = converters[i];
-      return 0;
-    }
+  const struct st_frame_converter* found = converter_find(src_fmt, dst_fmt);
+
+  if (found) {
+    *converter = *found;
+    converter->simd_level = mtl_get_simd_level();
+    converter->color_matrix = ST20_COLOR_MATRIX_BT709;
+    converter->color_range = ST20_COLOR_RANGE_NARROW;
+    return 0;
   }
 
   err("%s, format not supported, source: %s, dest: %s\n", __func__,
@@ -730,6 +875,56 @@ int st_frame_get_converter(enum st_frame_fmt src_fmt, enum st_frame_fmt dst_fmt,
   return -EINVAL;
 }
 
+int st_frame_converter_bind(struct st_frame_converter* converter, struct st_frame* src,
+                            struct st_frame* dst) {
+  if (src->fmt != converter->src_fmt || dst->fmt != converter->dst_fmt) {
+    err("%s, fmt mismatch, source: %s, dest: %s\n", __func__, st_frame_fmt_name(src->fmt),
+        st_frame_fmt_name(dst->fmt));
+    return -EINVAL;
+  }
+
+  converter->width = dst->width;
+  for (int plane = 0; plane < ST_MAX_PLANES; plane++) {
+    converter->src_linesize[plane] = src->linesize[plane];
+    converter->dst_linesize[plane] = dst->linesize[plane];
+  }
+  converter->lines_padding = has_lines_padding(src, dst);
+  converter->bound = true;
+  dbg("%s, %s to %s, width %u lines_padding %d simd %s\n", __func__,
+      st_frame_fmt_name(src->fmt), st_frame_fmt_name(dst->fmt), dst->width,
+      converter->lines_padding, mtl_get_simd_level_name(converter->simd_level));
+  return 0;
+}
+
+static inline bool converter_geometry_match(struct st_frame_converter* converter,
+                                            struct st_frame* src, struct st_frame* dst) {
+  if (!converter->bound) return false;
+  if (src->width != converter->width || dst->width != converter->width) return false;
+  for (int plane = 0; plane < ST_MAX_PLANES; plane++) {
+    if (src->linesize[plane] != converter->src_linesize[plane]) return false;
+    if (dst->linesize[plane] != converter->dst_linesize[plane]) return false;
+  }
+  return true;
+}
+
+int st_frame_converter_convert(struct st_frame_converter* converter,
+                               struct st_frame* src, struct st_frame* dst) {
+  bool lines_padding;
+
+  if (st_frame_data_height(dst) == 1) /* one line, nothing to skip */
+    lines_padding = false;
+  else if (converter_geometry_match(converter, src, dst))
+    lines_padding = converter->lines_padding;
+  else
+    lines_padding = has_lines_padding(src, dst);
+
+  if (converter->convert_color_kernel)
+    return converter->convert_color_kernel(src, dst, lines_padding, converter->simd_level,
+                                           converter->color_matrix,
+                                           converter->color_range);
+  return converter->convert_kernel(src, dst, lines_padding, converter->simd_level);
+}
+
 static int downsample_rfc4175_wh_half(struct st_frame* old_frame,
                                       struct st_frame* new_frame, int idx) {
   enum mtl_simd_level cpu_level = mtl_get_simd_level();
@@ -798,6 +993,12 @@ int st_frame_downsample(struct st_frame* src, struct st_frame* dst, int idx) {
         return downsample_rfc4175_wh_half(src, dst, idx);
       }
     }
+    /* other integer ratios of downsample by the scaler, no sample box */
+    if ((idx == 0) && dst->width && dst->height && (src->width > dst->width) &&
+        (src->height > dst->height) && !(src->width % dst->width) &&
+        !(src->height % dst->height)) {
+      return st_frame_scale(src, dst);
+    }
   }
 
   err("%s, downsample not supported, source: %s %ux%u, dest: %s %ux%u\n", __func__,
@@ -806,176 +1007,737 @@ int st_frame_downsample(struct st_frame* src, struct st_frame* dst, int idx) {
   return -EINVAL;
 }
 
-static int st20_yuv422p10le_to_rfc4175_422be10_scalar(
-    uint16_t* y, uint16_t* b, uint16_t* r, struct st20_rfc4175_422_10_pg2_be* pg,
-    uint32_t w, uint32_t h) {
-  uint32_t cnt = w * h / 2; /* two pgs in one convert */
-  uint16_t cb, y0, cr, y1;
+/* the 16bit planar fmt the scaler run on, and the fmt unpack to it */
+static const struct {
+  enum st_frame_fmt fmt;
+  enum st_frame_fmt scale_fmt;
+} scale_fmts[] = {
+    {ST_FRAME_FMT_YUV422PLANAR10LE, ST_FRAME_FMT_YUV422PLANAR10LE},
+    {ST_FRAME_FMT_YUV422PLANAR12LE, ST_FRAME_FMT_YUV422PLANAR12LE},
+    {ST_FRAME_FMT_YUV444PLANAR10LE, ST_FRAME_FMT_YUV444PLANAR10LE},
+    {ST_FRAME_FMT_YUV444PLANAR12LE, ST_FRAME_FMT_YUV444PLANAR12LE},
+    {ST_FRAME_FMT_GBRPLANAR10LE, ST_FRAME_FMT_GBRPLANAR10LE},
+    {ST_FRAME_FMT_GBRPLANAR12LE, ST_FRAME_FMT_GBRPLANAR12LE},
+    {ST_FRAME_FMT_YUV422RFC4175PG2BE10, ST_FRAME_FMT_YUV422PLANAR10LE},
+    {ST_FRAME_FMT_YUV422RFC4175PG2BE12, ST_FRAME_FMT_YUV422PLANAR12LE},
+    {ST_FRAME_FMT_YUV444RFC4175PG4BE10, ST_FRAME_FMT_YUV444PLANAR10LE},
+    {ST_FRAME_FMT_YUV444RFC4175PG2BE12, ST_FRAME_FMT_YUV444PLANAR12LE},
+    {ST_FRAME_FMT_RGBRFC4175PG4BE10, ST_FRAME_FMT_GBRPLANAR10LE},
+    {ST_FRAME_FMT_RGBRFC4175PG2BE12, ST_FRAME_FMT_GBRPLANAR12LE},
+};
 
-  for (uint32_t pg2 = 0; pg2 < cnt; pg2++) {
-    cb = *b++;
-    y0 = *y++;
-    cr = *r++;
-    y1 = *y++;
+static void scale_filter_free(struct st_scale_filter* f) {
+  if (f->start) {
+    mt_rte_free(f->start);
+    f->start = NULL;
+  }
+  if (f->coeffs) {
+    mt_rte_free(f->coeffs);
+    f->coeffs = NULL;
+  }
+}
 
-    pg->Cb00 = cb >> 2;
-    pg->Cb00_ = cb;
-    pg->Y00 = y0 >> 4;
-    pg->Y00_ = y0;
-    pg->Cr00 = cr >> 6;
-    pg->Cr00_ = cr;
-    pg->Y01 = y1 >> 8;
-    pg->Y01_ = y1;
+/*
+ * The triangle filter at the center of each output area, it's the bilinear for upscale
+ * and widened to the ratio for downscale. The taps out of the input are folded to edge.
+ * A window wider than the input covers all of it, the taps past the end read the
+ * replicated edge sample with zero weight.
+ */
+static int scale_filter_init(struct st_scale_filter* f, uint32_t src_size,
+                             uint32_t dst_size, int socket_id) {
+  /* all positions in Q16 of the input sample */
+  int64_t ratio = ((int64_t)src_size << 16) / dst_size;
+  int64_t radius = RTE_MAX(ratio, (int64_t)1 << 16);
+  uint32_t taps = MTL_ALIGN((uint32_t)((radius * 2 + 0xffff) >> 16), 2);
+  int64_t* weights;
+
+  if (taps > src_size) taps = MTL_ALIGN(src_size, 2);
+  if (!taps) {
+    err("%s, invalid size %u to %u\n", __func__, src_size, dst_size);
+    return -EINVAL;
+  }
 
-    pg++;
+  f->src_size = src_size;
+  f->dst_size = dst_size;
+  f->taps = taps;
+  f->start = mt_rte_zmalloc_socket(sizeof(*f->start) * dst_size, socket_id);
+  f->coeffs = mt_rte_zmalloc_socket(sizeof(*f->coeffs) * taps * dst_size, socket_id);
+  weights = mt_zmalloc(sizeof(*weights) * taps);
+  if (!f->start || !f->coeffs || !weights) {
+    err("%s, malloc fail for %u taps\n", __func__, taps);
+    if (weights) mt_free(weights);
+    scale_filter_free(f);
+    return -ENOMEM;
+  }
+
+  for (uint32_t i = 0; i < dst_size; i++) {
+    int64_t center = ((int64_t)(i * 2 + 1) * src_size << 16) / (dst_size * 2) - (1 << 15);
+    int64_t first = ((center - radius) >> 16) + 1;
+    int64_t last = ((center + radius + 0xffff) >> 16) - 1;
+    int64_t start = RTE_MAX(RTE_MIN(first, (int64_t)src_size - taps), 0);
+    int64_t end = RTE_MIN(start + taps, (int64_t)src_size) - 1; /* the last real tap */
+    int64_t sum = 0;
+
+    memset(weights, 0, sizeof(*weights) * taps);
+    for (int64_t n = first; n <= last; n++) {
+      int64_t pos = n * (1 << 16);
+      int64_t w = radius - (pos > center ? pos - center : center - pos);
+      if (w <= 0) continue;
+      int64_t k = RTE_MIN(RTE_MAX(n, start), end) - start;
+      weights[k] += w;
+      sum += w;
+    }
+
+    /* normalize to the sum of one, the rounding left is on the biggest tap */
+    int32_t left = 1 << ST_SCALE_COEFF_BITS;
+    uint32_t max_k = 0;
+    for (uint32_t k = 0; k < taps; k++) {
+      int16_t c = ((weights[k] << ST_SCALE_COEFF_BITS) + sum / 2) / sum;
+      f->coeffs[((k / 2) * dst_size + i) * 2 + (k & 1)] = c;
+      left -= c;
+      if (weights[k] > weights[max_k]) max_k = k;
+    }
+    f->coeffs[((max_k / 2) * dst_size + i) * 2 + (max_k & 1)] += left;
+    f->start[i] = start;
   }
 
+  mt_free(weights);
   return 0;
 }
 
-int st20_yuv422p10le_to_rfc4175_422be10_simd(uint16_t* y, uint16_t* b, uint16_t* r,
-                                             struct st20_rfc4175_422_10_pg2_be* pg,
-                                             uint32_t w, uint32_t h,
-                                             enum mtl_simd_level level) {
+static void scale_h_scalar(const uint16_t* src, uint16_t* dst,
+                           const struct st_scale_filter* f, uint32_t x) {
+  for (; x < f->dst_size; x++) {
+    const uint16_t* s = src + f->start[x];
+    int32_t sum = 1 << (ST_SCALE_COEFF_BITS - 1);
+    for (uint32_t t = 0; t < f->taps; t++) {
+      sum += s[t] * f->coeffs[((t / 2) * f->dst_size + x) * 2 + (t & 1)];
+    }
+    dst[x] = sum >> ST_SCALE_COEFF_BITS;
+  }
+}
+
+static void scale_v_scalar(uint16_t* const* lines, uint16_t* dst, uint32_t w,
+                           const struct st_scale_filter* f, uint32_t y, uint32_t x) {
+  for (; x < w; x++) {
+    int32_t sum = 1 << (ST_SCALE_COEFF_BITS - 1);
+    for (uint32_t t = 0; t < f->taps; t++) {
+      sum += lines[t][x] * f->coeffs[((t / 2) * f->dst_size + y) * 2 + (t & 1)];
+    }
+    dst[x] = sum >> ST_SCALE_COEFF_BITS;
+  }
+}
+
+static void scale_h_simd(const uint16_t* src, uint16_t* dst,
+                         const struct st_scale_filter* f, enum mtl_simd_level level) {
   enum mtl_simd_level cpu_level = mtl_get_simd_level();
-  int ret;
+  uint32_t x = 0;
 
   MTL_MAY_UNUSED(cpu_level);
-  MTL_MAY_UNUSED(ret);
+  MTL_MAY_UNUSED(level);
 
 #ifdef MTL_HAS_AVX512
   if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
     dbg("%s, avx512 ways\n", __func__);
-    ret = st20_yuv422p10le_to_rfc4175_422be10_avx512(y, b, r, pg, w, h);
-    if (ret == 0) return 0;
-    err("%s, avx512 ways failed %d\n", __func__, ret);
+    x = st_scale_h_avx512(src, dst, f, x);
   }
 #endif
 
-  /* the last option */
-  return st20_yuv422p10le_to_rfc4175_422be10_scalar(y, b, r, pg, w, h);
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    x = st_scale_h_avx2(src, dst, f, x);
+  }
+#endif
+
+  /* the left outputs */
+  scale_h_scalar(src, dst, f, x);
 }
 
-int st20_yuv422p10le_to_rfc4175_422be10_simd_dma(
-    mtl_udma_handle udma, uint16_t* y, mtl_iova_t y_iova, uint16_t* b, mtl_iova_t b_iova,
-    uint16_t* r, mtl_iova_t r_iova, struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
-    uint32_t h, enum mtl_simd_level level) {
+static void scale_v_simd(uint16_t* const* lines, uint16_t* dst, uint32_t w,
+                         const struct st_scale_filter* f, uint32_t y,
+                         enum mtl_simd_level level) {
   enum mtl_simd_level cpu_level = mtl_get_simd_level();
-  int ret;
+  uint32_t x = 0;
 
   MTL_MAY_UNUSED(cpu_level);
-  MTL_MAY_UNUSED(ret);
+  MTL_MAY_UNUSED(level);
 
 #ifdef MTL_HAS_AVX512
   if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
     dbg("%s, avx512 ways\n", __func__);
-    ret = st20_yuv422p10le_to_rfc4175_422be10_avx512_dma(udma, y, y_iova, b, b_iova, r,
-                                                         r_iova, pg, w, h);
-    if (ret == 0) return 0;
-    err("%s, avx512 ways failed %d\n", __func__, ret);
+    x = st_scale_v_avx512(lines, dst, w, f, y, x);
   }
 #endif
 
-  /* the last option */
-  return st20_yuv422p10le_to_rfc4175_422be10_scalar(y, b, r, pg, w, h);
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    x = st_scale_v_avx2(lines, dst, w, f, y, x);
+  }
+#endif
+
+  /* the left outputs */
+  scale_v_scalar(lines, dst, w, f, y, x);
 }
 
-static int st20_rfc4175_422be10_to_yuv422p10le_scalar(
-    struct st20_rfc4175_422_10_pg2_be* pg, uint16_t* y, uint16_t* b, uint16_t* r,
-    uint32_t w, uint32_t h) {
-  uint32_t cnt = w * h / 2; /* two pgs in one convert */
-  uint16_t cb, y0, cr, y1;
+/* the samples of one plane line in the 16bit planar fmt */
+static inline uint32_t scale_plane_width(enum st_frame_fmt fmt, uint32_t width,
+                                         uint8_t plane) {
+  return st_frame_least_linesize(fmt, width, plane) / sizeof(uint16_t);
+}
 
-  for (uint32_t pg2 = 0; pg2 < cnt; pg2++) {
-    cb = (pg->Cb00 << 2) + pg->Cb00_;
-    y0 = (pg->Y00 << 4) + pg->Y00_;
-    cr = (pg->Cr00 << 6) + pg->Cr00_;
-    y1 = (pg->Y01 << 8) + pg->Y01_;
+/* the sub frame of one line */
+static void scale_line_frame(struct st_frame* line, struct st_frame* frame, uint32_t y) {
+  uint8_t planes = st_frame_fmt_planes(frame->fmt);
 
-    *b++ = cb;
-    *y++ = y0;
-    *r++ = cr;
-    *y++ = y1;
-    pg++;
+  *line = *frame;
+  line->height = 1;
+  line->interlaced = false;
+  for (uint8_t plane = 0; plane < planes; plane++) {
+    size_t offset = frame->linesize[plane] * y;
+    line->addr[plane] = (uint8_t*)frame->addr[plane] + offset;
+    line->iova[plane] = frame->iova[plane] + offset;
   }
-
-  return 0;
 }
 
-int st20_rfc4175_422be10_to_yuv422p10le_simd(struct st20_rfc4175_422_10_pg2_be* pg,
-                                             uint16_t* y, uint16_t* b, uint16_t* r,
-                                             uint32_t w, uint32_t h,
-                                             enum mtl_simd_level level) {
-  enum mtl_simd_level cpu_level = mtl_get_simd_level();
-  int ret;
+static int scale_line_init(struct st_frame* line, enum st_frame_fmt fmt, uint32_t width,
+                           int socket_id) {
+  uint8_t planes = st_frame_fmt_planes(fmt);
+  size_t size = 0;
+
+  memset(line, 0, sizeof(*line));
+  line->fmt = fmt;
+  line->width = width;
+  line->height = 1;
+  for (uint8_t plane = 0; plane < planes; plane++) {
+    line->linesize[plane] = st_frame_least_linesize(fmt, width, plane);
+    size += line->linesize[plane];
+  }
 
-  MTL_MAY_UNUSED(cpu_level);
-  MTL_MAY_UNUSED(ret);
-  MTL_MAY_UNUSED(level);
+  uint8_t* addr = mt_rte_zmalloc_socket(size, socket_id);
+  if (!addr) return -ENOMEM;
+  for (uint8_t plane = 0; plane < planes; plane++) {
+    line->addr[plane] = addr;
+    addr += line->linesize[plane];
+  }
+  line->buffer_size = line->data_size = size;
+  return 0;
+}
 
-#ifdef MTL_HAS_AVX512_VBMI2
-  if ((level >= MTL_SIMD_LEVEL_AVX512_VBMI2) &&
-      (cpu_level >= MTL_SIMD_LEVEL_AVX512_VBMI2)) {
-    dbg("%s, avx512_vbmi ways\n", __func__);
-    ret = st20_rfc4175_422be10_to_yuv422p10le_avx512_vbmi(pg, y, b, r, w, h);
-    if (ret == 0) return 0;
-    dbg("%s, avx512_vbmi ways failed\n", __func__);
+static void scale_line_uinit(struct st_frame* line) {
+  if (line->addr[0]) {
+    mt_rte_free(line->addr[0]);
+    line->addr[0] = NULL;
   }
-#endif
+}
 
-#ifdef MTL_HAS_AVX512
-  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
-    dbg("%s, avx512 ways\n", __func__);
-    ret = st20_rfc4175_422be10_to_yuv422p10le_avx512(pg, y, b, r, w, h);
-    if (ret == 0) return 0;
-    dbg("%s, avx512 ways failed\n", __func__);
+int st_frame_scaler_free(struct st_frame_scaler* scaler) {
+  for (uint8_t plane = 0; plane < ST_MAX_PLANES; plane++) {
+    scale_filter_free(&scaler->filter_h[plane]);
+    if (scaler->ring[plane]) {
+      mt_rte_free(scaler->ring[plane]);
+      scaler->ring[plane] = NULL;
+    }
   }
-#endif
+  scale_filter_free(&scaler->filter_v);
+  if (scaler->ring_line) {
+    mt_rte_free(scaler->ring_line);
+    scaler->ring_line = NULL;
+  }
+  if (scaler->taps_lines) {
+    mt_rte_free(scaler->taps_lines);
+    scaler->taps_lines = NULL;
+  }
+  if (scaler->edge_line) {
+    mt_rte_free(scaler->edge_line);
+    scaler->edge_line = NULL;
+  }
+  scale_line_uinit(&scaler->src_line);
+  scale_line_uinit(&scaler->dst_line);
+  scale_line_uinit(&scaler->repack_line);
+  mt_rte_free(scaler);
+  return 0;
+}
 
-  /* the last option */
-  return st20_rfc4175_422be10_to_yuv422p10le_scalar(pg, y, b, r, w, h);
+static bool scale_fmt_has_pg(enum st_frame_fmt fmt, uint32_t width) {
+  enum st20_fmt t_fmt = st_frame_fmt_to_transport(fmt);
+  struct st20_pgroup st20_pg;
+
+  if (t_fmt == ST20_FMT_MAX) return true; /* not the pg fmt */
+  if (st20_get_pgroup(t_fmt, &st20_pg) < 0) return false;
+  return !(width % st20_pg.coverage);
 }
 
-static int st20_rfc4175_422be10_to_yuv422p10le_scalar_2way(
-    struct st20_rfc4175_422_10_pg2_be* pg_be, uint16_t* y_full, uint16_t* b_full,
-    uint16_t* r_full, uint32_t w, uint32_t h, uint16_t* y_decimated,
-    uint16_t* b_decimated, uint16_t* r_decimated, int decimator) {
-  uint32_t pg_per_line = w / 2; /* two pgs in one convert */
-  uint16_t cb, y0, cr, y1;
-  int stride = decimator - 1;
+/* the pack path of scale_fmt to dst_fmt */
+static int scaler_init_pack(struct st_frame_scaler* scaler) {
+  const struct st_frame_converter* converter;
+  enum st_frame_fmt dst_fmt = scaler->dst_fmt;
+  int ret;
 
-  for (uint32_t line = 0; line < h; line++) {
-    for (uint32_t p = 0; p < pg_per_line; p++) {
-      cb = (pg_be->Cb00 << 2) + pg_be->Cb00_;
-      y0 = (pg_be->Y00 << 4) + pg_be->Y00_;
-      cr = (pg_be->Cr00 << 6) + pg_be->Cr00_;
-      y1 = (pg_be->Y01 << 8) + pg_be->Y01_;
+  if (dst_fmt == scaler->scale_fmt) return 0; /* write to dst directly */
 
-      *b_full++ = cb;
-      *y_full++ = y0;
-      *r_full++ = cr;
-      *y_full++ = y1;
-      pg_be++;
+  if (st_frame_fmt_get_sampling(dst_fmt) == ST_FRAME_SAMPLING_420) {
+    err("%s, 420 dst %s not supported\n", __func__, st_frame_fmt_name(dst_fmt));
+    return -EINVAL;
+  }
 
-      /* handle decimated */
-      if (((line % decimator) == stride) && ((p % decimator) == stride)) {
-        *b_decimated++ = cb;
-        *y_decimated++ = y0;
-        *r_decimated++ = cr;
-        *y_decimated++ = y1;
-      }
+  converter = converter_find(scaler->scale_fmt, dst_fmt);
+  if (!converter) { /* try by the src fmt */
+    if (scaler->src_fmt == scaler->scale_fmt ||
+        !converter_find(scaler->src_fmt, dst_fmt)) {
+      err("%s, no convert from %s to %s\n", __func__,
+          st_frame_fmt_name(scaler->scale_fmt), st_frame_fmt_name(dst_fmt));
+      return -EINVAL;
+    }
+    if (!scale_fmt_has_pg(scaler->src_fmt, scaler->dst_width)) {
+      err("%s, dst width %u not aligned to the pg of %s\n", __func__, scaler->dst_width,
+          st_frame_fmt_name(scaler->src_fmt));
+      return -EINVAL;
     }
+    ret = st_frame_get_converter(scaler->src_fmt, dst_fmt, &scaler->repack_converter);
+    if (ret < 0) return ret;
+    ret = scale_line_init(&scaler->repack_line, scaler->src_fmt, scaler->dst_width,
+                          scaler->socket_id);
+    if (ret < 0) return ret;
+    scaler->repack = true;
+    dst_fmt = scaler->src_fmt;
   }
 
+  ret = st_frame_get_converter(scaler->scale_fmt, dst_fmt, &scaler->pack_converter);
+  if (ret < 0) return ret;
+  ret = scale_line_init(&scaler->dst_line, scaler->scale_fmt, scaler->dst_width,
+                        scaler->socket_id);
+  if (ret < 0) return ret;
+  scaler->pack = true;
   return 0;
 }
 
-int st20_rfc4175_422be10_to_yuv422p10le_simd_2way(
-    struct st20_rfc4175_422_10_pg2_be* pg_be, uint16_t* y_full, uint16_t* b_full,
-    uint16_t* r_full, uint32_t w, uint32_t h, uint16_t* y_decimated,
-    uint16_t* b_decimated, uint16_t* r_decimated, int decimator,
-    enum mtl_simd_level level) {
-  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+struct st_frame_scaler* st_frame_scaler_create(enum st_frame_fmt src_fmt,
+                                               uint32_t src_width, uint32_t src_height,
+                                               enum st_frame_fmt dst_fmt,
+                                               uint32_t dst_width, uint32_t dst_height,
+                                               int socket_id) {
+  struct st_frame_scaler* scaler;
+  enum st_frame_fmt scale_fmt = ST_FRAME_FMT_MAX;
+  int ret;
+
+  for (int i = 0; i < MTL_ARRAY_SIZE(scale_fmts); i++) {
+    if (scale_fmts[i].fmt == src_fmt) {
+      scale_fmt = scale_fmts[i].scale_fmt;
+      break;
+    }
+  }
+  if (scale_fmt == ST_FRAME_FMT_MAX) {
+    err("%s, src %s not supported\n", __func__, st_frame_fmt_name(src_fmt));
+    return NULL;
+  }
+  if (!src_width || !src_height || !dst_width || !dst_height) {
+    err("%s, invalid size %ux%u to %ux%u\n", __func__, src_width, src_height, dst_width,
+        dst_height);
+    return NULL;
+  }
+  if (!scale_fmt_has_pg(src_fmt, src_width) || !scale_fmt_has_pg(dst_fmt, dst_width)) {
+    err("%s, width %u to %u not aligned to the pg of %s to %s\n", __func__, src_width,
+        dst_width, st_frame_fmt_name(src_fmt), st_frame_fmt_name(dst_fmt));
+    return NULL;
+  }
+  if (st_frame_fmt_get_sampling(scale_fmt) == ST_FRAME_SAMPLING_422 &&
+      ((src_width | dst_width) & 0x1)) {
+    err("%s, odd width %u to %u for 422\n", __func__, src_width, dst_width);
+    return NULL;
+  }
+
+  scaler = mt_rte_zmalloc_socket(sizeof(*scaler), socket_id);
+  if (!scaler) {
+    err("%s, scaler malloc fail\n", __func__);
+    return NULL;
+  }
+  scaler->src_fmt = src_fmt;
+  scaler->dst_fmt = dst_fmt;
+  scaler->scale_fmt = scale_fmt;
+  scaler->src_width = src_width;
+  scaler->src_height = src_height;
+  scaler->dst_width = dst_width;
+  scaler->dst_height = dst_height;
+  scaler->planes = st_frame_fmt_planes(scale_fmt);
+  scaler->simd_level = mtl_get_simd_level();
+  scaler->socket_id = socket_id;
+
+  if (src_fmt != scale_fmt) {
+    ret = st_frame_get_converter(src_fmt, scale_fmt, &scaler->unpack_converter);
+    if (ret < 0) goto fail;
+    ret = scale_line_init(&scaler->src_line, scale_fmt, src_width, socket_id);
+    if (ret < 0) goto fail;
+    scaler->unpack = true;
+  }
+  ret = scaler_init_pack(scaler);
+  if (ret < 0) goto fail;
+
+  ret = scale_filter_init(&scaler->filter_v, src_height, dst_height, socket_id);
+  if (ret < 0) goto fail;
+  uint32_t taps = scaler->filter_v.taps;
+  uint32_t edge_taps = 0;
+  for (uint8_t plane = 0; plane < scaler->planes; plane++) {
+    uint32_t src_w = scale_plane_width(scale_fmt, src_width, plane);
+    uint32_t dst_w = scale_plane_width(scale_fmt, dst_width, plane);
+    ret = scale_filter_init(&scaler->filter_h[plane], src_w, dst_w, socket_id);
+    if (ret < 0) goto fail;
+    if (scaler->filter_h[plane].taps > src_w)
+      edge_taps = RTE_MAX(edge_taps, scaler->filter_h[plane].taps);
+    scaler->ring[plane] =
+        mt_rte_zmalloc_socket(sizeof(uint16_t) * dst_w * taps, socket_id);
+    if (!scaler->ring[plane]) {
+      ret = -ENOMEM;
+      goto fail;
+    }
+  }
+  scaler->ring_line = mt_rte_zmalloc_socket(sizeof(int32_t) * taps, socket_id);
+  scaler->taps_lines =
+      mt_rte_zmalloc_socket(sizeof(uint16_t*) * taps * scaler->planes, socket_id);
+  if (!scaler->ring_line || !scaler->taps_lines) {
+    ret = -ENOMEM;
+    goto fail;
+  }
+  if (edge_taps) {
+    scaler->edge_line = mt_rte_zmalloc_socket(sizeof(uint16_t) * edge_taps, socket_id);
+    if (!scaler->edge_line) {
+      ret = -ENOMEM;
+      goto fail;
+    }
+  }
+
+  info("%s, %s %ux%u to %s %ux%u, taps %ux%u, unpack %s pack %s repack %s\n", __func__,
+       st_frame_fmt_name(src_fmt), src_width, src_height, st_frame_fmt_name(dst_fmt),
+       dst_width, dst_height, scaler->filter_h[0].taps, taps,
+       scaler->unpack ? "yes" : "no", scaler->pack ? "yes" : "no",
+       scaler->repack ? "yes" : "no");
+  return scaler;
+
+fail:
+  err("%s, fail %d for %s %ux%u to %s %ux%u\n", __func__, ret,
+      st_frame_fmt_name(src_fmt), src_width, src_height, st_frame_fmt_name(dst_fmt),
+      dst_width, dst_height);
+  st_frame_scaler_free(scaler);
+  return NULL;
+}
+
+int st_frame_scaler_set_color(struct st_frame_scaler* scaler,
+                              enum st20_color_matrix matrix,
+                              enum st20_color_range range) {
+  if (matrix >= ST20_COLOR_MATRIX_MAX || range >= ST20_COLOR_RANGE_MAX) {
+    err("%s, invalid matrix %d or range %d\n", __func__, matrix, range);
+    return -EINVAL;
+  }
+  scaler->pack_converter.color_matrix = matrix;
+  scaler->pack_converter.color_range = range;
+  scaler->repack_converter.color_matrix = matrix;
+  scaler->repack_converter.color_range = range;
+  return 0;
+}
+
+/* horizontal scale the input line into the slot of the ring */
+static int scaler_fill_line(struct st_frame_scaler* scaler, struct st_frame* src,
+                            uint32_t line, uint32_t slot) {
+  struct st_frame src_line;
+  int ret;
+
+  scale_line_frame(&src_line, src, line);
+  if (scaler->unpack) {
+    ret = st_frame_converter_convert(&scaler->unpack_converter, &src_line,
+                                     &scaler->src_line);
+    if (ret < 0) return ret;
+    src_line = scaler->src_line;
+  }
+
+  for (uint8_t plane = 0; plane < scaler->planes; plane++) {
+    struct st_scale_filter* f = &scaler->filter_h[plane];
+    const uint16_t* in = src_line.addr[plane];
+    if (f->taps > f->src_size) {
+      /* replicate the edge sample for the taps past the end */
+      memcpy(scaler->edge_line, in, sizeof(*in) * f->src_size);
+      for (uint32_t n = f->src_size; n < f->taps; n++)
+        scaler->edge_line[n] = in[f->src_size - 1];
+      in = scaler->edge_line;
+    }
+    scale_h_simd(in, scaler->ring[plane] + f->dst_size * slot, f, scaler->simd_level);
+  }
+  scaler->ring_line[slot] = line;
+  return 0;
+}
+
+int st_frame_scaler_scale(struct st_frame_scaler* scaler, struct st_frame* src,
+                          struct st_frame* dst) {
+  struct st_scale_filter* fv = &scaler->filter_v;
+  uint32_t taps = fv->taps;
+  int ret;
+
+  if (src->fmt != scaler->src_fmt || dst->fmt != scaler->dst_fmt ||
+      src->width != scaler->src_width || dst->width != scaler->dst_width ||
+      st_frame_data_height(src) != scaler->src_height ||
+      st_frame_data_height(dst) != scaler->dst_height) {
+    err("%s, mismatch, source: %s %ux%u, dest: %s %ux%u\n", __func__,
+        st_frame_fmt_name(src->fmt), src->width, src->height, st_frame_fmt_name(dst->fmt),
+        dst->width, dst->height);
+    return -EINVAL;
+  }
+
+  for (uint32_t slot = 0; slot < taps; slot++) scaler->ring_line[slot] = -1;
+
+  for (uint32_t y = 0; y < scaler->dst_height; y++) {
+    /* the windows move forward only, each input line is filled once */
+    for (uint32_t t = 0; t < taps; t++) {
+      /* the tap past the end reuses the slot of the edge line */
+      uint32_t line = RTE_MIN(fv->start[y] + t, fv->src_size - 1);
+      uint32_t slot = line % taps;
+      if (scaler->ring_line[slot] != (int32_t)line) {
+        ret = scaler_fill_line(scaler, src, line, slot);
+        if (ret < 0) return ret;
+      }
+      for (uint8_t plane = 0; plane < scaler->planes; plane++) {
+        uint32_t w = scaler->filter_h[plane].dst_size;
+        scaler->taps_lines[plane * taps + t] = scaler->ring[plane] + w * slot;
+      }
+    }
+
+    struct st_frame dst_line;
+    scale_line_frame(&dst_line, dst, y);
+    struct st_frame* out = scaler->pack ? &scaler->dst_line : &dst_line;
+    for (uint8_t plane = 0; plane < scaler->planes; plane++) {
+      uint32_t w = scaler->filter_h[plane].dst_size;
+      scale_v_simd(scaler->taps_lines + plane * taps, out->addr[plane], w, fv, y,
+                   scaler->simd_level);
+    }
+
+    if (scaler->repack) {
+      ret = st_frame_converter_convert(&scaler->pack_converter, &scaler->dst_line,
+                                       &scaler->repack_line);
+      if (ret < 0) return ret;
+      ret = st_frame_converter_convert(&scaler->repack_converter, &scaler->repack_line,
+                                       &dst_line);
+      if (ret < 0) return ret;
+    } else if (scaler->pack) {
+      ret = st_frame_converter_convert(&scaler->pack_converter, &scaler->dst_line,
+                                       &dst_line);
+      if (ret < 0) return ret;
+    }
+  }
+
+  return 0;
+}
+
+int st_frame_scale_simd(struct st_frame* src, struct st_frame* dst,
+                        enum mtl_simd_level level) {
+  struct st_frame_scaler* scaler;
+  int ret;
+
+  if (src->interlaced != dst->interlaced) {
+    err("%s, interlaced mismatch\n", __func__);
+    return -EINVAL;
+  }
+
+  scaler = st_frame_scaler_create(src->fmt, src->width, st_frame_data_height(src),
+                                  dst->fmt, dst->width, st_frame_data_height(dst),
+                                  SOCKET_ID_ANY);
+  if (!scaler) return -EINVAL;
+  if (level < scaler->simd_level) scaler->simd_level = level;
+  ret = st_frame_scaler_scale(scaler, src, dst);
+  st_frame_scaler_free(scaler);
+  return ret;
+}
+
+int st_frame_scale(struct st_frame* src, struct st_frame* dst) {
+  return st_frame_scale_simd(src, dst, MTL_SIMD_LEVEL_MAX);
+}
+
+static int st20_yuv422p10le_to_rfc4175_422be10_scalar(
+    uint16_t* y, uint16_t* b, uint16_t* r, struct st20_rfc4175_422_10_pg2_be* pg,
+    uint32_t w, uint32_t h) {
+  uint32_t cnt = w * h / 2; /* two pgs in one convert */
+  uint16_t cb, y0, cr, y1;
+
+  for (uint32_t pg2 = 0; pg2 < cnt; pg2++) {
+    cb = *b++;
+    y0 = *y++;
+    cr = *r++;
+    y1 = *y++;
+
+    pg->Cb00 = cb >> 2;
+    pg->Cb00_ = cb;
+    pg->Y00 = y0 >> 4;
+    pg->Y00_ = y0;
+    pg->Cr00 = cr >> 6;
+    pg->Cr00_ = cr;
+    pg->Y01 = y1 >> 8;
+    pg->Y01_ = y1;
+
+    pg++;
+  }
+
+  return 0;
+}
+
+int st20_yuv422p10le_to_rfc4175_422be10_simd(uint16_t* y, uint16_t* b, uint16_t* r,
+                                             struct st20_rfc4175_422_10_pg2_be* pg,
+                                             uint32_t w, uint32_t h,
+                                             enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(ret);
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    ret = st20_yuv422p10le_to_rfc4175_422be10_avx512(y, b, r, pg, w, h);
+    if (ret == 0) return 0;
+    err("%s, avx512 ways failed %d\n", __func__, ret);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_yuv422p10le_to_rfc4175_422be10_avx2(y, b, r, pg, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
+  return st20_yuv422p10le_to_rfc4175_422be10_scalar(y, b, r, pg, w, h);
+}
+
+int st20_yuv422p10le_to_rfc4175_422be10_simd_dma(
+    mtl_udma_handle udma, uint16_t* y, mtl_iova_t y_iova, uint16_t* b, mtl_iova_t b_iova,
+    uint16_t* r, mtl_iova_t r_iova, struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+    uint32_t h, enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(ret);
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    ret = st20_yuv422p10le_to_rfc4175_422be10_avx512_dma(udma, y, y_iova, b, b_iova, r,
+                                                         r_iova, pg, w, h);
+    if (ret == 0) return 0;
+    err("%s, avx512 ways failed %d\n", __func__, ret);
+  }
+#endif
+
+  /* the last option */
+  return st20_yuv422p10le_to_rfc4175_422be10_scalar(y, b, r, pg, w, h);
+}
+
+static int st20_rfc4175_422be10_to_yuv422p10le_scalar(
+    struct st20_rfc4175_422_10_pg2_be* pg, uint16_t* y, uint16_t* b, uint16_t* r,
+    uint32_t w, uint32_t h) {
+  uint32_t cnt = w * h / 2; /* two pgs in one convert */
+  uint16_t cb, y0, cr, y1;
+
+  for (uint32_t pg2 = 0; pg2 < cnt; pg2++) {
+    cb = (pg->Cb00 << 2) + pg->Cb00_;
+    y0 = (pg->Y00 << 4) + pg->Y00_;
+    cr = (pg->Cr00 << 6) + pg->Cr00_;
+    y1 = (pg->Y01 << 8) + pg->Y01_;
+
+    *b++ = cb;
+    *y++ = y0;
+    *r++ = cr;
+    *y++ = y1;
+    pg++;
+  }
+
+  return 0;
+}
+
+int st20_rfc4175_422be10_to_yuv422p10le_simd(struct st20_rfc4175_422_10_pg2_be* pg,
+                                             uint16_t* y, uint16_t* b, uint16_t* r,
+                                             uint32_t w, uint32_t h,
+                                             enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(ret);
+  MTL_MAY_UNUSED(level);
+
+#ifdef MTL_HAS_AVX512_VBMI2
+  if ((level >= MTL_SIMD_LEVEL_AVX512_VBMI2) &&
+      (cpu_level >= MTL_SIMD_LEVEL_AVX512_VBMI2)) {
+    dbg("%s, avx512_vbmi ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_yuv422p10le_avx512_vbmi(pg, y, b, r, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx512_vbmi ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_yuv422p10le_avx512(pg, y, b, r, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx512 ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_yuv422p10le_avx2(pg, y, b, r, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
+  return st20_rfc4175_422be10_to_yuv422p10le_scalar(pg, y, b, r, w, h);
+}
+
+static int st20_rfc4175_422be10_to_yuv422p10le_scalar_2way(
+    struct st20_rfc4175_422_10_pg2_be* pg_be, uint16_t* y_full, uint16_t* b_full,
+    uint16_t* r_full, uint32_t w, uint32_t h, uint16_t* y_decimated,
+    uint16_t* b_decimated, uint16_t* r_decimated, int decimator) {
+  uint32_t pg_per_line = w / 2; /* two pgs in one convert */
+  uint16_t cb, y0, cr, y1;
+  int stride = decimator - 1;
+
+  for (uint32_t line = 0; line < h; line++) {
+    for (uint32_t p = 0; p < pg_per_line; p++) {
+      cb = (pg_be->Cb00 << 2) + pg_be->Cb00_;
+      y0 = (pg_be->Y00 << 4) + pg_be->Y00_;
+      cr = (pg_be->Cr00 << 6) + pg_be->Cr00_;
+      y1 = (pg_be->Y01 << 8) + pg_be->Y01_;
+
+      *b_full++ = cb;
+      *y_full++ = y0;
+      *r_full++ = cr;
+      *y_full++ = y1;
+      pg_be++;
+
+      /* handle decimated */
+      if (((line % decimator) == stride) && ((p % decimator) == stride)) {
+        *b_decimated++ = cb;
+        *y_decimated++ = y0;
+        *r_decimated++ = cr;
+        *y_decimated++ = y1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+int st20_rfc4175_422be10_to_yuv422p10le_simd_2way(
+    struct st20_rfc4175_422_10_pg2_be* pg_be, uint16_t* y_full, uint16_t* b_full,
+    uint16_t* r_full, uint32_t w, uint32_t h, uint16_t* y_decimated,
+    uint16_t* b_decimated, uint16_t* r_decimated, int decimator,
+    enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
   int ret;
 
   MTL_MAY_UNUSED(cpu_level);
@@ -1346,6 +2108,15 @@ int st20_rfc4175_422be10_to_422le8_simd(struct st20_rfc4175_422_10_pg2_be* pg_10
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_422le8_avx2(pg_10, pg_8, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_rfc4175_422be10_to_422le8_scalar(pg_10, pg_8, w, h);
 }
@@ -1423,6 +2194,15 @@ int st20_rfc4175_422be10_to_yuv422p8_simd(struct st20_rfc4175_422_10_pg2_be* pg,
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_yuv422p8_avx2(pg, y, b, r, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_rfc4175_422be10_to_yuv422p8_scalar(pg, y, b, r, w, h);
 }
@@ -1471,6 +2251,15 @@ int st20_rfc4175_422be10_to_yuv420p8_simd(struct st20_rfc4175_422_10_pg2_be* pg,
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_yuv420p8_avx2(pg, y, b, r, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_rfc4175_422be10_to_yuv420p8_scalar(pg, y, b, r, w, h);
 }
@@ -1540,6 +2329,15 @@ int st20_rfc4175_422le10_to_v210_simd(uint8_t* pg_le, uint8_t* pg_v210, uint32_t
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422le10_to_v210_avx2(pg_le, pg_v210, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_rfc4175_422le10_to_v210_scalar(pg_le, pg_v210, w, h);
 }
@@ -1648,6 +2446,15 @@ int st20_rfc4175_422be10_to_v210_simd(struct st20_rfc4175_422_10_pg2_be* pg_be,
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_v210_avx2(pg_be, pg_v210, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_rfc4175_422be10_to_v210_scalar((uint8_t*)pg_be, pg_v210, w, h);
 }
@@ -1834,6 +2641,15 @@ int st20_v210_to_rfc4175_422be10_simd(uint8_t* pg_v210,
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_v210_to_rfc4175_422be10_avx2(pg_v210, pg_be, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_v210_to_rfc4175_422be10_scalar(pg_v210, (uint8_t*)pg_be, w, h);
 }
@@ -1908,6 +2724,15 @@ int st20_rfc4175_422be10_to_y210_simd(struct st20_rfc4175_422_10_pg2_be* pg_be,
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_y210_avx2(pg_be, pg_y210, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_rfc4175_422be10_to_y210_scalar(pg_be, pg_y210, w, h);
 }
@@ -1978,6 +2803,15 @@ int st20_y210_to_rfc4175_422be10_simd(uint16_t* pg_y210,
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_y210_to_rfc4175_422be10_avx2(pg_y210, pg_be, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_y210_to_rfc4175_422be10_scalar(pg_y210, pg_be, w, h);
 }
@@ -2038,8 +2872,23 @@ int st20_yuv422p12le_to_rfc4175_422be12_simd(uint16_t* y, uint16_t* b, uint16_t*
                                              struct st20_rfc4175_422_12_pg2_be* pg,
                                              uint32_t w, uint32_t h,
                                              enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
   MTL_MAY_UNUSED(level);
-  /* the only option */
+  MTL_MAY_UNUSED(ret);
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_yuv422p12le_to_rfc4175_422be12_avx2(y, b, r, pg, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
   return st20_yuv422p12le_to_rfc4175_422be12_scalar(y, b, r, pg, w, h);
 }
 
@@ -2094,6 +2943,15 @@ int st20_rfc4175_422be12_to_yuv422p12le_simd(struct st20_rfc4175_422_12_pg2_be*
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422be12_to_yuv422p12le_avx2(pg, y, b, r, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_rfc4175_422be12_to_yuv422p12le_scalar(pg, y, b, r, w, h);
 }
@@ -2221,6 +3079,15 @@ int st20_rfc4175_422be12_to_422le12_simd(struct st20_rfc4175_422_12_pg2_be* pg_b
   }
 #endif
 
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422be12_to_422le12_avx2(pg_be, pg_le, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
   /* the last option */
   return st20_rfc4175_422be12_to_422le12_scalar(pg_be, pg_le, w, h);
 }
@@ -2284,8 +3151,23 @@ int st20_rfc4175_422le12_to_422be12_simd(struct st20_rfc4175_422_12_pg2_le* pg_l
                                          struct st20_rfc4175_422_12_pg2_be* pg_be,
                                          uint32_t w, uint32_t h,
                                          enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
   MTL_MAY_UNUSED(level);
-  /* the only option */
+  MTL_MAY_UNUSED(ret);
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422le12_to_422be12_avx2(pg_le, pg_be, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
   return st20_rfc4175_422le12_to_422be12_scalar(pg_le, pg_be, w, h);
 }
 
@@ -2345,8 +3227,31 @@ int st20_444p10le_to_rfc4175_444be10_simd(uint16_t* y_g, uint16_t* b_r, uint16_t
                                           struct st20_rfc4175_444_10_pg4_be* pg,
                                           uint32_t w, uint32_t h,
                                           enum mtl_simd_level level) {
-  MTL_MAY_UNUSED(level);
-  /* the only option */
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(ret);
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    ret = st20_444p10le_to_rfc4175_444be10_avx512(y_g, b_r, r_b, pg, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx512 ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_444p10le_to_rfc4175_444be10_avx2(y_g, b_r, r_b, pg, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
   return st20_444p10le_to_rfc4175_444be10_scalar(y_g, b_r, r_b, pg, w, h);
 }
 
@@ -2393,8 +3298,41 @@ int st20_rfc4175_444be10_to_444p10le_simd(struct st20_rfc4175_444_10_pg4_be* pg,
                                           uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
                                           uint32_t w, uint32_t h,
                                           enum mtl_simd_level level) {
-  MTL_MAY_UNUSED(level);
-  /* the only option */
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(ret);
+
+#ifdef MTL_HAS_AVX512_VBMI2
+  if ((level >= MTL_SIMD_LEVEL_AVX512_VBMI2) &&
+      (cpu_level >= MTL_SIMD_LEVEL_AVX512_VBMI2)) {
+    dbg("%s, avx512_vbmi ways\n", __func__);
+    ret = st20_rfc4175_444be10_to_444p10le_avx512_vbmi(pg, y_g, b_r, r_b, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx512_vbmi ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    ret = st20_rfc4175_444be10_to_444p10le_avx512(pg, y_g, b_r, r_b, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx512 ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_444be10_to_444p10le_avx2(pg, y_g, b_r, r_b, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
   return st20_rfc4175_444be10_to_444p10le_scalar(pg, y_g, b_r, r_b, w, h);
 }
 
@@ -2543,9 +3481,12 @@ int st20_rfc4175_444be10_to_444le10_simd(struct st20_rfc4175_444_10_pg4_be* pg_b
                                          struct st20_rfc4175_444_10_pg4_le* pg_le,
                                          uint32_t w, uint32_t h,
                                          enum mtl_simd_level level) {
-  MTL_MAY_UNUSED(level);
-  /* the only option */
-  return st20_rfc4175_444be10_to_444le10_scalar(pg_be, pg_le, w, h);
+  /* same sample stream as 422 10bit, one 444 pg4 is three 422 pg2 */
+  uint32_t pg2_w = w * h / 4 * 6;
+
+  return st20_rfc4175_422be10_to_422le10_simd((struct st20_rfc4175_422_10_pg2_be*)pg_be,
+                                             (struct st20_rfc4175_422_10_pg2_le*)pg_le,
+                                             pg2_w, 1, level);
 }
 
 int st20_rfc4175_444le10_to_444be10_scalar(struct st20_rfc4175_444_10_pg4_le* pg_le,
@@ -2604,9 +3545,12 @@ int st20_rfc4175_444le10_to_444be10_simd(struct st20_rfc4175_444_10_pg4_le* pg_l
                                          struct st20_rfc4175_444_10_pg4_be* pg_be,
                                          uint32_t w, uint32_t h,
                                          enum mtl_simd_level level) {
-  MTL_MAY_UNUSED(level);
-  /* the only option */
-  return st20_rfc4175_444le10_to_444be10_scalar(pg_le, pg_be, w, h);
+  /* same sample stream as 422 10bit, one 444 pg4 is three 422 pg2 */
+  uint32_t pg2_w = w * h / 4 * 6;
+
+  return st20_rfc4175_422le10_to_422be10_simd((struct st20_rfc4175_422_10_pg2_le*)pg_le,
+                                             (struct st20_rfc4175_422_10_pg2_be*)pg_be,
+                                             pg2_w, 1, level);
 }
 
 static int st20_444p12le_to_rfc4175_444be12_scalar(uint16_t* y_g, uint16_t* b_r,
@@ -2647,8 +3591,31 @@ int st20_444p12le_to_rfc4175_444be12_simd(uint16_t* y_g, uint16_t* b_r, uint16_t
                                           struct st20_rfc4175_444_12_pg2_be* pg,
                                           uint32_t w, uint32_t h,
                                           enum mtl_simd_level level) {
-  MTL_MAY_UNUSED(level);
-  /* the only option */
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(ret);
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    ret = st20_444p12le_to_rfc4175_444be12_avx512(y_g, b_r, r_b, pg, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx512 ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_444p12le_to_rfc4175_444be12_avx2(y_g, b_r, r_b, pg, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
   return st20_444p12le_to_rfc4175_444be12_scalar(y_g, b_r, r_b, pg, w, h);
 }
 
@@ -2683,11 +3650,171 @@ int st20_rfc4175_444be12_to_444p12le_simd(struct st20_rfc4175_444_12_pg2_be* pg,
                                           uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
                                           uint32_t w, uint32_t h,
                                           enum mtl_simd_level level) {
-  MTL_MAY_UNUSED(level);
-  /* the only option */
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(ret);
+
+#ifdef MTL_HAS_AVX512_VBMI2
+  if ((level >= MTL_SIMD_LEVEL_AVX512_VBMI2) &&
+      (cpu_level >= MTL_SIMD_LEVEL_AVX512_VBMI2)) {
+    dbg("%s, avx512_vbmi ways\n", __func__);
+    ret = st20_rfc4175_444be12_to_444p12le_avx512_vbmi(pg, y_g, b_r, r_b, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx512_vbmi ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    ret = st20_rfc4175_444be12_to_444p12le_avx512(pg, y_g, b_r, r_b, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx512 ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_444be12_to_444p12le_avx2(pg, y_g, b_r, r_b, w, h);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
   return st20_rfc4175_444be12_to_444p12le_scalar(pg, y_g, b_r, r_b, w, h);
 }
 
+/* the 444 be to planar kernel of one simd level, h is always 1 for dma */
+typedef int (*st20_444be_to_444ple_fn)(void* pg, uint16_t* y_g, uint16_t* b_r,
+                                       uint16_t* r_b, uint32_t w, uint32_t h,
+                                       enum mtl_simd_level level);
+
+static int st20_444be10_to_444p10le_cvt(void* pg, uint16_t* y_g, uint16_t* b_r,
+                                        uint16_t* r_b, uint32_t w, uint32_t h,
+                                        enum mtl_simd_level level) {
+  return st20_rfc4175_444be10_to_444p10le_simd(pg, y_g, b_r, r_b, w, h, level);
+}
+
+static int st20_444be12_to_444p12le_cvt(void* pg, uint16_t* y_g, uint16_t* b_r,
+                                        uint16_t* r_b, uint32_t w, uint32_t h,
+                                        enum mtl_simd_level level) {
+  return st20_rfc4175_444be12_to_444p12le_simd(pg, y_g, b_r, r_b, w, h, level);
+}
+
+/*
+ * dma the be pg groups into the LLC caches ahead, and convert each cache with the simd
+ * dispatcher, so every simd level share the same dma pipeline.
+ */
+static int st20_444be_to_444ple_dma(struct mtl_dma_lender_dev* dma, uint8_t* pg_be,
+                                    mtl_iova_t pg_be_iova, size_t pg_size,
+                                    uint32_t pg_pixels, uint16_t* y_g, uint16_t* b_r,
+                                    uint16_t* r_b, uint32_t w, uint32_t h,
+                                    enum mtl_simd_level level,
+                                    st20_444be_to_444ple_fn cvt) {
+  int pg_cnt = w * h / pg_pixels;
+  int ret;
+
+  int caches_num = 4;
+  int cache_pg_cnt = (256 * 1024) / pg_size; /* pg cnt for each cache */
+  int align = caches_num * 32; /* align to simd pg groups and caches_num */
+  cache_pg_cnt = cache_pg_cnt / align * align;
+  size_t cache_size = cache_pg_cnt * pg_size;
+  uint32_t cache_pixels = cache_pg_cnt * pg_pixels;
+  int soc_id = dma->parent->soc_id;
+
+  uint8_t* be_caches = mt_rte_zmalloc_socket(cache_size * caches_num, soc_id);
+  struct mt_cvt_dma_ctx* ctx = mt_cvt_dma_ctx_init(2 * caches_num, soc_id, 2);
+  if (!be_caches || !ctx) {
+    err("%s, alloc cache(%d,%" PRIu64 ") fail, %p\n", __func__, cache_pg_cnt, cache_size,
+        be_caches);
+    if (be_caches) mt_rte_free(be_caches);
+    if (ctx) mt_cvt_dma_ctx_uinit(ctx);
+    return cvt(pg_be, y_g, b_r, r_b, w, h, level);
+  }
+  rte_iova_t be_caches_iova = rte_malloc_virt2iova(be_caches);
+
+  /* first with caches batch step */
+  int cache_batch = pg_cnt / cache_pg_cnt;
+  dbg("%s, pg_cnt %d cache_pg_cnt %d caches_num %d cache_batch %d\n", __func__, pg_cnt,
+      cache_pg_cnt, caches_num, cache_batch);
+  for (int i = 0; i < cache_batch; i++) {
+    uint8_t* be_cache = be_caches + (i % caches_num) * cache_size;
+    dbg("%s, cache batch idx %d\n", __func__, i);
+
+    int max_tran = i + caches_num;
+    max_tran = RTE_MIN(max_tran, cache_batch);
+    int cur_tran = mt_cvt_dma_ctx_get_tran(ctx, 0);
+    /* push max be dma */
+    while (cur_tran < max_tran) {
+      rte_iova_t be_cache_iova = be_caches_iova + (cur_tran % caches_num) * cache_size;
+      mt_dma_copy_busy(dma, be_cache_iova, pg_be_iova, cache_size);
+      pg_be += cache_size;
+      pg_be_iova += cache_size;
+      mt_cvt_dma_ctx_push(ctx, 0);
+      cur_tran = mt_cvt_dma_ctx_get_tran(ctx, 0);
+    }
+    mt_dma_submit_busy(dma);
+
+    /* wait until current be dma copy done */
+    while (mt_cvt_dma_ctx_get_done(ctx, 0) < (i + 1)) {
+      uint16_t nb_dq = mt_dma_completed(dma, 1, NULL, NULL);
+      if (nb_dq) mt_cvt_dma_ctx_pop(ctx);
+    }
+
+    ret = cvt(be_cache, y_g, b_r, r_b, cache_pixels, 1, level);
+    if (ret < 0) {
+      err("%s, cvt fail %d at cache batch %d\n", __func__, ret, i);
+      /* drain the in flight copies before the caches freed */
+      while (mt_cvt_dma_ctx_get_done(ctx, 0) < mt_cvt_dma_ctx_get_tran(ctx, 0)) {
+        uint16_t nb_dq = mt_dma_completed(dma, 1, NULL, NULL);
+        if (nb_dq) mt_cvt_dma_ctx_pop(ctx);
+      }
+      mt_cvt_dma_ctx_uinit(ctx);
+      mt_rte_free(be_caches);
+      return ret;
+    }
+    y_g += cache_pixels;
+    b_r += cache_pixels;
+    r_b += cache_pixels;
+  }
+
+  pg_cnt = pg_cnt % cache_pg_cnt;
+  mt_cvt_dma_ctx_uinit(ctx);
+  mt_rte_free(be_caches);
+
+  /* remaining pg groups */
+  if (!pg_cnt) return 0;
+  return cvt(pg_be, y_g, b_r, r_b, pg_cnt * pg_pixels, 1, level);
+}
+
+int st20_rfc4175_444be10_to_444p10le_simd_dma(mtl_udma_handle udma,
+                                              struct st20_rfc4175_444_10_pg4_be* pg_be,
+                                              mtl_iova_t pg_be_iova, uint16_t* y_g,
+                                              uint16_t* b_r, uint16_t* r_b, uint32_t w,
+                                              uint32_t h, enum mtl_simd_level level) {
+  struct mtl_dma_lender_dev* dma = udma;
+
+  return st20_444be_to_444ple_dma(dma, (uint8_t*)pg_be, pg_be_iova, sizeof(*pg_be), 4,
+                                  y_g, b_r, r_b, w, h, level,
+                                  st20_444be10_to_444p10le_cvt);
+}
+
+int st20_rfc4175_444be12_to_444p12le_simd_dma(mtl_udma_handle udma,
+                                              struct st20_rfc4175_444_12_pg2_be* pg_be,
+                                              mtl_iova_t pg_be_iova, uint16_t* y_g,
+                                              uint16_t* b_r, uint16_t* r_b, uint32_t w,
+                                              uint32_t h, enum mtl_simd_level level) {
+  struct mtl_dma_lender_dev* dma = udma;
+
+  return st20_444be_to_444ple_dma(dma, (uint8_t*)pg_be, pg_be_iova, sizeof(*pg_be), 2,
+                                  y_g, b_r, r_b, w, h, level,
+                                  st20_444be12_to_444p12le_cvt);
+}
+
 int st20_444p12le_to_rfc4175_444le12(uint16_t* y_g, uint16_t* b_r, uint16_t* r_b,
                                      struct st20_rfc4175_444_12_pg2_le* pg, uint32_t w,
                                      uint32_t h) {
@@ -2833,6 +3960,278 @@ int st20_rfc4175_444le12_to_444be12_simd(struct st20_rfc4175_444_12_pg2_le* pg_l
   return st20_rfc4175_444le12_to_444be12_scalar(pg_le, pg_be, w, h);
 }
 
+/*
+ * The coefficients of BT.709(Kr 0.2126, Kb 0.0722) and BT.2020(Kr 0.2627, Kb 0.0593),
+ * the 10bit yuv scale to 8bit rgb is 255/876 for Y and 255/896 for C in narrow range,
+ * 255/1023 for both in full range.
+ */
+static const struct st_color_coeffs
+    color_coeffs[ST20_COLOR_MATRIX_MAX][ST20_COLOR_RANGE_MAX] = {
+    {
+        /* BT709 narrow */
+        {64, 4769, 7343, -873, -2183, 8652, 2991, 10064, 1016, -1649, -5547, 7196, 7196,
+         -6536, -660},
+        /* BT709 full */
+        {0, 4084, 6431, -765, -1912, 7578, 3493, 11752, 1186, -1883, -6333, 8216, 8216,
+         -7463, -753},
+    },
+    {
+        /* BT2020 narrow */
+        {64, 4769, 6876, -767, -2664, 8773, 3696, 9540, 834, -2010, -5187, 7196, 7196,
+         -6617, -579},
+        /* BT2020 full */
+        {0, 4084, 6022, -672, -2333, 7684, 4317, 11141, 974, -2294, -5922, 8216, 8216,
+         -7555, -661},
+    },
+};
+
+static const struct st_color_coeffs* color_coeffs_get(enum st20_color_matrix matrix,
+                                                      enum st20_color_range range) {
+  if (matrix >= ST20_COLOR_MATRIX_MAX || range >= ST20_COLOR_RANGE_MAX) {
+    err("%s, invalid matrix %d or range %d\n", __func__, matrix, range);
+    return NULL;
+  }
+  return &color_coeffs[matrix][range];
+}
+
+/* the byte offset of each sample in one pixel, a is not used for rgb8 */
+struct rgb_pixel_layout {
+  uint8_t size;
+  uint8_t r;
+  uint8_t g;
+  uint8_t b;
+  uint8_t a;
+};
+
+static int rgb_pixel_layout_get(enum st_frame_fmt fmt, struct rgb_pixel_layout* layout) {
+  switch (fmt) {
+    case ST_FRAME_FMT_ARGB:
+      *layout = (struct rgb_pixel_layout){.size = 4, .r = 1, .g = 2, .b = 3, .a = 0};
+      return 0;
+    case ST_FRAME_FMT_BGRA:
+      *layout = (struct rgb_pixel_layout){.size = 4, .r = 2, .g = 1, .b = 0, .a = 3};
+      return 0;
+    case ST_FRAME_FMT_RGB8:
+      *layout = (struct rgb_pixel_layout){.size = 3, .r = 0, .g = 1, .b = 2};
+      return 0;
+    default:
+      err("%s, invalid fmt %s\n", __func__, st_frame_fmt_name(fmt));
+      return -EINVAL;
+  }
+}
+
+static inline uint8_t color_clip_8(int32_t v) {
+  return RTE_MAX(RTE_MIN(v, 255), 0);
+}
+
+static inline uint16_t color_clip_10(int32_t v) {
+  return RTE_MAX(RTE_MIN(v, 1023), 0);
+}
+
+static int st20_rfc4175_422be10_to_rgb_scalar(struct st20_rfc4175_422_10_pg2_be* pg,
+                                              uint8_t* rgb, enum st_frame_fmt fmt,
+                                              uint32_t w, uint32_t h,
+                                              const struct st_color_coeffs* c) {
+  uint32_t cnt = w * h / 2; /* two pixels in one pg */
+  struct rgb_pixel_layout l;
+  int32_t y[2], cb, cr, r, g, b;
+
+  int ret = rgb_pixel_layout_get(fmt, &l);
+  if (ret < 0) return ret;
+
+  for (uint32_t pg2 = 0; pg2 < cnt; pg2++) {
+    cb = (pg->Cb00 << 2) + pg->Cb00_ - 512;
+    y[0] = (pg->Y00 << 4) + pg->Y00_ - c->y_offset;
+    cr = (pg->Cr00 << 6) + pg->Cr00_ - 512;
+    y[1] = (pg->Y01 << 8) + pg->Y01_ - c->y_offset;
+
+    r = c->cr_r * cr + (1 << 13);
+    g = c->cb_g * cb + c->cr_g * cr + (1 << 13);
+    b = c->cb_b * cb + (1 << 13);
+    for (int i = 0; i < 2; i++) {
+      int32_t ys = c->y * y[i];
+      rgb[l.r] = color_clip_8((ys + r) >> 14);
+      rgb[l.g] = color_clip_8((ys + g) >> 14);
+      rgb[l.b] = color_clip_8((ys + b) >> 14);
+      if (l.size == 4) rgb[l.a] = 0xff;
+      rgb += l.size;
+    }
+    pg++;
+  }
+
+  return 0;
+}
+
+int st20_rfc4175_422be10_to_rgb_simd(struct st20_rfc4175_422_10_pg2_be* pg, uint8_t* rgb,
+                                     enum st_frame_fmt fmt, uint32_t w, uint32_t h,
+                                     enum st20_color_matrix matrix,
+                                     enum st20_color_range range,
+                                     enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  const struct st_color_coeffs* coeffs = color_coeffs_get(matrix, range);
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(ret);
+
+  if (!coeffs) return -EINVAL;
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_rgb_avx512(pg, rgb, fmt, w, h, coeffs);
+    if (ret == 0) return 0;
+    dbg("%s, avx512 ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rfc4175_422be10_to_rgb_avx2(pg, rgb, fmt, w, h, coeffs);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
+  return st20_rfc4175_422be10_to_rgb_scalar(pg, rgb, fmt, w, h, coeffs);
+}
+
+int st20_rfc4175_422be10_to_argb_simd(struct st20_rfc4175_422_10_pg2_be* pg,
+                                      uint8_t* argb, uint32_t w, uint32_t h,
+                                      enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level) {
+  return st20_rfc4175_422be10_to_rgb_simd(pg, argb, ST_FRAME_FMT_ARGB, w, h, matrix,
+                                          range, level);
+}
+
+int st20_rfc4175_422be10_to_bgra_simd(struct st20_rfc4175_422_10_pg2_be* pg,
+                                      uint8_t* bgra, uint32_t w, uint32_t h,
+                                      enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level) {
+  return st20_rfc4175_422be10_to_rgb_simd(pg, bgra, ST_FRAME_FMT_BGRA, w, h, matrix,
+                                          range, level);
+}
+
+int st20_rfc4175_422be10_to_rgb8_simd(struct st20_rfc4175_422_10_pg2_be* pg,
+                                      uint8_t* rgb8, uint32_t w, uint32_t h,
+                                      enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level) {
+  return st20_rfc4175_422be10_to_rgb_simd(pg, rgb8, ST_FRAME_FMT_RGB8, w, h, matrix,
+                                          range, level);
+}
+
+static int st20_rgb_to_rfc4175_422be10_scalar(uint8_t* rgb, enum st_frame_fmt fmt,
+                                              struct st20_rfc4175_422_10_pg2_be* pg,
+                                              uint32_t w, uint32_t h,
+                                              const struct st_color_coeffs* c) {
+  uint32_t cnt = w * h / 2; /* two pixels in one pg */
+  int32_t y_base = (c->y_offset << 12) + (1 << 11);
+  int32_t c_base = (512 << 13) + (1 << 12);
+  struct rgb_pixel_layout l;
+  uint16_t y0, y1, cb, cr;
+
+  int ret = rgb_pixel_layout_get(fmt, &l);
+  if (ret < 0) return ret;
+
+  for (uint32_t pg2 = 0; pg2 < cnt; pg2++) {
+    uint8_t* p0 = rgb;
+    uint8_t* p1 = rgb + l.size;
+    /* the chroma from the sum of the two pixels */
+    int32_t r = p0[l.r] + p1[l.r];
+    int32_t g = p0[l.g] + p1[l.g];
+    int32_t b = p0[l.b] + p1[l.b];
+
+    y0 = color_clip_10(
+        (c->r_y * p0[l.r] + c->g_y * p0[l.g] + c->b_y * p0[l.b] + y_base) >> 12);
+    y1 = color_clip_10(
+        (c->r_y * p1[l.r] + c->g_y * p1[l.g] + c->b_y * p1[l.b] + y_base) >> 12);
+    cb = color_clip_10((c->r_cb * r + c->g_cb * g + c->b_cb * b + c_base) >> 13);
+    cr = color_clip_10((c->r_cr * r + c->g_cr * g + c->b_cr * b + c_base) >> 13);
+
+    pg->Cb00 = cb >> 2;
+    pg->Cb00_ = cb;
+    pg->Y00 = y0 >> 4;
+    pg->Y00_ = y0;
+    pg->Cr00 = cr >> 6;
+    pg->Cr00_ = cr;
+    pg->Y01 = y1 >> 8;
+    pg->Y01_ = y1;
+
+    rgb += l.size * 2;
+    pg++;
+  }
+
+  return 0;
+}
+
+int st20_rgb_to_rfc4175_422be10_simd(uint8_t* rgb, enum st_frame_fmt fmt,
+                                     struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                     uint32_t h, enum st20_color_matrix matrix,
+                                     enum st20_color_range range,
+                                     enum mtl_simd_level level) {
+  enum mtl_simd_level cpu_level = mtl_get_simd_level();
+  const struct st_color_coeffs* coeffs = color_coeffs_get(matrix, range);
+  int ret;
+
+  MTL_MAY_UNUSED(cpu_level);
+  MTL_MAY_UNUSED(ret);
+
+  if (!coeffs) return -EINVAL;
+
+#ifdef MTL_HAS_AVX512
+  if ((level >= MTL_SIMD_LEVEL_AVX512) && (cpu_level >= MTL_SIMD_LEVEL_AVX512)) {
+    dbg("%s, avx512 ways\n", __func__);
+    ret = st20_rgb_to_rfc4175_422be10_avx512(rgb, fmt, pg, w, h, coeffs);
+    if (ret == 0) return 0;
+    dbg("%s, avx512 ways failed\n", __func__);
+  }
+#endif
+
+#ifdef MTL_HAS_AVX2
+  if ((level >= MTL_SIMD_LEVEL_AVX2) && (cpu_level >= MTL_SIMD_LEVEL_AVX2)) {
+    dbg("%s, avx2 ways\n", __func__);
+    ret = st20_rgb_to_rfc4175_422be10_avx2(rgb, fmt, pg, w, h, coeffs);
+    if (ret == 0) return 0;
+    dbg("%s, avx2 ways failed\n", __func__);
+  }
+#endif
+
+  /* the last option */
+  return st20_rgb_to_rfc4175_422be10_scalar(rgb, fmt, pg, w, h, coeffs);
+}
+
+int st20_argb_to_rfc4175_422be10_simd(uint8_t* argb,
+                                      struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                      uint32_t h, enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level) {
+  return st20_rgb_to_rfc4175_422be10_simd(argb, ST_FRAME_FMT_ARGB, pg, w, h, matrix,
+                                          range, level);
+}
+
+int st20_bgra_to_rfc4175_422be10_simd(uint8_t* bgra,
+                                      struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                      uint32_t h, enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level) {
+  return st20_rgb_to_rfc4175_422be10_simd(bgra, ST_FRAME_FMT_BGRA, pg, w, h, matrix,
+                                          range, level);
+}
+
+int st20_rgb8_to_rfc4175_422be10_simd(uint8_t* rgb8,
+                                      struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                      uint32_t h, enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level) {
+  return st20_rgb_to_rfc4175_422be10_simd(rgb8, ST_FRAME_FMT_RGB8, pg, w, h, matrix,
+                                          range, level);
+}
+
 int st31_am824_to_aes3(struct st31_am824* sf_am824, struct st31_aes3* sf_aes3,
                        uint16_t subframes) {
   for (int i = 0; i < subframes; ++i) {
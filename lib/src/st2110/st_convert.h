@@ -8,13 +8,136 @@
 #include <st_convert_api.h>
 #include <st_pipeline_api.h>
 
+/* the integer coefficients of the yuv422 10bit and 8bit rgb convert */
+struct st_color_coeffs {
+  /* yuv to rgb in Q14, applied on Y - y_offset and C - 512 */
+  int16_t y_offset;
+  int16_t y;
+  int16_t cr_r;
+  int16_t cb_g;
+  int16_t cr_g;
+  int16_t cb_b;
+  /* rgb to yuv in Q12, the chroma of two pixels from the sum of the pair */
+  int16_t r_y;
+  int16_t g_y;
+  int16_t b_y;
+  int16_t r_cb;
+  int16_t g_cb;
+  int16_t b_cb;
+  int16_t r_cr;
+  int16_t g_cr;
+  int16_t b_cr;
+};
+
 struct st_frame_converter {
   enum st_frame_fmt src_fmt;
   enum st_frame_fmt dst_fmt;
-  int (*convert_func)(struct st_frame* src, struct st_frame* dst);
+  /* the table kernel, lines_padding to convert line by line */
+  int (*convert_kernel)(struct st_frame* src, struct st_frame* dst, bool lines_padding,
+                        enum mtl_simd_level level);
+  /* the table kernel of the yuv and rgb convert, used instead if set */
+  int (*convert_color_kernel)(struct st_frame* src, struct st_frame* dst,
+                              bool lines_padding, enum mtl_simd_level level,
+                              enum st20_color_matrix matrix,
+                              enum st20_color_range range);
+
+  /* resolved by st_frame_get_converter */
+  enum mtl_simd_level simd_level;
+  /* for convert_color_kernel, default BT709 narrow range */
+  enum st20_color_matrix color_matrix;
+  enum st20_color_range color_range;
+  /* the geometry bound by st_frame_converter_bind */
+  bool bound;
+  bool lines_padding;
+  uint32_t width;
+  size_t src_linesize[ST_MAX_PLANES];
+  size_t dst_linesize[ST_MAX_PLANES];
 };
 
+/* the yuv422 10bit and 8bit rgb convert, fmt is ARGB, BGRA or RGB8 */
+int st20_rfc4175_422be10_to_rgb_simd(struct st20_rfc4175_422_10_pg2_be* pg, uint8_t* rgb,
+                                     enum st_frame_fmt fmt, uint32_t w, uint32_t h,
+                                     enum st20_color_matrix matrix,
+                                     enum st20_color_range range,
+                                     enum mtl_simd_level level);
+int st20_rgb_to_rfc4175_422be10_simd(uint8_t* rgb, enum st_frame_fmt fmt,
+                                     struct st20_rfc4175_422_10_pg2_be* pg, uint32_t w,
+                                     uint32_t h, enum st20_color_matrix matrix,
+                                     enum st20_color_range range,
+                                     enum mtl_simd_level level);
+
+/* resolve the converter of the fmt pair with the best simd level of the cpu */
 int st_frame_get_converter(enum st_frame_fmt src_fmt, enum st_frame_fmt dst_fmt,
                            struct st_frame_converter* converter);
+/* bind the geometry, the lines padding check is skipped for frames of same geometry */
+int st_frame_converter_bind(struct st_frame_converter* converter, struct st_frame* src,
+                            struct st_frame* dst);
+int st_frame_converter_convert(struct st_frame_converter* converter,
+                               struct st_frame* src, struct st_frame* dst);
+
+/* the coeffs of the scale filter in Q14 */
+#define ST_SCALE_COEFF_BITS (14)
+
+/*
+ * The polyphase filter of one direction, each output is filtered from taps inputs from
+ * start. The coeffs are in [taps / 2][dst_size][2], the pair of two taps is one dword.
+ */
+struct st_scale_filter {
+  uint32_t src_size;
+  uint32_t dst_size;
+  uint32_t taps; /* always even, may be one more than src_size with edge replicated */
+  int32_t* start;
+  int16_t* coeffs;
+};
+
+/* scale line by line on the 16bit planar fmt, with the convert of both sides */
+struct st_frame_scaler {
+  enum st_frame_fmt src_fmt;
+  enum st_frame_fmt dst_fmt;
+  enum st_frame_fmt scale_fmt; /* the 16bit planar fmt the filters run on */
+  uint32_t src_width;
+  uint32_t src_height; /* the data height */
+  uint32_t dst_width;
+  uint32_t dst_height; /* the data height */
+  uint8_t planes;
+  enum mtl_simd_level simd_level;
+  int socket_id;
+
+  struct st_scale_filter filter_h[ST_MAX_PLANES];
+  struct st_scale_filter filter_v; /* all planes have the same lines */
+
+  /* src_fmt to scale_fmt of the input line, if src_fmt is not scale_fmt */
+  bool unpack;
+  struct st_frame_converter unpack_converter;
+  struct st_frame src_line;
+  /* scale_fmt to dst_fmt of the output line, if dst_fmt is not scale_fmt */
+  bool pack;
+  struct st_frame_converter pack_converter;
+  struct st_frame dst_line;
+  /* no direct pack, scale_fmt to src_fmt by the pack_converter, then to dst_fmt */
+  bool repack;
+  struct st_frame_converter repack_converter;
+  struct st_frame repack_line;
+
+  /* the horizontal scaled lines of each plane, in a ring of the vertical taps */
+  uint16_t* ring[ST_MAX_PLANES];
+  int32_t* ring_line;    /* the input line in each slot of the ring */
+  uint16_t** taps_lines; /* [planes][taps] of the vertical filter */
+  /* the input line padded with the edge sample, for the filter wider than the input */
+  uint16_t* edge_line;
+};
+
+struct st_frame_scaler* st_frame_scaler_create(enum st_frame_fmt src_fmt,
+                                               uint32_t src_width, uint32_t src_height,
+                                               enum st_frame_fmt dst_fmt,
+                                               uint32_t dst_width, uint32_t dst_height,
+                                               int socket_id);
+int st_frame_scaler_free(struct st_frame_scaler* scaler);
+/* for the yuv and rgb convert of the pack, default BT709 narrow range */
+int st_frame_scaler_set_color(struct st_frame_scaler* scaler,
+                              enum st20_color_matrix matrix, enum st20_color_range range);
+/* the size of src and dst should be same as the scaler, interlaced in data height */
+int st_frame_scaler_scale(struct st_frame_scaler* scaler, struct st_frame* src,
+                          struct st_frame* dst);
 
 #endif
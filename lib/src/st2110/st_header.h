@@ -37,6 +37,10 @@
 
 /* number of tmstamp it will tracked for out of order pkts */
 #define ST_VIDEO_RX_REC_NUM_OFO (2)
+/* max number of tmstamp tracked if user set ofo_slots */
+#define ST_VIDEO_RX_REC_NUM_OFO_MAX (ST20_RX_OFO_SLOTS_MAX)
+/* size of the tmstamp to slot index table, power of 2 */
+#define ST_VIDEO_RX_SLOT_HASH_SIZE (16)
 /* number of slices it will tracked as out of order pkts */
 #define ST_VIDEO_RX_SLICE_NUM (32)
 /* sync to atomic if reach this threshold */
@@ -379,6 +383,7 @@ struct st_tx_video_session_impl {
   int stat_pkts_burst;
   int stat_pkts_burst_dummy;
   int stat_pkts_chain_realloc_fail;
+  uint32_t stat_uframe_pg_fail;
   int stat_trs_ret_code[MTL_SESSION_PORT_MAX];
   int stat_build_ret_code;
   uint64_t stat_last_time;
@@ -418,6 +423,10 @@ struct st_tx_video_sessions_mgr {
   struct st_tx_video_session_impl* sessions[ST_SCH_MAX_TX_VIDEO_SESSIONS];
   /* protect session, spin(fast) lock as it call from tasklet aslo */
   rte_spinlock_t mutex[ST_SCH_MAX_TX_VIDEO_SESSIONS];
+  /* set by the lock owner, tasklet lockless reader skip the busy session */
+  rte_atomic32_t writer_busy[ST_SCH_MAX_TX_VIDEO_SESSIONS];
+  /* odd when tasklet is walking the sessions with lockless get */
+  rte_atomic32_t reader_epoch;
 };
 
 struct st_video_transmitter_impl {
@@ -462,6 +471,10 @@ struct st_rx_video_slot_impl {
   /* timestamp(ST10_TIMESTAMP_FMT_TAI, PTP) value for the first pkt */
   uint64_t timestamp_first_pkt;
   int last_pkt_idx;
+  /* pkts hit this slot when it's not the newest one */
+  uint32_t stat_pkts_late;
+  /* pkts hit this slot when it's the newest but the older slot still in progress */
+  uint32_t stat_pkts_early;
 };
 
 enum st20_detect_status {
@@ -559,7 +572,7 @@ struct st_rx_video_tp {
   struct st20_rx_tp_pass pass;
 
   /* timing info for each slot */
-  struct st_rv_tp_slot slots[ST_VIDEO_RX_REC_NUM_OFO][MTL_SESSION_PORT_MAX];
+  struct st_rv_tp_slot slots[ST_VIDEO_RX_REC_NUM_OFO_MAX][MTL_SESSION_PORT_MAX];
   uint32_t pre_rtp_tmstamp[MTL_SESSION_PORT_MAX];
 
   /* for the status */
@@ -627,10 +640,13 @@ struct st_rx_video_session_impl {
   /* rtp info */
   struct rte_ring* rtps_ring;
 
-  /* record two frames in case pkts out of order within marker */
-  struct st_rx_video_slot_impl slots[ST_VIDEO_RX_REC_NUM_OFO];
+  /* record multiple frames in case pkts out of order within marker */
+  struct st_rx_video_slot_impl slots[ST_VIDEO_RX_REC_NUM_OFO_MAX];
   int slot_idx;
   int slot_max;
+  int slot_cnt; /* the number of slots initialized */
+  /* tmstamp to slot index, -1 means empty */
+  int8_t slot_hash[ST_VIDEO_RX_SLOT_HASH_SIZE];
 
   /* slice info */
   uint32_t slice_lines;
@@ -670,6 +686,10 @@ struct st_rx_video_session_impl {
 
   int (*pkt_handler)(struct st_rx_video_session_impl* s, struct rte_mbuf* mbuf,
                      enum mtl_session_port s_port, bool ctrl_thread);
+  /* optional burst level handler, NULL means dispatch to pkt_handler one by one */
+  int (*pkt_burst_handler)(struct st_rx_video_session_impl* s, struct rte_mbuf** mbufs,
+                           uint16_t nb, enum mtl_session_port s_port);
+  bool burst_stream_copy; /* non-temporal store for the burst handler copy */
 
   /* if enable the parser for the st2110-21 timing */
   bool enable_timing_parser;
@@ -727,6 +747,9 @@ struct st_rx_video_session_impl {
   int stat_burst_succ_cnt;
   uint16_t stat_burst_pkts_max;
   uint64_t stat_burst_pkts_sum;
+  /* cycles spent on the pkt handler */
+  uint64_t stat_handle_pkts;
+  uint64_t stat_handle_cycles;
 };
 
 struct st_rx_video_sessions_mgr {
@@ -739,6 +762,10 @@ struct st_rx_video_sessions_mgr {
   struct st_rx_video_session_impl* sessions[ST_SCH_MAX_RX_VIDEO_SESSIONS];
   /* protect session, spin(fast) lock as it call from tasklet aslo */
   rte_spinlock_t mutex[ST_SCH_MAX_RX_VIDEO_SESSIONS];
+  /* set by the lock owner, tasklet lockless reader skip the busy session */
+  rte_atomic32_t writer_busy[ST_SCH_MAX_RX_VIDEO_SESSIONS];
+  /* odd when tasklet is walking the sessions with lockless get */
+  rte_atomic32_t reader_epoch;
 };
 
 struct st_tx_audio_session_pacing {
@@ -903,6 +930,10 @@ struct st_tx_audio_sessions_mgr {
   struct st_tx_audio_session_impl* sessions[ST_SCH_MAX_TX_AUDIO_SESSIONS];
   /* protect session, spin(fast) lock as it call from tasklet aslo */
   rte_spinlock_t mutex[ST_SCH_MAX_TX_AUDIO_SESSIONS]; /* protect session */
+  /* set by the lock owner, tasklet lockless reader skip the busy session */
+  rte_atomic32_t writer_busy[ST_SCH_MAX_TX_AUDIO_SESSIONS];
+  /* odd when tasklet is walking the sessions with lockless get */
+  rte_atomic32_t reader_epoch;
 
   rte_atomic32_t transmitter_started;
   rte_atomic32_t transmitter_clients;
@@ -1046,6 +1077,10 @@ struct st_rx_audio_sessions_mgr {
   struct st_rx_audio_session_impl* sessions[ST_SCH_MAX_RX_AUDIO_SESSIONS];
   /* protect session, spin(fast) lock as it call from tasklet aslo */
   rte_spinlock_t mutex[ST_SCH_MAX_RX_AUDIO_SESSIONS];
+  /* set by the lock owner, tasklet lockless reader skip the busy session */
+  rte_atomic32_t writer_busy[ST_SCH_MAX_RX_AUDIO_SESSIONS];
+  /* odd when tasklet is walking the sessions with lockless get */
+  rte_atomic32_t reader_epoch;
 };
 
 struct st_tx_ancillary_session_pacing {
@@ -1146,6 +1181,10 @@ struct st_tx_ancillary_sessions_mgr {
   struct st_tx_ancillary_session_impl* sessions[ST_MAX_TX_ANC_SESSIONS];
   /* protect session, spin(fast) lock as it call from tasklet aslo */
   rte_spinlock_t mutex[ST_MAX_TX_ANC_SESSIONS];
+  /* set by the lock owner, tasklet lockless reader skip the busy session */
+  rte_atomic32_t writer_busy[ST_MAX_TX_ANC_SESSIONS];
+  /* odd when tasklet is walking the sessions with lockless get */
+  rte_atomic32_t reader_epoch;
 
   rte_atomic32_t transmitter_started;
   rte_atomic32_t transmitter_clients;
@@ -1206,6 +1245,10 @@ struct st_rx_ancillary_sessions_mgr {
   struct st_rx_ancillary_session_impl* sessions[ST_MAX_RX_ANC_SESSIONS];
   /* protect session, spin(fast) lock as it call from tasklet aslo */
   rte_spinlock_t mutex[ST_MAX_RX_ANC_SESSIONS];
+  /* set by the lock owner, tasklet lockless reader skip the busy session */
+  rte_atomic32_t writer_busy[ST_MAX_RX_ANC_SESSIONS];
+  /* odd when tasklet is walking the sessions with lockless get */
+  rte_atomic32_t reader_epoch;
 };
 
 struct st_ancillary_transmitter_impl {
@@ -1315,6 +1358,10 @@ struct st_tx_fastmetadata_sessions_mgr {
   struct st_tx_fastmetadata_session_impl* sessions[ST_MAX_TX_FMD_SESSIONS];
   /* protect session, spin(fast) lock as it call from tasklet aslo */
   rte_spinlock_t mutex[ST_MAX_TX_FMD_SESSIONS];
+  /* set by the lock owner, tasklet lockless reader skip the busy session */
+  rte_atomic32_t writer_busy[ST_MAX_TX_FMD_SESSIONS];
+  /* odd when tasklet is walking the sessions with lockless get */
+  rte_atomic32_t reader_epoch;
 
   rte_atomic32_t transmitter_started;
   rte_atomic32_t transmitter_clients;
@@ -1375,6 +1422,10 @@ struct st_rx_fastmetadata_sessions_mgr {
   struct st_rx_fastmetadata_session_impl* sessions[ST_MAX_RX_FMD_SESSIONS];
   /* protect session, spin(fast) lock as it call from tasklet aslo */
   rte_spinlock_t mutex[ST_MAX_RX_FMD_SESSIONS];
+  /* set by the lock owner, tasklet lockless reader skip the busy session */
+  rte_atomic32_t writer_busy[ST_MAX_RX_FMD_SESSIONS];
+  /* odd when tasklet is walking the sessions with lockless get */
+  rte_atomic32_t reader_epoch;
 };
 
 struct st_fastmetadata_transmitter_impl {
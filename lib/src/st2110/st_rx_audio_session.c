@@ -22,7 +22,15 @@ static inline struct st_rx_audio_session_impl* rx_audio_session_get(
     struct st_rx_audio_sessions_mgr* mgr, int idx) {
   rte_spinlock_lock(&mgr->mutex[idx]);
   struct st_rx_audio_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               0)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -31,7 +39,15 @@ static inline struct st_rx_audio_session_impl* rx_audio_session_get_timeout(
     struct st_rx_audio_sessions_mgr* mgr, int idx, int timeout_us) {
   if (!mt_spinlock_lock_timeout(mgr->parent, &mgr->mutex[idx], timeout_us)) return NULL;
   struct st_rx_audio_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               timeout_us)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -40,7 +56,14 @@ static inline struct st_rx_audio_session_impl* rx_audio_session_try_get(
     struct st_rx_audio_sessions_mgr* mgr, int idx) {
   if (!rte_spinlock_trylock(&mgr->mutex[idx])) return NULL;
   struct st_rx_audio_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_try_sync(&mgr->writer_busy[idx], &mgr->reader_epoch)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -58,9 +81,17 @@ static inline bool rx_audio_session_get_empty(struct st_rx_audio_sessions_mgr* m
 }
 
 static inline void rx_audio_session_put(struct st_rx_audio_sessions_mgr* mgr, int idx) {
+  rte_atomic32_set(&mgr->writer_busy[idx], 0);
   rte_spinlock_unlock(&mgr->mutex[idx]);
 }
 
+/* tasklet only, call between mt_sessions_reader_enter/exit and no put needed */
+static inline struct st_rx_audio_session_impl* rx_audio_session_lockless_get(
+    struct st_rx_audio_sessions_mgr* mgr, int idx) {
+  if (rte_atomic32_read(&mgr->writer_busy[idx])) return NULL;
+  return mgr->sessions[idx];
+}
+
 static struct st_frame_trans* rx_audio_session_get_frame(
     struct st_rx_audio_session_impl* s) {
   struct st_frame_trans* frame_info;
@@ -602,8 +633,9 @@ static int rx_audio_sessions_tasklet_handler(void* priv) {
   uint64_t tsc_s = 0;
   bool time_measure = mt_sessions_time_measure(impl);
 
+  mt_sessions_reader_enter(&mgr->reader_epoch);
   for (int sidx = 0; sidx < mgr->max_idx; sidx++) {
-    s = rx_audio_session_try_get(mgr, sidx);
+    s = rx_audio_session_lockless_get(mgr, sidx);
     if (!s) continue;
     if (time_measure) tsc_s = mt_get_tsc(impl);
 
@@ -613,8 +645,8 @@ static int rx_audio_sessions_tasklet_handler(void* priv) {
       uint64_t delta_ns = mt_get_tsc(impl) - tsc_s;
       mt_stat_u64_update(&s->stat_time, delta_ns);
     }
-    rx_audio_session_put(mgr, sidx);
   }
+  mt_sessions_reader_exit(&mgr->reader_epoch);
 
   return pending;
 }
@@ -1024,7 +1056,9 @@ static int rx_audio_sessions_mgr_init(struct mtl_main_impl* impl,
 
   for (int i = 0; i < ST_SCH_MAX_RX_AUDIO_SESSIONS; i++) {
     rte_spinlock_init(&mgr->mutex[i]);
+    rte_atomic32_set(&mgr->writer_busy[i], 0);
   }
+  rte_atomic32_set(&mgr->reader_epoch, 0);
 
   memset(&ops, 0x0, sizeof(ops));
   ops.priv = mgr;
@@ -1032,6 +1066,8 @@ static int rx_audio_sessions_mgr_init(struct mtl_main_impl* impl,
   ops.start = rx_audio_sessions_tasklet_start;
   ops.stop = rx_audio_sessions_tasklet_stop;
   ops.handler = rx_audio_sessions_tasklet_handler;
+  /* audio pkt rate is low, no need to poll on every loop */
+  ops.priority = MTL_TASKLET_PRIORITY_NORMAL;
 
   mgr->tasklet = mtl_sch_register_tasklet(sch, &ops);
   if (!mgr->tasklet) {
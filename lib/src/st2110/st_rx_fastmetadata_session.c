@@ -14,7 +14,15 @@ static inline struct st_rx_fastmetadata_session_impl* rx_fastmetadata_session_ge
     struct st_rx_fastmetadata_sessions_mgr* mgr, int idx) {
   rte_spinlock_lock(&mgr->mutex[idx]);
   struct st_rx_fastmetadata_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               0)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -23,7 +31,14 @@ static inline struct st_rx_fastmetadata_session_impl* rx_fastmetadata_session_tr
     struct st_rx_fastmetadata_sessions_mgr* mgr, int idx) {
   if (!rte_spinlock_trylock(&mgr->mutex[idx])) return NULL;
   struct st_rx_fastmetadata_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_try_sync(&mgr->writer_busy[idx], &mgr->reader_epoch)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -32,7 +47,15 @@ static inline struct st_rx_fastmetadata_session_impl* rx_fastmetadata_session_ge
     struct st_rx_fastmetadata_sessions_mgr* mgr, int idx, int timeout_us) {
   if (!mt_spinlock_lock_timeout(mgr->parent, &mgr->mutex[idx], timeout_us)) return NULL;
   struct st_rx_fastmetadata_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               timeout_us)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -51,9 +74,18 @@ static inline bool rx_fastmetadata_session_get_empty(
 
 static inline void rx_fastmetadata_session_put(
     struct st_rx_fastmetadata_sessions_mgr* mgr, int idx) {
+  rte_atomic32_set(&mgr->writer_busy[idx], 0);
   rte_spinlock_unlock(&mgr->mutex[idx]);
 }
 
+/* tasklet only, call between mt_sessions_reader_enter/exit and no put needed */
+static inline struct st_rx_fastmetadata_session_impl*
+rx_fastmetadata_session_lockless_get(struct st_rx_fastmetadata_sessions_mgr* mgr,
+                                     int idx) {
+  if (rte_atomic32_read(&mgr->writer_busy[idx])) return NULL;
+  return mgr->sessions[idx];
+}
+
 static inline uint16_t rx_fastmetadata_queue_id(struct st_rx_fastmetadata_session_impl* s,
                                                 enum mtl_session_port s_port) {
   return mt_rxq_queue_id(s->rxq[s_port]);
@@ -206,8 +238,9 @@ static int rx_fastmetadata_sessions_tasklet_handler(void* priv) {
   uint64_t tsc_s = 0;
   bool time_measure = mt_sessions_time_measure(impl);
 
+  mt_sessions_reader_enter(&mgr->reader_epoch);
   for (int sidx = 0; sidx < mgr->max_idx; sidx++) {
-    s = rx_fastmetadata_session_try_get(mgr, sidx);
+    s = rx_fastmetadata_session_lockless_get(mgr, sidx);
     if (!s) continue;
     if (time_measure) tsc_s = mt_get_tsc(impl);
 
@@ -217,8 +250,8 @@ static int rx_fastmetadata_sessions_tasklet_handler(void* priv) {
       uint64_t delta_ns = mt_get_tsc(impl) - tsc_s;
       mt_stat_u64_update(&s->stat_time, delta_ns);
     }
-    rx_fastmetadata_session_put(mgr, sidx);
   }
+  mt_sessions_reader_exit(&mgr->reader_epoch);
 
   return pending;
 }
@@ -571,7 +604,9 @@ static int rx_fastmetadata_sessions_mgr_init(
 
   for (int i = 0; i < ST_MAX_RX_FMD_SESSIONS; i++) {
     rte_spinlock_init(&mgr->mutex[i]);
+    rte_atomic32_set(&mgr->writer_busy[i], 0);
   }
+  rte_atomic32_set(&mgr->reader_epoch, 0);
 
   memset(&ops, 0x0, sizeof(ops));
   ops.priv = mgr;
@@ -579,6 +614,8 @@ static int rx_fastmetadata_sessions_mgr_init(
   ops.start = rx_fastmetadata_sessions_tasklet_start;
   ops.stop = rx_fastmetadata_sessions_tasklet_stop;
   ops.handler = rx_fastmetadata_sessions_tasklet_handler;
+  /* few pkts per frame for fast metadata */
+  ops.priority = MTL_TASKLET_PRIORITY_LOW;
 
   mgr->tasklet = mtl_sch_register_tasklet(sch, &ops);
   if (!mgr->tasklet) {
@@ -12,6 +12,7 @@
 #include "../mt_ptp.h"
 #include "../mt_rtcp.h"
 #include "../mt_stat.h"
+#include "st_avx2.h"
 #include "st_fmt.h"
 #include "st_rx_timing_parser.h"
 
@@ -617,7 +618,7 @@ static inline void rv_slot_pkt_lcore_add_frame_size(struct st_rx_video_slot_impl
 void rv_slot_dump(struct st_rx_video_session_impl* s) {
   struct st_rx_video_slot_impl* slot;
 
-  for (int i = 0; i < ST_VIDEO_RX_REC_NUM_OFO; i++) {
+  for (int i = 0; i < s->slot_cnt; i++) {
     slot = &s->slots[i];
     info("%s(%d), tmstamp %u recv_size %" PRIu64 " pkts_received %u\n", __func__, i,
          slot->tmstamp, rv_slot_get_frame_size(slot), slot->pkts_received);
@@ -634,7 +635,7 @@ static int rv_init(struct st_rx_video_sessions_mgr* mgr,
 static int rv_uinit_slot(struct st_rx_video_session_impl* s) {
   struct st_rx_video_slot_impl* slot;
 
-  for (int i = 0; i < ST_VIDEO_RX_REC_NUM_OFO; i++) {
+  for (int i = 0; i < ST_VIDEO_RX_REC_NUM_OFO_MAX; i++) {
     slot = &s->slots[i];
     if (slot->frame_bitmap) {
       mt_rte_free(slot->frame_bitmap);
@@ -662,9 +663,10 @@ static int rv_init_slot(struct st_rx_video_session_impl* s) {
   uint8_t* frame_bitmap;
   struct st_rx_video_slot_slice_info* slice_info;
   enum st20_type type = s->ops.type;
+  int slot_cnt = RTE_MAX(ST_VIDEO_RX_REC_NUM_OFO, s->ops.ofo_slots);
 
   /* init slot */
-  for (int i = 0; i < ST_VIDEO_RX_REC_NUM_OFO; i++) {
+  for (int i = 0; i < slot_cnt; i++) {
     slot = &s->slots[i];
 
     slot->idx = i;
@@ -673,6 +675,8 @@ static int rv_init_slot(struct st_rx_video_session_impl* s) {
     slot->pkts_received = 0;
     slot->tmstamp = 0;
     slot->seq_id_got = false;
+    slot->stat_pkts_late = 0;
+    slot->stat_pkts_early = 0;
     frame_bitmap = mt_rte_zmalloc_socket(bitmap_size, soc_id);
     if (!frame_bitmap) {
       err("%s(%d), bitmap malloc %" PRIu64 " fail\n", __func__, idx, bitmap_size);
@@ -689,8 +693,12 @@ static int rv_init_slot(struct st_rx_video_session_impl* s) {
       slot->slice_info = slice_info;
     }
   }
+  s->slot_cnt = slot_cnt;
   s->slot_idx = -1;
-  if (s->ops.flags & ST20_RX_FLAG_ENABLE_RTCP)
+  for (int i = 0; i < ST_VIDEO_RX_SLOT_HASH_SIZE; i++) s->slot_hash[i] = -1;
+  if (s->ops.ofo_slots)
+    s->slot_max = s->ops.ofo_slots; /* user defined window */
+  else if (s->ops.flags & ST20_RX_FLAG_ENABLE_RTCP)
     s->slot_max = 2; /* use 2 slots for rtcp */
   else
     s->slot_max = 1; /* default only one slot */
@@ -1081,21 +1089,65 @@ static void rv_slice_add(struct st_rx_video_session_impl* s,
   }
 }
 
-static struct st_rx_video_slot_impl* rv_slot_by_tmstamp(
-    struct st_rx_video_session_impl* s, uint32_t tmstamp, void* hdr_split_pd,
-    bool* exist_ts) {
-  int i, slot_idx;
+static inline int rv_slot_hash(uint32_t tmstamp) {
+  /* fibonacci hashing, consecutive tmstamp spread well over the table */
+  return ((tmstamp * 2654435761u) >> 16) & (ST_VIDEO_RX_SLOT_HASH_SIZE - 1);
+}
+
+static inline void rv_slot_account(struct st_rx_video_session_impl* s,
+                                   struct st_rx_video_slot_impl* slot) {
+  int prev_idx;
+
+  if (s->slot_max < 2) return;
+
+  if (slot->idx != s->slot_idx) {
+    slot->stat_pkts_late++;
+    return;
+  }
+  prev_idx = (s->slot_idx + s->slot_max - 1) % s->slot_max;
+  if (s->slots[prev_idx].frame) slot->stat_pkts_early++;
+}
+
+/* lookup only, no new slot and no stat */
+static struct st_rx_video_slot_impl* rv_slot_find(struct st_rx_video_session_impl* s,
+                                                  uint32_t tmstamp) {
+  int hash = rv_slot_hash(tmstamp);
+  int slot_idx;
   struct st_rx_video_slot_impl* slot;
 
-  for (i = 0; i < s->slot_max; i++) {
+  /* fast path, the index may be overwritten by another tmstamp with same hash */
+  slot_idx = s->slot_hash[hash];
+  if (slot_idx >= 0) {
+    slot = &s->slots[slot_idx];
+    if (tmstamp == slot->tmstamp) return slot;
+  }
+
+  for (int i = 0; i < s->slot_max; i++) {
     slot = &s->slots[i];
 
     if (tmstamp == slot->tmstamp) {
-      *exist_ts = true;
+      s->slot_hash[hash] = i;
       return slot;
     }
   }
 
+  return NULL;
+}
+
+static struct st_rx_video_slot_impl* rv_slot_by_tmstamp(
+    struct st_rx_video_session_impl* s, uint32_t tmstamp, void* hdr_split_pd,
+    bool* exist_ts) {
+  int slot_idx;
+  int hash = rv_slot_hash(tmstamp);
+  struct st_rx_video_slot_impl* slot;
+
+  slot = rv_slot_find(s, tmstamp);
+  if (slot) {
+    *exist_ts = true;
+    rv_slot_account(s, slot);
+    return slot;
+  }
+
   dbg("%s(%d): new tmstamp %u\n", __func__, s->idx, tmstamp);
   if (s->dma_dev && !mt_dma_empty(s->dma_dev)) {
     /* still in progress of previous frame, drop current pkt */
@@ -1125,6 +1177,7 @@ static struct st_rx_video_slot_impl* rv_slot_by_tmstamp(
   slot->pkts_recv_per_port[MTL_SESSION_PORT_P] = 0;
   slot->pkts_recv_per_port[MTL_SESSION_PORT_R] = 0;
   s->slot_idx = slot_idx;
+  s->slot_hash[hash] = slot_idx;
 
   if (s->enable_timing_parser) {
     for (int s_port = 0; s_port < s->ops.num_port; s_port++) {
@@ -1730,6 +1783,174 @@ static int rv_handle_frame_pkt(struct st_rx_video_session_impl* s, struct rte_mb
   return 0;
 }
 
+/* the parsed info of one pkt for the burst handler */
+struct rv_burst_pkt {
+  void* payload;
+  uint32_t tmstamp;
+  uint32_t seq_id;
+  uint32_t offset;
+  uint16_t length;
+  bool second_field;
+  bool fast; /* simple pkt which can be handled by the burst path */
+};
+
+static inline void rv_burst_parse(struct st_rx_video_session_impl* s,
+                                  struct rte_mbuf* mbuf, struct rv_burst_pkt* pkt) {
+  struct st20_rx_ops* ops = &s->ops;
+  size_t hdr_offset =
+      sizeof(struct st_rfc4175_video_hdr) - sizeof(struct st20_rfc4175_rtp_hdr);
+  struct st20_rfc4175_rtp_hdr* rtp =
+      rte_pktmbuf_mtod_offset(mbuf, struct st20_rfc4175_rtp_hdr*, hdr_offset);
+  uint16_t line1_number = ntohs(rtp->row_number);
+  uint16_t line1_offset = ntohs(rtp->row_offset);
+  uint16_t line1_length = ntohs(rtp->row_length);
+
+  pkt->fast = false;
+  /* leave all the special cases to rv_handle_frame_pkt */
+  if (line1_offset & ST20_SRD_OFFSET_CONTINUATION) return;
+  if (line1_length & (ST20_RETRANSMIT | ST20_LEN_USER_META)) return;
+  if (mbuf->next && mbuf->next->data_len) return;
+  if (ops->payload_type && (rtp->base.payload_type != ops->payload_type)) return;
+  if (ops->ssrc && (ntohl(rtp->base.ssrc) != ops->ssrc)) return;
+  pkt->second_field = (line1_number & ST20_SECOND_FIELD) ? true : false;
+  if (pkt->second_field) {
+    if (!ops->interlaced) return;
+    line1_number &= ~ST20_SECOND_FIELD;
+  }
+  if ((mbuf->pkt_len - sizeof(struct st_rfc4175_video_hdr)) != line1_length) return;
+
+  pkt->offset = line1_number * (uint32_t)s->st20_linesize +
+                line1_offset / s->st20_pg.coverage * s->st20_pg.size;
+  if ((pkt->offset + line1_length) >
+      s->st20_fb_size + s->st20_bytes_in_line - s->st20_linesize)
+    return;
+
+  pkt->payload = &rtp[1];
+  pkt->length = line1_length;
+  pkt->tmstamp = ntohl(rtp->base.tmstamp);
+  pkt->seq_id = rfc4175_rtp_seq_id(rtp);
+  pkt->fast = true;
+}
+
+static inline void rv_burst_copy(struct st_rx_video_session_impl* s, void* dst,
+                                 const void* src, size_t n) {
+#ifdef MTL_HAS_AVX2
+  if (s->burst_stream_copy && (n >= ST_RX_VIDEO_STREAM_MIN_SIZE)) {
+    st_memcpy_stream_avx2(dst, src, n);
+    return;
+  }
+#endif
+  rv_frame_memcpy(dst, src, n);
+}
+
+/*
+ * Burst version of rv_handle_frame_pkt, parse all headers first and then scatter the
+ * payloads to the frame. Only used from the ctrl thread without dma/uframe/timing parser,
+ * any pkt not on the fast path is handled by rv_handle_frame_pkt in the same order.
+ */
+static int rv_handle_frame_pkts_burst(struct st_rx_video_session_impl* s,
+                                      struct rte_mbuf** mbufs, uint16_t nb,
+                                      enum mtl_session_port s_port) {
+  struct rv_burst_pkt pkts[nb];
+  struct st_rx_video_slot_impl* slot = NULL;
+  uint32_t slot_tmstamp = 0;
+  int pkt_idx, ret, err_cnt = 0;
+  bool stream_pending = false;
+
+  /* pass 1: parse the headers */
+  for (uint16_t i = 0; i < nb; i++) {
+    if (i + 1 < nb) rte_prefetch0(rte_pktmbuf_mtod(mbufs[i + 1], void*));
+    rv_burst_parse(s, mbufs[i], &pkts[i]);
+  }
+
+  /* pass 2: bitmap and copy */
+  for (uint16_t i = 0; i < nb; i++) {
+    struct rv_burst_pkt* pkt = &pkts[i];
+    struct rte_mbuf* mbuf = mbufs[i];
+
+    ret = -EIO;
+    if (!pkt->fast) goto slow_path;
+
+    if (!slot || !slot->frame || (pkt->tmstamp != slot_tmstamp)) {
+      /*
+       * lookup only, a new slot may drop and notify the oldest frame, leave that to
+       * rv_handle_frame_pkt after the fence of the slow path, which also does the stat.
+       */
+      slot = rv_slot_find(s, pkt->tmstamp);
+      if (!slot || !slot->frame || !slot->seq_id_got) {
+        /* no slot or the first pkt of frame */
+        slot = NULL;
+        goto slow_path;
+      }
+      slot_tmstamp = pkt->tmstamp;
+    }
+    rv_slot_account(s, slot);
+
+    if (pkt->seq_id >= slot->seq_id_base_u32)
+      pkt_idx = pkt->seq_id - slot->seq_id_base_u32;
+    else
+      pkt_idx = pkt->seq_id + (0xFFFFFFFF - slot->seq_id_base_u32) + 1;
+    if ((pkt_idx < 0) || (pkt_idx >= (s->st20_frame_bitmap_size * 8))) {
+      s->stat_pkts_idx_oo_bitmap++;
+      goto done;
+    }
+    if (mt_bitmap_test_and_set(slot->frame_bitmap, pkt_idx)) {
+      s->stat_pkts_redundant_dropped++;
+      slot->pkts_recv_per_port[s_port]++;
+      ret = 0;
+      goto done;
+    }
+    if (pkt_idx != (slot->last_pkt_idx + 1)) s->stat_pkts_out_of_order++;
+    slot->last_pkt_idx = pkt_idx;
+    slot->second_field = pkt->second_field;
+
+    /* prefetch the dst of next pkt while copying the current one */
+    if ((i + 1 < nb) && pkts[i + 1].fast && !s->burst_stream_copy)
+      rte_prefetch0(slot->frame->addr + pkts[i + 1].offset);
+    rv_burst_copy(s, slot->frame->addr + pkt->offset, pkt->payload, pkt->length);
+    if (s->burst_stream_copy) stream_pending = true;
+
+    rv_slot_pkt_lcore_add_frame_size(slot, pkt->length);
+    s->stat_pkts_received++;
+    slot->pkts_received++;
+    slot->pkts_recv_per_port[s_port]++;
+    if (slot->slice_info) rv_slice_add(s, slot, pkt->offset, pkt->length);
+
+    if (rv_slot_get_frame_size(slot) >= s->st20_frame_size) {
+      /* all stream stores should be visible before the frame pass to app */
+      if (stream_pending) {
+        rte_wmb();
+        stream_pending = false;
+      }
+      rv_slot_full_frame(s, slot);
+      slot = NULL;
+    }
+    ret = 0;
+    goto done;
+
+  slow_path:
+    if (stream_pending) {
+      rte_wmb();
+      stream_pending = false;
+    }
+    ret = rv_handle_frame_pkt(s, mbuf, s_port, true);
+    slot = NULL; /* slots may changed, lookup again */
+
+  done:
+    if (ret < 0) {
+      err_cnt++;
+      s->port_user_stats[s_port].err_packets++;
+    } else {
+      s->stat_bytes_received += mbuf->pkt_len;
+      s->port_user_stats[s_port].packets++;
+      s->port_user_stats[s_port].bytes += mbuf->pkt_len;
+    }
+  }
+
+  if (stream_pending) rte_wmb();
+  return err_cnt ? -EIO : 0;
+}
+
 static int rv_handle_rtp_pkt(struct st_rx_video_session_impl* s, struct rte_mbuf* mbuf,
                              enum mtl_session_port s_port, bool ctrl_thread) {
   MTL_MAY_UNUSED(s_port);
@@ -2475,7 +2696,7 @@ static int rv_init_sw(struct mtl_main_impl* impl, struct st_rx_video_sessions_mg
       return ret;
     }
     /* enable multi slot as it has two threads running */
-    s->slot_max = ST_VIDEO_RX_REC_NUM_OFO;
+    s->slot_max = RTE_MAX(s->slot_max, ST_VIDEO_RX_REC_NUM_OFO);
   }
 
   if (s->enable_timing_parser) {
@@ -2709,6 +2930,16 @@ static int rv_handle_mbuf(void* priv, struct rte_mbuf** mbuf, uint16_t nb) {
   }
   if (!nb) return 0;
 
+  uint64_t tsc_start = rte_get_tsc_cycles();
+  s->stat_handle_pkts += nb;
+
+  if (s->pkt_burst_handler && ctl_thread && !s->rtcp_rx[s_port] &&
+      !(s->ops.flags & ST20_RX_FLAG_SIMULATE_PKT_LOSS)) {
+    ret = s->pkt_burst_handler(s, mbuf, nb, s_port);
+    s->stat_handle_cycles += rte_get_tsc_cycles() - tsc_start;
+    return ret;
+  }
+
   /* now dispatch the pkts to handler */
   for (uint16_t i = 0; i < nb; i++) {
     if ((s->ops.flags & ST20_RX_FLAG_SIMULATE_PKT_LOSS) && rv_simulate_pkt_loss(s))
@@ -2728,6 +2959,7 @@ static int rv_handle_mbuf(void* priv, struct rte_mbuf** mbuf, uint16_t nb) {
       s->port_user_stats[s_port].bytes += mbuf[i]->pkt_len;
     }
   }
+  s->stat_handle_cycles += rte_get_tsc_cycles() - tsc_start;
   return ret;
 }
 
@@ -3009,6 +3241,26 @@ static int rv_init_pkt_handler(struct st_rx_video_session_impl* s) {
     s->pkt_handler = rv_handle_rtp_pkt;
   }
 
+  /* the burst handler only for the plain cpu copy frame mode */
+  s->pkt_burst_handler = NULL;
+  s->burst_stream_copy = false;
+  if ((s->pkt_handler == rv_handle_frame_pkt) && !s->dma_dev && !s->st20_uframe_size &&
+      !s->enable_timing_parser) {
+    s->pkt_burst_handler = rv_handle_frame_pkts_burst;
+#ifdef MTL_HAS_AVX2
+    /*
+     * bypass the cache for the big payload as the frame is not read back by lcore. Not
+     * for slice level, the app reads the ready lines from the slice callback before any
+     * fence. The pkt convert path is uframe and never reach here.
+     */
+    if ((mtl_get_simd_level() >= MTL_SIMD_LEVEL_AVX2) &&
+        (s->ops.type != ST20_TYPE_SLICE_LEVEL) && !rv_framebuffer_in_gpu_direct_vram(s))
+      s->burst_stream_copy = true;
+#endif
+    dbg("%s(%d), burst handler enabled, stream copy %s\n", __func__, s->idx,
+        s->burst_stream_copy ? "on" : "off");
+  }
+
   return 0;
 }
 
@@ -3248,8 +3500,9 @@ static int rvs_pkt_rx_tasklet_handler(void* priv) {
   uint64_t tsc_s = 0;
   bool time_measure = mt_sessions_time_measure(impl);
 
+  mt_sessions_reader_enter(&mgr->reader_epoch);
   for (sidx = 0; sidx < mgr->max_idx; sidx++) {
-    s = rx_video_session_try_get(mgr, sidx);
+    s = rx_video_session_lockless_get(mgr, sidx);
     if (!s) continue;
     if (time_measure) tsc_s = mt_get_tsc(impl);
 
@@ -3263,9 +3516,8 @@ static int rvs_pkt_rx_tasklet_handler(void* priv) {
       uint64_t delta_ns = mt_get_tsc(impl) - tsc_s;
       mt_stat_u64_update(&s->stat_time, delta_ns);
     }
-
-    rx_video_session_put(mgr, sidx);
   }
+  mt_sessions_reader_exit(&mgr->reader_epoch);
 
   return pending;
 }
@@ -3380,6 +3632,14 @@ static void rv_stat(struct st_rx_video_sessions_mgr* mgr,
            s->stat_pkts_no_slot);
     s->stat_pkts_no_slot = 0;
   }
+  for (int i = 0; i < s->slot_cnt; i++) {
+    struct st_rx_video_slot_impl* slot = &s->slots[i];
+    if (!slot->stat_pkts_late && !slot->stat_pkts_early) continue;
+    notice("RX_VIDEO_SESSION(%d,%d): slot %d late pkts %u early pkts %u\n", m_idx, idx, i,
+           slot->stat_pkts_late, slot->stat_pkts_early);
+    slot->stat_pkts_late = 0;
+    slot->stat_pkts_early = 0;
+  }
   if (s->stat_pkts_out_of_order) {
     notice("RX_VIDEO_SESSION(%d,%d): out of order pkts %d\n", m_idx, idx,
            s->stat_pkts_out_of_order);
@@ -3497,6 +3757,13 @@ static void rv_stat(struct st_rx_video_sessions_mgr* mgr,
            s->stat_st22_boxes);
     s->stat_st22_boxes = 0;
   }
+  if (s->stat_handle_cycles) {
+    notice("RX_VIDEO_SESSION(%d,%d): %s handler pkts per kcycle %f\n", m_idx, idx,
+           s->pkt_burst_handler ? "burst" : "pkt",
+           (double)s->stat_handle_pkts * 1000 / s->stat_handle_cycles);
+    s->stat_handle_pkts = 0;
+    s->stat_handle_cycles = 0;
+  }
   if (s->stat_burst_succ_cnt) {
     notice("RX_VIDEO_SESSION(%d,%d): succ burst max %u, avg %f\n", m_idx, idx,
            s->stat_burst_pkts_max,
@@ -3639,7 +3906,9 @@ static int rvs_mgr_init(struct mtl_main_impl* impl, struct mtl_sch_impl* sch,
 
   for (int i = 0; i < ST_SCH_MAX_RX_VIDEO_SESSIONS; i++) {
     rte_spinlock_init(&mgr->mutex[i]);
+    rte_atomic32_set(&mgr->writer_busy[i], 0);
   }
+  rte_atomic32_set(&mgr->reader_epoch, 0);
 
   memset(&ops, 0x0, sizeof(ops));
   ops.priv = mgr;
@@ -3824,6 +4093,24 @@ int st_rx_video_session_migrate(struct mtl_main_impl* impl,
   return 0;
 }
 
+static int rv_ofo_slots_check(uint16_t ofo_slots, uint16_t framebuff_cnt,
+                              bool frame_type) {
+  if (!ofo_slots) return 0; /* default window */
+
+  if ((ofo_slots < 2) || (ofo_slots > ST20_RX_OFO_SLOTS_MAX)) {
+    err("%s, invalid ofo_slots %u, should in range [2:%d]\n", __func__, ofo_slots,
+        ST20_RX_OFO_SLOTS_MAX);
+    return -EINVAL;
+  }
+  if (frame_type && (framebuff_cnt <= ofo_slots)) {
+    /* each slot hold one framebuffer, app may starve with a small framebuff_cnt */
+    warn("%s, framebuff_cnt %u not bigger than ofo_slots %u\n", __func__, framebuff_cnt,
+         ofo_slots);
+  }
+
+  return 0;
+}
+
 static int rv_ops_check(struct st20_rx_ops* ops) {
   int num_ports = ops->num_port, ret;
   uint8_t* ip;
@@ -3913,6 +4200,9 @@ static int rv_ops_check(struct st20_rx_ops* ops) {
     }
   }
 
+  ret = rv_ofo_slots_check(ops->ofo_slots, ops->framebuff_cnt, st20_is_frame_type(type));
+  if (ret < 0) return ret;
+
   /* Zero means disable the payload_type check */
   if (!st_is_valid_payload_type(ops->payload_type)) {
     err("%s, invalid payload_type %d\n", __func__, ops->payload_type);
@@ -3978,6 +4268,10 @@ static int rv_st22_ops_check(struct st22_rx_ops* ops) {
     }
   }
 
+  ret = rv_ofo_slots_check(ops->ofo_slots, ops->framebuff_cnt,
+                           ops->type == ST22_TYPE_FRAME_LEVEL);
+  if (ret < 0) return ret;
+
   /* Zero means disable the payload_type check */
   if (!st_is_valid_payload_type(ops->payload_type)) {
     err("%s, invalid payload_type %d\n", __func__, ops->payload_type);
@@ -4488,6 +4782,7 @@ st22_rx_handle st22_rx_create(mtl_handle mt, struct st22_rx_ops* ops) {
   st20_ops.notify_rtp_ready = ops->notify_rtp_ready;
   st20_ops.framebuff_cnt = ops->framebuff_cnt;
   st20_ops.notify_event = ops->notify_event;
+  st20_ops.ofo_slots = ops->ofo_slots;
   mt_pthread_mutex_lock(&sch->rx_video_mgr_mutex);
   s = rv_mgr_attach(sch, &st20_ops, ops);
   mt_pthread_mutex_unlock(&sch->rx_video_mgr_mutex);
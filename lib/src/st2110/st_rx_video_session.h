@@ -8,6 +8,8 @@
 #include "st_main.h"
 
 #define ST_RX_VIDEO_DMA_MIN_SIZE (1024)
+/* min payload size to use the non-temporal store in the burst handler */
+#define ST_RX_VIDEO_STREAM_MIN_SIZE (1024)
 
 #define ST_RV_TP_TSC_SYNC_MS (100) /* sync tsc with ptp period(ms) */
 #define ST_RV_TP_TSC_SYNC_NS (ST_RV_TP_TSC_SYNC_MS * 1000 * 1000)
@@ -23,7 +25,15 @@ static inline struct st_rx_video_session_impl* rx_video_session_get(
     struct st_rx_video_sessions_mgr* mgr, int idx) {
   rte_spinlock_lock(&mgr->mutex[idx]);
   struct st_rx_video_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               0)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -32,7 +42,15 @@ static inline struct st_rx_video_session_impl* rx_video_session_get_timeout(
     struct st_rx_video_sessions_mgr* mgr, int idx, int timeout_us) {
   if (!mt_spinlock_lock_timeout(mgr->parent, &mgr->mutex[idx], timeout_us)) return NULL;
   struct st_rx_video_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               timeout_us)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -41,7 +59,14 @@ static inline struct st_rx_video_session_impl* rx_video_session_try_get(
     struct st_rx_video_sessions_mgr* mgr, int idx) {
   if (!rte_spinlock_trylock(&mgr->mutex[idx])) return NULL;
   struct st_rx_video_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_try_sync(&mgr->writer_busy[idx], &mgr->reader_epoch)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -59,9 +84,17 @@ static inline bool rx_video_session_get_empty(struct st_rx_video_sessions_mgr* m
 }
 
 static inline void rx_video_session_put(struct st_rx_video_sessions_mgr* mgr, int idx) {
+  rte_atomic32_set(&mgr->writer_busy[idx], 0);
   rte_spinlock_unlock(&mgr->mutex[idx]);
 }
 
+/* tasklet only, call between mt_sessions_reader_enter/exit and no put needed */
+static inline struct st_rx_video_session_impl* rx_video_session_lockless_get(
+    struct st_rx_video_sessions_mgr* mgr, int idx) {
+  if (rte_atomic32_read(&mgr->writer_busy[idx])) return NULL;
+  return mgr->sessions[idx];
+}
+
 st20_rx_handle st20_rx_create_with_mask(struct mtl_main_impl* impl,
                                         struct st20_rx_ops* ops, mt_sch_mask_t sch_mask);
 
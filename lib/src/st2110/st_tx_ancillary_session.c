@@ -15,7 +15,15 @@ static inline struct st_tx_ancillary_session_impl* tx_ancillary_session_get(
     struct st_tx_ancillary_sessions_mgr* mgr, int idx) {
   rte_spinlock_lock(&mgr->mutex[idx]);
   struct st_tx_ancillary_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               0)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -24,7 +32,14 @@ static inline struct st_tx_ancillary_session_impl* tx_ancillary_session_try_get(
     struct st_tx_ancillary_sessions_mgr* mgr, int idx) {
   if (!rte_spinlock_trylock(&mgr->mutex[idx])) return NULL;
   struct st_tx_ancillary_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_try_sync(&mgr->writer_busy[idx], &mgr->reader_epoch)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -33,7 +48,15 @@ static inline struct st_tx_ancillary_session_impl* tx_ancillary_session_get_time
     struct st_tx_ancillary_sessions_mgr* mgr, int idx, int timeout_us) {
   if (!mt_spinlock_lock_timeout(mgr->parent, &mgr->mutex[idx], timeout_us)) return NULL;
   struct st_tx_ancillary_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               timeout_us)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -52,9 +75,17 @@ static inline bool tx_ancillary_session_get_empty(
 
 static inline void tx_ancillary_session_put(struct st_tx_ancillary_sessions_mgr* mgr,
                                             int idx) {
+  rte_atomic32_set(&mgr->writer_busy[idx], 0);
   rte_spinlock_unlock(&mgr->mutex[idx]);
 }
 
+/* tasklet only, call between mt_sessions_reader_enter/exit and no put needed */
+static inline struct st_tx_ancillary_session_impl* tx_ancillary_session_lockless_get(
+    struct st_tx_ancillary_sessions_mgr* mgr, int idx) {
+  if (rte_atomic32_read(&mgr->writer_busy[idx])) return NULL;
+  return mgr->sessions[idx];
+}
+
 static int tx_ancillary_session_free_frames(struct st_tx_ancillary_session_impl* s) {
   if (s->st40_frames) {
     struct st_frame_trans* frame;
@@ -1109,8 +1140,9 @@ static int tx_ancillary_sessions_tasklet_handler(void* priv) {
   uint64_t tsc_s = 0;
   bool time_measure = mt_sessions_time_measure(impl);
 
+  mt_sessions_reader_enter(&mgr->reader_epoch);
   for (int sidx = 0; sidx < mgr->max_idx; sidx++) {
-    s = tx_ancillary_session_try_get(mgr, sidx);
+    s = tx_ancillary_session_lockless_get(mgr, sidx);
     if (!s) continue;
     if (time_measure) tsc_s = mt_get_tsc(impl);
 
@@ -1124,8 +1156,8 @@ static int tx_ancillary_sessions_tasklet_handler(void* priv) {
       uint64_t delta_ns = mt_get_tsc(impl) - tsc_s;
       mt_stat_u64_update(&s->stat_time, delta_ns);
     }
-    tx_ancillary_session_put(mgr, sidx);
   }
+  mt_sessions_reader_exit(&mgr->reader_epoch);
 
   return pending;
 }
@@ -1752,7 +1784,9 @@ static int tx_ancillary_sessions_mgr_init(struct mtl_main_impl* impl,
 
   for (i = 0; i < ST_MAX_TX_ANC_SESSIONS; i++) {
     rte_spinlock_init(&mgr->mutex[i]);
+    rte_atomic32_set(&mgr->writer_busy[i], 0);
   }
+  rte_atomic32_set(&mgr->reader_epoch, 0);
 
   memset(&ops, 0x0, sizeof(ops));
   ops.priv = mgr;
@@ -15,7 +15,15 @@ static inline struct st_tx_audio_session_impl* tx_audio_session_get(
     struct st_tx_audio_sessions_mgr* mgr, int idx) {
   rte_spinlock_lock(&mgr->mutex[idx]);
   struct st_tx_audio_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               0)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -24,7 +32,15 @@ static inline struct st_tx_audio_session_impl* tx_audio_session_get_timeout(
     struct st_tx_audio_sessions_mgr* mgr, int idx, int timeout_us) {
   if (!mt_spinlock_lock_timeout(mgr->parent, &mgr->mutex[idx], timeout_us)) return NULL;
   struct st_tx_audio_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_sync(mgr->parent, &mgr->writer_busy[idx], &mgr->reader_epoch,
+                               timeout_us)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -33,7 +49,14 @@ static inline struct st_tx_audio_session_impl* tx_audio_session_try_get(
     struct st_tx_audio_sessions_mgr* mgr, int idx) {
   if (!rte_spinlock_trylock(&mgr->mutex[idx])) return NULL;
   struct st_tx_audio_session_impl* s = mgr->sessions[idx];
-  if (!s) rte_spinlock_unlock(&mgr->mutex[idx]);
+  if (!s) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
+  if (!mt_sessions_writer_try_sync(&mgr->writer_busy[idx], &mgr->reader_epoch)) {
+    rte_spinlock_unlock(&mgr->mutex[idx]);
+    return NULL;
+  }
   return s;
 }
 
@@ -51,9 +74,17 @@ static inline bool tx_audio_session_get_empty(struct st_tx_audio_sessions_mgr* m
 }
 
 static inline void tx_audio_session_put(struct st_tx_audio_sessions_mgr* mgr, int idx) {
+  rte_atomic32_set(&mgr->writer_busy[idx], 0);
   rte_spinlock_unlock(&mgr->mutex[idx]);
 }
 
+/* tasklet only, call between mt_sessions_reader_enter/exit and no put needed */
+static inline struct st_tx_audio_session_impl* tx_audio_session_lockless_get(
+    struct st_tx_audio_sessions_mgr* mgr, int idx) {
+  if (rte_atomic32_read(&mgr->writer_busy[idx])) return NULL;
+  return mgr->sessions[idx];
+}
+
 static int tx_audio_session_free_frames(struct st_tx_audio_session_impl* s) {
   if (s->st30_frames) {
     struct st_frame_trans* frame;
@@ -1531,10 +1562,11 @@ static int tx_audio_sessions_tasklet(void* priv) {
   uint64_t tsc_s = 0;
   bool time_measure = mt_sessions_time_measure(impl);
 
+  mt_sessions_reader_enter(&mgr->reader_epoch);
   for (int sidx = 0; sidx < mgr->max_idx; sidx++) {
-    s = tx_audio_session_try_get(mgr, sidx);
+    s = tx_audio_session_lockless_get(mgr, sidx);
     if (!s) continue;
-    if (!s->active) goto exit;
+    if (!s->active) continue;
     if (time_measure) tsc_s = mt_get_tsc(impl);
 
     s->stat_build_ret_code = 0;
@@ -1554,9 +1586,8 @@ static int tx_audio_sessions_tasklet(void* priv) {
       uint64_t delta_ns = mt_get_tsc(impl) - tsc_s;
       mt_stat_u64_update(&s->stat_time, delta_ns);
     }
-  exit:
-    tx_audio_session_put(mgr, sidx);
   }
+  mt_sessions_reader_exit(&mgr->reader_epoch);
 
   return pending;
 }
@@ -2388,7 +2419,9 @@ static int tx_audio_sessions_mgr_init(struct mtl_main_impl* impl,
 
   for (i = 0; i < ST_SCH_MAX_TX_AUDIO_SESSIONS; i++) {
     rte_spinlock_init(&mgr->mutex[i]);
+    rte_atomic32_set(&mgr->writer_busy[i], 0);
   }
+  rte_atomic32_set(&mgr->reader_epoch, 0);
 
   memset(&ops, 0x0, sizeof(ops));
   ops.priv = mgr;
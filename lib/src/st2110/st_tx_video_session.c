@@ -952,6 +952,28 @@ static int tv_build_st20_redundant(struct st_tx_video_session_impl* s,
   return 0;
 }
 
+static int tv_uframe_pg_fill(struct st_tx_video_session_impl* s,
+                             struct st_frame_trans* frame_info, void* payload,
+                             uint16_t row_number, uint16_t row_offset,
+                             uint16_t row_length) {
+  struct st20_tx_ops* ops = &s->ops;
+  struct st20_tx_uframe_pg_meta meta;
+  int ret;
+
+  meta.width = ops->width;
+  meta.height = ops->height;
+  meta.fmt = ops->fmt;
+  meta.second_field = frame_info->tv_meta.second_field;
+  meta.payload = payload;
+  meta.row_length = row_length;
+  meta.row_number = row_number;
+  meta.row_offset = row_offset;
+  meta.pg_cnt = row_length / s->st20_pg.size;
+  ret = ops->uframe_pg_callback(ops->priv, s->st20_frame_idx, &meta);
+  if (ret < 0) s->stat_uframe_pg_fail++; /* the pkt still go out to keep the pacing */
+  return ret;
+}
+
 static int tv_build_st20(struct st_tx_video_session_impl* s, struct rte_mbuf* pkt) {
   struct st_rfc4175_video_hdr* hdr;
   struct rte_ipv4_hdr* ipv4;
@@ -1031,7 +1053,17 @@ static int tv_build_st20(struct st_tx_video_session_impl* s, struct rte_mbuf* pk
     payload = &e_rtp[1];
   else
     payload = (void*)((uint8_t*)rtp + sizeof(*rtp));
-  if (e_rtp && s->st20_linesize > s->st20_bytes_in_line) {
+  if (ops->uframe_pg_callback) {
+    /* the pixel groups filled by user, no read from the framebuffer */
+    if (e_rtp) {
+      tv_uframe_pg_fill(s, frame_info, payload, line1_number, line1_offset,
+                        line1_length);
+      tv_uframe_pg_fill(s, frame_info, payload + line1_length, line1_number + 1, 0,
+                        line2_length);
+    } else {
+      tv_uframe_pg_fill(s, frame_info, payload, line1_number, line1_offset, left_len);
+    }
+  } else if (e_rtp && s->st20_linesize > s->st20_bytes_in_line) {
     /* cross lines with padding case */
     mtl_memcpy(payload, frame_info->addr + offset, line1_length);
     mtl_memcpy(payload + line1_length,
@@ -2449,10 +2481,11 @@ static int tvs_tasklet_handler(void* priv) {
   uint64_t tsc_s = 0;
   bool time_measure = mt_sessions_time_measure(impl);
 
+  mt_sessions_reader_enter(&mgr->reader_epoch);
   for (int sidx = 0; sidx < mgr->max_idx; sidx++) {
-    s = tx_video_session_try_get(mgr, sidx);
+    s = tx_video_session_lockless_get(mgr, sidx);
     if (!s) continue;
-    if (!s->active) goto exit;
+    if (!s->active) continue;
 
     if (time_measure) tsc_s = mt_get_tsc(impl);
 
@@ -2472,10 +2505,8 @@ static int tvs_tasklet_handler(void* priv) {
       uint64_t delta_ns = mt_get_tsc(impl) - tsc_s;
       mt_stat_u64_update(&s->stat_time, delta_ns);
     }
-
-  exit:
-    tx_video_session_put(mgr, sidx);
   }
+  mt_sessions_reader_exit(&mgr->reader_epoch);
 
   return pending;
 }
@@ -3162,6 +3193,8 @@ static int tv_attach(struct mtl_main_impl* impl, struct st_tx_video_sessions_mgr
     /* manually disable chain or any port can't support chain */
     s->tx_no_chain = mt_user_tx_no_chain(impl) || !tv_has_chain_buf(s) ||
                      !tv_pkts_capable_chain(impl, s);
+    /* the payload is filled by user, nothing to attach */
+    if (ops->uframe_pg_callback) s->tx_no_chain = true;
   }
   if (s->tx_no_chain) {
     info("%s(%d), no chain mbuf support\n", __func__, idx);
@@ -3373,6 +3406,11 @@ static void tv_stat(struct st_tx_video_sessions_mgr* mgr,
     notice("TX_VIDEO_SESSION(%d,%d): SERIOUS MEMORY ISSUE!\n", m_idx, idx);
     s->stat_pkts_chain_realloc_fail = 0;
   }
+  if (s->stat_uframe_pg_fail) {
+    notice("TX_VIDEO_SESSION(%d,%d): uframe pg callback fail cnt %u\n", m_idx, idx,
+           s->stat_uframe_pg_fail);
+    s->stat_uframe_pg_fail = 0;
+  }
   if (frame_cnt <= 0) {
     warn("TX_VIDEO_SESSION(%d,%d:%s): build ret %d, trs ret %d:%d\n", m_idx, idx,
          s->ops_name, s->stat_build_ret_code, s->stat_trs_ret_code[MTL_SESSION_PORT_P],
@@ -3571,7 +3609,9 @@ static int tv_mgr_init(struct mtl_main_impl* impl, struct mtl_sch_impl* sch,
 
   for (i = 0; i < ST_SCH_MAX_TX_VIDEO_SESSIONS; i++) {
     rte_spinlock_init(&mgr->mutex[i]);
+    rte_atomic32_set(&mgr->writer_busy[i], 0);
   }
+  rte_atomic32_set(&mgr->reader_epoch, 0);
 
   memset(&ops, 0x0, sizeof(ops));
   ops.priv = mgr;
@@ -3729,6 +3769,10 @@ static int tv_ops_check(struct st20_tx_ops* ops) {
         err("%s, pls set query_frame_lines_ready\n", __func__);
         return -EINVAL;
       }
+      if (ops->uframe_pg_callback) {
+        err("%s, uframe_pg_callback only for frame level\n", __func__);
+        return -EINVAL;
+      }
     }
   } else if (ops->type == ST20_TYPE_RTP_LEVEL) {
     if (ops->rtp_ring_size <= 0) {
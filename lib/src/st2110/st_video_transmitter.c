@@ -644,16 +644,17 @@ static int video_trs_tasklet_handler(void* priv) {
   int sidx, s_port;
   int pending = MTL_TASKLET_ALL_DONE;
 
+  mt_sessions_reader_enter(&mgr->reader_epoch);
   for (sidx = 0; sidx < mgr->max_idx; sidx++) {
-    s = tx_video_session_try_get(mgr, sidx);
+    s = tx_video_session_lockless_get(mgr, sidx);
     if (!s) continue;
 
     for (s_port = 0; s_port < s->ops.num_port; s_port++) {
       if (!s->queue[s_port]) continue;
       pending += s->pacing_tasklet_func[s_port](impl, s, s_port);
     }
-    tx_video_session_put(mgr, sidx);
   }
+  mt_sessions_reader_exit(&mgr->reader_epoch);
 
   return pending;
 }
@@ -4,6 +4,7 @@
 
 #include "udp_main.h"
 
+#include "../mt_arp.h"
 #include "../mt_log.h"
 #include "../mt_stat.h"
 #include "udp_rxq.h"
@@ -47,6 +48,52 @@ static inline bool udp_is_fallback(struct mudp_impl* s) {
     return false;
 }
 
+/* lazy on the first gso send as the pool is big, only try once */
+static int udp_init_gso_pool(struct mtl_main_impl* impl, struct mudp_impl* s) {
+  enum mtl_port port = s->port;
+  int idx = s->idx;
+  char pool_name[32];
+
+  s->gso_pool_tried = true;
+  if (!s->txq || !mt_if_has_multi_seg(impl, port)) return -ENOTSUP;
+
+  snprintf(pool_name, 32, "%sP%dQ%uS%d_GSO", MUDP_PREFIX, port, mt_txq_queue_id(s->txq),
+           idx);
+  /* no cache as the element is big */
+  s->gso_pool = mt_mempool_create(impl, port, pool_name, MUDP_GSO_POOL_NB, 0, 0,
+                                  MUDP_GSO_BUF_SIZE);
+  if (!s->gso_pool) { /* not fatal, use the copy mode */
+    warn("%s(%d), gso mempool create fail\n", __func__, idx);
+    return -ENOMEM;
+  }
+  /* no data room, the segs only attach to the big buf */
+  snprintf(pool_name, 32, "%sP%dQ%uS%d_GSEG", MUDP_PREFIX, port, mt_txq_queue_id(s->txq),
+           idx);
+  s->gso_seg_pool = mt_mempool_create(impl, port, pool_name,
+                                      MUDP_GSO_POOL_NB * MUDP_GSO_SEGS_MAX,
+                                      MT_MBUF_CACHE_SIZE, 0, 0);
+  if (!s->gso_seg_pool) {
+    warn("%s(%d), gso seg mempool create fail\n", __func__, idx);
+    mt_mempool_free(s->gso_pool);
+    s->gso_pool = NULL;
+    return -ENOMEM;
+  }
+  info("%s(%d), gso mempool %s created\n", __func__, idx, pool_name);
+  return 0;
+}
+
+/* if build the gso pkts with mbuf chain */
+static inline bool udp_gso_chain(struct mtl_main_impl* impl, struct mudp_impl* s,
+                                 unsigned int pkts_nb, size_t total_len) {
+  if ((pkts_nb <= 1) || (pkts_nb > MUDP_GSO_SEGS_MAX)) return false;
+  if (total_len > MUDP_GSO_BUF_SIZE) return false;
+  if (!s->gso_pool) {
+    if (s->gso_pool_tried) return false; /* copy mode */
+    if (udp_init_gso_pool(impl, s) < 0) return false;
+  }
+  return true;
+}
+
 int mudp_verify_socket_args(int domain, int type, int protocol) {
   if (domain != AF_INET) {
     dbg("%s, invalid domain %d\n", __func__, domain);
@@ -140,63 +187,132 @@ static int udp_verify_poll(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeou
   return 0;
 }
 
-static int udp_build_tx_pkt(struct mtl_main_impl* impl, struct mudp_impl* s,
-                            struct rte_mbuf* pkt, const void* buf, size_t len,
-                            const struct sockaddr_in* addr_in, int arp_timeout_ms) {
-  struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(pkt, struct mt_udp_hdr*);
-  struct rte_ether_hdr* eth = &hdr->eth;
-  struct rte_ipv4_hdr* ipv4 = &hdr->ipv4;
-  struct rte_udp_hdr* udp = &hdr->udp;
-  enum mtl_port port = s->port;
+static int udp_tx_dst_mac(struct mtl_main_impl* impl, struct mudp_impl* s, uint8_t* dip,
+                          struct rte_ether_addr* d_addr, int arp_timeout_ms) {
   int idx = s->idx;
   int ret;
 
-  if (len > MUDP_MAX_BYTES) {
-    err("%s(%d), invalid len %" PRId64 "\n", __func__, idx, len);
+  if (udp_get_flag(s, MUDP_TX_USER_MAC)) {
+    rte_memcpy(d_addr->addr_bytes, s->user_mac, RTE_ETHER_ADDR_LEN);
+    return 0;
+  }
+
+  ret = mt_dst_ip_mac(impl, dip, d_addr, s->port, arp_timeout_ms);
+  if (ret < 0) {
+    if (arp_timeout_ms) /* log only if not zero timeout */
+      err("%s(%d), mt_dst_ip_mac fail %d for %u.%u.%u.%u\n", __func__, idx, ret, dip[0],
+          dip[1], dip[2], dip[3]);
+    s->stat_pkt_arp_fail++;
     MUDP_ERR_RET(EIO);
   }
 
-  /* copy eth, ip, udp */
-  rte_memcpy(hdr, &s->hdr, sizeof(*hdr));
+  return 0;
+}
 
-  /* eth */
-  struct rte_ether_addr* d_addr = mt_eth_d_addr(eth);
-  uint8_t* dip = (uint8_t*)&addr_in->sin_addr;
-  if (udp_get_flag(s, MUDP_TX_USER_MAC)) {
-    rte_memcpy(d_addr->addr_bytes, s->user_mac, RTE_ETHER_ADDR_LEN);
-  } else {
-    ret = mt_dst_ip_mac(impl, dip, d_addr, port, arp_timeout_ms);
-    if (ret < 0) {
-      if (arp_timeout_ms) /* log only if not zero timeout */
-        err("%s(%d), mt_dst_ip_mac fail %d for %u.%u.%u.%u\n", __func__, idx, ret, dip[0],
-            dip[1], dip[2], dip[3]);
-      s->stat_pkt_arp_fail++;
-      MUDP_ERR_RET(EIO);
-    }
+static inline void udp_dst_cache_flush(struct mudp_impl* s) {
+  for (int i = 0; i < MUDP_DST_CACHE_NB; i++) s->dst_cache[i].valid = false;
+}
+
+/* get the prebuilt hdr for the dst, build it if not cached or stale */
+static struct mudp_dst_cache* udp_dst_cache_get(struct mtl_main_impl* impl,
+                                                struct mudp_impl* s,
+                                                const struct sockaddr_in* addr_in,
+                                                int arp_timeout_ms) {
+  uint32_t dip = addr_in->sin_addr.s_addr;
+  uint16_t dport = addr_in->sin_port;
+  uint32_t arp_gen = mt_arp_generation(impl, s->port);
+  uint64_t cur_tsc = mt_get_tsc(impl);
+  struct mudp_dst_cache* dc = NULL;
+  int i;
+
+  for (i = 0; i < MUDP_DST_CACHE_NB; i++) {
+    dc = &s->dst_cache[i];
+    if (!dc->valid || (dc->dip != dip) || (dc->dport != dport)) continue;
+    /* the mac may be changed if arp updated or expired */
+    bool expired = (cur_tsc - dc->build_tsc) > MUDP_DST_CACHE_EXPIRE_NS;
+    if ((dc->arp_gen == arp_gen) && !expired) return dc;
+    break; /* rebuild in place */
+  }
+  if (i >= MUDP_DST_CACHE_NB) {
+    dc = &s->dst_cache[s->dst_cache_next];
+    s->dst_cache_next = (s->dst_cache_next + 1) % MUDP_DST_CACHE_NB;
   }
+  s->stat_dst_cache_miss++;
 
+  dc->valid = false;
+  struct mt_udp_hdr* hdr = &dc->hdr;
+  /* copy eth, ip, udp */
+  rte_memcpy(hdr, &s->hdr, sizeof(*hdr));
+  /* eth */
+  struct rte_ether_addr* d_addr = mt_eth_d_addr(&hdr->eth);
+  if (udp_tx_dst_mac(impl, s, (uint8_t*)&dip, d_addr, arp_timeout_ms) < 0) return NULL;
   /* ip */
-  mtl_memcpy(&ipv4->dst_addr, dip, MTL_IP_ADDR_LEN);
-
+  hdr->ipv4.dst_addr = dip;
+  hdr->ipv4.total_length = 0;
+  hdr->ipv4.hdr_checksum = 0;
   /* udp */
-  udp->dst_port = addr_in->sin_port;
+  hdr->udp.dst_port = dport;
+  /* the sum of all ipv4 hdr fields except the total_length */
+  dc->ipv4_raw_cksum = rte_raw_cksum(&hdr->ipv4, sizeof(hdr->ipv4));
+
+  dc->dip = dip;
+  dc->dport = dport;
+  dc->arp_gen = arp_gen;
+  dc->build_tsc = cur_tsc;
+  dc->valid = true;
+  return dc;
+}
 
+/* copy the prebuilt hdr to the pkt */
+static inline struct mt_udp_hdr* udp_dst_cache_fill_hdr(struct mudp_dst_cache* dc,
+                                                        struct rte_mbuf* pkt) {
+  struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(pkt, struct mt_udp_hdr*);
+
+  rte_memcpy(hdr, &dc->hdr, sizeof(*hdr));
   /* pkt mbuf */
   mt_mbuf_init_ipv4(pkt);
   pkt->packet_type = RTE_PTYPE_L2_ETHER | RTE_PTYPE_L3_IPV4 | RTE_PTYPE_L4_UDP;
+  return hdr;
+}
+
+/* fix up the len fields and cksum after the pkt_len is known */
+static inline void udp_dst_cache_fill_len(struct mtl_main_impl* impl, struct mudp_impl* s,
+                                          struct mudp_dst_cache* dc,
+                                          struct rte_mbuf* pkt) {
+  struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(pkt, struct mt_udp_hdr*);
+  struct rte_ipv4_hdr* ipv4 = &hdr->ipv4;
+
+  hdr->udp.dgram_len = htons(pkt->pkt_len - pkt->l2_len - pkt->l3_len);
+  ipv4->total_length = htons(pkt->pkt_len - pkt->l2_len);
+  if (!mt_if_has_offload_ipv4_cksum(impl, s->port)) {
+    /* generate cksum from the precomputed sum if no offload */
+    uint32_t sum = dc->ipv4_raw_cksum + ipv4->total_length;
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    uint16_t cksum = (uint16_t)sum;
+    ipv4->hdr_checksum = (cksum == 0xffff) ? cksum : (uint16_t)~cksum;
+  }
+}
+
+static int udp_build_tx_pkt(struct mtl_main_impl* impl, struct mudp_impl* s,
+                            struct rte_mbuf* pkt, const void* buf, size_t len,
+                            struct mudp_dst_cache* dc) {
+  int idx = s->idx;
+
+  if (len > MUDP_MAX_BYTES) {
+    err("%s(%d), invalid len %" PRId64 "\n", __func__, idx, len);
+    MUDP_ERR_RET(EIO);
+  }
+
+  /* copy the prebuilt eth, ip, udp */
+  struct mt_udp_hdr* hdr = udp_dst_cache_fill_hdr(dc, pkt);
   pkt->data_len = len + sizeof(*hdr);
   pkt->pkt_len = pkt->data_len;
 
   /* copy payload */
-  void* payload = (uint8_t*)udp + sizeof(struct rte_udp_hdr);
-  mtl_memcpy(payload, buf, len);
+  mtl_memcpy(&hdr[1], buf, len);
 
-  udp->dgram_len = htons(pkt->pkt_len - pkt->l2_len - pkt->l3_len);
-  ipv4->total_length = htons(pkt->pkt_len - pkt->l2_len);
-  if (!mt_if_has_offload_ipv4_cksum(impl, port)) {
-    /* generate cksum if no offload */
-    ipv4->hdr_checksum = rte_ipv4_cksum(ipv4);
-  }
+  udp_dst_cache_fill_len(impl, s, dc, pkt);
 
   s->stat_pkt_build++;
   return 0;
@@ -210,7 +326,17 @@ static ssize_t udp_msg_len(const struct msghdr* msg) {
   return len;
 }
 
-static int udp_cmsg_handle(struct mudp_impl* s, const struct msghdr* msg) {
+static int udp_verify_gso_sz(struct mudp_impl* s, size_t gso_sz) {
+  if (!gso_sz || (gso_sz > MUDP_MAX_BYTES)) {
+    err("%s(%d), invalid gso size %" PRIu64 "\n", __func__, s->idx, gso_sz);
+    MUDP_ERR_RET(EINVAL);
+  }
+  return 0;
+}
+
+/* the UDP_SEGMENT by cmsg only applies to this msg, same as kernel */
+static int udp_cmsg_handle(struct mudp_impl* s, const struct msghdr* msg,
+                           size_t* gso_sz) {
   struct cmsghdr* cmsg = CMSG_FIRSTHDR(msg);
   if (!cmsg) return 0;
   int idx = s->idx;
@@ -222,7 +348,8 @@ static int udp_cmsg_handle(struct mudp_impl* s, const struct msghdr* msg) {
           uint16_t* p_val = (uint16_t*)CMSG_DATA(cmsg);
           uint16_t val = *p_val;
           dbg("%s(%d), UDP_SEGMENT val %u\n", __func__, idx, val);
-          s->gso_segment_sz = val;
+          if (udp_verify_gso_sz(s, val) < 0) return -1;
+          *gso_sz = val;
         } else {
           err("%s(%d), unknow cmsg_len %" PRId64 " for UDP_SEGMENT\n", __func__, idx,
               cmsg->cmsg_len);
@@ -237,55 +364,82 @@ static int udp_cmsg_handle(struct mudp_impl* s, const struct msghdr* msg) {
   return 0;
 }
 
-static int udp_build_tx_msg_pkt(struct mtl_main_impl* impl, struct mudp_impl* s,
+/*
+ * Build the gso pkts by mbuf chain, the msg payload is copied only once to a big
+ * buffer, and each segment is an indirect mbuf of the big buffer chained after the
+ * hdr mbuf. The indirect mbufs come from the gso_seg_pool, so the tx_pool usage is
+ * the same as the copy mode.
+ */
+static int udp_build_tx_gso_pkt(struct mtl_main_impl* impl, struct mudp_impl* s,
                                 struct rte_mbuf** pkts, unsigned int pkts_nb,
-                                const struct msghdr* msg,
-                                const struct sockaddr_in* addr_in, int arp_timeout_ms,
-                                size_t sz_per_pkt) {
-  enum mtl_port port = s->port;
+                                const struct msghdr* msg, struct mudp_dst_cache* dc,
+                                size_t sz_per_pkt, size_t total_len) {
   int idx = s->idx;
+  struct rte_mbuf* segs[pkts_nb];
   int ret;
 
-  /* get the dst mac address */
-  struct rte_ether_addr d_addr;
-  uint8_t* dip = (uint8_t*)&addr_in->sin_addr;
-  if (udp_get_flag(s, MUDP_TX_USER_MAC)) {
-    rte_memcpy(&d_addr.addr_bytes, s->user_mac, RTE_ETHER_ADDR_LEN);
-  } else {
-    ret = mt_dst_ip_mac(impl, dip, &d_addr, port, arp_timeout_ms);
-    if (ret < 0) {
-      if (arp_timeout_ms) /* log only if not zero timeout */
-        err("%s(%d), mt_dst_ip_mac fail %d for %u.%u.%u.%u\n", __func__, idx, ret, dip[0],
-            dip[1], dip[2], dip[3]);
-      s->stat_pkt_arp_fail++;
-      MUDP_ERR_RET(EIO);
-    }
+  struct rte_mbuf* big = rte_pktmbuf_alloc(s->gso_pool);
+  if (!big) {
+    dbg("%s(%d), big buf alloc fail\n", __func__, idx);
+    MUDP_ERR_RET(ENOMEM);
   }
+  ret = rte_pktmbuf_alloc_bulk(s->gso_seg_pool, segs, pkts_nb);
+  if (ret < 0) {
+    dbg("%s(%d), segs alloc fail\n", __func__, idx);
+    rte_pktmbuf_free(big);
+    MUDP_ERR_RET(ENOMEM);
+  }
+
+  /* copy the msg payload to the big buf */
+  uint8_t* pd = rte_pktmbuf_mtod(big, uint8_t*);
+  for (int i = 0; i < msg->msg_iovlen; i++) {
+    rte_memcpy(pd, msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
+    pd += msg->msg_iov[i].iov_len;
+  }
+  big->data_len = total_len;
+  big->pkt_len = total_len;
+
+  size_t offset = 0;
+  for (unsigned int i = 0; i < pkts_nb; i++) {
+    struct rte_mbuf* pkt = pkts[i];
+    struct rte_mbuf* seg = segs[i];
+    uint16_t seg_len = RTE_MIN(sz_per_pkt, total_len - offset);
+
+    udp_dst_cache_fill_hdr(dc, pkt);
+    pkt->data_len = sizeof(struct mt_udp_hdr);
+    pkt->pkt_len = pkt->data_len;
+
+    /* the seg point to the offset of big buf */
+    rte_pktmbuf_attach(seg, big);
+    seg->data_off += offset;
+    seg->data_len = seg_len;
+    seg->pkt_len = seg_len;
+    rte_pktmbuf_chain(pkt, seg);
+
+    udp_dst_cache_fill_len(impl, s, dc, pkt);
+    offset += seg_len;
+    s->stat_pkt_build++;
+  }
+
+  /* the big buf is freed once all segs are freed */
+  rte_pktmbuf_free(big);
+  s->stat_tx_gso_chain++;
+  return 0;
+}
+
+static int udp_build_tx_msg_pkt(struct mtl_main_impl* impl, struct mudp_impl* s,
+                                struct rte_mbuf** pkts, unsigned int pkts_nb,
+                                const struct msghdr* msg, struct mudp_dst_cache* dc,
+                                size_t sz_per_pkt) {
+  int idx = s->idx;
 
   void* payloads[pkts_nb];
   memset(payloads, 0, sizeof(payloads)); /* prvents maybe-uninitialized error */
 
   /* fill hdr info for all pkts */
   for (unsigned int i = 0; i < pkts_nb; i++) {
-    struct rte_mbuf* pkt = pkts[i];
-    struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(pkt, struct mt_udp_hdr*);
-    struct rte_ether_hdr* eth = &hdr->eth;
-    struct rte_ipv4_hdr* ipv4 = &hdr->ipv4;
-    struct rte_udp_hdr* udp = &hdr->udp;
-
-    /* copy eth, ip, udp */
-    rte_memcpy(hdr, &s->hdr, sizeof(*hdr));
-    /* update dst mac */
-    rte_memcpy(mt_eth_d_addr(eth), &d_addr, sizeof(d_addr));
-    /* ip */
-    mtl_memcpy(&ipv4->dst_addr, dip, MTL_IP_ADDR_LEN);
-    /* udp */
-    udp->dst_port = addr_in->sin_port;
-    /* pkt mbuf */
-    mt_mbuf_init_ipv4(pkt);
-    pkt->packet_type = RTE_PTYPE_L2_ETHER | RTE_PTYPE_L3_IPV4 | RTE_PTYPE_L4_UDP;
-
-    payloads[i] = &udp[1];
+    struct mt_udp_hdr* hdr = udp_dst_cache_fill_hdr(dc, pkts[i]);
+    payloads[i] = &hdr[1];
     s->stat_pkt_build++;
   }
 
@@ -332,17 +486,7 @@ static int udp_build_tx_msg_pkt(struct mtl_main_impl* impl, struct mudp_impl* s,
 
   /* fill the info according to the payload */
   for (unsigned int i = 0; i < pkts_nb; i++) {
-    struct rte_mbuf* pkt = pkts[i];
-    struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(pkt, struct mt_udp_hdr*);
-    struct rte_ipv4_hdr* ipv4 = &hdr->ipv4;
-    struct rte_udp_hdr* udp = &hdr->udp;
-
-    udp->dgram_len = htons(pkt->pkt_len - pkt->l2_len - pkt->l3_len);
-    ipv4->total_length = htons(pkt->pkt_len - pkt->l2_len);
-    if (!mt_if_has_offload_ipv4_cksum(impl, port)) {
-      /* generate cksum if no offload */
-      ipv4->hdr_checksum = rte_ipv4_cksum(ipv4);
-    }
+    udp_dst_cache_fill_len(impl, s, dc, pkts[i]);
   }
 
   return 0;
@@ -377,6 +521,25 @@ static unsigned int udp_tx_pkts(struct mtl_main_impl* impl, struct mudp_impl* s,
   return sent;
 }
 
+/* tx the pkts of a mmsg burst, return the number of msgs with all pkts sent */
+static unsigned int udp_tx_mmsg_burst(struct mtl_main_impl* impl, struct mudp_impl* s,
+                                      struct rte_mbuf** pkts, unsigned int pkts_nb,
+                                      const unsigned int* msg_pkts,
+                                      unsigned int msgs_nb) {
+  unsigned int sent = 0;
+
+  if (pkts_nb) sent = udp_tx_pkts(impl, s, pkts, pkts_nb);
+  if (sent >= pkts_nb) return msgs_nb;
+
+  rte_pktmbuf_free_bulk(pkts + sent, pkts_nb - sent);
+  unsigned int msgs_sent = 0;
+  for (; msgs_sent < msgs_nb; msgs_sent++) {
+    if (msg_pkts[msgs_sent] > sent) break;
+    sent -= msg_pkts[msgs_sent];
+  }
+  return msgs_sent;
+}
+
 static int udp_bind_port(struct mudp_impl* s, uint16_t bind_port) {
   int idx = s->idx;
 
@@ -388,6 +551,7 @@ static int udp_bind_port(struct mudp_impl* s, uint16_t bind_port) {
   s->bind_port = bind_port;
   /* update src port for tx also */
   s->hdr.udp.src_port = htons(bind_port);
+  udp_dst_cache_flush(s);
   info("%s(%d), bind port number %u\n", __func__, idx, bind_port);
   return 0;
 }
@@ -437,6 +601,15 @@ static int udp_uinit_txq(struct mtl_main_impl* impl, struct mudp_impl* s) {
     mt_txq_put(s->txq);
     s->txq = NULL;
   }
+  if (s->gso_pool) {
+    mt_mempool_free(s->gso_pool);
+    s->gso_pool = NULL;
+  }
+  if (s->gso_seg_pool) {
+    mt_mempool_free(s->gso_seg_pool);
+    s->gso_seg_pool = NULL;
+  }
+  s->gso_pool_tried = false;
   if (s->tx_pool_by_queue) {
     /* tsq use same mempool for shared queue */
     if (s->tx_pool) {
@@ -542,15 +715,33 @@ static int udp_stat_dump(void* priv) {
     s->stat_rx_msg_timeout_cnt = 0;
     s->stat_rx_msg_again_cnt = 0;
   }
+  if (s->stat_rx_mmsg_cnt) {
+    notice("%s(%d,%d), rx_mmsg %u succ %u pkts %u\n", __func__, port, idx,
+           s->stat_rx_mmsg_cnt, s->stat_rx_mmsg_succ_cnt, s->stat_rx_mmsg_pkts);
+    s->stat_rx_mmsg_cnt = 0;
+    s->stat_rx_mmsg_succ_cnt = 0;
+    s->stat_rx_mmsg_pkts = 0;
+  }
   if (s->stat_poll_cnt) {
     notice("%s(%d,%d), poll %u succ %u timeout %u 0-timeout %u query_ret %u\n", __func__,
            port, idx, s->stat_poll_cnt, s->stat_poll_succ_cnt, s->stat_poll_timeout_cnt,
            s->stat_poll_zero_timeout_cnt, s->stat_poll_query_ret_cnt);
+    if (s->stat_poll_event_wait_cnt)
+      notice("%s(%d,%d), poll event wait %u\n", __func__, port, idx,
+             s->stat_poll_event_wait_cnt);
     s->stat_poll_cnt = 0;
     s->stat_poll_succ_cnt = 0;
     s->stat_poll_timeout_cnt = 0;
     s->stat_poll_zero_timeout_cnt = 0;
     s->stat_poll_query_ret_cnt = 0;
+    s->stat_poll_event_wait_cnt = 0;
+  }
+  /* the release may come from any app thread, read and clear in one step */
+  int zc_release = mt_atomic32_read_clear(&s->stat_rx_zc_release);
+  if (s->stat_rx_zc_lent || zc_release) {
+    notice("%s(%d,%d), zc lent %u release %d outstanding %d\n", __func__, port, idx,
+           s->stat_rx_zc_lent, zc_release, rte_atomic32_read(&s->stat_rx_zc_outstanding));
+    s->stat_rx_zc_lent = 0;
   }
   if (s->stat_pkt_dequeue) {
     notice("%s(%d,%d), pkt dequeue %u deliver %u\n", __func__, port, idx,
@@ -566,9 +757,22 @@ static int udp_stat_dump(void* priv) {
     s->stat_pkt_build = 0;
     s->stat_pkt_tx = 0;
   }
+  if (s->stat_tx_mmsg_cnt) {
+    notice("%s(%d,%d), tx_mmsg %u msgs %u\n", __func__, port, idx, s->stat_tx_mmsg_cnt,
+           s->stat_tx_mmsg_msgs);
+    s->stat_tx_mmsg_cnt = 0;
+    s->stat_tx_mmsg_msgs = 0;
+  }
+  if (s->stat_dst_cache_miss) {
+    notice("%s(%d,%d), tx dst cache miss %u\n", __func__, port, idx,
+           s->stat_dst_cache_miss);
+    s->stat_dst_cache_miss = 0;
+  }
   if (s->stat_tx_gso_count) {
-    notice("%s(%d,%d), tx gso count %u\n", __func__, port, idx, s->stat_tx_gso_count);
+    notice("%s(%d,%d), tx gso count %u chain %u\n", __func__, port, idx,
+           s->stat_tx_gso_count, s->stat_tx_gso_chain);
     s->stat_tx_gso_count = 0;
+    s->stat_tx_gso_chain = 0;
   }
   if (s->stat_pkt_arp_fail) {
     warn("%s(%d,%d), pkt %u arp fail\n", __func__, port, idx, s->stat_pkt_arp_fail);
@@ -751,6 +955,24 @@ static int udp_set_reuse_addr(struct mudp_impl* s, const void* optval, socklen_t
   return 0;
 }
 
+static int udp_set_gso_segment(struct mudp_impl* s, const void* optval,
+                               socklen_t optlen) {
+  int idx = s->idx;
+  size_t sz = sizeof(int);
+  int gso_sz;
+
+  if (optlen != sz) {
+    err("%s(%d), invalid optlen %d\n", __func__, idx, optlen);
+    MUDP_ERR_RET(EINVAL);
+  }
+
+  gso_sz = *((int*)optval);
+  if (udp_verify_gso_sz(s, gso_sz) < 0) return -1;
+  info("%s(%d), gso_segment_sz %d\n", __func__, idx, gso_sz);
+  s->gso_segment_sz = gso_sz;
+  return 0;
+}
+
 static int udp_get_reuse_addr(struct mudp_impl* s, void* optval, socklen_t* optlen) {
   int idx = s->idx;
   size_t sz = sizeof(int);
@@ -989,17 +1211,11 @@ dequeue:
   return udp_rx_ret_timeout(s, flags);
 }
 
-static ssize_t udp_rx_msg_dequeue(struct mudp_impl* s, struct msghdr* msg, int flags) {
+/* copy the payload and src addr of one rx pkt to msg, the pkt is not freed */
+static ssize_t udp_rx_msg_fill(struct mudp_impl* s, struct rte_mbuf* pkt,
+                               struct msghdr* msg) {
   int idx = s->idx;
-  int ret;
   ssize_t copied = 0;
-  struct rte_mbuf* pkt = NULL;
-  MTL_MAY_UNUSED(flags);
-
-  /* dequeue pkt from rx ring */
-  ret = rte_ring_sc_dequeue(mur_client_ring(s->rxq), (void**)&pkt);
-  if (ret < 0) return ret;
-  s->stat_pkt_dequeue++;
 
   struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(pkt, struct mt_udp_hdr*);
   struct rte_udp_hdr* udp = &hdr->udp;
@@ -1044,11 +1260,45 @@ static ssize_t udp_rx_msg_dequeue(struct mudp_impl* s, struct msghdr* msg, int f
   if (payload_len)
     warn("%s(%d), %" PRIu64 " bytes not copied \n", __func__, idx, payload_len);
 
+  return copied;
+}
+
+static ssize_t udp_rx_msg_dequeue(struct mudp_impl* s, struct msghdr* msg, int flags) {
+  int ret;
+  ssize_t copied = 0;
+  struct rte_mbuf* pkt = NULL;
+  MTL_MAY_UNUSED(flags);
+
+  /* dequeue pkt from rx ring */
+  ret = rte_ring_sc_dequeue(mur_client_ring(s->rxq), (void**)&pkt);
+  if (ret < 0) return ret;
+  s->stat_pkt_dequeue++;
+
+  copied = udp_rx_msg_fill(s, pkt, msg);
+
   rte_pktmbuf_free(pkt);
-  dbg("%s(%d), copied %" PRId64 " bytes, flags %d\n", __func__, idx, copied, flags);
+  dbg("%s(%d), copied %" PRId64 " bytes, flags %d\n", __func__, s->idx, copied, flags);
   return copied;
 }
 
+/* bulk dequeue pkts from rx ring, return the number of msgs filled */
+static unsigned int udp_rx_mmsg_dequeue(struct mudp_impl* s, struct mmsghdr* msgvec,
+                                        unsigned int vlen) {
+  struct rte_mbuf* pkts[MUDP_MMSG_BURST_SIZE];
+  unsigned int n = RTE_MIN(vlen, MUDP_MMSG_BURST_SIZE);
+
+  n = rte_ring_sc_dequeue_burst(mur_client_ring(s->rxq), (void**)pkts, n, NULL);
+  if (!n) return 0;
+  s->stat_pkt_dequeue += n;
+
+  for (unsigned int i = 0; i < n; i++) {
+    msgvec[i].msg_len = udp_rx_msg_fill(s, pkts[i], &msgvec[i].msg_hdr);
+  }
+
+  rte_pktmbuf_free_bulk(pkts, n);
+  return n;
+}
+
 static ssize_t udp_recvmsg(struct mudp_impl* s, struct msghdr* msg, int flags) {
   struct mtl_main_impl* impl = s->parent;
   ssize_t copied = 0;
@@ -1089,6 +1339,117 @@ dequeue:
   return udp_rx_ret_timeout(s, flags);
 }
 
+static int udp_recvmmsg(struct mudp_impl* s, struct mmsghdr* msgvec, unsigned int vlen,
+                        int flags, struct timespec* timeout) {
+  struct mtl_main_impl* impl = s->parent;
+  unsigned int received = 0;
+  uint64_t start_ts = mt_get_tsc(impl);
+  unsigned int timeout_us = s->rx_timeout_us;
+
+  if (timeout) {
+    uint64_t us = (uint64_t)timeout->tv_sec * US_PER_S + timeout->tv_nsec / 1000;
+    if (us < timeout_us) timeout_us = us;
+  }
+
+  s->stat_rx_mmsg_cnt++;
+
+dequeue:
+  received += udp_rx_mmsg_dequeue(s, msgvec + received, vlen - received);
+  if (received >= vlen) goto done;
+
+  if (mur_client_rx(s->rxq)) { /* dequeue again as rx succ */
+    goto dequeue;
+  }
+
+  /* no wait for the remaining once any msg is received, same as MSG_WAITFORONE */
+  if (received) goto done;
+
+  /* return EAGAIN if MSG_DONTWAIT is set */
+  if (flags & MSG_DONTWAIT) {
+    MUDP_ERR_RET(EAGAIN);
+  }
+
+  unsigned int us = (mt_get_tsc(impl) - start_ts) / NS_PER_US;
+  if ((us < timeout_us) && udp_alive(s)) {
+    if (s->rx_poll_sleep_us) {
+      mur_client_timedwait(s->rxq, timeout_us - us, s->rx_poll_sleep_us);
+    }
+    goto dequeue;
+  }
+
+  return udp_rx_ret_timeout(s, flags);
+
+done:
+  s->stat_rx_mmsg_succ_cnt++;
+  s->stat_rx_mmsg_pkts += received;
+  return received;
+}
+
+/* bulk dequeue pkts from rx ring and lend the payload to user, no copy */
+static unsigned int udp_rx_zc_dequeue(struct mudp_impl* s, struct mudp_zc_buf* bufs,
+                                      unsigned int nb) {
+  struct rte_mbuf* pkts[MUDP_MMSG_BURST_SIZE];
+  unsigned int n = RTE_MIN(nb, MUDP_MMSG_BURST_SIZE);
+
+  n = rte_ring_sc_dequeue_burst(mur_client_ring(s->rxq), (void**)pkts, n, NULL);
+  if (!n) return 0;
+  s->stat_pkt_dequeue += n;
+
+  for (unsigned int i = 0; i < n; i++) {
+    struct rte_mbuf* pkt = pkts[i];
+    struct mt_udp_hdr* hdr = rte_pktmbuf_mtod(pkt, struct mt_udp_hdr*);
+    struct rte_udp_hdr* udp = &hdr->udp;
+    struct mudp_zc_buf* buf = &bufs[i];
+
+    buf->payload = &udp[1];
+    buf->len = ntohs(udp->dgram_len) - sizeof(*udp);
+    memset(&buf->src_addr, 0, sizeof(buf->src_addr));
+    buf->src_addr.sin_family = AF_INET;
+    buf->src_addr.sin_port = udp->src_port;
+    buf->src_addr.sin_addr.s_addr = hdr->ipv4.src_addr;
+    buf->token = pkt;
+  }
+
+  s->stat_pkt_deliver += n;
+  s->stat_rx_zc_lent += n;
+  rte_atomic32_add(&s->stat_rx_zc_outstanding, n);
+  return n;
+}
+
+static int udp_recv_zc(struct mudp_impl* s, struct mudp_zc_buf* bufs, unsigned int nb,
+                       int flags) {
+  struct mtl_main_impl* impl = s->parent;
+  unsigned int received = 0;
+  uint64_t start_ts = mt_get_tsc(impl);
+
+dequeue:
+  received += udp_rx_zc_dequeue(s, bufs + received, nb - received);
+  if (received >= nb) return received;
+
+  if (mur_client_rx(s->rxq)) { /* dequeue again as rx succ */
+    goto dequeue;
+  }
+
+  /* no wait for the remaining once any pkt is received */
+  if (received) return received;
+
+  /* return EAGAIN if MSG_DONTWAIT is set */
+  if (flags & MSG_DONTWAIT) {
+    MUDP_ERR_RET(EAGAIN);
+  }
+
+  unsigned int us = (mt_get_tsc(impl) - start_ts) / NS_PER_US;
+  unsigned int timeout = s->rx_timeout_us;
+  if ((us < timeout) && udp_alive(s)) {
+    if (s->rx_poll_sleep_us) {
+      mur_client_timedwait(s->rxq, timeout - us, s->rx_poll_sleep_us);
+    }
+    goto dequeue;
+  }
+
+  return udp_rx_ret_timeout(s, flags);
+}
+
 static int udp_fallback_poll(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout) {
   struct mudp_impl* s;
   struct pollfd p_fds[nfds];
@@ -1128,11 +1489,55 @@ static int udp_fallback_poll(struct mudp_pollfd* fds, mudp_nfds_t nfds, int time
   return ret;
 }
 
+/* all fds has the rx event fd, only for lcore mode */
+static bool udp_poll_event_mode(struct mudp_pollfd* fds, mudp_nfds_t nfds) {
+  for (mudp_nfds_t i = 0; i < nfds; i++) {
+    struct mudp_impl* s = fds[i].fd;
+    if (mur_client_event_fd(s->rxq) < 0) return false;
+  }
+  return true;
+}
+
+/* block in kernel until the rx event fd or the wait_fd is ready */
+static int udp_poll_event_wait(struct mudp_pollfd* fds, mudp_nfds_t nfds, int wait_fd,
+                               uint64_t wait_us) {
+#ifdef WINDOWSENV
+  MTL_MAY_UNUSED(fds);
+  MTL_MAY_UNUSED(nfds);
+  MTL_MAY_UNUSED(wait_fd);
+  mt_sleep_us(wait_us);
+  return 0;
+#else
+  struct pollfd kfds[nfds + 1];
+  nfds_t kfds_cnt = 0;
+  struct timespec ts;
+
+  for (mudp_nfds_t i = 0; i < nfds; i++) {
+    struct mudp_impl* s = fds[i].fd;
+    kfds[kfds_cnt].fd = mur_client_event_fd(s->rxq);
+    kfds[kfds_cnt].events = POLLIN;
+    kfds[kfds_cnt].revents = 0;
+    kfds_cnt++;
+    s->stat_poll_event_wait_cnt++;
+  }
+  if (wait_fd >= 0) {
+    kfds[kfds_cnt].fd = wait_fd;
+    kfds[kfds_cnt].events = POLLIN;
+    kfds[kfds_cnt].revents = 0;
+    kfds_cnt++;
+  }
+
+  mt_ns_to_timespec(wait_us * NS_PER_US, &ts);
+  return ppoll(kfds, kfds_cnt, &ts, NULL);
+#endif
+}
+
 static int udp_poll(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout,
-                    int (*query)(void* priv), void* priv) {
+                    int (*query)(void* priv), void* priv, int wait_fd) {
   struct mudp_impl* s = fds[0].fd;
   struct mtl_main_impl* impl = s->parent;
   uint64_t start_ts = mt_get_tsc(impl);
+  bool event_mode;
   int rc, ret;
 
   dbg("%s(%d), nfds %d timeout %d\n", __func__, s->idx, (int)nfds, timeout);
@@ -1153,6 +1558,8 @@ static int udp_poll(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout,
     }
     s->stat_poll_cnt++;
   }
+  /* no need to arm the event for the query only call */
+  event_mode = (timeout != 0) && udp_poll_event_mode(fds, nfds);
 
   /* rx from nic firstly if no pending pkt for each fd */
 rx_poll:
@@ -1169,6 +1576,8 @@ rx_poll:
   for (mudp_nfds_t i = 0; i < nfds; i++) {
     s = fds[i].fd;
     unsigned int count = rte_ring_count(mur_client_ring(s->rxq));
+    /* arm before the last check to not miss the notify from the tasklet */
+    if (!count && event_mode) count = mur_client_event_arm(s->rxq);
     if (count > 0) {
       rc++;
       fds[i].revents = POLLIN;
@@ -1196,7 +1605,13 @@ rx_poll:
   /* check if timeout */
   int ms = (mt_get_tsc(impl) - start_ts) / NS_PER_MS;
   if (((ms < timeout) || (timeout < 0)) && udp_alive(s)) {
-    if (s->rx_poll_sleep_us) {
+    if (event_mode) {
+      uint64_t wait_us = MUDP_POLL_EVENT_WAIT_MAX_US;
+      if (timeout > 0) wait_us = RTE_MIN(wait_us, (uint64_t)(timeout - ms) * US_PER_MS);
+      /* the query has to be checked periodically if no fd to notify its event */
+      if (query && wait_fd < 0) wait_us = RTE_MIN(wait_us, s->rx_poll_sleep_us);
+      if (wait_us) udp_poll_event_wait(fds, nfds, wait_fd, wait_us);
+    } else if (s->rx_poll_sleep_us) {
       mur_client_timedwait(s->rxq, (timeout - ms) * US_PER_MS, s->rx_poll_sleep_us);
     }
     goto rx_poll;
@@ -1254,6 +1669,8 @@ mudp_handle mudp_socket_port(mtl_handle mt, int domain, int type, int protocol,
   s->gso_segment_sz = MUDP_MAX_BYTES;
   s->fallback_fd = -1;
   mt_pthread_mutex_init(&s->mcast_addrs_mutex, NULL);
+  rte_atomic32_set(&s->stat_rx_zc_release, 0);
+  rte_atomic32_set(&s->stat_rx_zc_outstanding, 0);
 
   if (mt_pmd_is_kernel_socket(impl, port)) {
     ret = socket(domain, type, protocol);
@@ -1304,6 +1721,14 @@ int mudp_close(mudp_handle ut) {
     MUDP_ERR_RET(EIO);
   }
 
+  /* the release of the lent buffers access the socket, must be done before close */
+  int zc_outstanding = rte_atomic32_read(&s->stat_rx_zc_outstanding);
+  if (zc_outstanding) {
+    err("%s(%d), %d zero-copy buffers still not released\n", __func__, idx,
+        zc_outstanding);
+    MUDP_ERR_RET(EBUSY);
+  }
+
   s->alive = false;
 
   if (s->fallback_fd >= 0) {
@@ -1412,22 +1837,29 @@ ssize_t mudp_sendto(mudp_handle ut, const void* buf, size_t len, int flags,
     MUDP_ERR_RET(ENOMEM);
   }
 
+  struct mudp_dst_cache* dc = udp_dst_cache_get(impl, s, addr_in, arp_timeout_ms);
+  if (!dc) {
+    rte_pktmbuf_free_bulk(pkts, pkts_nb);
+    if (arp_timeout_ms) {
+      err("%s(%d), get dst fail\n", __func__, idx);
+      MUDP_ERR_RET(EIO);
+    } else {
+      mt_sleep_us(1);
+      /* align to kernel behavior which sendto succ even if arp not resolved */
+      return len;
+    }
+  }
+
   size_t offset = 0;
   for (unsigned int i = 0; i < pkts_nb; i++) {
     size_t cur_len = RTE_MIN(sz_per_pkt, len - offset);
-    ret = udp_build_tx_pkt(impl, s, pkts[i], buf + offset, cur_len, addr_in,
-                           arp_timeout_ms);
+    ret = udp_build_tx_pkt(impl, s, pkts[i], buf + offset, cur_len, dc);
     if (ret < 0) {
+      err("%s(%d), build pkt fail %d\n", __func__, idx, ret);
       rte_pktmbuf_free_bulk(pkts, pkts_nb);
-      if (arp_timeout_ms) {
-        err("%s(%d), build pkt fail %d\n", __func__, idx, ret);
-        return ret;
-      } else {
-        mt_sleep_us(1);
-        /* align to kernel behavior which sendto succ even if arp not resolved */
-        return len;
-      }
+      return ret;
     }
+    offset += cur_len;
   }
 
   unsigned int sent = udp_tx_pkts(impl, s, pkts, pkts_nb);
@@ -1471,10 +1903,10 @@ ssize_t mudp_sendmsg(mudp_handle ut, const struct msghdr* msg, int flags) {
     }
   }
 
-  udp_cmsg_handle(s, msg);
-
   /* UDP_SEGMENT check */
   size_t sz_per_pkt = s->gso_segment_sz;
+  ret = udp_cmsg_handle(s, msg, &sz_per_pkt);
+  if (ret < 0) return ret;
   size_t total_len = udp_msg_len(msg);
   unsigned int pkts_nb = total_len / sz_per_pkt;
   if (total_len % sz_per_pkt) pkts_nb++;
@@ -1494,8 +1926,16 @@ ssize_t mudp_sendmsg(mudp_handle ut, const struct msghdr* msg, int flags) {
     MUDP_ERR_RET(ENOMEM);
   }
 
-  ret = udp_build_tx_msg_pkt(impl, s, pkts, pkts_nb, msg, addr_in, arp_timeout_ms,
-                             sz_per_pkt);
+  struct mudp_dst_cache* dc = udp_dst_cache_get(impl, s, addr_in, arp_timeout_ms);
+  if (!dc) {
+    ret = -1; /* errno set by the dst mac resolve */
+  } else {
+    ret = -1;
+    if (udp_gso_chain(impl, s, pkts_nb, total_len))
+      ret = udp_build_tx_gso_pkt(impl, s, pkts, pkts_nb, msg, dc, sz_per_pkt, total_len);
+    /* fallback to copy to each pkt */
+    if (ret < 0) ret = udp_build_tx_msg_pkt(impl, s, pkts, pkts_nb, msg, dc, sz_per_pkt);
+  }
   if (ret < 0) {
     rte_pktmbuf_free_bulk(pkts, pkts_nb);
     if (arp_timeout_ms) {
@@ -1521,8 +1961,123 @@ ssize_t mudp_sendmsg(mudp_handle ut, const struct msghdr* msg, int flags) {
   return total_len;
 }
 
-int mudp_poll_query(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout,
-                    int (*query)(void* priv), void* priv) {
+int mudp_sendmmsg(mudp_handle ut, struct mmsghdr* msgvec, unsigned int vlen,
+                  int flags) {
+  struct mudp_impl* s = ut;
+  struct mtl_main_impl* impl = s->parent;
+  int idx = s->idx;
+  int arp_timeout_ms = s->msg_arp_timeout_us / 1000;
+  int ret = 0;
+
+#ifndef WINDOWSENV
+  if (udp_is_fallback(s)) return sendmmsg(s->fallback_fd, msgvec, vlen, flags);
+#endif
+
+  if (!msgvec || !vlen) {
+    err("%s(%d), invalid msgvec %p vlen %u\n", __func__, idx, msgvec, vlen);
+    MUDP_ERR_RET(EINVAL);
+  }
+
+  struct rte_mbuf* pkts[MUDP_MMSG_BURST_SIZE];
+  unsigned int pkts_nb = 0;
+  unsigned int msg_pkts[MUDP_MMSG_BURST_SIZE]; /* pkts nb of each msg in the burst */
+  unsigned int msgs_nb = 0;                    /* msgs nb in the burst */
+  unsigned int msgs_sent = 0;
+
+  s->stat_tx_mmsg_cnt++;
+
+  for (unsigned int i = 0; i < vlen; i++) {
+    const struct msghdr* msg = &msgvec[i].msg_hdr;
+    const struct sockaddr_in* addr_in = (struct sockaddr_in*)msg->msg_name;
+
+    /* len to 1 to let the verify happy */
+    ret = udp_verify_sendto_args(1, flags, addr_in, msg->msg_namelen);
+    if (ret < 0) {
+      err("%s(%d), invalid args for msg %u\n", __func__, idx, i);
+      break;
+    }
+
+    /* init txq if not */
+    if (!udp_get_flag(s, MUDP_TXQ_ALLOC)) {
+      ret = udp_init_txq(impl, s, addr_in);
+      if (ret < 0) {
+        err("%s(%d), init txq fail\n", __func__, idx);
+        break;
+      }
+    }
+
+    size_t sz_per_pkt = s->gso_segment_sz;
+    ret = udp_cmsg_handle(s, msg, &sz_per_pkt);
+    if (ret < 0) break;
+    size_t total_len = udp_msg_len(msg);
+    unsigned int nb = total_len / sz_per_pkt;
+    if (total_len % sz_per_pkt) nb++;
+    if (!nb || nb > MUDP_MMSG_BURST_SIZE) {
+      err("%s(%d), invalid pkts nb %u for msg %u\n", __func__, idx, nb, i);
+      errno = EINVAL;
+      ret = -1;
+      break;
+    }
+
+    /* flush current burst if no space for this msg */
+    if ((pkts_nb + nb > MUDP_MMSG_BURST_SIZE) || (msgs_nb >= MUDP_MMSG_BURST_SIZE)) {
+      unsigned int n = udp_tx_mmsg_burst(impl, s, pkts, pkts_nb, msg_pkts, msgs_nb);
+      msgs_sent += n;
+      if (n < msgs_nb) goto out;
+      pkts_nb = 0;
+      msgs_nb = 0;
+    }
+
+    struct mudp_dst_cache* dc = udp_dst_cache_get(impl, s, addr_in, arp_timeout_ms);
+    if (!dc) {
+      if (arp_timeout_ms) {
+        err("%s(%d), get dst fail for msg %u\n", __func__, idx, i);
+        ret = -1; /* errno set by the dst mac resolve */
+        break;
+      }
+      /* align to kernel behavior which sendmsg succ even if arp not resolved */
+      msgvec[i].msg_len = total_len;
+      msg_pkts[msgs_nb++] = 0;
+      continue;
+    }
+
+    ret = rte_pktmbuf_alloc_bulk(s->tx_pool, &pkts[pkts_nb], nb);
+    if (ret < 0) {
+      err("%s(%d), pktmbuf alloc fail, nb %u\n", __func__, idx, nb);
+      errno = ENOMEM;
+      ret = -1;
+      break;
+    }
+    if (nb > 1) s->stat_tx_gso_count++;
+
+    ret = -1;
+    if (udp_gso_chain(impl, s, nb, total_len))
+      ret = udp_build_tx_gso_pkt(impl, s, &pkts[pkts_nb], nb, msg, dc, sz_per_pkt,
+                                 total_len);
+    if (ret < 0)
+      ret = udp_build_tx_msg_pkt(impl, s, &pkts[pkts_nb], nb, msg, dc, sz_per_pkt);
+    if (ret < 0) {
+      err("%s(%d), build pkt fail %d for msg %u\n", __func__, idx, ret, i);
+      rte_pktmbuf_free_bulk(&pkts[pkts_nb], nb);
+      break;
+    }
+
+    msgvec[i].msg_len = total_len;
+    msg_pkts[msgs_nb++] = nb;
+    pkts_nb += nb;
+  }
+
+  msgs_sent += udp_tx_mmsg_burst(impl, s, pkts, pkts_nb, msg_pkts, msgs_nb);
+
+out:
+  s->stat_tx_mmsg_msgs += msgs_sent;
+  if (msgs_sent) return msgs_sent;
+  if (ret < 0) return ret; /* errno already set */
+  MUDP_ERR_RET(ETIMEDOUT);
+}
+
+int mudp_poll_query_fd(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout,
+                       int (*query)(void* priv), void* priv, int wait_fd) {
   int ret = udp_verify_poll(fds, nfds, timeout);
   if (ret < 0) return ret;
 
@@ -1535,10 +2090,15 @@ int mudp_poll_query(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout,
     }
     return udp_fallback_poll(fds, nfds, timeout);
   } else {
-    return udp_poll(fds, nfds, timeout, query, priv);
+    return udp_poll(fds, nfds, timeout, query, priv, wait_fd);
   }
 }
 
+int mudp_poll_query(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout,
+                    int (*query)(void* priv), void* priv) {
+  return mudp_poll_query_fd(fds, nfds, timeout, query, priv, -1);
+}
+
 int mudp_poll(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout) {
   return mudp_poll_query(fds, nfds, timeout, NULL, NULL);
 }
@@ -1587,6 +2147,88 @@ ssize_t mudp_recvmsg(mudp_handle ut, struct msghdr* msg, int flags) {
   return udp_recvmsg(s, msg, flags);
 }
 
+int mudp_recvmmsg(mudp_handle ut, struct mmsghdr* msgvec, unsigned int vlen, int flags,
+                  struct timespec* timeout) {
+  struct mudp_impl* s = ut;
+  struct mtl_main_impl* impl = s->parent;
+  int idx = s->idx;
+  int ret;
+
+#ifndef WINDOWSENV
+  if (udp_is_fallback(s)) return recvmmsg(s->fallback_fd, msgvec, vlen, flags, timeout);
+#endif
+
+  if (!msgvec || !vlen) {
+    err("%s(%d), invalid msgvec %p vlen %u\n", __func__, idx, msgvec, vlen);
+    MUDP_ERR_RET(EINVAL);
+  }
+
+  /* init rxq if not */
+  if (!s->rxq) {
+    ret = udp_init_rxq(impl, s);
+    if (ret < 0) {
+      err("%s(%d), init rxq fail\n", __func__, idx);
+      return ret;
+    }
+  }
+
+  return udp_recvmmsg(s, msgvec, vlen, flags, timeout);
+}
+
+int mudp_recv_zc(mudp_handle ut, struct mudp_zc_buf* bufs, unsigned int nb, int flags) {
+  struct mudp_impl* s = ut;
+  struct mtl_main_impl* impl = s->parent;
+  int idx = s->idx;
+  int ret;
+
+  if (udp_is_fallback(s)) {
+    err("%s(%d), not support for fallback path\n", __func__, idx);
+    MUDP_ERR_RET(ENOTSUP);
+  }
+
+  if (!bufs || !nb) {
+    err("%s(%d), invalid bufs %p nb %u\n", __func__, idx, bufs, nb);
+    MUDP_ERR_RET(EINVAL);
+  }
+
+  /* init rxq if not */
+  if (!s->rxq) {
+    ret = udp_init_rxq(impl, s);
+    if (ret < 0) {
+      err("%s(%d), init rxq fail\n", __func__, idx);
+      return ret;
+    }
+  }
+
+  return udp_recv_zc(s, bufs, nb, flags);
+}
+
+int mudp_release_zc(mudp_handle ut, struct mudp_zc_buf* bufs, unsigned int nb) {
+  struct mudp_impl* s = ut;
+  struct rte_mbuf* pkts[MUDP_MMSG_BURST_SIZE];
+  unsigned int pkts_nb = 0;
+
+  for (unsigned int i = 0; i < nb; i++) {
+    if (!bufs[i].token) continue;
+    pkts[pkts_nb++] = bufs[i].token;
+    bufs[i].token = NULL;
+    bufs[i].payload = NULL;
+    if (pkts_nb >= MUDP_MMSG_BURST_SIZE) {
+      rte_pktmbuf_free_bulk(pkts, pkts_nb);
+      rte_atomic32_sub(&s->stat_rx_zc_outstanding, pkts_nb);
+      rte_atomic32_add(&s->stat_rx_zc_release, pkts_nb);
+      pkts_nb = 0;
+    }
+  }
+  if (pkts_nb) {
+    rte_pktmbuf_free_bulk(pkts, pkts_nb);
+    rte_atomic32_sub(&s->stat_rx_zc_outstanding, pkts_nb);
+    rte_atomic32_add(&s->stat_rx_zc_release, pkts_nb);
+  }
+
+  return 0;
+}
+
 int mudp_getsockopt(mudp_handle ut, int level, int optname, void* optval,
                     socklen_t* optlen) {
   struct mudp_impl* s = ut;
@@ -1655,6 +2297,15 @@ int mudp_setsockopt(mudp_handle ut, int level, int optname, const void* optval,
           MUDP_ERR_RET(EINVAL);
       }
     }
+    case SOL_UDP: {
+      switch (optname) {
+        case UDP_SEGMENT:
+          return udp_set_gso_segment(s, optval, optlen);
+        default:
+          err("%s(%d), unknown optname %d for SOL_UDP\n", __func__, idx, optname);
+          MUDP_ERR_RET(EINVAL);
+      }
+    }
     case IPPROTO_IP: {
       switch (optname) {
         case IP_ADD_MEMBERSHIP:
@@ -1720,6 +2371,7 @@ int mudp_set_tx_mac(mudp_handle ut, uint8_t mac[MTL_MAC_ADDR_LEN]) {
 
   rte_memcpy(s->user_mac, mac, MTL_MAC_ADDR_LEN);
   udp_set_flag(s, MUDP_TX_USER_MAC);
+  udp_dst_cache_flush(s);
   info("%s(%d), mac: %02hhx:%02hhx:%02hhx:%02hhx:%02hhx:%02hhx\n", __func__, idx, mac[0],
        mac[1], mac[2], mac[3], mac[4], mac[5]);
   return 0;
@@ -1919,6 +2571,47 @@ int mudp_set_rx_poll_sleep(mudp_handle ut, unsigned int us) {
   return 0;
 }
 
+int mudp_get_event_fd(mudp_handle ut) {
+  struct mudp_impl* s = ut;
+  struct mtl_main_impl* impl = s->parent;
+  int idx = s->idx;
+  int ret;
+
+  if (s->type != MT_HANDLE_UDP) {
+    err("%s(%d), invalid type %d\n", __func__, idx, s->type);
+    MUDP_ERR_RET(EIO);
+  }
+  if (udp_is_fallback(s)) {
+    dbg("%s(%d), it's backed by a fallback fd\n", __func__, idx);
+    MUDP_ERR_RET(ENOTSUP);
+  }
+
+  if (!s->rxq) {
+    ret = udp_init_rxq(impl, s);
+    if (ret < 0) {
+      err("%s(%d), init rxq fail\n", __func__, idx);
+      return ret;
+    }
+  }
+
+  int fd = mur_client_event_fd(s->rxq);
+  if (fd < 0) MUDP_ERR_RET(ENOTSUP); /* only for lcore mode */
+  return fd;
+}
+
+int mudp_rx_ready_arm(mudp_handle ut) {
+  struct mudp_impl* s = ut;
+
+  if (!s->rxq) {
+    err("%s(%d), rxq not init\n", __func__, s->idx);
+    MUDP_ERR_RET(EIO);
+  }
+
+  unsigned int count = rte_ring_count(mur_client_ring(s->rxq));
+  if (count) return count;
+  return mur_client_event_arm(s->rxq);
+}
+
 int mudp_get_sip(mudp_handle ut, uint8_t ip[MTL_IP_ADDR_LEN]) {
   struct mudp_impl* s = ut;
   int idx = s->idx;
@@ -38,6 +38,39 @@
 
 #define MUDP_PREFIX "MU_"
 
+/* max pkts for one bulk dequeue/enqueue of the mmsg api */
+#define MUDP_MMSG_BURST_SIZE (64)
+
+/*
+ * The big payload buffer for the gso pkts by mbuf chain, fit in uint16_t buf_len.
+ * The pool takes about 4MB(63 * 63KB) for each socket which sends with gso, and the
+ * indirect mbufs of the segments take about 1MB more.
+ */
+#define MUDP_GSO_BUF_SIZE (63 * 1024)
+#define MUDP_GSO_POOL_NB (63)
+/* max segments of one gso send by mbuf chain, same as UDP_MAX_SEGMENTS of kernel */
+#define MUDP_GSO_SEGS_MAX (64)
+
+/* the number of dst entries in the tx hdr cache */
+#define MUDP_DST_CACHE_NB (8)
+/* rebuild the cached hdr after this time to follow the mac change from kernel arp */
+#define MUDP_DST_CACHE_EXPIRE_NS (1ul * NS_PER_S)
+
+/* max time of one kernel wait on the rx event fd, to check the abort status */
+#define MUDP_POLL_EVENT_WAIT_MAX_US (100 * 1000)
+
+/* prebuilt eth/ip/udp hdr for one tx destination */
+struct mudp_dst_cache {
+  bool valid;
+  uint32_t dip;     /* network order */
+  uint16_t dport;   /* network order */
+  uint32_t arp_gen; /* the arp generation when built */
+  uint64_t build_tsc;
+  struct mt_udp_hdr hdr;
+  /* raw sum of the ipv4 hdr with zero total_length and cksum */
+  uint32_t ipv4_raw_cksum;
+};
+
 struct mudp_impl {
   struct mtl_main_impl* parent;
   enum mt_handle_type type;
@@ -49,6 +82,9 @@ struct mudp_impl {
   enum mtl_port port;
   struct mt_udp_hdr hdr;
   uint16_t bind_port;
+  /* tx hdr cache per destination */
+  struct mudp_dst_cache dst_cache[MUDP_DST_CACHE_NB];
+  int dst_cache_next;
 
   int fallback_fd; /* for MTL_PMD_KERNEL_SOCKET */
 
@@ -59,6 +95,12 @@ struct mudp_impl {
   unsigned int rx_poll_sleep_us;
   struct rte_mempool* tx_pool;
   bool tx_pool_by_queue;
+  /* the big payload buffers for gso by mbuf chain, created on the first gso send */
+  struct rte_mempool* gso_pool;
+  /* the indirect mbufs of the gso segments, not taken from the tx_pool */
+  struct rte_mempool* gso_seg_pool;
+  /* no retry if no multi seg support or the create fails */
+  bool gso_pool_tried;
   uint16_t element_size;
   unsigned int element_nb;
 
@@ -99,7 +141,11 @@ struct mudp_impl {
   uint32_t stat_pkt_arp_fail;
   uint32_t stat_pkt_tx;
   uint32_t stat_tx_gso_count;
+  uint32_t stat_tx_gso_chain;
   uint32_t stat_tx_retry;
+  uint32_t stat_dst_cache_miss;
+  uint32_t stat_tx_mmsg_cnt;
+  uint32_t stat_tx_mmsg_msgs;
 
   uint32_t stat_pkt_dequeue;
   uint32_t stat_pkt_deliver;
@@ -108,10 +154,19 @@ struct mudp_impl {
   uint32_t stat_poll_timeout_cnt;
   uint32_t stat_poll_zero_timeout_cnt;
   uint32_t stat_poll_query_ret_cnt;
+  uint32_t stat_poll_event_wait_cnt;
   uint32_t stat_rx_msg_cnt;
   uint32_t stat_rx_msg_succ_cnt;
   uint32_t stat_rx_msg_timeout_cnt;
   uint32_t stat_rx_msg_again_cnt;
+  uint32_t stat_rx_mmsg_cnt;
+  uint32_t stat_rx_mmsg_succ_cnt;
+  uint32_t stat_rx_mmsg_pkts;
+  uint32_t stat_rx_zc_lent;
+  /* the release may happen on another thread than the rx and the stat dump */
+  rte_atomic32_t stat_rx_zc_release;
+  /* lent zero-copy buffers not released yet, release may happen on another thread */
+  rte_atomic32_t stat_rx_zc_outstanding;
 };
 
 int mudp_verify_socket_args(int domain, int type, int protocol);
@@ -119,4 +174,13 @@ int mudp_verify_socket_args(int domain, int type, int protocol);
 int mudp_poll_query(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout,
                     int (*query)(void* priv), void* priv);
 
+/* the rx event fd of the socket, lcore mode only */
+int mudp_get_event_fd(mudp_handle ut);
+/* return the pending pkts count, arm the rx event fd if no pending pkt */
+int mudp_rx_ready_arm(mudp_handle ut);
+
+/* wait_fd: kernel fd which is readable when the query has event, -1 if not used */
+int mudp_poll_query_fd(struct mudp_pollfd* fds, mudp_nfds_t nfds, int timeout,
+                       int (*query)(void* priv), void* priv, int wait_fd);
+
 #endif
@@ -33,6 +33,23 @@ static inline void urq_unlock(struct mur_queue* q) {
   mt_pthread_mutex_unlock(&q->mutex);
 }
 
+static void urc_event_notify(struct mur_client* c) {
+  if (c->event_fd < 0) return;
+
+  /* only signal the waiter who armed, edge triggered */
+  rte_smp_mb();
+  if (!rte_atomic32_read(&c->event_armed)) return;
+  if (!mt_atomic32_read_clear(&c->event_armed)) return;
+
+#ifndef WINDOWSENV
+  uint64_t v = 1;
+  if (write(c->event_fd, &v, sizeof(v)) < 0) {
+    dbg("%s(%d), write event fd fail %s\n", __func__, c->idx, strerror(errno));
+  }
+  c->stat_event_notify++;
+#endif
+}
+
 static uint16_t urq_rx_handle(struct mur_queue* q, struct rte_mbuf** pkts,
                               uint16_t nb_pkts) {
   uint16_t idx = q->rxq_id;
@@ -74,6 +91,8 @@ static uint16_t urq_rx_handle(struct mur_queue* q, struct rte_mbuf** pkts,
       dbg("%s(%d), %u pkts enqueue fail\n", __func__, idx, valid_mbuf_cnt);
       rte_pktmbuf_free_bulk(&valid_mbuf[0], valid_mbuf_cnt);
       c->stat_pkt_rx_enq_fail += valid_mbuf_cnt;
+    } else {
+      urc_event_notify(c);
     }
 
     return n;
@@ -108,6 +127,8 @@ static uint16_t urq_rx_handle(struct mur_queue* q, struct rte_mbuf** pkts,
         if (0 == e) { /* enqueue fail */
           rte_pktmbuf_free_bulk(c_pkts, c_pkts_nb);
           c->stat_pkt_rx_enq_fail += c_pkts_nb;
+        } else {
+          urc_event_notify(c);
         }
       }
       last_c_idx = c_idx;
@@ -123,6 +144,8 @@ static uint16_t urq_rx_handle(struct mur_queue* q, struct rte_mbuf** pkts,
     if (0 == e) { /* enqueue fail */
       rte_pktmbuf_free_bulk(c_pkts, c_pkts_nb);
       c->stat_pkt_rx_enq_fail += c_pkts_nb;
+    } else {
+      urc_event_notify(c);
     }
   }
 
@@ -379,6 +402,15 @@ static int urc_init_tasklet(struct mtl_main_impl* impl, struct mur_client* c) {
     err("%s, register lcore tasklet fail\n", __func__);
     MUDP_ERR_RET(EIO);
   }
+
+#ifndef WINDOWSENV
+  /* the event fd let the waiter block in kernel until the tasklet has data */
+  c->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (c->event_fd < 0) {
+    warn("%s(%d), eventfd create fail %s, fallback to cond wait\n", __func__, c->idx,
+         strerror(errno));
+  }
+#endif
   /* start mtl to start the sch */
   mtl_start(impl);
   return 0;
@@ -410,6 +442,7 @@ struct mur_client* mur_client_get(struct mur_client_create* create) {
   c->parent = impl;
   c->port = port;
   c->dst_port = dst_port;
+  c->event_fd = -1;
 
   /* lcore related */
   mt_pthread_mutex_init(&c->lcore_wake_mutex, NULL);
@@ -454,6 +487,8 @@ struct mur_client* mur_client_get(struct mur_client_create* create) {
 
 int mur_client_put(struct mur_client* c) {
   urc_lcore_wakeup(c); /* wake up any pending wait */
+  rte_atomic32_set(&c->event_armed, 1);
+  urc_event_notify(c);
 
   if (c->lcore_tasklet) {
     mtl_sch_unregister_tasklet(c->lcore_tasklet);
@@ -470,6 +505,11 @@ int mur_client_put(struct mur_client* c) {
     c->ring = NULL;
   }
 
+  if (c->event_fd >= 0) {
+    close(c->event_fd);
+    c->event_fd = -1;
+  }
+
   /* lcore related */
   mt_pthread_mutex_destroy(&c->lcore_wake_mutex);
   mt_pthread_cond_destroy(&c->lcore_wake_cond);
@@ -499,6 +539,12 @@ int mur_client_dump(struct mur_client* c) {
     c->stat_timedwait = 0;
     c->stat_timedwait_timeout = 0;
   }
+  if (c->stat_event_arm) {
+    notice("%s(%d,%u,%d), event arm %u notify %u\n", __func__, port, dst_port, idx,
+           c->stat_event_arm, c->stat_event_notify);
+    c->stat_event_arm = 0;
+    c->stat_event_notify = 0;
+  }
 
   return 0;
 }
@@ -533,6 +579,28 @@ int mur_client_timedwait(struct mur_client* c, unsigned int timedwait_us,
   return ret;
 }
 
+unsigned int mur_client_event_arm(struct mur_client* c) {
+  if (c->event_fd < 0) return rte_ring_count(c->ring);
+
+#ifndef WINDOWSENV
+  /*
+   * drain the last notify before arm again, unconditionally since a notify can land
+   * anytime around a previous arm. The fd is EFD_NONBLOCK, EAGAIN means nothing to
+   * drain, and a notify racing with this arm is caught by the ring check below.
+   */
+  uint64_t v;
+  if (read(c->event_fd, &v, sizeof(v)) < 0 && errno != EAGAIN) {
+    dbg("%s(%d), read event fd fail %s\n", __func__, c->idx, strerror(errno));
+  }
+#endif
+
+  c->stat_event_arm++;
+  rte_atomic32_set(&c->event_armed, 1);
+  rte_smp_mb();
+  /* recheck after armed, the caller should not block if any pkt already arrived */
+  return rte_ring_count(c->ring);
+}
+
 int mudp_rxq_init(struct mtl_main_impl* impl) {
   int num_ports = mt_num_ports(impl);
   int socket = mt_socket_id(impl, MTL_PORT_P);
@@ -33,11 +33,16 @@ struct mur_client {
   /* wakeup when timeout with last wakeup */
   unsigned int wake_timeout_us;
   uint64_t wake_tsc_last;
+  /* eventfd for kernel blocking wait, lcore mode only, -1 if not available */
+  int event_fd;
+  rte_atomic32_t event_armed; /* set by the waiter before it sleep on event_fd */
 
   uint32_t stat_timedwait;
   uint32_t stat_timedwait_timeout;
   uint32_t stat_pkt_rx;
   uint32_t stat_pkt_rx_enq_fail;
+  uint32_t stat_event_notify;
+  uint32_t stat_event_arm;
 
   /* linked list for reuse port */
   MT_TAILQ_ENTRY(mur_client) next;
@@ -94,6 +99,12 @@ int mur_client_dump(struct mur_client* q);
 int mur_client_timedwait(struct mur_client* cq, unsigned int timedwait_us,
                          unsigned int poll_sleep_us);
 
+unsigned int mur_client_event_arm(struct mur_client* c);
+
+static inline int mur_client_event_fd(struct mur_client* c) {
+  return c->event_fd;
+}
+
 static inline struct rte_ring* mur_client_ring(struct mur_client* c) {
   return c->ring;
 }
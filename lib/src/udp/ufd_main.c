@@ -50,7 +50,11 @@ static int ufd_free_slot(struct ufd_mt_ctx* ctx, struct ufd_slot* slot) {
   }
 
   if (slot->handle) {
-    mudp_close(slot->handle);
+    int ret = mudp_close(slot->handle);
+    if (ret < 0) {
+      err("%s(%d), close fail %d\n", __func__, idx, ret);
+      return ret;
+    }
     slot->handle = NULL;
   }
   mt_rte_free(slot);
@@ -608,8 +612,7 @@ int mufd_close(int sockfd) {
     MUDP_ERR_RET(EIO);
   }
 
-  ufd_free_slot(ctx, slot);
-  return 0;
+  return ufd_free_slot(ctx, slot);
 }
 
 int mufd_bind(int sockfd, const struct sockaddr* addr, socklen_t addrlen) {
@@ -628,8 +631,13 @@ ssize_t mufd_sendmsg(int sockfd, const struct msghdr* msg, int flags) {
   return mudp_sendmsg(slot->handle, msg, flags);
 }
 
-int mufd_poll_query(struct pollfd* fds, nfds_t nfds, int timeout,
-                    int (*query)(void* priv), void* priv) {
+int mufd_sendmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags) {
+  struct ufd_slot* slot = ufd_fd2slot(sockfd);
+  return mudp_sendmmsg(slot->handle, msgvec, vlen, flags);
+}
+
+int mufd_poll_query_fd(struct pollfd* fds, nfds_t nfds, int timeout,
+                       int (*query)(void* priv), void* priv, int wait_fd) {
   struct mudp_pollfd mfds[nfds];
   struct ufd_slot* slot;
 
@@ -640,13 +648,18 @@ int mufd_poll_query(struct pollfd* fds, nfds_t nfds, int timeout,
     mfds[i].events = fds[i].events;
   }
 
-  int ret = mudp_poll_query(mfds, nfds, timeout, query, priv);
+  int ret = mudp_poll_query_fd(mfds, nfds, timeout, query, priv, wait_fd);
   for (nfds_t i = 0; i < nfds; i++) {
     fds[i].revents = mfds[i].revents;
   }
   return ret;
 }
 
+int mufd_poll_query(struct pollfd* fds, nfds_t nfds, int timeout,
+                    int (*query)(void* priv), void* priv) {
+  return mufd_poll_query_fd(fds, nfds, timeout, query, priv, -1);
+}
+
 int mufd_poll(struct pollfd* fds, nfds_t nfds, int timeout) {
   return mufd_poll_query(fds, nfds, timeout, NULL, NULL);
 }
@@ -662,6 +675,22 @@ ssize_t mufd_recvmsg(int sockfd, struct msghdr* msg, int flags) {
   return mudp_recvmsg(slot->handle, msg, flags);
 }
 
+int mufd_recvmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags,
+                  struct timespec* timeout) {
+  struct ufd_slot* slot = ufd_fd2slot(sockfd);
+  return mudp_recvmmsg(slot->handle, msgvec, vlen, flags, timeout);
+}
+
+int mufd_recv_zc(int sockfd, struct mudp_zc_buf* bufs, unsigned int nb, int flags) {
+  struct ufd_slot* slot = ufd_fd2slot(sockfd);
+  return mudp_recv_zc(slot->handle, bufs, nb, flags);
+}
+
+int mufd_release_zc(int sockfd, struct mudp_zc_buf* bufs, unsigned int nb) {
+  struct ufd_slot* slot = ufd_fd2slot(sockfd);
+  return mudp_release_zc(slot->handle, bufs, nb);
+}
+
 int mufd_getsockopt(int sockfd, int level, int optname, void* optval, socklen_t* optlen) {
   struct ufd_slot* slot = ufd_fd2slot(sockfd);
   return mudp_getsockopt(slot->handle, level, optname, optval, optlen);
@@ -868,6 +897,16 @@ void* mufd_get_opaque(int sockfd) {
   return slot->opaque;
 }
 
+int mufd_get_event_fd(int sockfd) {
+  struct ufd_slot* slot = ufd_fd2slot(sockfd);
+  return mudp_get_event_fd(slot->handle);
+}
+
+int mufd_rx_ready_arm(int sockfd) {
+  struct ufd_slot* slot = ufd_fd2slot(sockfd);
+  return mudp_rx_ready_arm(slot->handle);
+}
+
 int mufd_get_sip(int sockfd, uint8_t ip[MTL_IP_ADDR_LEN]) {
   struct ufd_slot* slot = ufd_fd2slot(sockfd);
   return mudp_get_sip(slot->handle, ip);
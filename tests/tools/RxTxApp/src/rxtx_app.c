@@ -49,6 +49,12 @@ static int app_dump_io_stat(struct st_app_context* ctx) {
     tx_rate_m = (double)stats.tx_bytes * 8 / time_sec / MTL_STAT_M_UNIT;
     rx_rate_m = (double)stats.rx_bytes * 8 / time_sec / MTL_STAT_M_UNIT;
     info("%s(%u), tx %f Mb/s rx %f Mb/s\n", __func__, port, tx_rate_m, rx_rate_m);
+    if (stats.tx_batches || stats.rx_batches) {
+      info("%s(%u), tx %" PRIu64 " pkts in %" PRIu64 " batches, rx %" PRIu64
+           " pkts in %" PRIu64 " batches\n",
+           __func__, port, stats.tx_packets, stats.tx_batches, stats.rx_packets,
+           stats.rx_batches);
+    }
     if (stats.rx_hw_dropped_packets || stats.rx_err_packets || stats.rx_nombuf_packets ||
         stats.tx_err_packets) {
       warn("%s(%u), hw drop %" PRIu64 " rx err %" PRIu64 " no mbuf %" PRIu64
@@ -58,6 +58,22 @@ TEST(Cvt, rfc4175_422be10_to_yuv422p10le_scalar) {
                                           MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_422be10_to_yuv422p10le_avx2) {
+  test_cvt_rfc4175_422be10_to_yuv422p10le(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_yuv422p10le(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_yuv422p10le(722, 111, MTL_SIMD_LEVEL_NONE,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_yuv422p10le(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_422be10_to_yuv422p10le(w, h, MTL_SIMD_LEVEL_AVX2,
+                                            MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
 TEST(Cvt, rfc4175_422be10_to_yuv422p10le_avx512) {
   test_cvt_rfc4175_422be10_to_yuv422p10le(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                           MTL_SIMD_LEVEL_AVX512);
@@ -248,6 +264,22 @@ TEST(Cvt, yuv422p10le_to_rfc4175_422be10_scalar) {
                                           MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, yuv422p10le_to_rfc4175_422be10_avx2) {
+  test_cvt_yuv422p10le_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_yuv422p10le_to_rfc4175_422be10(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_yuv422p10le_to_rfc4175_422be10(722, 111, MTL_SIMD_LEVEL_NONE,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_yuv422p10le_to_rfc4175_422be10(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_yuv422p10le_to_rfc4175_422be10(w, h, MTL_SIMD_LEVEL_AVX2,
+                                            MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
 TEST(Cvt, yuv422p10le_to_rfc4175_422be10_avx512) {
   test_cvt_yuv422p10le_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                           MTL_SIMD_LEVEL_AVX512);
@@ -979,6 +1011,18 @@ TEST(Cvt, rfc4175_422be10_to_422le8_scalar) {
                                      MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_422be10_to_422le8_avx2) {
+  test_cvt_rfc4175_422be10_to_422le8(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                     MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_422le8(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_422le8(722, 111, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_422le8(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_422be10_to_422le8(w, h, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
 TEST(Cvt, rfc4175_422be10_to_422le8_avx512) {
   test_cvt_rfc4175_422be10_to_422le8(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                      MTL_SIMD_LEVEL_AVX512);
@@ -1208,7 +1252,8 @@ TEST(Cvt, rfc4175_422be10_to_yuv422p8_avx512_vbmi) {
   }
 }
 
-static void test_cvt_rfc4175_422be10_to_yuv420p8(int w, int h) {
+static void test_cvt_rfc4175_422be10_to_yuv420p8(int w, int h,
+                                                 enum mtl_simd_level cvt_level) {
   int ret;
   size_t fb_pg2_size_10 = (size_t)w * h * 5 / 2;
   size_t fb_yuv420p8_size = (size_t)w * h * 3 / 2;
@@ -1229,8 +1274,8 @@ static void test_cvt_rfc4175_422be10_to_yuv420p8(int w, int h) {
   ret = st20_rfc4175_422be10_to_yuv420p8_simd(pg_10, p8, p8 + w * h, p8 + w * h * 5 / 4,
                                               w, h, MTL_SIMD_LEVEL_NONE);
   EXPECT_EQ(0, ret);
-  ret = st20_rfc4175_422be10_to_yuv420p8_simd(
-      pg_10, p8_2, p8_2 + w * h, p8_2 + w * h * 5 / 4, w, h, MTL_SIMD_LEVEL_AVX512);
+  ret = st20_rfc4175_422be10_to_yuv420p8_simd(pg_10, p8_2, p8_2 + w * h,
+                                              p8_2 + w * h * 5 / 4, w, h, cvt_level);
   EXPECT_EQ(0, ret);
 
   EXPECT_EQ(0, memcmp(p8, p8_2, fb_yuv420p8_size));
@@ -1241,7 +1286,16 @@ static void test_cvt_rfc4175_422be10_to_yuv420p8(int w, int h) {
 }
 
 TEST(Cvt, rfc4175_422be10_to_yuv420p8) {
-  test_cvt_rfc4175_422be10_to_yuv420p8(1920, 1080);
+  test_cvt_rfc4175_422be10_to_yuv420p8(1920, 1080, MTL_SIMD_LEVEL_AVX512);
+}
+
+TEST(Cvt, rfc4175_422be10_to_yuv420p8_avx2) {
+  test_cvt_rfc4175_422be10_to_yuv420p8(1920, 1080, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_yuv420p8(722, 112, MTL_SIMD_LEVEL_AVX2);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h += 2) {
+    test_cvt_rfc4175_422be10_to_yuv420p8(w, h, MTL_SIMD_LEVEL_AVX2);
+  }
 }
 
 static void test_cvt_rfc4175_422le10_to_v210(int w, int h, enum mtl_simd_level cvt_level,
@@ -1295,6 +1349,15 @@ TEST(Cvt, rfc4175_422le10_to_v210_scalar) {
   test_cvt_rfc4175_422le10_to_v210(1920, 1080, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_422le10_to_v210_avx2) {
+  test_cvt_rfc4175_422le10_to_v210(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422le10_to_v210(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422le10_to_v210(1920, 1080, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422le10_to_v210(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_NONE);
+  test_cvt_rfc4175_422le10_to_v210(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422le10_to_v210(1921, 1079, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+}
+
 TEST(Cvt, rfc4175_422le10_to_v210_avx512) {
   test_cvt_rfc4175_422le10_to_v210(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                    MTL_SIMD_LEVEL_AVX512);
@@ -1382,6 +1445,15 @@ TEST(Cvt, rfc4175_422be10_to_v210_scalar) {
   test_cvt_rfc4175_422be10_to_v210(1920, 1080, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_422be10_to_v210_avx2) {
+  test_cvt_rfc4175_422be10_to_v210(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_v210(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_v210(1920, 1080, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_v210(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_NONE);
+  test_cvt_rfc4175_422be10_to_v210(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_v210(1921, 1079, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+}
+
 TEST(Cvt, rfc4175_422be10_to_v210_avx512) {
   test_cvt_rfc4175_422be10_to_v210(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                    MTL_SIMD_LEVEL_AVX512);
@@ -1585,6 +1657,15 @@ TEST(Cvt, v210_to_rfc4175_422be10_scalar) {
   test_cvt_v210_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, v210_to_rfc4175_422be10_avx2) {
+  test_cvt_v210_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_v210_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_v210_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_v210_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_NONE);
+  test_cvt_v210_to_rfc4175_422be10(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_v210_to_rfc4175_422be10(1921, 1079, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+}
+
 TEST(Cvt, v210_to_rfc4175_422be10_avx512) {
   test_cvt_v210_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                    MTL_SIMD_LEVEL_AVX512);
@@ -1668,6 +1749,20 @@ TEST(Cvt, v210_to_rfc4175_422be10_2_scalar) {
                                      MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, v210_to_rfc4175_422be10_2_avx2) {
+  test_cvt_v210_to_rfc4175_422be10_2(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                     MTL_SIMD_LEVEL_AVX2);
+  test_cvt_v210_to_rfc4175_422be10_2(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                     MTL_SIMD_LEVEL_AVX2);
+  test_cvt_v210_to_rfc4175_422be10_2(1920, 1080, MTL_SIMD_LEVEL_NONE,
+                                     MTL_SIMD_LEVEL_AVX2);
+  test_cvt_v210_to_rfc4175_422be10_2(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                     MTL_SIMD_LEVEL_NONE);
+  test_cvt_v210_to_rfc4175_422be10_2(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_v210_to_rfc4175_422be10_2(1921, 1079, MTL_SIMD_LEVEL_AVX2,
+                                     MTL_SIMD_LEVEL_AVX2);
+}
+
 TEST(Cvt, v210_to_rfc4175_422be10_2_avx512) {
   test_cvt_v210_to_rfc4175_422be10_2(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                      MTL_SIMD_LEVEL_AVX512);
@@ -1856,6 +1951,17 @@ TEST(Cvt, rfc4175_422be10_to_y210_scalar) {
   test_cvt_rfc4175_422be10_to_y210(1920, 1080, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_422be10_to_y210_avx2) {
+  test_cvt_rfc4175_422be10_to_y210(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_y210(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_y210(722, 111, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be10_to_y210(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_422be10_to_y210(w, h, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
 TEST(Cvt, rfc4175_422be10_to_y210_avx512) {
   test_cvt_rfc4175_422be10_to_y210(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                    MTL_SIMD_LEVEL_AVX512);
@@ -1996,6 +2102,17 @@ TEST(Cvt, y210_to_rfc4175_422be10_scalar) {
   test_cvt_y210_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, y210_to_rfc4175_422be10_avx2) {
+  test_cvt_y210_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_y210_to_rfc4175_422be10(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_y210_to_rfc4175_422be10(722, 111, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_y210_to_rfc4175_422be10(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_y210_to_rfc4175_422be10(w, h, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
 TEST(Cvt, y210_to_rfc4175_422be10_avx512) {
   test_cvt_y210_to_rfc4175_422be10(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                    MTL_SIMD_LEVEL_AVX512);
@@ -2279,6 +2396,22 @@ TEST(Cvt, rfc4175_422be12_to_yuv422p12le_scalar) {
                                           MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_422be12_to_yuv422p12le_avx2) {
+  test_cvt_rfc4175_422be12_to_yuv422p12le(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be12_to_yuv422p12le(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be12_to_yuv422p12le(722, 111, MTL_SIMD_LEVEL_NONE,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be12_to_yuv422p12le(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_422be12_to_yuv422p12le(w, h, MTL_SIMD_LEVEL_AVX2,
+                                            MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
 TEST(Cvt, rfc4175_422be12_to_yuv422p12le_avx512) {
   test_cvt_rfc4175_422be12_to_yuv422p12le(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                           MTL_SIMD_LEVEL_AVX512);
@@ -2446,6 +2579,22 @@ TEST(Cvt, yuv422p12le_to_rfc4175_422be12_scalar) {
                                           MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, yuv422p12le_to_rfc4175_422be12_avx2) {
+  test_cvt_yuv422p12le_to_rfc4175_422be12(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_yuv422p12le_to_rfc4175_422be12(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_yuv422p12le_to_rfc4175_422be12(722, 111, MTL_SIMD_LEVEL_NONE,
+                                          MTL_SIMD_LEVEL_AVX2);
+  test_cvt_yuv422p12le_to_rfc4175_422be12(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                          MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_yuv422p12le_to_rfc4175_422be12(w, h, MTL_SIMD_LEVEL_AVX2,
+                                            MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
 static void test_cvt_rfc4175_422le12_to_yuv422p12le(int w, int h,
                                                     enum mtl_simd_level cvt_level,
                                                     enum mtl_simd_level back_level) {
@@ -2585,6 +2734,18 @@ TEST(Cvt, rfc4175_422be12_to_422le12_scalar) {
                                       MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_422be12_to_422le12_avx2) {
+  test_cvt_rfc4175_422be12_to_422le12(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                      MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be12_to_422le12(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be12_to_422le12(722, 111, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422be12_to_422le12(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_422be12_to_422le12(w, h, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
 TEST(Cvt, rfc4175_422be12_to_422le12_avx512) {
   test_cvt_rfc4175_422be12_to_422le12(1920, 1080, MTL_SIMD_LEVEL_AVX512,
                                       MTL_SIMD_LEVEL_AVX512);
@@ -2768,6 +2929,20 @@ TEST(Cvt, rfc4175_422le12_to_422be12_scalar) {
                                       MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_422le12_to_422be12_avx2) {
+  test_cvt_rfc4175_422le12_to_422be12(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                      MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422le12_to_422be12(722, 111, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422le12_to_422be12_2(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                        MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_422le12_to_422be12_2(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                        MTL_SIMD_LEVEL_AVX2);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_422le12_to_422be12(w, h, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
 static void test_rotate_rfc4175_422be12_422le12_yuv422p12le(
     int w, int h, enum mtl_simd_level cvt1_level, enum mtl_simd_level cvt2_level,
     enum mtl_simd_level cvt3_level) {
@@ -2913,6 +3088,139 @@ TEST(Cvt, rfc4175_444be10_to_444p10le_scalar) {
                                        MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_444be10_to_444p10le_avx2) {
+  test_cvt_rfc4175_444be10_to_444p10le(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be10_to_444p10le(722, 112, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be10_to_444p10le(722, 112, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be10_to_444p10le(722, 112, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 4; /* each pg has four pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_444be10_to_444p10le(w, h, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
+TEST(Cvt, rfc4175_444be10_to_444p10le_avx512) {
+  test_cvt_rfc4175_444be10_to_444p10le(1920, 1080, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_rfc4175_444be10_to_444p10le(722, 112, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_rfc4175_444be10_to_444p10le(722, 112, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_rfc4175_444be10_to_444p10le(722, 112, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 4; /* each pg has four pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_444be10_to_444p10le(w, h, MTL_SIMD_LEVEL_AVX512,
+                                         MTL_SIMD_LEVEL_AVX512);
+  }
+}
+
+TEST(Cvt, rfc4175_444be10_to_444p10le_avx512_vbmi) {
+  test_cvt_rfc4175_444be10_to_444p10le(1920, 1080, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                       MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be10_to_444p10le(722, 112, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                       MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be10_to_444p10le(722, 112, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be10_to_444p10le(722, 112, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 4; /* each pg has four pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_444be10_to_444p10le(w, h, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                         MTL_SIMD_LEVEL_AVX512_VBMI2);
+  }
+}
+
+static void test_cvt_rfc4175_444be10_to_444p10le_dma(mtl_udma_handle dma, int w, int h,
+                                                     enum mtl_simd_level cvt_level,
+                                                     enum mtl_simd_level back_level) {
+  int ret;
+  size_t fb_pg_size = (size_t)w * h * 15 / 4;
+  struct st_tests_context* ctx = st_test_ctx();
+  mtl_handle st = ctx->handle;
+  struct st20_rfc4175_444_10_pg4_be* pg =
+      (struct st20_rfc4175_444_10_pg4_be*)mtl_hp_zmalloc(st, fb_pg_size, MTL_PORT_P);
+  struct st20_rfc4175_444_10_pg4_be* pg_2 =
+      (struct st20_rfc4175_444_10_pg4_be*)st_test_zmalloc(fb_pg_size);
+  size_t planar_size = (size_t)w * h * 3 * sizeof(uint16_t);
+  uint16_t* p_u16 = (uint16_t*)st_test_zmalloc(planar_size);
+
+  if (!pg || !pg_2 || !p_u16) {
+    EXPECT_EQ(0, 1);
+    if (pg) mtl_hp_free(st, pg);
+    if (pg_2) st_test_free(pg_2);
+    if (p_u16) st_test_free(p_u16);
+    return;
+  }
+
+  st_test_rand_data((uint8_t*)pg, fb_pg_size, 0);
+
+  ret = st20_rfc4175_444be10_to_444p10le_simd_dma(
+      dma, pg, mtl_hp_virt2iova(st, pg), p_u16, (p_u16 + w * h), (p_u16 + w * h * 2), w,
+      h, cvt_level);
+  EXPECT_EQ(0, ret);
+
+  ret = st20_444p10le_to_rfc4175_444be10_simd(p_u16, (p_u16 + w * h), (p_u16 + w * h * 2),
+                                              pg_2, w, h, back_level);
+  EXPECT_EQ(0, ret);
+
+  EXPECT_EQ(0, memcmp(pg, pg_2, fb_pg_size));
+
+  mtl_hp_free(st, pg);
+  st_test_free(pg_2);
+  st_test_free(p_u16);
+}
+
+TEST(Cvt, rfc4175_444be10_to_444p10le_dma) {
+  struct st_tests_context* ctx = st_test_ctx();
+  mtl_handle handle = ctx->handle;
+  mtl_udma_handle dma = mtl_udma_create(handle, 128, MTL_PORT_P);
+  if (!dma) return;
+
+  test_cvt_rfc4175_444be10_to_444p10le_dma(dma, 1920, 1080, MTL_SIMD_LEVEL_MAX,
+                                           MTL_SIMD_LEVEL_MAX);
+  test_cvt_rfc4175_444be10_to_444p10le_dma(dma, 3840, 2160, MTL_SIMD_LEVEL_MAX,
+                                           MTL_SIMD_LEVEL_MAX);
+
+  mtl_udma_free(dma);
+}
+
+TEST(Cvt, rfc4175_444be10_to_444p10le_avx2_dma) {
+  struct st_tests_context* ctx = st_test_ctx();
+  mtl_handle handle = ctx->handle;
+  mtl_udma_handle dma = mtl_udma_create(handle, 128, MTL_PORT_P);
+  if (!dma) return;
+
+  test_cvt_rfc4175_444be10_to_444p10le_dma(dma, 1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                           MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be10_to_444p10le_dma(dma, 3840, 2160, MTL_SIMD_LEVEL_AVX2,
+                                           MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be10_to_444p10le_dma(dma, 722, 112, MTL_SIMD_LEVEL_AVX2,
+                                           MTL_SIMD_LEVEL_NONE);
+
+  mtl_udma_free(dma);
+}
+
+TEST(Cvt, rfc4175_444be10_to_444p10le_avx512_vbmi_dma) {
+  struct st_tests_context* ctx = st_test_ctx();
+  mtl_handle handle = ctx->handle;
+  mtl_udma_handle dma = mtl_udma_create(handle, 128, MTL_PORT_P);
+  if (!dma) return;
+
+  test_cvt_rfc4175_444be10_to_444p10le_dma(dma, 1920, 1080, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                           MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be10_to_444p10le_dma(dma, 3840, 2160, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                           MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be10_to_444p10le_dma(dma, 722, 112, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                           MTL_SIMD_LEVEL_NONE);
+
+  mtl_udma_free(dma);
+}
+
 static void test_cvt_444p10le_to_rfc4175_444be10(int w, int h,
                                                  enum mtl_simd_level cvt_level,
                                                  enum mtl_simd_level back_level) {
@@ -2961,6 +3269,37 @@ TEST(Cvt, 444p10le_to_rfc4175_444be10_scalar) {
                                        MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, 444p10le_to_rfc4175_444be10_avx2) {
+  test_cvt_444p10le_to_rfc4175_444be10(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_444p10le_to_rfc4175_444be10(722, 112, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_444p10le_to_rfc4175_444be10(722, 112, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_444p10le_to_rfc4175_444be10(722, 112, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 4; /* each pg has four pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_444p10le_to_rfc4175_444be10(w, h, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
+TEST(Cvt, 444p10le_to_rfc4175_444be10_avx512) {
+  test_cvt_444p10le_to_rfc4175_444be10(1920, 1080, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_444p10le_to_rfc4175_444be10(722, 112, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_444p10le_to_rfc4175_444be10(722, 112, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_444p10le_to_rfc4175_444be10(722, 112, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 4; /* each pg has four pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_444p10le_to_rfc4175_444be10(w, h, MTL_SIMD_LEVEL_AVX512,
+                                         MTL_SIMD_LEVEL_AVX512);
+  }
+}
+
 static void test_cvt_rfc4175_444le10_to_yuv444p10le(int w, int h,
                                                     enum mtl_simd_level cvt_level,
                                                     enum mtl_simd_level back_level) {
@@ -3422,6 +3761,139 @@ TEST(Cvt, rfc4175_444be12_to_444p12le_scalar) {
                                        MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, rfc4175_444be12_to_444p12le_avx2) {
+  test_cvt_rfc4175_444be12_to_444p12le(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be12_to_444p12le(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be12_to_444p12le(722, 111, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be12_to_444p12le(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_444be12_to_444p12le(w, h, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
+TEST(Cvt, rfc4175_444be12_to_444p12le_avx512) {
+  test_cvt_rfc4175_444be12_to_444p12le(1920, 1080, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_rfc4175_444be12_to_444p12le(722, 111, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_rfc4175_444be12_to_444p12le(722, 111, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_rfc4175_444be12_to_444p12le(722, 111, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_444be12_to_444p12le(w, h, MTL_SIMD_LEVEL_AVX512,
+                                         MTL_SIMD_LEVEL_AVX512);
+  }
+}
+
+TEST(Cvt, rfc4175_444be12_to_444p12le_avx512_vbmi) {
+  test_cvt_rfc4175_444be12_to_444p12le(1920, 1080, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                       MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be12_to_444p12le(722, 111, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                       MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be12_to_444p12le(722, 111, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be12_to_444p12le(722, 111, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_rfc4175_444be12_to_444p12le(w, h, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                         MTL_SIMD_LEVEL_AVX512_VBMI2);
+  }
+}
+
+static void test_cvt_rfc4175_444be12_to_444p12le_dma(mtl_udma_handle dma, int w, int h,
+                                                     enum mtl_simd_level cvt_level,
+                                                     enum mtl_simd_level back_level) {
+  int ret;
+  size_t fb_pg_size = (size_t)w * h * 9 / 2;
+  struct st_tests_context* ctx = st_test_ctx();
+  mtl_handle st = ctx->handle;
+  struct st20_rfc4175_444_12_pg2_be* pg =
+      (struct st20_rfc4175_444_12_pg2_be*)mtl_hp_zmalloc(st, fb_pg_size, MTL_PORT_P);
+  struct st20_rfc4175_444_12_pg2_be* pg_2 =
+      (struct st20_rfc4175_444_12_pg2_be*)st_test_zmalloc(fb_pg_size);
+  size_t planar_size = (size_t)w * h * 3 * sizeof(uint16_t);
+  uint16_t* p_u16 = (uint16_t*)st_test_zmalloc(planar_size);
+
+  if (!pg || !pg_2 || !p_u16) {
+    EXPECT_EQ(0, 1);
+    if (pg) mtl_hp_free(st, pg);
+    if (pg_2) st_test_free(pg_2);
+    if (p_u16) st_test_free(p_u16);
+    return;
+  }
+
+  st_test_rand_data((uint8_t*)pg, fb_pg_size, 0);
+
+  ret = st20_rfc4175_444be12_to_444p12le_simd_dma(
+      dma, pg, mtl_hp_virt2iova(st, pg), p_u16, (p_u16 + w * h), (p_u16 + w * h * 2), w,
+      h, cvt_level);
+  EXPECT_EQ(0, ret);
+
+  ret = st20_444p12le_to_rfc4175_444be12_simd(p_u16, (p_u16 + w * h), (p_u16 + w * h * 2),
+                                              pg_2, w, h, back_level);
+  EXPECT_EQ(0, ret);
+
+  EXPECT_EQ(0, memcmp(pg, pg_2, fb_pg_size));
+
+  mtl_hp_free(st, pg);
+  st_test_free(pg_2);
+  st_test_free(p_u16);
+}
+
+TEST(Cvt, rfc4175_444be12_to_444p12le_dma) {
+  struct st_tests_context* ctx = st_test_ctx();
+  mtl_handle handle = ctx->handle;
+  mtl_udma_handle dma = mtl_udma_create(handle, 128, MTL_PORT_P);
+  if (!dma) return;
+
+  test_cvt_rfc4175_444be12_to_444p12le_dma(dma, 1920, 1080, MTL_SIMD_LEVEL_MAX,
+                                           MTL_SIMD_LEVEL_MAX);
+  test_cvt_rfc4175_444be12_to_444p12le_dma(dma, 3840, 2160, MTL_SIMD_LEVEL_MAX,
+                                           MTL_SIMD_LEVEL_MAX);
+
+  mtl_udma_free(dma);
+}
+
+TEST(Cvt, rfc4175_444be12_to_444p12le_avx2_dma) {
+  struct st_tests_context* ctx = st_test_ctx();
+  mtl_handle handle = ctx->handle;
+  mtl_udma_handle dma = mtl_udma_create(handle, 128, MTL_PORT_P);
+  if (!dma) return;
+
+  test_cvt_rfc4175_444be12_to_444p12le_dma(dma, 1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                           MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be12_to_444p12le_dma(dma, 3840, 2160, MTL_SIMD_LEVEL_AVX2,
+                                           MTL_SIMD_LEVEL_AVX2);
+  test_cvt_rfc4175_444be12_to_444p12le_dma(dma, 722, 112, MTL_SIMD_LEVEL_AVX2,
+                                           MTL_SIMD_LEVEL_NONE);
+
+  mtl_udma_free(dma);
+}
+
+TEST(Cvt, rfc4175_444be12_to_444p12le_avx512_vbmi_dma) {
+  struct st_tests_context* ctx = st_test_ctx();
+  mtl_handle handle = ctx->handle;
+  mtl_udma_handle dma = mtl_udma_create(handle, 128, MTL_PORT_P);
+  if (!dma) return;
+
+  test_cvt_rfc4175_444be12_to_444p12le_dma(dma, 1920, 1080, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                           MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be12_to_444p12le_dma(dma, 3840, 2160, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                           MTL_SIMD_LEVEL_AVX512_VBMI2);
+  test_cvt_rfc4175_444be12_to_444p12le_dma(dma, 722, 112, MTL_SIMD_LEVEL_AVX512_VBMI2,
+                                           MTL_SIMD_LEVEL_NONE);
+
+  mtl_udma_free(dma);
+}
+
 static void test_cvt_444p12le_to_rfc4175_444be12(int w, int h,
                                                  enum mtl_simd_level cvt_level,
                                                  enum mtl_simd_level back_level) {
@@ -3470,6 +3942,37 @@ TEST(Cvt, 444p12le_to_rfc4175_444be12_scalar) {
                                        MTL_SIMD_LEVEL_NONE);
 }
 
+TEST(Cvt, 444p12le_to_rfc4175_444be12_avx2) {
+  test_cvt_444p12le_to_rfc4175_444be12(1920, 1080, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_444p12le_to_rfc4175_444be12(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_444p12le_to_rfc4175_444be12(722, 111, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX2);
+  test_cvt_444p12le_to_rfc4175_444be12(722, 111, MTL_SIMD_LEVEL_AVX2,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_444p12le_to_rfc4175_444be12(w, h, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
+TEST(Cvt, 444p12le_to_rfc4175_444be12_avx512) {
+  test_cvt_444p12le_to_rfc4175_444be12(1920, 1080, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_444p12le_to_rfc4175_444be12(722, 111, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_444p12le_to_rfc4175_444be12(722, 111, MTL_SIMD_LEVEL_NONE,
+                                       MTL_SIMD_LEVEL_AVX512);
+  test_cvt_444p12le_to_rfc4175_444be12(722, 111, MTL_SIMD_LEVEL_AVX512,
+                                       MTL_SIMD_LEVEL_NONE);
+  int w = 2; /* each pg has two pixels */
+  for (int h = 640; h < (640 + 64); h++) {
+    test_cvt_444p12le_to_rfc4175_444be12(w, h, MTL_SIMD_LEVEL_AVX512,
+                                         MTL_SIMD_LEVEL_AVX512);
+  }
+}
+
 static void test_cvt_rfc4175_444le12_to_yuv444p12le(int w, int h,
                                                     enum mtl_simd_level cvt_level,
                                                     enum mtl_simd_level back_level) {
@@ -3884,6 +4387,323 @@ TEST(Cvt, rotate_rfc4175_444be12_444p12le_444le12_scalar) {
                                                MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_NONE);
 }
 
+static int cvt_rfc4175_422be10_to_rgb(struct st20_rfc4175_422_10_pg2_be* pg, uint8_t* rgb,
+                                      enum st_frame_fmt fmt, int w, int h,
+                                      enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level) {
+  if (fmt == ST_FRAME_FMT_ARGB)
+    return st20_rfc4175_422be10_to_argb_simd(pg, rgb, w, h, matrix, range, level);
+  if (fmt == ST_FRAME_FMT_BGRA)
+    return st20_rfc4175_422be10_to_bgra_simd(pg, rgb, w, h, matrix, range, level);
+  return st20_rfc4175_422be10_to_rgb8_simd(pg, rgb, w, h, matrix, range, level);
+}
+
+static int cvt_rgb_to_rfc4175_422be10(uint8_t* rgb, enum st_frame_fmt fmt,
+                                      struct st20_rfc4175_422_10_pg2_be* pg, int w,
+                                      int h, enum st20_color_matrix matrix,
+                                      enum st20_color_range range,
+                                      enum mtl_simd_level level) {
+  if (fmt == ST_FRAME_FMT_ARGB)
+    return st20_argb_to_rfc4175_422be10_simd(rgb, pg, w, h, matrix, range, level);
+  if (fmt == ST_FRAME_FMT_BGRA)
+    return st20_bgra_to_rfc4175_422be10_simd(rgb, pg, w, h, matrix, range, level);
+  return st20_rgb8_to_rfc4175_422be10_simd(rgb, pg, w, h, matrix, range, level);
+}
+
+/* the simd result should be same as the scalar for all the matrix and range */
+static void test_cvt_rfc4175_422be10_to_rgb(int w, int h, enum st_frame_fmt fmt,
+                                            enum mtl_simd_level level) {
+  int ret;
+  size_t fb_pg2_size = (size_t)w * h * 5 / 2;
+  struct st20_rfc4175_422_10_pg2_be* pg =
+      (struct st20_rfc4175_422_10_pg2_be*)st_test_zmalloc(fb_pg2_size);
+  size_t rgb_size = (size_t)w * h * (fmt == ST_FRAME_FMT_RGB8 ? 3 : 4);
+  uint8_t* rgb = (uint8_t*)st_test_zmalloc(rgb_size);
+  uint8_t* rgb_2 = (uint8_t*)st_test_zmalloc(rgb_size);
+
+  if (!pg || !rgb || !rgb_2) {
+    EXPECT_EQ(0, 1);
+    if (pg) st_test_free(pg);
+    if (rgb) st_test_free(rgb);
+    if (rgb_2) st_test_free(rgb_2);
+    return;
+  }
+
+  st_test_rand_data((uint8_t*)pg, fb_pg2_size, 0);
+
+  for (int m = 0; m < ST20_COLOR_MATRIX_MAX; m++) {
+    for (int r = 0; r < ST20_COLOR_RANGE_MAX; r++) {
+      enum st20_color_matrix matrix = (enum st20_color_matrix)m;
+      enum st20_color_range range = (enum st20_color_range)r;
+
+      ret = cvt_rfc4175_422be10_to_rgb(pg, rgb, fmt, w, h, matrix, range,
+                                       MTL_SIMD_LEVEL_NONE);
+      EXPECT_EQ(0, ret);
+      ret = cvt_rfc4175_422be10_to_rgb(pg, rgb_2, fmt, w, h, matrix, range, level);
+      EXPECT_EQ(0, ret);
+      EXPECT_EQ(0, memcmp(rgb, rgb_2, rgb_size));
+    }
+  }
+
+  st_test_free(pg);
+  st_test_free(rgb);
+  st_test_free(rgb_2);
+}
+
+TEST(Cvt, rfc4175_422be10_to_rgb) {
+  test_cvt_rfc4175_422be10_to_rgb(1920, 1080, ST_FRAME_FMT_ARGB, MTL_SIMD_LEVEL_MAX);
+  test_cvt_rfc4175_422be10_to_rgb(1920, 1080, ST_FRAME_FMT_BGRA, MTL_SIMD_LEVEL_MAX);
+  test_cvt_rfc4175_422be10_to_rgb(1920, 1080, ST_FRAME_FMT_RGB8, MTL_SIMD_LEVEL_MAX);
+}
+
+TEST(Cvt, rfc4175_422be10_to_rgb_avx2) {
+  enum st_frame_fmt fmts[] = {ST_FRAME_FMT_ARGB, ST_FRAME_FMT_BGRA, ST_FRAME_FMT_RGB8};
+  for (size_t i = 0; i < sizeof(fmts) / sizeof(fmts[0]); i++) {
+    test_cvt_rfc4175_422be10_to_rgb(1920, 1080, fmts[i], MTL_SIMD_LEVEL_AVX2);
+    test_cvt_rfc4175_422be10_to_rgb(722, 111, fmts[i], MTL_SIMD_LEVEL_AVX2);
+    for (int w = 2; w < 2 + 32; w += 2) {
+      test_cvt_rfc4175_422be10_to_rgb(w, 3, fmts[i], MTL_SIMD_LEVEL_AVX2);
+    }
+  }
+}
+
+TEST(Cvt, rfc4175_422be10_to_rgb_avx512) {
+  enum st_frame_fmt fmts[] = {ST_FRAME_FMT_ARGB, ST_FRAME_FMT_BGRA, ST_FRAME_FMT_RGB8};
+  for (size_t i = 0; i < sizeof(fmts) / sizeof(fmts[0]); i++) {
+    test_cvt_rfc4175_422be10_to_rgb(1920, 1080, fmts[i], MTL_SIMD_LEVEL_AVX512);
+    test_cvt_rfc4175_422be10_to_rgb(722, 111, fmts[i], MTL_SIMD_LEVEL_AVX512);
+    for (int w = 2; w < 2 + 32; w += 2) {
+      test_cvt_rfc4175_422be10_to_rgb(w, 3, fmts[i], MTL_SIMD_LEVEL_AVX512);
+    }
+  }
+}
+
+static void test_cvt_rgb_to_rfc4175_422be10(int w, int h, enum st_frame_fmt fmt,
+                                            enum mtl_simd_level level) {
+  int ret;
+  size_t fb_pg2_size = (size_t)w * h * 5 / 2;
+  struct st20_rfc4175_422_10_pg2_be* pg =
+      (struct st20_rfc4175_422_10_pg2_be*)st_test_zmalloc(fb_pg2_size);
+  struct st20_rfc4175_422_10_pg2_be* pg_2 =
+      (struct st20_rfc4175_422_10_pg2_be*)st_test_zmalloc(fb_pg2_size);
+  size_t rgb_size = (size_t)w * h * (fmt == ST_FRAME_FMT_RGB8 ? 3 : 4);
+  uint8_t* rgb = (uint8_t*)st_test_zmalloc(rgb_size);
+
+  if (!pg || !pg_2 || !rgb) {
+    EXPECT_EQ(0, 1);
+    if (pg) st_test_free(pg);
+    if (pg_2) st_test_free(pg_2);
+    if (rgb) st_test_free(rgb);
+    return;
+  }
+
+  st_test_rand_data(rgb, rgb_size, 0);
+
+  for (int m = 0; m < ST20_COLOR_MATRIX_MAX; m++) {
+    for (int r = 0; r < ST20_COLOR_RANGE_MAX; r++) {
+      enum st20_color_matrix matrix = (enum st20_color_matrix)m;
+      enum st20_color_range range = (enum st20_color_range)r;
+
+      ret = cvt_rgb_to_rfc4175_422be10(rgb, fmt, pg, w, h, matrix, range,
+                                       MTL_SIMD_LEVEL_NONE);
+      EXPECT_EQ(0, ret);
+      ret = cvt_rgb_to_rfc4175_422be10(rgb, fmt, pg_2, w, h, matrix, range, level);
+      EXPECT_EQ(0, ret);
+      EXPECT_EQ(0, memcmp(pg, pg_2, fb_pg2_size));
+    }
+  }
+
+  st_test_free(pg);
+  st_test_free(pg_2);
+  st_test_free(rgb);
+}
+
+TEST(Cvt, rgb_to_rfc4175_422be10) {
+  test_cvt_rgb_to_rfc4175_422be10(1920, 1080, ST_FRAME_FMT_ARGB, MTL_SIMD_LEVEL_MAX);
+  test_cvt_rgb_to_rfc4175_422be10(1920, 1080, ST_FRAME_FMT_BGRA, MTL_SIMD_LEVEL_MAX);
+  test_cvt_rgb_to_rfc4175_422be10(1920, 1080, ST_FRAME_FMT_RGB8, MTL_SIMD_LEVEL_MAX);
+}
+
+TEST(Cvt, rgb_to_rfc4175_422be10_avx2) {
+  enum st_frame_fmt fmts[] = {ST_FRAME_FMT_ARGB, ST_FRAME_FMT_BGRA, ST_FRAME_FMT_RGB8};
+  for (size_t i = 0; i < sizeof(fmts) / sizeof(fmts[0]); i++) {
+    test_cvt_rgb_to_rfc4175_422be10(1920, 1080, fmts[i], MTL_SIMD_LEVEL_AVX2);
+    test_cvt_rgb_to_rfc4175_422be10(722, 111, fmts[i], MTL_SIMD_LEVEL_AVX2);
+    for (int w = 2; w < 2 + 32; w += 2) {
+      test_cvt_rgb_to_rfc4175_422be10(w, 3, fmts[i], MTL_SIMD_LEVEL_AVX2);
+    }
+  }
+}
+
+TEST(Cvt, rgb_to_rfc4175_422be10_avx512) {
+  enum st_frame_fmt fmts[] = {ST_FRAME_FMT_ARGB, ST_FRAME_FMT_BGRA, ST_FRAME_FMT_RGB8};
+  for (size_t i = 0; i < sizeof(fmts) / sizeof(fmts[0]); i++) {
+    test_cvt_rgb_to_rfc4175_422be10(1920, 1080, fmts[i], MTL_SIMD_LEVEL_AVX512);
+    test_cvt_rgb_to_rfc4175_422be10(722, 111, fmts[i], MTL_SIMD_LEVEL_AVX512);
+    for (int w = 2; w < 2 + 32; w += 2) {
+      test_cvt_rgb_to_rfc4175_422be10(w, 3, fmts[i], MTL_SIMD_LEVEL_AVX512);
+    }
+  }
+}
+
+/* the pixel pairs share one chroma, the rgb of same pairs come back within 1 */
+static void test_cvt_rgb_rfc4175_422be10_rotate(int w, int h, enum st_frame_fmt fmt,
+                                                enum st20_color_matrix matrix,
+                                                enum st20_color_range range) {
+  int ret;
+  size_t fb_pg2_size = (size_t)w * h * 5 / 2;
+  struct st20_rfc4175_422_10_pg2_be* pg =
+      (struct st20_rfc4175_422_10_pg2_be*)st_test_zmalloc(fb_pg2_size);
+  int pixel_size = fmt == ST_FRAME_FMT_RGB8 ? 3 : 4;
+  size_t rgb_size = (size_t)w * h * pixel_size;
+  uint8_t* rgb = (uint8_t*)st_test_zmalloc(rgb_size);
+  uint8_t* rgb_2 = (uint8_t*)st_test_zmalloc(rgb_size);
+
+  if (!pg || !rgb || !rgb_2) {
+    EXPECT_EQ(0, 1);
+    if (pg) st_test_free(pg);
+    if (rgb) st_test_free(rgb);
+    if (rgb_2) st_test_free(rgb_2);
+    return;
+  }
+
+  for (size_t i = 0; i < rgb_size; i += pixel_size * 2) {
+    for (int j = 0; j < pixel_size; j++) {
+      rgb[i + j] = rgb[i + pixel_size + j] = rand();
+    }
+    /* the alpha is always opaque on the yuv to rgb */
+    if (fmt == ST_FRAME_FMT_ARGB) rgb[i] = rgb[i + pixel_size] = 0xff;
+    if (fmt == ST_FRAME_FMT_BGRA) rgb[i + 3] = rgb[i + pixel_size + 3] = 0xff;
+  }
+
+  ret = cvt_rgb_to_rfc4175_422be10(rgb, fmt, pg, w, h, matrix, range,
+                                   MTL_SIMD_LEVEL_MAX);
+  EXPECT_EQ(0, ret);
+  ret = cvt_rfc4175_422be10_to_rgb(pg, rgb_2, fmt, w, h, matrix, range,
+                                   MTL_SIMD_LEVEL_MAX);
+  EXPECT_EQ(0, ret);
+
+  int max_diff = 0;
+  for (size_t i = 0; i < rgb_size; i++) {
+    int diff = abs(rgb[i] - rgb_2[i]);
+    if (diff > max_diff) max_diff = diff;
+  }
+  EXPECT_LE(max_diff, 1);
+
+  st_test_free(pg);
+  st_test_free(rgb);
+  st_test_free(rgb_2);
+}
+
+TEST(Cvt, rotate_rgb_rfc4175_422be10) {
+  enum st_frame_fmt fmts[] = {ST_FRAME_FMT_ARGB, ST_FRAME_FMT_BGRA, ST_FRAME_FMT_RGB8};
+  for (size_t i = 0; i < sizeof(fmts) / sizeof(fmts[0]); i++) {
+    for (int m = 0; m < ST20_COLOR_MATRIX_MAX; m++) {
+      for (int r = 0; r < ST20_COLOR_RANGE_MAX; r++) {
+        test_cvt_rgb_rfc4175_422be10_rotate(1920, 1080, fmts[i],
+                                            (enum st20_color_matrix)m,
+                                            (enum st20_color_range)r);
+        test_cvt_rgb_rfc4175_422be10_rotate(722, 111, fmts[i], (enum st20_color_matrix)m,
+                                            (enum st20_color_range)r);
+      }
+    }
+  }
+}
+
+/* the reference 10bit yuv of the BT.709 colors, from the Kr 0.2126 and Kb 0.0722 */
+static const struct {
+  enum st20_color_range range;
+  const char* name;
+  uint16_t y, cb, cr;
+  uint8_t r, g, b;
+} bt709_refs[] = {
+    {ST20_COLOR_RANGE_NARROW, "white", 940, 512, 512, 255, 255, 255},
+    {ST20_COLOR_RANGE_NARROW, "black", 64, 512, 512, 0, 0, 0},
+    {ST20_COLOR_RANGE_NARROW, "red", 250, 409, 960, 255, 0, 0},
+    {ST20_COLOR_RANGE_NARROW, "green", 691, 167, 105, 0, 255, 0},
+    {ST20_COLOR_RANGE_NARROW, "blue", 127, 960, 471, 0, 0, 255},
+    {ST20_COLOR_RANGE_FULL, "white", 1023, 512, 512, 255, 255, 255},
+    {ST20_COLOR_RANGE_FULL, "black", 0, 512, 512, 0, 0, 0},
+};
+
+/* a flat line of the reference color, both ways against the reference within 1 */
+static void test_cvt_rgb_rfc4175_422be10_bt709(enum st_frame_fmt fmt,
+                                               enum mtl_simd_level level) {
+  const int w = 64, h = 1;
+  struct st20_rfc4175_422_10_pg2_be pg[w / 2];
+  int pixel_size = fmt == ST_FRAME_FMT_RGB8 ? 3 : 4;
+  /* the byte offset of r, g, b in one pixel */
+  int r_off = 0, g_off = 1, b_off = 2;
+  if (fmt == ST_FRAME_FMT_ARGB) {
+    r_off = 1;
+    g_off = 2;
+    b_off = 3;
+  } else if (fmt == ST_FRAME_FMT_BGRA) {
+    r_off = 2;
+    b_off = 0;
+  }
+  uint8_t rgb[w * 4];
+  int ret;
+
+  for (size_t i = 0; i < MTL_ARRAY_SIZE(bt709_refs); i++) {
+    uint16_t y = bt709_refs[i].y, cb = bt709_refs[i].cb, cr = bt709_refs[i].cr;
+    const char* name = bt709_refs[i].name;
+
+    /* yuv to rgb */
+    for (int p = 0; p < w / 2; p++) {
+      pg[p].Cb00 = cb >> 2;
+      pg[p].Cb00_ = cb;
+      pg[p].Y00 = y >> 4;
+      pg[p].Y00_ = y;
+      pg[p].Cr00 = cr >> 6;
+      pg[p].Cr00_ = cr;
+      pg[p].Y01 = y >> 8;
+      pg[p].Y01_ = y;
+    }
+    memset(rgb, 0, sizeof(rgb));
+    ret = cvt_rfc4175_422be10_to_rgb(pg, rgb, fmt, w, h, ST20_COLOR_MATRIX_BT709,
+                                     bt709_refs[i].range, level);
+    EXPECT_EQ(0, ret);
+    for (int x = 0; x < w; x++) {
+      uint8_t* px = rgb + x * pixel_size;
+      EXPECT_NEAR(bt709_refs[i].r, px[r_off], 1) << name << " at " << x;
+      EXPECT_NEAR(bt709_refs[i].g, px[g_off], 1) << name << " at " << x;
+      EXPECT_NEAR(bt709_refs[i].b, px[b_off], 1) << name << " at " << x;
+    }
+
+    /* rgb to yuv */
+    for (int x = 0; x < w; x++) {
+      uint8_t* px = rgb + x * pixel_size;
+      px[r_off] = bt709_refs[i].r;
+      px[g_off] = bt709_refs[i].g;
+      px[b_off] = bt709_refs[i].b;
+    }
+    memset(pg, 0, sizeof(pg));
+    ret = cvt_rgb_to_rfc4175_422be10(rgb, fmt, pg, w, h, ST20_COLOR_MATRIX_BT709,
+                                     bt709_refs[i].range, level);
+    EXPECT_EQ(0, ret);
+    for (int p = 0; p < w / 2; p++) {
+      EXPECT_NEAR(cb, (pg[p].Cb00 << 2) + pg[p].Cb00_, 1) << name << " at " << p;
+      EXPECT_NEAR(y, (pg[p].Y00 << 4) + pg[p].Y00_, 1) << name << " at " << p;
+      EXPECT_NEAR(cr, (pg[p].Cr00 << 6) + pg[p].Cr00_, 1) << name << " at " << p;
+      EXPECT_NEAR(y, (pg[p].Y01 << 8) + pg[p].Y01_, 1) << name << " at " << p;
+    }
+  }
+}
+
+TEST(Cvt, rgb_rfc4175_422be10_bt709) {
+  enum st_frame_fmt fmts[] = {ST_FRAME_FMT_ARGB, ST_FRAME_FMT_BGRA, ST_FRAME_FMT_RGB8};
+  enum mtl_simd_level levels[] = {MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX2,
+                                  MTL_SIMD_LEVEL_AVX512};
+  for (size_t i = 0; i < MTL_ARRAY_SIZE(fmts); i++) {
+    for (size_t j = 0; j < MTL_ARRAY_SIZE(levels); j++) {
+      if (mtl_get_simd_level() < levels[j]) continue;
+      test_cvt_rgb_rfc4175_422be10_bt709(fmts[i], levels[j]);
+    }
+  }
+}
+
 static void test_am824_to_aes3(int blocks) {
   int ret;
   int subframes = blocks * 2 * 192;
@@ -4250,6 +5070,214 @@ TEST(Cvt, st_frame_convert_rotate_mix_padding) {
   frame_free(&new_src);
 }
 
+TEST(Cvt, st_frame_convert_color) {
+  struct st_frame src, dst, dst_2;
+  memset(&src, 0, sizeof(src));
+  memset(&dst, 0, sizeof(dst));
+  memset(&dst_2, 0, sizeof(dst_2));
+
+  src.width = dst.width = dst_2.width = 1920;
+  src.height = dst.height = dst_2.height = 1080;
+  src.fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10;
+  dst.fmt = dst_2.fmt = ST_FRAME_FMT_BGRA;
+  frame_malloc(&src, 1, false);
+  frame_malloc(&dst, 0, true);
+  frame_malloc(&dst_2, 0, false);
+
+  /* the default of st_frame_convert is bt709 narrow range */
+  EXPECT_EQ(0, st_frame_convert(&src, &dst));
+  EXPECT_EQ(0, st_frame_convert_color(&src, &dst_2, ST20_COLOR_MATRIX_BT709,
+                                      ST20_COLOR_RANGE_NARROW));
+  EXPECT_EQ(0, frame_compare_each_line(&dst, &dst_2));
+
+  EXPECT_EQ(0, st_frame_convert_color(&src, &dst_2, ST20_COLOR_MATRIX_BT2020,
+                                      ST20_COLOR_RANGE_FULL));
+  EXPECT_NE(0, frame_compare_each_line(&dst, &dst_2));
+
+  EXPECT_NE(0, st_frame_convert_color(&src, &dst_2, ST20_COLOR_MATRIX_MAX,
+                                      ST20_COLOR_RANGE_NARROW));
+  EXPECT_NE(0, st_frame_convert_color(&src, &dst_2, ST20_COLOR_MATRIX_BT709,
+                                      ST20_COLOR_RANGE_MAX));
+
+  frame_free(&src);
+  frame_free(&dst);
+  frame_free(&dst_2);
+}
+
+TEST(Cvt, st_frame_scale) {
+  struct st_frame src, dst, dst_2, dst_3;
+  memset(&src, 0, sizeof(src));
+  memset(&dst, 0, sizeof(dst));
+  memset(&dst_2, 0, sizeof(dst_2));
+  memset(&dst_3, 0, sizeof(dst_3));
+
+  /* the filters sum to one, a flat frame stays flat */
+  src.width = 1920;
+  src.height = 1080;
+  dst.width = 1280;
+  dst.height = 720;
+  src.fmt = dst.fmt = ST_FRAME_FMT_YUV422PLANAR10LE;
+  frame_malloc(&src, 0, false);
+  frame_malloc(&dst, 0, true);
+  uint16_t* p10 = (uint16_t*)src.addr[0];
+  for (size_t i = 0; i < src.data_size / 2; i++) p10[i] = 0x155;
+  EXPECT_EQ(0, st_frame_scale(&src, &dst));
+  for (uint8_t plane = 0; plane < 3; plane++) {
+    uint32_t w = plane ? dst.width / 2 : dst.width;
+    for (uint32_t line = 0; line < dst.height; line++) {
+      uint16_t* d = (uint16_t*)((uint8_t*)dst.addr[plane] + dst.linesize[plane] * line);
+      for (uint32_t x = 0; x < w; x++) EXPECT_EQ(0x155, d[x]);
+    }
+  }
+  frame_free(&src);
+  frame_free(&dst);
+
+  /* same size is a copy */
+  src.width = dst.width = 1280;
+  src.height = dst.height = 720;
+  src.fmt = dst.fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10;
+  frame_malloc(&src, 1, false);
+  frame_malloc(&dst, 0, true);
+  EXPECT_EQ(0, st_frame_scale(&src, &dst));
+  EXPECT_EQ(0, frame_compare_each_line(&src, &dst));
+  frame_free(&dst);
+
+  /* scale with convert equals to scale then convert, and the downsample of 2/3 */
+  dst.width = dst_2.width = dst_3.width = 1920;
+  dst.height = dst_2.height = dst_3.height = 1080;
+  dst.fmt = ST_FRAME_FMT_V210;
+  dst_2.fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10;
+  dst_3.fmt = ST_FRAME_FMT_V210;
+  frame_malloc(&dst, 0, false);
+  frame_malloc(&dst_2, 0, true);
+  frame_malloc(&dst_3, 0, false);
+  EXPECT_EQ(0, st_frame_scale(&src, &dst));
+  EXPECT_EQ(0, st_frame_scale(&src, &dst_2));
+  EXPECT_EQ(0, st_frame_convert(&dst_2, &dst_3));
+  EXPECT_EQ(0, frame_compare_each_line(&dst, &dst_3));
+  EXPECT_EQ(0, st_frame_scale(&dst_2, &src));
+  /* downsample is integer ratio only */
+  EXPECT_NE(0, st_frame_downsample(&dst_2, &src, 0));
+  EXPECT_NE(0, st_frame_downsample(&src, &dst_2, 0));
+  frame_free(&dst);
+  frame_free(&dst_3);
+  dst.width = 1920 / 3;
+  dst.height = 1080 / 3;
+  dst.fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10;
+  frame_malloc(&dst, 0, false);
+  EXPECT_EQ(0, st_frame_downsample(&dst_2, &dst, 0));
+  frame_free(&dst);
+
+  /* no 4:2:0 output */
+  dst.width = 1280;
+  dst.height = 720;
+  dst.fmt = ST_FRAME_FMT_YUV420PLANAR8;
+  frame_malloc(&dst, 0, false);
+  EXPECT_NE(0, st_frame_scale(&dst_2, &dst));
+
+  frame_free(&src);
+  frame_free(&dst);
+  frame_free(&dst_2);
+}
+
+TEST(Cvt, st_frame_scale_odd_edge) {
+  struct st_frame src, dst;
+  memset(&src, 0, sizeof(src));
+  memset(&dst, 0, sizeof(dst));
+
+  /* the window is wider than the odd input, each sample has the same weight */
+  const uint16_t cols[3] = {0x100, 0x200, 0x3c0};
+  const uint16_t rows[3] = {0x0, 0x10, 0x20};
+  src.width = 3;
+  src.height = 3;
+  dst.width = 1;
+  dst.height = 1;
+  src.fmt = dst.fmt = ST_FRAME_FMT_YUV444PLANAR10LE;
+  frame_malloc(&src, 0, false);
+  frame_malloc(&dst, 0, false);
+  if (!src.addr[0] || !dst.addr[0]) {
+    EXPECT_EQ(0, 1);
+    frame_free(&src);
+    frame_free(&dst);
+    return;
+  }
+  for (uint8_t plane = 0; plane < 3; plane++) {
+    for (uint32_t line = 0; line < src.height; line++) {
+      uint16_t* s = (uint16_t*)((uint8_t*)src.addr[plane] + src.linesize[plane] * line);
+      for (uint32_t x = 0; x < src.width; x++) s[x] = cols[x] + rows[line];
+    }
+  }
+  EXPECT_EQ(0, st_frame_scale(&src, &dst));
+  for (uint8_t plane = 0; plane < 3; plane++) {
+    uint16_t* d = (uint16_t*)dst.addr[plane];
+    EXPECT_NEAR(0x250, d[0], 1); /* (0x100 + 0x200 + 0x3c0) / 3 + 0x10 */
+  }
+  frame_free(&src);
+  frame_free(&dst);
+}
+
+static void test_st_frame_scale_simd(enum st_frame_fmt fmt, uint32_t src_w,
+                                     uint32_t src_h, uint32_t dst_w, uint32_t dst_h,
+                                     uint16_t mask) {
+  enum mtl_simd_level levels[] = {MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX512};
+  struct st_frame src, dst, dst_simd;
+  memset(&src, 0, sizeof(src));
+  memset(&dst, 0, sizeof(dst));
+  memset(&dst_simd, 0, sizeof(dst_simd));
+
+  src.width = src_w;
+  src.height = src_h;
+  dst.width = dst_simd.width = dst_w;
+  dst.height = dst_simd.height = dst_h;
+  src.fmt = dst.fmt = dst_simd.fmt = fmt;
+  frame_malloc(&src, 1, false);
+  frame_malloc(&dst, 0, true);
+  frame_malloc(&dst_simd, 0, false);
+  if (!src.addr[0] || !dst.addr[0] || !dst_simd.addr[0]) {
+    EXPECT_EQ(0, 1);
+    frame_free(&src);
+    frame_free(&dst);
+    frame_free(&dst_simd);
+    return;
+  }
+  uint16_t* p16 = (uint16_t*)src.addr[0];
+  for (size_t i = 0; i < src.data_size / 2; i++) p16[i] &= mask;
+
+  EXPECT_EQ(0, st_frame_scale_simd(&src, &dst, MTL_SIMD_LEVEL_NONE));
+  for (size_t i = 0; i < MTL_ARRAY_SIZE(levels); i++) {
+    if (mtl_get_simd_level() < levels[i]) {
+      info("%s, skip %s as not supported by cpu\n", __func__,
+           mtl_get_simd_level_name(levels[i]));
+      continue;
+    }
+    memset(dst_simd.addr[0], 0, dst_simd.data_size);
+    EXPECT_EQ(0, st_frame_scale_simd(&src, &dst_simd, levels[i]));
+    int ret = frame_compare_each_line(&dst, &dst_simd);
+    if (ret < 0) {
+      err("%s, %s %ux%u to %ux%u mismatch on %s\n", __func__, st_frame_fmt_name(fmt),
+          src_w, src_h, dst_w, dst_h, mtl_get_simd_level_name(levels[i]));
+    }
+    EXPECT_EQ(0, ret);
+  }
+
+  frame_free(&src);
+  frame_free(&dst);
+  frame_free(&dst_simd);
+}
+
+TEST(Cvt, st_frame_scale_simd) {
+  /* odd sizes and tails not the multiple of the vector width, both directions */
+  test_st_frame_scale_simd(ST_FRAME_FMT_YUV444PLANAR10LE, 1921, 1081, 1279, 719, 0x3ff);
+  test_st_frame_scale_simd(ST_FRAME_FMT_YUV444PLANAR10LE, 719, 405, 1283, 723, 0x3ff);
+  test_st_frame_scale_simd(ST_FRAME_FMT_YUV444PLANAR12LE, 1283, 723, 427, 241, 0xfff);
+  test_st_frame_scale_simd(ST_FRAME_FMT_YUV444PLANAR12LE, 37, 23, 101, 67, 0xfff);
+  test_st_frame_scale_simd(ST_FRAME_FMT_YUV422PLANAR10LE, 1918, 1079, 1266, 713, 0x3ff);
+  test_st_frame_scale_simd(ST_FRAME_FMT_YUV422PLANAR10LE, 638, 359, 1922, 1081, 0x3ff);
+  test_st_frame_scale_simd(ST_FRAME_FMT_GBRPLANAR12LE, 1921, 1081, 643, 361, 0xfff);
+  /* the vertical window wider than the odd input height */
+  test_st_frame_scale_simd(ST_FRAME_FMT_YUV444PLANAR10LE, 37, 3, 17, 1, 0x3ff);
+}
+
 static void test_field_to_frame(mtl_handle mt, uint32_t width, uint32_t height,
                                 enum st_frame_fmt fmt) {
   struct st_frame* frame = st_frame_create(mt, fmt, width, height, false);
@@ -4288,3 +5316,83 @@ TEST(Cvt, field_to_frame) {
   test_field_to_frame(ctx->handle, 1920, 1080, ST_FRAME_FMT_YUV422RFC4175PG2BE10);
   test_field_to_frame(ctx->handle, 1920, 1080, ST_FRAME_FMT_YUV422PLANAR10LE);
 }
+
+static void test_st40_udws(uint32_t idx, uint32_t num, enum mtl_simd_level set_level,
+                           enum mtl_simd_level get_level) {
+  int ret;
+  size_t payload_size = (idx + num) * 10 / 8 + 4;
+  uint8_t* payload = (uint8_t*)st_test_zmalloc(payload_size);
+  uint8_t* payload_ref = (uint8_t*)st_test_zmalloc(payload_size);
+  uint16_t* udws = (uint16_t*)st_test_zmalloc(num * sizeof(uint16_t) + 1);
+  uint16_t* udws_back = (uint16_t*)st_test_zmalloc(num * sizeof(uint16_t) + 1);
+  uint8_t* words = (uint8_t*)st_test_zmalloc(num + 1);
+
+  if (!payload || !payload_ref || !udws || !udws_back || !words) {
+    EXPECT_EQ(0, 1);
+    if (payload) st_test_free(payload);
+    if (payload_ref) st_test_free(payload_ref);
+    if (udws) st_test_free(udws);
+    if (udws_back) st_test_free(udws_back);
+    if (words) st_test_free(words);
+    return;
+  }
+
+  st_test_rand_data(payload, payload_size, 0);
+  memcpy(payload_ref, payload, payload_size);
+  st_test_rand_data(words, num, 0);
+  for (uint32_t i = 0; i < num; i++) udws[i] = st40_add_parity_bits(words[i]);
+
+  /* bulk with parity should match the single udw scalar api */
+  ret = st40_set_udws_parity_simd(idx, num, words, payload, set_level);
+  EXPECT_EQ(0, ret);
+  for (uint32_t i = 0; i < num; i++) st40_set_udw(idx + i, udws[i], payload_ref);
+  EXPECT_EQ(0, memcmp(payload, payload_ref, payload_size));
+
+  ret = st40_get_udws_simd(idx, num, payload, udws_back, get_level);
+  EXPECT_EQ(0, ret);
+  EXPECT_EQ(0, memcmp(udws, udws_back, num * sizeof(uint16_t)));
+  for (uint32_t i = 0; i < num; i++) EXPECT_TRUE(st40_check_parity_bits(udws_back[i]));
+
+  EXPECT_EQ(st40_calc_checksum_simd(idx + num, payload, MTL_SIMD_LEVEL_NONE),
+            st40_calc_checksum_simd(idx + num, payload, get_level));
+
+  /* 10 bit bulk set back to the reference */
+  st_test_rand_data(payload, payload_size, 0);
+  memcpy(payload_ref, payload, payload_size);
+  ret = st40_set_udws_simd(idx, num, udws_back, payload, set_level);
+  EXPECT_EQ(0, ret);
+  for (uint32_t i = 0; i < num; i++) st40_set_udw(idx + i, udws_back[i], payload_ref);
+  EXPECT_EQ(0, memcmp(payload, payload_ref, payload_size));
+
+  st_test_free(payload);
+  st_test_free(payload_ref);
+  st_test_free(udws);
+  st_test_free(udws_back);
+  st_test_free(words);
+}
+
+TEST(Cvt, st40_udws) {
+  test_st40_udws(3, 255, MTL_SIMD_LEVEL_MAX, MTL_SIMD_LEVEL_MAX);
+}
+
+TEST(Cvt, st40_udws_scalar) {
+  test_st40_udws(3, 255, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_NONE);
+}
+
+TEST(Cvt, st40_udws_avx2) {
+  test_st40_udws(3, 255, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  test_st40_udws(0, 1024, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX2);
+  test_st40_udws(0, 1024, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_NONE);
+  for (uint32_t num = 1; num < 64; num++) {
+    test_st40_udws(num % 7, num, MTL_SIMD_LEVEL_AVX2, MTL_SIMD_LEVEL_AVX2);
+  }
+}
+
+TEST(Cvt, st40_udws_avx512) {
+  test_st40_udws(3, 255, MTL_SIMD_LEVEL_AVX512, MTL_SIMD_LEVEL_AVX512);
+  test_st40_udws(0, 1024, MTL_SIMD_LEVEL_NONE, MTL_SIMD_LEVEL_AVX512);
+  test_st40_udws(0, 1024, MTL_SIMD_LEVEL_AVX512, MTL_SIMD_LEVEL_NONE);
+  for (uint32_t num = 1; num < 96; num++) {
+    test_st40_udws(num % 7, num, MTL_SIMD_LEVEL_AVX512, MTL_SIMD_LEVEL_AVX512);
+  }
+}
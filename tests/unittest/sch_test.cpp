@@ -4,9 +4,15 @@
 
 #include <mtl/mtl_sch_api.h>
 
+#include <atomic>
+#include <thread>
+
 #include "log.h"
 #include "tests.h"
 
+#define SCH_TEST_VIDEO_PAYLOAD_TYPE (112)
+#define SCH_TEST_AUDIO_PAYLOAD_TYPE (111)
+
 static void sch_create_test(mtl_handle mt) {
   struct mtl_sch_ops sch_ops;
   memset(&sch_ops, 0x0, sizeof(sch_ops));
@@ -239,3 +245,318 @@ TEST(Sch, tasklet_runtime) {
   para.runtime = true;
   sch_tasklet_digest_test(ctx->handle, &para);
 }
+
+struct tasklet_priority_test_ctx {
+  int ret;
+  uint64_t job;
+};
+
+static int test_tasklet_priority_handler(void* priv) {
+  struct tasklet_priority_test_ctx* ctx = (struct tasklet_priority_test_ctx*)priv;
+  ctx->job++;
+  return ctx->ret;
+}
+
+TEST(Sch, tasklet_priority) {
+  auto ctx = st_test_ctx();
+  mtl_handle mt = ctx->handle;
+  int ret;
+
+  struct mtl_sch_ops sch_ops;
+  memset(&sch_ops, 0x0, sizeof(sch_ops));
+  sch_ops.name = "sch_priority_test";
+  sch_ops.nb_tasklets = 4;
+
+  mtl_sch_handle sch = mtl_sch_create(mt, &sch_ops);
+  ASSERT_TRUE(sch != NULL);
+
+  /* realtime always busy so the sch never sleeps */
+  struct tasklet_priority_test_ctx rt_ctx = {MTL_TASKLET_HAS_PENDING, 0};
+  struct tasklet_priority_test_ctx normal_ctx = {MTL_TASKLET_ALL_DONE, 0};
+  struct tasklet_priority_test_ctx low_ctx = {MTL_TASKLET_ALL_DONE, 0};
+  struct tasklet_priority_test_ctx low_busy_ctx = {MTL_TASKLET_HAS_PENDING, 0};
+  struct {
+    struct tasklet_priority_test_ctx* ctx;
+    enum mtl_tasklet_priority priority;
+  } cfgs[] = {
+      {&rt_ctx, MTL_TASKLET_PRIORITY_REALTIME},
+      {&normal_ctx, MTL_TASKLET_PRIORITY_NORMAL},
+      {&low_ctx, MTL_TASKLET_PRIORITY_LOW},
+      {&low_busy_ctx, MTL_TASKLET_PRIORITY_LOW},
+  };
+  std::vector<mtl_tasklet_handle> handles;
+
+  struct mtl_tasklet_ops ops;
+  memset(&ops, 0x0, sizeof(ops));
+  ops.name = "priority_test";
+  ops.handler = test_tasklet_priority_handler;
+  for (auto& cfg : cfgs) {
+    ops.priv = cfg.ctx;
+    ops.priority = cfg.priority;
+    mtl_tasklet_handle handle = mtl_sch_register_tasklet(sch, &ops);
+    ASSERT_TRUE(handle != NULL);
+    handles.push_back(handle);
+  }
+
+  ret = mtl_sch_start(sch);
+  EXPECT_GE(ret, 0);
+  mtl_sleep_us(1000 * 1000);
+  ret = mtl_sch_stop(sch);
+  EXPECT_GE(ret, 0);
+
+  info("%s, realtime %" PRIu64 " normal %" PRIu64 " low %" PRIu64 " low busy %" PRIu64
+       "\n",
+       __func__, rt_ctx.job, normal_ctx.job, low_ctx.job, low_busy_ctx.job);
+  EXPECT_GT(low_ctx.job, 0);
+  /* idle tasklets back off to 8 and 64 loops, leave margin for the ramp up */
+  EXPECT_LT(normal_ctx.job * 4, rt_ctx.job);
+  EXPECT_LT(low_ctx.job * 32, rt_ctx.job);
+  EXPECT_LT(low_ctx.job, normal_ctx.job);
+  /* a busy tasklet is polled on every loop regardless of its class */
+  EXPECT_EQ(low_busy_ctx.job, rt_ctx.job);
+
+  for (auto handle : handles) {
+    ret = mtl_sch_unregister_tasklet(handle);
+    EXPECT_GE(ret, 0);
+  }
+  ret = mtl_sch_free(sch);
+  EXPECT_GE(ret, 0);
+}
+
+/* a session reporting every sch loop it gets polled on */
+struct sch_probe_test_ctx {
+  void* handle;
+  /* spin in the tasklet to load the sch loop */
+  std::atomic<bool> spin;
+  std::atomic<uint64_t> query;
+  /* the sch thread this session running on */
+  std::atomic<std::thread::id> tid;
+};
+
+static void sch_probe_init(struct sch_probe_test_ctx* ctx) {
+  ctx->handle = NULL;
+  ctx->spin = false;
+  ctx->query = 0;
+  ctx->tid = std::thread::id();
+}
+
+static void sch_probe_polled(struct sch_probe_test_ctx* ctx) {
+  ctx->tid = std::this_thread::get_id();
+  ctx->query++;
+  if (ctx->spin) {
+    uint64_t end = st_test_get_monotonic_time() + 6 * NS_PER_US;
+    while (st_test_get_monotonic_time() < end) {
+    }
+  }
+}
+
+static bool sch_probe_running(struct sch_probe_test_ctx* ctxs, int cnt) {
+  for (int i = 0; i < 100; i++) {
+    bool all_running = true;
+    for (int j = 0; j < cnt; j++) {
+      if (!ctxs[j].query) all_running = false;
+    }
+    if (all_running) return true;
+    mtl_sleep_us(10 * 1000);
+  }
+  return false;
+}
+
+static int sch_probe_next_frame(void* priv, uint16_t* next_frame_idx,
+                                struct st20_tx_frame_meta* meta) {
+  *next_frame_idx = 0;
+  return 0;
+}
+
+static int sch_probe_lines_ready(void* priv, uint16_t frame_idx,
+                                 struct st20_tx_slice_meta* meta) {
+  sch_probe_polled((struct sch_probe_test_ctx*)priv);
+  /* never ready, the lib query again on every sch loop */
+  meta->lines_ready = 0;
+  return 0;
+}
+
+/* a slice level 1080p tx video session which never sends */
+static st20_tx_handle sch_probe_video_create(struct st_tests_context* st,
+                                             struct sch_probe_test_ctx* ctx,
+                                             uint16_t udp_port) {
+  struct st20_tx_ops ops;
+  memset(&ops, 0, sizeof(ops));
+  ops.name = "sch_probe_test";
+  ops.priv = ctx;
+  ops.num_port = 1;
+  memcpy(ops.dip_addr[MTL_SESSION_PORT_P], st->mcast_ip_addr[MTL_PORT_P],
+         MTL_IP_ADDR_LEN);
+  snprintf(ops.port[MTL_SESSION_PORT_P], MTL_PORT_MAX_LEN, "%s",
+           st->para.port[MTL_PORT_P]);
+  ops.udp_port[MTL_SESSION_PORT_P] = udp_port;
+  ops.pacing = ST21_PACING_NARROW;
+  ops.type = ST20_TYPE_SLICE_LEVEL;
+  ops.width = 1920;
+  ops.height = 1080;
+  ops.fps = ST_FPS_P59_94;
+  ops.fmt = ST20_FMT_YUV_422_10BIT;
+  ops.payload_type = SCH_TEST_VIDEO_PAYLOAD_TYPE;
+  ops.framebuff_cnt = 2;
+  ops.get_next_frame = sch_probe_next_frame;
+  ops.query_frame_lines_ready = sch_probe_lines_ready;
+  return st20_tx_create(st->handle, &ops);
+}
+
+/* two spinning sessions on one sch and an idle session on another sch */
+TEST(Sch, rebalance) {
+  auto st = st_test_ctx();
+  const int session_cnt = 3;
+  struct sch_probe_test_ctx ctxs[session_cnt];
+  int ret;
+
+  if (!(st->para.flags & MTL_FLAG_SCH_REBALANCE)) {
+    info("%s, skip as sch_rebalance not enabled\n", __func__);
+    return;
+  }
+
+  st->sch_rebalance_cnt = 0;
+  for (int i = 0; i < session_cnt; i++) {
+    struct sch_probe_test_ctx* ctx = &ctxs[i];
+    sch_probe_init(ctx);
+    ctx->handle = sch_probe_video_create(st, ctx, 20000 + i * 2);
+    ASSERT_TRUE(ctx->handle != NULL);
+  }
+  sch_probe_running(ctxs, session_cnt);
+
+  /* find the two sessions sharing one sch, run with --sch_session_quota 2 */
+  int pair[2] = {-1, -1};
+  for (int i = 0; i < session_cnt && pair[0] < 0; i++) {
+    for (int j = i + 1; j < session_cnt; j++) {
+      if (ctxs[i].query && ctxs[i].tid.load() == ctxs[j].tid.load()) {
+        pair[0] = i;
+        pair[1] = j;
+        break;
+      }
+    }
+  }
+  int idle = session_cnt - pair[0] - pair[1];
+  if (pair[0] < 0 || ctxs[idle].tid.load() == ctxs[pair[0]].tid.load()) {
+    info("%s, skip as no two sessions on one sch, try --sch_session_quota 2\n",
+         __func__);
+  } else {
+    ctxs[pair[0]].spin = true;
+    ctxs[pair[1]].spin = true;
+
+    /* the admin check the load every 6s */
+    for (int i = 0; i < 30 && !st->sch_rebalance_cnt; i++) mtl_sleep_us(1000 * 1000);
+    ctxs[pair[0]].spin = false;
+    ctxs[pair[1]].spin = false;
+
+    struct mtl_sch_rebalance_meta* meta = &st->sch_rebalance_meta;
+    EXPECT_GT(st->sch_rebalance_cnt, 0);
+    if (st->sch_rebalance_cnt > 0) {
+      EXPECT_TRUE(meta->tx);
+      EXPECT_NE(meta->from_sch, meta->to_sch);
+      EXPECT_GE(meta->from_load, 60.0);
+      EXPECT_LE(meta->to_load, 30.0);
+      EXPECT_LT(meta->from_load_expect, meta->from_load);
+      EXPECT_LT(meta->to_load_expect, 60.0);
+      /* the moved session left the loaded sch */
+      mtl_sleep_us(100 * 1000);
+      EXPECT_NE(ctxs[pair[0]].tid.load(), ctxs[pair[1]].tid.load());
+    }
+  }
+
+  for (int i = 0; i < session_cnt; i++) {
+    ret = st20_tx_free((st20_tx_handle)ctxs[i].handle);
+    EXPECT_GE(ret, 0);
+  }
+}
+
+static int sch_probe_audio_next_frame(void* priv, uint16_t* next_frame_idx,
+                                      struct st30_tx_frame_meta* meta) {
+  sch_probe_polled((struct sch_probe_test_ctx*)priv);
+  return -EBUSY; /* no frame, the lib query again on every sch loop */
+}
+
+/* the avg ns of one loop for the sch the probe running on, same as the sch stat */
+static uint64_t sch_probe_avg_ns_loop(struct sch_probe_test_ctx* probe) {
+  uint64_t query = probe->query;
+  uint64_t start = st_test_get_monotonic_time();
+  mtl_sleep_us(1000 * 1000);
+  uint64_t loops = probe->query - query;
+  uint64_t ns = st_test_get_monotonic_time() - start;
+  return loops ? ns / loops : UINT64_MAX;
+}
+
+/* the loop time of the sch as idle tx audio sessions attached */
+TEST(Sch, session_walk_perf) {
+  auto st = st_test_ctx();
+  const int max_audio = 128;
+  const int steps[] = {16, 64, max_audio};
+  struct sch_probe_test_ctx probe;
+  std::vector<sch_probe_test_ctx> audio(max_audio);
+  int audio_cnt = 0;
+  int ret;
+
+  sch_probe_init(&probe);
+  probe.handle = sch_probe_video_create(st, &probe, 20000);
+  ASSERT_TRUE(probe.handle != NULL);
+  EXPECT_TRUE(sch_probe_running(&probe, 1));
+  uint64_t base_ns = sch_probe_avg_ns_loop(&probe);
+  info("%s, no audio session, avg %" PRIu64 " ns per loop\n", __func__, base_ns);
+  EXPECT_NE(base_ns, UINT64_MAX);
+
+  struct st30_tx_ops ops;
+  memset(&ops, 0, sizeof(ops));
+  ops.name = "sch_walk_test";
+  ops.num_port = 1;
+  memcpy(ops.dip_addr[MTL_SESSION_PORT_P], st->mcast_ip_addr[MTL_PORT_P],
+         MTL_IP_ADDR_LEN);
+  snprintf(ops.port[MTL_SESSION_PORT_P], MTL_PORT_MAX_LEN, "%s",
+           st->para.port[MTL_PORT_P]);
+  ops.type = ST30_TYPE_FRAME_LEVEL;
+  ops.channel = 2;
+  ops.fmt = ST30_FMT_PCM16;
+  ops.payload_type = SCH_TEST_AUDIO_PAYLOAD_TYPE;
+  ops.sampling = ST30_SAMPLING_48K;
+  ops.ptime = ST30_PTIME_1MS;
+  ops.framebuff_cnt = 2;
+  ops.framebuff_size =
+      st30_get_packet_size(ops.fmt, ops.ptime, ops.sampling, ops.channel);
+  ops.get_next_frame = sch_probe_audio_next_frame;
+
+  for (int step : steps) {
+    for (; audio_cnt < step; audio_cnt++) {
+      struct sch_probe_test_ctx* ctx = &audio[audio_cnt];
+      sch_probe_init(ctx);
+      ops.priv = ctx;
+      ops.udp_port[MTL_SESSION_PORT_P] = 30000 + audio_cnt;
+      ctx->handle = st30_tx_create(st->handle, &ops);
+      if (!ctx->handle) break;
+    }
+    if (audio_cnt < step) {
+      info("%s, only %d audio sessions created\n", __func__, audio_cnt);
+      break;
+    }
+    EXPECT_TRUE(sch_probe_running(audio.data(), audio_cnt));
+
+    /* only the sessions on the probe sch add to the loop */
+    int on_sch = 0;
+    std::thread::id tid = probe.tid;
+    for (int i = 0; i < audio_cnt; i++) {
+      if (audio[i].tid.load() == tid) on_sch++;
+    }
+    uint64_t avg_ns = sch_probe_avg_ns_loop(&probe);
+    info("%s, %d audio sessions(%d on the sch), avg %" PRIu64 " ns per loop\n",
+         __func__, audio_cnt, on_sch, avg_ns);
+    EXPECT_NE(avg_ns, UINT64_MAX);
+    if (on_sch && avg_ns > base_ns) {
+      /* the walk is plain loads, one idle session costs far less than 1us */
+      EXPECT_LT((avg_ns - base_ns) / on_sch, NS_PER_US);
+    }
+  }
+
+  for (int i = 0; i < audio_cnt; i++) {
+    ret = st30_tx_free((st30_tx_handle)audio[i].handle);
+    EXPECT_GE(ret, 0);
+  }
+  ret = st20_tx_free((st20_tx_handle)probe.handle);
+  EXPECT_GE(ret, 0);
+}
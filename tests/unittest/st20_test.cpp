@@ -1853,7 +1853,7 @@ static void st20_rx_digest_test(enum st20_type tx_type[], enum st20_type rx_type
                                 enum st20_fmt fmt[], bool check_fps,
                                 enum st_test_level level, int sessions = 1,
                                 bool out_of_order = false, bool hdr_split = false,
-                                bool enable_rtcp = false) {
+                                bool enable_rtcp = false, bool dma_offload = true) {
   auto ctx = (struct st_tests_context*)st_test_ctx();
   auto m_handle = ctx->handle;
   int ret;
@@ -2025,7 +2025,7 @@ static void st20_rx_digest_test(enum st20_type tx_type[], enum st20_type rx_type
     ops_rx.notify_slice_ready = st20_digest_rx_slice_ready;
     ops_rx.notify_rtp_ready = rx_rtp_ready;
     ops_rx.rtp_ring_size = 1024 * 2;
-    ops_rx.flags = ST20_RX_FLAG_DMA_OFFLOAD;
+    ops_rx.flags = dma_offload ? ST20_RX_FLAG_DMA_OFFLOAD : 0;
     if (hdr_split) ops_rx.flags |= ST20_RX_FLAG_HDR_SPLIT;
     if (enable_rtcp) {
       ops_rx.flags |= ST20_RX_FLAG_ENABLE_RTCP | ST20_RX_FLAG_SIMULATE_PKT_LOSS;
@@ -2597,6 +2597,20 @@ TEST(St20_rx, digest_ooo_slice_4320p) {
   }
 }
 
+TEST(St20_rx, digest_slice_1080p_burst) {
+  enum st20_type type[1] = {ST20_TYPE_FRAME_LEVEL};
+  enum st20_type rx_type[1] = {ST20_TYPE_SLICE_LEVEL};
+  enum st20_packing packing[1] = {ST20_PACKING_BPM};
+  enum st_fps fps[1] = {ST_FPS_P59_94};
+  int width[1] = {1920};
+  int height[1] = {1080};
+  bool interlaced[1] = {false};
+  enum st20_fmt fmt[1] = {ST20_FMT_YUV_422_10BIT};
+  /* no dma, the slice notify from the burst pkt handler */
+  st20_rx_digest_test(type, rx_type, packing, fps, width, height, interlaced, fmt, false,
+                      ST_TEST_LEVEL_MANDATORY, 1, false, false, false, false);
+}
+
 TEST(St20_rx, digest_hdr_split) {
   enum st20_type type[1] = {ST20_TYPE_FRAME_LEVEL};
   enum st20_type rx_type[1] = {ST20_TYPE_FRAME_LEVEL};
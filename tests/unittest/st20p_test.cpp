@@ -242,6 +242,21 @@ static int test_st20p_rx_frame_available(void* priv) {
   return 0;
 }
 
+static int test_st20p_rx_slice_ready(void* priv, struct st_frame* frame,
+                                     uint32_t ready_lines) {
+  tests_context* s = (tests_context*)priv;
+
+  if (ready_lines > frame->height) {
+    err("%s(%d), wrong ready_lines %u\n", __func__, s->idx, ready_lines);
+    return -EIO;
+  }
+  s->slice_cnt++;
+  s->slice_recv_lines = ready_lines;
+  s->slice_recv_timestamp = frame->timestamp;
+
+  return 0;
+}
+
 static void st20p_tx_ops_init(tests_context* st20, struct st20p_tx_ops* ops_tx) {
   auto ctx = st20->ctx;
 
@@ -493,16 +508,18 @@ static void test_st20p_rx_frame_thread(void* args) {
       s->pre_timestamp = (uint32_t)frame->timestamp;
     }
 
-    unsigned char* sha =
-        (unsigned char*)frame->addr[0] + frame->data_size - SHA256_DIGEST_LENGTH;
-    int i = 0;
-    for (i = 0; i < TEST_SHA_HIST_NUM; i++) {
-      unsigned char* target_sha = s->shas[i];
-      if (!memcmp(sha, target_sha, SHA256_DIGEST_LENGTH)) break;
-    }
-    if (i >= TEST_SHA_HIST_NUM) {
-      test_sha_dump("st20p_rx_error_sha", sha);
-      s->sha_fail_cnt++;
+    if (s->check_sha) {
+      unsigned char* sha =
+          (unsigned char*)frame->addr[0] + frame->data_size - SHA256_DIGEST_LENGTH;
+      int i = 0;
+      for (i = 0; i < TEST_SHA_HIST_NUM; i++) {
+        unsigned char* target_sha = s->shas[i];
+        if (!memcmp(sha, target_sha, SHA256_DIGEST_LENGTH)) break;
+      }
+      if (i >= TEST_SHA_HIST_NUM) {
+        test_sha_dump("st20p_rx_error_sha", sha);
+        s->sha_fail_cnt++;
+      }
     }
     /* directly put */
     st20p_rx_put_frame((st20p_rx_handle)handle, frame);
@@ -627,6 +644,7 @@ struct st20p_rx_digest_test_para {
   bool user_timestamp;
   bool vsync;
   bool pkt_convert;
+  bool slice_convert;
   size_t line_padding_size;
   bool send_done_check;
   bool interlace;
@@ -639,6 +657,10 @@ struct st20p_rx_digest_test_para {
   bool rx_timing_parser;
   bool rx_auto_detect;
   bool zero_payload_type;
+  uint16_t convert_workers;
+  bool tx_pkt_convert;
+  uint32_t rx_output_width;
+  uint32_t rx_output_height;
 };
 
 static void test_st20p_init_rx_digest_para(struct st20p_rx_digest_test_para* para) {
@@ -657,6 +679,7 @@ static void test_st20p_init_rx_digest_para(struct st20p_rx_digest_test_para* par
   para->user_timestamp = false;
   para->vsync = true;
   para->pkt_convert = false;
+  para->slice_convert = false;
   para->line_padding_size = 0;
   para->send_done_check = false;
   para->interlace = false;
@@ -668,6 +691,10 @@ static void test_st20p_init_rx_digest_para(struct st20p_rx_digest_test_para* par
   para->block_get = false;
   para->rx_auto_detect = false;
   para->zero_payload_type = false;
+  para->convert_workers = 0;
+  para->tx_pkt_convert = false;
+  para->rx_output_width = 0;
+  para->rx_output_height = 0;
 }
 
 static void st20p_rx_digest_test(enum st_fps fps[], int width[], int height[],
@@ -700,7 +727,7 @@ static void st20p_rx_digest_test(enum st_fps fps[], int width[], int height[],
     }
   }
 
-  if (para->pkt_convert) {
+  if (para->pkt_convert || para->slice_convert) {
     enum mtl_pmd_type pmd = ctx->para.pmd[MTL_PORT_R];
     if (MTL_PMD_DPDK_USER != pmd) {
       info("%s, skip as pmd %d is not dpdk user\n", __func__, pmd);
@@ -792,6 +819,8 @@ static void st20p_rx_digest_test(enum st_fps fps[], int width[], int height[],
     }
     if (para->user_timestamp) ops_tx.flags |= ST20P_TX_FLAG_USER_TIMESTAMP;
     if (para->vsync) ops_tx.flags |= ST20P_TX_FLAG_ENABLE_VSYNC;
+    ops_tx.convert_workers = para->convert_workers;
+    if (para->tx_pkt_convert) ops_tx.flags |= ST20P_TX_FLAG_PKT_CONVERT;
 
     if (para->rtcp) {
       ops_tx.flags |= ST20P_TX_FLAG_ENABLE_RTCP;
@@ -933,8 +962,16 @@ static void st20p_rx_digest_test(enum st_fps fps[], int width[], int height[],
     test_ctx_rx[i]->user_meta = para->user_meta;
     test_ctx_rx[i]->block_get = para->block_get;
     test_ctx_rx[i]->rx_timing_parser = para->rx_timing_parser;
+    test_ctx_rx[i]->check_sha = true;
+    if (para->rx_output_width) {
+      /* the scaled frame has no sha of tx */
+      test_ctx_rx[i]->width = para->rx_output_width;
+      test_ctx_rx[i]->height = para->rx_output_height;
+      test_ctx_rx[i]->check_sha = false;
+    }
     test_ctx_rx[i]->frame_size =
-        st_frame_size(rx_fmt[i], width[i], height[i], para->interlace);
+        st_frame_size(rx_fmt[i], test_ctx_rx[i]->width, test_ctx_rx[i]->height,
+                      para->interlace);
     /* copy sha */
     memcpy(test_ctx_rx[i]->shas, test_ctx_tx[i]->shas,
            TEST_SHA_HIST_NUM * SHA256_DIGEST_LENGTH);
@@ -1002,6 +1039,8 @@ static void st20p_rx_digest_test(enum st_fps fps[], int width[], int height[],
     ops_rx.port.ssrc = para->ssrc;
     ops_rx.width = width[i];
     ops_rx.height = height[i];
+    ops_rx.output_width = para->rx_output_width;
+    ops_rx.output_height = para->rx_output_height;
     ops_rx.fps = fps[i];
     ops_rx.output_fmt = rx_fmt[i];
     ops_rx.transport_fmt = t_fmt[i];
@@ -1015,6 +1054,7 @@ static void st20p_rx_digest_test(enum st_fps fps[], int width[], int height[],
       ops_rx.notify_frame_available = test_st20p_rx_frame_available;
     if (para->rx_timing_parser) ops_rx.flags |= ST20P_RX_FLAG_TIMING_PARSER_META;
     ops_rx.notify_event = test_ctx_notify_event;
+    ops_rx.convert_workers = para->convert_workers;
     if (para->rx_ext) {
       if (para->rx_dedicated_ext) {
         ops_rx.ext_frames = test_ctx_rx[i]->p_ext_frames;
@@ -1027,6 +1067,11 @@ static void st20p_rx_digest_test(enum st_fps fps[], int width[], int height[],
     }
     if (para->vsync) ops_rx.flags |= ST20P_RX_FLAG_ENABLE_VSYNC;
     if (para->pkt_convert) ops_rx.flags |= ST20P_RX_FLAG_PKT_CONVERT;
+    if (para->slice_convert) {
+      ops_rx.flags |= ST20P_RX_FLAG_SLICE_CONVERT;
+      ops_rx.slice_lines = height[i] / 16;
+      ops_rx.notify_slice_ready = test_st20p_rx_slice_ready;
+    }
     if (para->rx_auto_detect) ops_rx.flags |= ST20P_RX_FLAG_AUTO_DETECT;
 
     if (para->rtcp) {
@@ -1109,13 +1154,13 @@ static void st20p_rx_digest_test(enum st_fps fps[], int width[], int height[],
         test_ctx_rx[i]->vsync_cnt, vsyncrate_rx[i]);
     EXPECT_GT(test_ctx_rx[i]->vsync_cnt, 0);
 
-    /* with kernel:lo interfaces we don't have enough single core performance to perform
-     * this test */
-    if ((strcmp(ctx->para.port[MTL_PORT_P], "kernel:lo") != 0) &&
-        (strcmp(ctx->para.port[MTL_PORT_R], "kernel:lo") != 0))
+    /* with kernel:lo or kernel_uring:lo interfaces we don't have enough single core
+     * performance to perform this test */
+    if (!st_test_port_is_kernel_lo(ctx->para.port[MTL_PORT_P]) &&
+        !st_test_port_is_kernel_lo(ctx->para.port[MTL_PORT_R]))
       EXPECT_NEAR(vsyncrate_rx[i], st_frame_rate(fps[i]), st_frame_rate(fps[i]) * 0.1);
     else
-      info("%s, skip vsync check as it's kernel:lo\n", __func__);
+      info("%s, skip vsync check as it's kernel loopback\n", __func__);
 
     test_ctx_rx[i]->stop = true;
     if (para->block_get) st20p_rx_wake_block(rx_handle[i]);
@@ -1147,6 +1192,10 @@ static void st20p_rx_digest_test(enum st_fps fps[], int width[], int height[],
     EXPECT_LE(test_ctx_rx[i]->incomplete_frame_cnt, 4);
     EXPECT_EQ(test_ctx_rx[i]->sha_fail_cnt, 0);
     EXPECT_LE(test_ctx_rx[i]->user_meta_fail_cnt, 2);
+    if (para->slice_convert) {
+      info("%s, session %d slice_cnt %d\n", __func__, i, test_ctx_rx[i]->slice_cnt);
+      EXPECT_GT(test_ctx_rx[i]->slice_cnt, test_ctx_rx[i]->fb_rec);
+    }
     if (para->check_fps) {
       if (para->fail_interval || para->timeout_interval) {
         EXPECT_NEAR(framerate_rx[i], expect_framerate_rx[i],
@@ -1189,6 +1238,74 @@ TEST(St20p, digest_1080p_s1) {
   st20p_rx_digest_test(fps, width, height, tx_fmt, t_fmt, rx_fmt, &para);
 }
 
+/* run with --socket_batch on kernel:lo, the data check is the sha digest */
+TEST(St20p, digest_socket_batch) {
+  auto ctx = (struct st_tests_context*)st_test_ctx();
+  auto st = ctx->handle;
+  int num_port = st_test_num_port(ctx);
+  struct mtl_port_status stats;
+  uint64_t tx_pkts = 0, tx_batches = 0, rx_pkts = 0, rx_batches = 0;
+  int ret;
+
+  if (!(ctx->para.flags & MTL_FLAG_SOCKET_BATCH) ||
+      strncmp(ctx->para.port[MTL_PORT_P], "kernel:", strlen("kernel:"))) {
+    info("%s, skip as socket batch not enabled on kernel socket port\n", __func__);
+    return;
+  }
+
+  enum st_fps fps[1] = {ST_FPS_P59_94};
+  int width[1] = {1920};
+  int height[1] = {1080};
+  enum st_frame_fmt tx_fmt[1] = {ST_FRAME_FMT_YUV422RFC4175PG2BE10};
+  enum st20_fmt t_fmt[1] = {ST20_FMT_YUV_422_10BIT};
+  enum st_frame_fmt rx_fmt[1] = {ST_FRAME_FMT_YUV422RFC4175PG2BE10};
+
+  struct st20p_rx_digest_test_para para;
+  test_st20p_init_rx_digest_para(&para);
+  para.check_fps = false;
+
+  for (int port = 0; port < num_port; port++)
+    mtl_reset_port_stats(st, (enum mtl_port)port);
+  st20p_rx_digest_test(fps, width, height, tx_fmt, t_fmt, rx_fmt, &para);
+
+  for (int port = 0; port < num_port; port++) {
+    ret = mtl_get_port_stats(st, (enum mtl_port)port, &stats);
+    EXPECT_GE(ret, 0);
+    tx_pkts += stats.tx_packets;
+    tx_batches += stats.tx_batches;
+    rx_pkts += stats.rx_packets;
+    rx_batches += stats.rx_batches;
+  }
+  info("%s, tx %" PRIu64 " pkts in %" PRIu64 " batches, rx %" PRIu64 " pkts in %" PRIu64
+       " batches\n",
+       __func__, tx_pkts, tx_batches, rx_pkts, rx_batches);
+  EXPECT_GT(tx_batches, 0);
+  EXPECT_GT(rx_batches, 0);
+  /* one sendmmsg/recvmmsg carries at least one pkt */
+  EXPECT_GE(tx_pkts, tx_batches);
+  EXPECT_GE(rx_pkts, rx_batches);
+}
+
+TEST(St20p, digest_scale_s2) {
+  enum st_fps fps[2] = {ST_FPS_P59_94, ST_FPS_P50};
+  int width[2] = {1920, 1920};
+  int height[2] = {1080, 1080};
+  enum st_frame_fmt tx_fmt[2] = {ST_FRAME_FMT_YUV422RFC4175PG2BE10,
+                                 ST_FRAME_FMT_YUV422RFC4175PG2BE10};
+  enum st20_fmt t_fmt[2] = {ST20_FMT_YUV_422_10BIT, ST20_FMT_YUV_422_10BIT};
+  enum st_frame_fmt rx_fmt[2] = {ST_FRAME_FMT_YUV422RFC4175PG2BE10,
+                                 ST_FRAME_FMT_YUV422PLANAR10LE};
+
+  struct st20p_rx_digest_test_para para;
+  test_st20p_init_rx_digest_para(&para);
+  para.sessions = 2;
+  para.check_fps = false;
+  para.rx_output_width = 1280;
+  para.rx_output_height = 720;
+
+  st20p_rx_digest_test(fps, width, height, tx_fmt, t_fmt, rx_fmt, &para);
+}
+
 TEST(St20p, digest_1080i_s2) {
   enum st_fps fps[2] = {ST_FPS_P50, ST_FPS_P50};
   int width[2] = {1920, 1920};
@@ -1334,6 +1451,83 @@ TEST(St20p, digest_1080p_packet_convert_s2) {
   st20p_rx_digest_test(fps, width, height, tx_fmt, t_fmt, rx_fmt, &para);
 }
 
+TEST(St20p, digest_1080p_packet_convert_fmts_s2) {
+  enum st_fps fps[2] = {ST_FPS_P50, ST_FPS_P59_94};
+  int width[2] = {1920, 1920};
+  int height[2] = {1080, 1080};
+  enum st_frame_fmt tx_fmt[2] = {ST_FRAME_FMT_YUV422PLANAR12LE,
+                                 ST_FRAME_FMT_YUV444PLANAR10LE};
+  enum st20_fmt t_fmt[2] = {ST20_FMT_YUV_422_12BIT, ST20_FMT_YUV_444_10BIT};
+  enum st_frame_fmt rx_fmt[2] = {ST_FRAME_FMT_YUV422PLANAR12LE,
+                                 ST_FRAME_FMT_YUV444PLANAR10LE};
+
+  struct st20p_rx_digest_test_para para;
+  test_st20p_init_rx_digest_para(&para);
+  para.sessions = 2;
+  para.device = ST_PLUGIN_DEVICE_TEST_INTERNAL;
+  para.check_fps = false;
+  para.pkt_convert = true;
+  para.send_done_check = false;
+
+  st20p_rx_digest_test(fps, width, height, tx_fmt, t_fmt, rx_fmt, &para);
+}
+
+TEST(St20p, digest_1080p_slice_convert_s2) {
+  enum st_fps fps[2] = {ST_FPS_P50, ST_FPS_P59_94};
+  int width[2] = {1920, 1920};
+  int height[2] = {1080, 1080};
+  enum st_frame_fmt tx_fmt[2] = {ST_FRAME_FMT_YUV422PLANAR10LE, ST_FRAME_FMT_Y210};
+  enum st20_fmt t_fmt[2] = {ST20_FMT_YUV_422_10BIT, ST20_FMT_YUV_422_10BIT};
+  enum st_frame_fmt rx_fmt[2] = {ST_FRAME_FMT_YUV422PLANAR10LE, ST_FRAME_FMT_Y210};
+
+  struct st20p_rx_digest_test_para para;
+  test_st20p_init_rx_digest_para(&para);
+  para.sessions = 2;
+  para.device = ST_PLUGIN_DEVICE_TEST_INTERNAL;
+  para.check_fps = false;
+  para.slice_convert = true;
+  para.send_done_check = false;
+
+  st20p_rx_digest_test(fps, width, height, tx_fmt, t_fmt, rx_fmt, &para);
+}
+
+TEST(St20p, digest_1080p_tx_packet_convert_s2) {
+  enum st_fps fps[2] = {ST_FPS_P50, ST_FPS_P59_94};
+  int width[2] = {1920, 1920};
+  int height[2] = {1080, 1080};
+  enum st_frame_fmt tx_fmt[2] = {ST_FRAME_FMT_YUV422PLANAR10LE, ST_FRAME_FMT_Y210};
+  enum st20_fmt t_fmt[2] = {ST20_FMT_YUV_422_10BIT, ST20_FMT_YUV_422_10BIT};
+  enum st_frame_fmt rx_fmt[2] = {ST_FRAME_FMT_YUV422PLANAR10LE, ST_FRAME_FMT_Y210};
+
+  struct st20p_rx_digest_test_para para;
+  test_st20p_init_rx_digest_para(&para);
+  para.sessions = 2;
+  para.device = ST_PLUGIN_DEVICE_TEST_INTERNAL;
+  para.check_fps = false;
+  para.tx_pkt_convert = true;
+
+  st20p_rx_digest_test(fps, width, height, tx_fmt, t_fmt, rx_fmt, &para);
+}
+
+TEST(St20p, digest_1080p_convert_workers_s2) {
+  enum st_fps fps[2] = {ST_FPS_P50, ST_FPS_P59_94};
+  int width[2] = {1920, 1920};
+  int height[2] = {1080, 1080};
+  enum st_frame_fmt tx_fmt[2] = {ST_FRAME_FMT_YUV422PLANAR10LE, ST_FRAME_FMT_Y210};
+  enum st20_fmt t_fmt[2] = {ST20_FMT_YUV_422_10BIT, ST20_FMT_YUV_422_10BIT};
+  enum st_frame_fmt rx_fmt[2] = {ST_FRAME_FMT_YUV422PLANAR10LE, ST_FRAME_FMT_Y210};
+
+  struct st20p_rx_digest_test_para para;
+  test_st20p_init_rx_digest_para(&para);
+  para.sessions = 2;
+  para.device = ST_PLUGIN_DEVICE_TEST_INTERNAL;
+  para.check_fps = false;
+  para.convert_workers = 1;
+  para.send_done_check = false;
+
+  st20p_rx_digest_test(fps, width, height, tx_fmt, t_fmt, rx_fmt, &para);
+}
+
 TEST(St20p, tx_ext_digest_1080p_no_convert_s2) {
   enum st_fps fps[2] = {ST_FPS_P50, ST_FPS_P59_94};
   int width[2] = {1920, 1920};
@@ -1610,3 +1804,95 @@ TEST(St20p, transport_yuv422p10le) {
 
   st20p_rx_digest_test(fps, width, height, tx_fmt, t_fmt, rx_fmt, &para);
 }
+
+TEST(St20p, tx_get_put_latency) {
+  auto ctx = st_test_ctx();
+  auto m_handle = ctx->handle;
+  struct st20p_tx_ops ops_tx;
+  int ret;
+  int fb_cnt = 3;
+  int target = 30 * fb_cnt; /* 30 rounds of all frames */
+  uint64_t get_min = UINT64_MAX, get_max = 0, get_sum = 0;
+  uint64_t put_min = UINT64_MAX, put_max = 0, put_sum = 0;
+  int cnt = 0;
+
+  auto test_ctx = new tests_context();
+  ASSERT_TRUE(test_ctx != NULL);
+  test_ctx->idx = 0;
+  test_ctx->ctx = ctx;
+  test_ctx->fb_cnt = fb_cnt;
+  st20p_tx_ops_init(test_ctx, &ops_tx);
+  /* derive mode, only the frame rings in the get/put path */
+  ops_tx.input_fmt = ST_FRAME_FMT_YUV422RFC4175PG2BE10;
+  ops_tx.notify_frame_available = NULL;
+  st20p_tx_handle tx_handle = st20p_tx_create(m_handle, &ops_tx);
+  ASSERT_TRUE(tx_handle != NULL);
+
+  ret = mtl_start(m_handle);
+  EXPECT_GE(ret, 0);
+
+  /* all frames free at the start, get fails exactly when all frames are held */
+  std::vector<struct st_frame*> held;
+  for (int i = 0; i < fb_cnt; i++) {
+    struct st_frame* frame = st20p_tx_get_frame(tx_handle);
+    EXPECT_TRUE(frame != NULL);
+    if (frame) held.push_back(frame);
+  }
+  EXPECT_TRUE(st20p_tx_get_frame(tx_handle) == NULL);
+  for (auto frame : held) {
+    ret = st20p_tx_put_frame(tx_handle, frame);
+    EXPECT_GE(ret, 0);
+  }
+  held.clear();
+
+  uint64_t deadline = st_test_get_monotonic_time() + (uint64_t)NS_PER_S * 10;
+  while (cnt < target && st_test_get_monotonic_time() < deadline) {
+    uint64_t start = st_test_get_monotonic_time();
+    struct st_frame* frame = st20p_tx_get_frame(tx_handle);
+    uint64_t get_ns = st_test_get_monotonic_time() - start;
+    if (!frame) { /* all frames in the transport, wait it done */
+      st_usleep(1000);
+      continue;
+    }
+    start = st_test_get_monotonic_time();
+    ret = st20p_tx_put_frame(tx_handle, frame);
+    uint64_t put_ns = st_test_get_monotonic_time() - start;
+    EXPECT_GE(ret, 0);
+
+    if (get_ns < get_min) get_min = get_ns;
+    if (get_ns > get_max) get_max = get_ns;
+    get_sum += get_ns;
+    if (put_ns < put_min) put_min = put_ns;
+    if (put_ns > put_max) put_max = put_ns;
+    put_sum += put_ns;
+    cnt++;
+  }
+  EXPECT_EQ(cnt, target);
+
+  /* every frame should cycle back to free once the transport is done with it */
+  deadline = st_test_get_monotonic_time() + (uint64_t)NS_PER_S * 5;
+  while ((int)held.size() < fb_cnt && st_test_get_monotonic_time() < deadline) {
+    struct st_frame* frame = st20p_tx_get_frame(tx_handle);
+    if (frame)
+      held.push_back(frame);
+    else
+      st_usleep(1000);
+  }
+  EXPECT_EQ((int)held.size(), fb_cnt);
+  EXPECT_TRUE(st20p_tx_get_frame(tx_handle) == NULL);
+
+  ret = mtl_stop(m_handle);
+  EXPECT_GE(ret, 0);
+  ret = st20p_tx_free(tx_handle);
+  EXPECT_GE(ret, 0);
+
+  /* log only, the wall clock latency is not stable on a shared runner */
+  if (cnt) {
+    info("%s, get min %" PRIu64 " avg %" PRIu64 " max %" PRIu64 " ns\n", __func__,
+         get_min, get_sum / cnt, get_max);
+    info("%s, put min %" PRIu64 " avg %" PRIu64 " max %" PRIu64 " ns\n", __func__,
+         put_min, put_sum / cnt, put_max);
+  }
+
+  delete test_ctx;
+}
@@ -2,6 +2,7 @@
  * Copyright(c) 2022 Intel Corporation
  */
 
+#include <atomic>
 #include <thread>
 
 #include "log.h"
@@ -1156,3 +1157,96 @@ TEST(St40_rx, after_start_mix_s2_r2) {
   enum st_fps fps[2] = {ST_FPS_P50, ST_FPS_P59_94};
   st40_after_start_test(type, fps, 2, 2);
 }
+
+struct st40_detach_test_ctx {
+  std::atomic<bool> detached;
+  std::atomic<int> late_cb_cnt;
+};
+
+static int tx_anc_next_frame_detach(void* priv, uint16_t* next_frame_idx,
+                                    struct st40_tx_frame_meta* meta) {
+  auto ctx = (tests_context*)priv;
+  auto detach = (struct st40_detach_test_ctx*)ctx->priv;
+
+  /* the tasklet should never reach a session after the free return */
+  if (detach->detached) detach->late_cb_cnt++;
+  return tx_next_frame(priv, next_frame_idx);
+}
+
+/* attach and detach sessions while the mgr tasklet is walking the lockless slots */
+static void st40_tx_attach_detach_test(int loops) {
+  auto ctx = (struct st_tests_context*)st_test_ctx();
+  auto m_handle = ctx->handle;
+  int ret;
+  struct st40_tx_ops ops;
+
+  std::vector<tests_context*> test_ctx(loops + 1);
+  std::vector<struct st40_detach_test_ctx*> detach_ctx(loops + 1);
+  std::vector<st40_tx_handle> handle(loops + 1);
+
+  for (int i = 0; i <= loops; i++) {
+    test_ctx[i] = new tests_context();
+    ASSERT_TRUE(test_ctx[i] != NULL);
+    detach_ctx[i] = new st40_detach_test_ctx();
+    ASSERT_TRUE(detach_ctx[i] != NULL);
+    detach_ctx[i]->detached = false;
+    detach_ctx[i]->late_cb_cnt = 0;
+
+    test_ctx[i]->idx = i;
+    test_ctx[i]->ctx = ctx;
+    test_ctx[i]->fb_cnt = 3;
+    test_ctx[i]->fb_idx = 0;
+    test_ctx[i]->priv = detach_ctx[i];
+  }
+
+  /* session 0 keep the tasklet busy during the whole test */
+  st40_tx_ops_init(test_ctx[0], &ops);
+  ops.get_next_frame = tx_anc_next_frame_detach;
+  handle[0] = st40_tx_create(m_handle, &ops);
+  ASSERT_TRUE(handle[0] != NULL);
+  st40_tx_frame_init(test_ctx[0], handle[0], ST40_TYPE_FRAME_LEVEL);
+  test_ctx[0]->handle = handle[0];
+
+  ret = mtl_start(m_handle);
+  EXPECT_GE(ret, 0);
+
+  for (int i = 1; i <= loops; i++) {
+    st40_tx_ops_init(test_ctx[i], &ops);
+    ops.get_next_frame = tx_anc_next_frame_detach;
+    handle[i] = st40_tx_create(m_handle, &ops);
+    ASSERT_TRUE(handle[i] != NULL);
+    st40_tx_frame_init(test_ctx[i], handle[i], ST40_TYPE_FRAME_LEVEL);
+    test_ctx[i]->handle = handle[i];
+
+    mtl_sleep_us(100 * 1000);
+
+    uint64_t start = st_test_get_monotonic_time();
+    ret = st40_tx_free(handle[i]);
+    uint64_t free_ns = st_test_get_monotonic_time() - start;
+    detach_ctx[i]->detached = true;
+    EXPECT_GE(ret, 0);
+    /* the detach waits only for the in-flight tasklet pass */
+    EXPECT_LT(free_ns, (uint64_t)NS_PER_S);
+    EXPECT_GT(test_ctx[i]->fb_send, 0);
+    dbg("%s, loop %d free %" PRIu64 "us\n", __func__, i, free_ns / 1000);
+  }
+
+  /* give the tasklet time to reach any stale slot */
+  mtl_sleep_us(100 * 1000);
+  ret = mtl_stop(m_handle);
+  EXPECT_GE(ret, 0);
+
+  EXPECT_GT(test_ctx[0]->fb_send, 0);
+  ret = st40_tx_free(handle[0]);
+  EXPECT_GE(ret, 0);
+  for (int i = 0; i <= loops; i++) {
+    EXPECT_EQ(detach_ctx[i]->late_cb_cnt, 0);
+    st40_tx_frame_uinit(test_ctx[i]);
+    delete detach_ctx[i];
+    delete test_ctx[i];
+  }
+}
+
+TEST(St40_tx, attach_detach_lockless) {
+  st40_tx_attach_detach_test(10);
+}
@@ -48,6 +48,8 @@ enum test_args_cmd {
   TEST_ARG_MCAST_ONLY,
   TEST_ARG_ALLOW_ACROSS_NUMA_CORE,
   TEST_ARG_AUDIO_TX_PACING,
+  TEST_ARG_SCH_REBALANCE,
+  TEST_ARG_SOCKET_BATCH,
 };
 
 static struct option test_args_options[] = {
@@ -85,6 +87,8 @@ static struct option test_args_options[] = {
     {"mcast_only", no_argument, 0, TEST_ARG_MCAST_ONLY},
     {"allow_across_numa_core", no_argument, 0, TEST_ARG_ALLOW_ACROSS_NUMA_CORE},
     {"audio_tx_pacing", required_argument, 0, TEST_ARG_AUDIO_TX_PACING},
+    {"sch_rebalance", no_argument, 0, TEST_ARG_SCH_REBALANCE},
+    {"socket_batch", no_argument, 0, TEST_ARG_SOCKET_BATCH},
 
     {0, 0, 0, 0}};
 
@@ -110,6 +114,15 @@ static int test_args_dma_dev(struct mtl_init_params* p, const char* in_dev) {
   return 0;
 }
 
+static void test_sch_rebalance_notify(void* priv, struct mtl_sch_rebalance_meta* meta) {
+  auto ctx = (struct st_tests_context*)priv;
+
+  info("%s, %s session(%d,%d) to sch %d, load %f:%f\n", __func__, meta->tx ? "tx" : "rx",
+       meta->from_sch, meta->from_idx, meta->to_sch, meta->from_load, meta->to_load);
+  ctx->sch_rebalance_meta = *meta;
+  ctx->sch_rebalance_cnt++;
+}
+
 static int test_parse_args(struct st_tests_context* ctx, struct mtl_init_params* p,
                            int argc, char** argv) {
   int cmd = -1, opt_idx = 0;
@@ -284,6 +297,13 @@ static int test_parse_args(struct st_tests_context* ctx, struct mtl_init_params*
         else
           err("%s, unknow audio tx pacing %s\n", __func__, optarg);
         break;
+      case TEST_ARG_SCH_REBALANCE:
+        p->flags |= MTL_FLAG_SCH_REBALANCE;
+        p->sch_rebalance_notify = test_sch_rebalance_notify;
+        break;
+      case TEST_ARG_SOCKET_BATCH:
+        p->flags |= MTL_FLAG_SOCKET_BATCH;
+        break;
       default:
         break;
     }
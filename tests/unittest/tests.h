@@ -108,6 +108,10 @@ struct st_tests_context {
 
   enum st30_tx_pacing_way tx_audio_pacing_way;
 
+  /* updated from the admin thread by the sch rebalance notify */
+  int sch_rebalance_cnt;
+  struct mtl_sch_rebalance_meta sch_rebalance_meta;
+
   st22_encoder_dev_handle encoder_dev_handle;
   st22_decoder_dev_handle decoder_dev_handle;
   st20_converter_dev_handle converter_dev_handle;
@@ -128,6 +132,11 @@ static inline int st_test_num_port(struct st_tests_context* ctx) {
   return ctx->para.num_ports;
 }
 
+/* kernel:lo or kernel_uring:lo */
+static inline bool st_test_port_is_kernel_lo(const char* port) {
+  return !strcmp(port, "kernel:lo") || !strcmp(port, "kernel_uring:lo");
+}
+
 static inline void st_test_jxs_fail_interval(struct st_tests_context* ctx, int interval) {
   ctx->plugin_fail_interval = interval;
 }
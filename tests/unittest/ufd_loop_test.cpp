@@ -2,9 +2,17 @@
  * Copyright(c) 2022 Intel Corporation
  */
 
+#ifndef WINDOWSENV
+#include <poll.h>
+#endif
+
 #include "log.h"
 #include "ufd_test.h"
 
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103 /* Set GSO segmentation size */
+#endif
+
 struct loop_para {
   int sessions;
   uint16_t udp_port;
@@ -438,3 +446,478 @@ TEST(Loop, mcast_multi_shared_max) {
   para.tx_sleep_us = 0;
   loop_sanity_test(ctx, &para);
 }
+
+/* the tx socket on MTL_PORT_P and the rx socket bind to rx_addr on MTL_PORT_R */
+static int loop_open_pair(struct utest_ctx* ctx, struct loop_para* para, int* tx_fd,
+                          int* rx_fd, struct sockaddr_in* rx_addr) {
+  struct mtl_init_params* p = &ctx->init_params.mt_params;
+  int ret;
+
+  *tx_fd = -1;
+  *rx_fd = -1;
+  mufd_init_sockaddr(rx_addr, p->sip_addr[MTL_PORT_R], para->udp_port);
+
+  ret = mufd_socket_port(AF_INET, SOCK_DGRAM, 0, MTL_PORT_P);
+  EXPECT_GE(ret, 0);
+  if (ret < 0) return ret;
+  *tx_fd = ret;
+
+  ret = mufd_socket_port(AF_INET, SOCK_DGRAM, 0, MTL_PORT_R);
+  EXPECT_GE(ret, 0);
+  if (ret < 0) return ret;
+  *rx_fd = ret;
+
+  ret = mufd_bind(*rx_fd, (const struct sockaddr*)rx_addr, sizeof(*rx_addr));
+  EXPECT_GE(ret, 0);
+  if (ret < 0) return ret;
+
+  struct timeval tv;
+  tv.tv_sec = 0;
+  tv.tv_usec = para->rx_timeout_us;
+  ret = mufd_setsockopt(*rx_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  EXPECT_GE(ret, 0);
+  if (ret < 0) return ret;
+
+  return 0;
+}
+
+static void loop_close_pair(int* tx_fd, int* rx_fd) {
+  if (*tx_fd >= 0) mufd_close(*tx_fd);
+  if (*rx_fd >= 0) mufd_close(*rx_fd);
+  *tx_fd = -1;
+  *rx_fd = -1;
+}
+
+/* random payload with the idx at the first byte and the sha digest at the end */
+static void loop_sha_fill(char* buf, int udp_len, int idx) {
+  int payload_len = udp_len - SHA256_DIGEST_LENGTH;
+
+  st_test_rand_data((uint8_t*)buf, payload_len, 0);
+  buf[0] = idx;
+  SHA256((unsigned char*)buf, payload_len, (unsigned char*)buf + payload_len);
+}
+
+/* check the len, the idx and the sha digest of one pkt by loop_sha_fill */
+static void loop_sha_check(const char* buf, size_t len, int udp_len, int idx) {
+  int payload_len = udp_len - SHA256_DIGEST_LENGTH;
+  unsigned char sha_result[SHA256_DIGEST_LENGTH];
+
+  EXPECT_EQ(len, (size_t)udp_len);
+  /* check idx */
+  EXPECT_EQ((char)idx, buf[0]);
+  /* check sha */
+  SHA256((const unsigned char*)buf, payload_len, sha_result);
+  EXPECT_EQ(memcmp(buf + payload_len, sha_result, SHA256_DIGEST_LENGTH), 0);
+}
+
+static int loop_mmsg_test(struct utest_ctx* ctx, struct loop_para* para, int vlen) {
+  int udp_len = para->udp_len;
+  struct sockaddr_in rx_addr;
+  int tx_fd = -1, rx_fd = -1;
+  int rx_timeout = 0;
+  int ret;
+
+  std::vector<struct mmsghdr> tx_msgs(vlen);
+  std::vector<struct mmsghdr> rx_msgs(vlen);
+  std::vector<struct iovec> tx_iovs(vlen);
+  std::vector<struct iovec> rx_iovs(vlen);
+  char* send_buf = new char[udp_len * vlen];
+  char* recv_buf = new char[udp_len * vlen];
+
+  for (int i = 0; i < vlen; i++) {
+    tx_iovs[i].iov_base = send_buf + udp_len * i;
+    tx_iovs[i].iov_len = udp_len;
+    memset(&tx_msgs[i], 0, sizeof(tx_msgs[i]));
+    tx_msgs[i].msg_hdr.msg_name = &rx_addr;
+    tx_msgs[i].msg_hdr.msg_namelen = sizeof(rx_addr);
+    tx_msgs[i].msg_hdr.msg_iov = &tx_iovs[i];
+    tx_msgs[i].msg_hdr.msg_iovlen = 1;
+
+    rx_iovs[i].iov_base = recv_buf + udp_len * i;
+    rx_iovs[i].iov_len = udp_len;
+    memset(&rx_msgs[i], 0, sizeof(rx_msgs[i]));
+    rx_msgs[i].msg_hdr.msg_iov = &rx_iovs[i];
+    rx_msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  ret = loop_open_pair(ctx, para, &tx_fd, &rx_fd, &rx_addr);
+  if (ret < 0) goto exit;
+
+  for (int loop = 0; loop < para->tx_pkts / vlen; loop++) {
+    for (int i = 0; i < vlen; i++) loop_sha_fill(send_buf + udp_len * i, udp_len, i);
+    ret = mufd_sendmmsg(tx_fd, tx_msgs.data(), vlen, 0);
+    EXPECT_EQ(ret, vlen);
+    for (int i = 0; i < vlen; i++) EXPECT_EQ(tx_msgs[i].msg_len, (unsigned int)udp_len);
+    if (para->tx_sleep_us) st_usleep(para->tx_sleep_us);
+
+    int received = 0;
+    while (received < vlen) {
+      ret = mufd_recvmmsg(rx_fd, rx_msgs.data() + received, vlen - received, 0, NULL);
+      if (ret <= 0) { /* timeout */
+        rx_timeout++;
+        err("%s, recv fail %d at pkt %d\n", __func__, ret, loop);
+        break;
+      }
+      for (int i = received; i < received + ret; i++)
+        loop_sha_check(recv_buf + udp_len * i, rx_msgs[i].msg_len, udp_len, i);
+      received += ret;
+    }
+  }
+
+  /* rx timeout max check */
+  EXPECT_LT(rx_timeout, para->max_rx_timeout_pkts);
+
+exit:
+  loop_close_pair(&tx_fd, &rx_fd);
+  delete[] send_buf;
+  delete[] recv_buf;
+  return 0;
+}
+
+TEST(Loop, mmsg_single) {
+  struct utest_ctx* ctx = utest_get_ctx();
+  struct loop_para para;
+
+  loop_para_init(&para);
+  loop_mmsg_test(ctx, &para, 16);
+}
+
+static int loop_zc_test(struct utest_ctx* ctx, struct loop_para* para, int nb) {
+  int udp_len = para->udp_len;
+  struct sockaddr_in rx_addr;
+  int tx_fd = -1, rx_fd = -1;
+  int rx_timeout = 0;
+  int ret;
+
+  std::vector<struct mudp_zc_buf> bufs(nb);
+  char* send_buf = new char[udp_len];
+
+  ret = loop_open_pair(ctx, para, &tx_fd, &rx_fd, &rx_addr);
+  if (ret < 0) goto exit;
+
+  for (int loop = 0; loop < para->tx_pkts / nb; loop++) {
+    for (int i = 0; i < nb; i++) {
+      loop_sha_fill(send_buf, udp_len, i);
+      ssize_t send = mufd_sendto(tx_fd, send_buf, udp_len, 0,
+                                 (const struct sockaddr*)&rx_addr, sizeof(rx_addr));
+      EXPECT_EQ((size_t)send, udp_len);
+    }
+    if (para->tx_sleep_us) st_usleep(para->tx_sleep_us);
+
+    int received = 0;
+    while (received < nb) {
+      ret = mufd_recv_zc(rx_fd, bufs.data(), nb - received, 0);
+      if (ret <= 0) { /* timeout */
+        rx_timeout++;
+        err("%s, recv fail %d at pkt %d\n", __func__, ret, loop);
+        break;
+      }
+      for (int i = 0; i < ret; i++)
+        loop_sha_check((const char*)bufs[i].payload, bufs[i].len, udp_len, received + i);
+      received += ret;
+      ret = mufd_release_zc(rx_fd, bufs.data(), ret);
+      EXPECT_GE(ret, 0);
+    }
+  }
+
+  /* rx timeout max check */
+  EXPECT_LT(rx_timeout, para->max_rx_timeout_pkts);
+
+  /* the close is rejected until all the lent buffers are released */
+  loop_sha_fill(send_buf, udp_len, 0);
+  mufd_sendto(tx_fd, send_buf, udp_len, 0, (const struct sockaddr*)&rx_addr,
+              sizeof(rx_addr));
+  ret = mufd_recv_zc(rx_fd, bufs.data(), 1, 0);
+  if (ret > 0) {
+    EXPECT_LT(mufd_close(rx_fd), 0);
+    EXPECT_EQ(0, mufd_release_zc(rx_fd, bufs.data(), ret));
+  }
+
+exit:
+  loop_close_pair(&tx_fd, &rx_fd);
+  delete[] send_buf;
+  return 0;
+}
+
+TEST(Loop, zc_single) {
+  struct utest_ctx* ctx = utest_get_ctx();
+  struct loop_para para;
+
+  loop_para_init(&para);
+  loop_zc_test(ctx, &para, 16);
+}
+
+static int loop_gso_test(struct utest_ctx* ctx, struct loop_para* para, int segs) {
+  int udp_len = para->udp_len;
+  struct sockaddr_in rx_addr;
+  int tx_fd = -1, rx_fd = -1;
+  int rx_timeout = 0;
+  int ret;
+
+  char* send_buf = new char[udp_len * segs];
+  char* recv_buf = new char[udp_len];
+  struct iovec iov;
+  struct msghdr msg;
+  char control[CMSG_SPACE(sizeof(uint16_t))];
+  struct cmsghdr* cmsg;
+
+  iov.iov_base = send_buf;
+  iov.iov_len = udp_len * segs;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_name = &rx_addr;
+  msg.msg_namelen = sizeof(rx_addr);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  memset(control, 0, sizeof(control));
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_UDP;
+  cmsg->cmsg_type = UDP_SEGMENT;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+  *((uint16_t*)CMSG_DATA(cmsg)) = udp_len;
+
+  ret = loop_open_pair(ctx, para, &tx_fd, &rx_fd, &rx_addr);
+  if (ret < 0) goto exit;
+
+  for (int loop = 0; loop < para->tx_pkts / segs; loop++) {
+    for (int i = 0; i < segs; i++) loop_sha_fill(send_buf + udp_len * i, udp_len, i);
+    ssize_t send = mufd_sendmsg(tx_fd, &msg, 0);
+    EXPECT_EQ((size_t)send, iov.iov_len);
+    if (para->tx_sleep_us) st_usleep(para->tx_sleep_us);
+
+    /* each segment should arrive as one datagram */
+    for (int i = 0; i < segs; i++) {
+      ssize_t recv = mufd_recvfrom(rx_fd, recv_buf, udp_len, 0, NULL, NULL);
+      if (recv < 0) { /* timeout */
+        rx_timeout++;
+        err("%s, recv fail %d at seg %d pkt %d\n", __func__, (int)recv, i, loop);
+        continue;
+      }
+      loop_sha_check(recv_buf, recv, udp_len, i);
+    }
+  }
+
+  /* rx timeout max check */
+  EXPECT_LT(rx_timeout, para->max_rx_timeout_pkts);
+
+exit:
+  loop_close_pair(&tx_fd, &rx_fd);
+  delete[] send_buf;
+  delete[] recv_buf;
+  return 0;
+}
+
+TEST(Loop, gso_single) {
+  struct utest_ctx* ctx = utest_get_ctx();
+  struct loop_para para;
+
+  loop_para_init(&para);
+  loop_gso_test(ctx, &para, 8);
+}
+
+/* one sendto split by the UDP_SEGMENT sockopt, each segment carries its own payload */
+static int loop_gso_sendto_test(struct utest_ctx* ctx, struct loop_para* para,
+                                int segs) {
+  int udp_len = para->udp_len;
+  struct sockaddr_in rx_addr;
+  int tx_fd = -1, rx_fd = -1;
+  int rx_timeout = 0;
+  int gso_sz = udp_len;
+  int ret;
+
+  char* send_buf = new char[udp_len * segs];
+  char* recv_buf = new char[udp_len];
+
+  ret = loop_open_pair(ctx, para, &tx_fd, &rx_fd, &rx_addr);
+  if (ret < 0) goto exit;
+  ret = mufd_setsockopt(tx_fd, SOL_UDP, UDP_SEGMENT, &gso_sz, sizeof(gso_sz));
+  EXPECT_GE(ret, 0);
+  if (ret < 0) goto exit;
+
+  for (int loop = 0; loop < para->tx_pkts / segs; loop++) {
+    for (int i = 0; i < segs; i++) loop_sha_fill(send_buf + udp_len * i, udp_len, i);
+    ssize_t send = mufd_sendto(tx_fd, send_buf, udp_len * segs, 0,
+                               (const struct sockaddr*)&rx_addr, sizeof(rx_addr));
+    EXPECT_EQ((size_t)send, udp_len * segs);
+    if (para->tx_sleep_us) st_usleep(para->tx_sleep_us);
+
+    for (int i = 0; i < segs; i++) {
+      ssize_t recv = mufd_recvfrom(rx_fd, recv_buf, udp_len, 0, NULL, NULL);
+      if (recv < 0) { /* timeout */
+        rx_timeout++;
+        err("%s, recv fail %d at seg %d pkt %d\n", __func__, (int)recv, i, loop);
+        continue;
+      }
+      loop_sha_check(recv_buf, recv, udp_len, i);
+    }
+  }
+
+  /* rx timeout max check */
+  EXPECT_LT(rx_timeout, para->max_rx_timeout_pkts);
+
+exit:
+  loop_close_pair(&tx_fd, &rx_fd);
+  delete[] send_buf;
+  delete[] recv_buf;
+  return 0;
+}
+
+TEST(Loop, gso_sendto_single) {
+  struct utest_ctx* ctx = utest_get_ctx();
+  struct loop_para para;
+
+  loop_para_init(&para);
+  loop_gso_sendto_test(ctx, &para, 4);
+}
+
+/* send sha digest pkts to dst_addr and check them on rx_fd, return the rx timeout cnt */
+static int loop_dst_send_check(struct loop_para* para, int tx_fd, int rx_fd,
+                               struct sockaddr_in* dst_addr, int pkts) {
+  int udp_len = para->udp_len;
+  int rx_timeout = 0;
+  char* send_buf = new char[udp_len];
+  char* recv_buf = new char[udp_len];
+
+  for (int i = 0; i < pkts; i++) {
+    loop_sha_fill(send_buf, udp_len, i);
+    ssize_t send = mufd_sendto(tx_fd, send_buf, udp_len, 0,
+                               (const struct sockaddr*)dst_addr, sizeof(*dst_addr));
+    EXPECT_EQ((size_t)send, udp_len);
+    if (para->tx_sleep_us) st_usleep(para->tx_sleep_us);
+
+    ssize_t recv = mufd_recvfrom(rx_fd, recv_buf, udp_len, 0, NULL, NULL);
+    if (recv < 0) { /* timeout */
+      rx_timeout++;
+      err("%s, recv fail %d at pkt %d\n", __func__, (int)recv, i);
+      continue;
+    }
+    loop_sha_check(recv_buf, recv, udp_len, i);
+  }
+
+  delete[] send_buf;
+  delete[] recv_buf;
+  return rx_timeout;
+}
+
+static int loop_dst_cache_test(struct utest_ctx* ctx, struct loop_para* para) {
+  struct mtl_init_params* p = &ctx->init_params.mt_params;
+  struct sockaddr_in rx_addr, rx2_addr;
+  int tx_fd = -1, rx_fd = -1, rx2_fd = -1;
+  int pkts = 4;
+  int rx_timeout = 0;
+  int ret;
+
+  ret = loop_open_pair(ctx, para, &tx_fd, &rx_fd, &rx_addr);
+  if (ret < 0) goto exit;
+
+  /* the second destination, same ip with another port */
+  mufd_init_sockaddr(&rx2_addr, p->sip_addr[MTL_PORT_R], para->udp_port + 1);
+  ret = mufd_socket_port(AF_INET, SOCK_DGRAM, 0, MTL_PORT_R);
+  EXPECT_GE(ret, 0);
+  if (ret < 0) goto exit;
+  rx2_fd = ret;
+  ret = mufd_bind(rx2_fd, (const struct sockaddr*)&rx2_addr, sizeof(rx2_addr));
+  EXPECT_GE(ret, 0);
+  if (ret < 0) goto exit;
+  struct timeval tv;
+  tv.tv_sec = 0;
+  tv.tv_usec = para->rx_timeout_us;
+  ret = mufd_setsockopt(rx2_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  EXPECT_GE(ret, 0);
+  if (ret < 0) goto exit;
+
+  /* switch between the two cached hdrs, each pkt should land on its own socket */
+  for (int loop = 0; loop < para->tx_pkts / pkts / 2; loop++) {
+    rx_timeout += loop_dst_send_check(para, tx_fd, rx_fd, &rx_addr, pkts);
+    rx_timeout += loop_dst_send_check(para, tx_fd, rx2_fd, &rx2_addr, pkts);
+  }
+
+  /* rx timeout max check */
+  EXPECT_LT(rx_timeout, para->max_rx_timeout_pkts);
+
+exit:
+  loop_close_pair(&tx_fd, &rx_fd);
+  if (rx2_fd >= 0) mufd_close(rx2_fd);
+  return 0;
+}
+
+TEST(Loop, dst_cache_single) {
+  struct utest_ctx* ctx = utest_get_ctx();
+  struct loop_para para;
+
+  loop_para_init(&para);
+  loop_dst_cache_test(ctx, &para);
+}
+
+#ifndef WINDOWSENV
+static bool loop_event_fd_readable(int event_fd, int timeout_ms) {
+  struct pollfd pfd;
+  pfd.fd = event_fd;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+  return poll(&pfd, 1, timeout_ms) == 1 && (pfd.revents & POLLIN);
+}
+
+static int loop_event_rearm_test(struct utest_ctx* ctx, struct loop_para* para) {
+  int udp_len = para->udp_len;
+  struct sockaddr_in rx_addr;
+  int tx_fd = -1, rx_fd = -1;
+  int event_fd;
+  int ret;
+
+  char* send_buf = new char[udp_len];
+  char* recv_buf = new char[udp_len];
+
+  ret = loop_open_pair(ctx, para, &tx_fd, &rx_fd, &rx_addr);
+  if (ret < 0) goto exit;
+
+  event_fd = mufd_get_event_fd(rx_fd);
+  if (event_fd < 0) {
+    info("%s, no rx event fd, only available in udp lcore mode\n", __func__);
+    goto exit;
+  }
+
+  for (int loop = 0; loop < para->tx_pkts; loop++) {
+    /* nothing pending, the arm should leave the event fd not readable */
+    ret = mufd_rx_ready_arm(rx_fd);
+    EXPECT_EQ(ret, 0);
+    EXPECT_FALSE(loop_event_fd_readable(event_fd, 0));
+
+    st_test_rand_data((uint8_t*)send_buf, udp_len, 0);
+    send_buf[0] = loop;
+    ssize_t send = mufd_sendto(tx_fd, send_buf, udp_len, 0,
+                               (const struct sockaddr*)&rx_addr, sizeof(rx_addr));
+    EXPECT_EQ((size_t)send, udp_len);
+
+    /* the pkt should wake the armed event fd */
+    bool readable = loop_event_fd_readable(event_fd, 100);
+    EXPECT_TRUE(readable);
+    if (!readable) err("%s, no event at pkt %d\n", __func__, loop);
+
+    ssize_t recv = mufd_recvfrom(rx_fd, recv_buf, udp_len, MSG_DONTWAIT, NULL, NULL);
+    EXPECT_EQ((size_t)recv, udp_len);
+    if (recv > 0) EXPECT_EQ(memcmp(send_buf, recv_buf, udp_len), 0);
+  }
+
+  /* the last re-arm should drain the event from the last pkt */
+  ret = mufd_rx_ready_arm(rx_fd);
+  EXPECT_EQ(ret, 0);
+  EXPECT_FALSE(loop_event_fd_readable(event_fd, 0));
+
+exit:
+  loop_close_pair(&tx_fd, &rx_fd);
+  delete[] send_buf;
+  delete[] recv_buf;
+  return 0;
+}
+
+TEST(Loop, event_rearm_single) {
+  struct utest_ctx* ctx = utest_get_ctx();
+  struct loop_para para;
+
+  loop_para_init(&para);
+  para.tx_pkts = 64;
+  loop_event_rearm_test(ctx, &para);
+}
+#endif
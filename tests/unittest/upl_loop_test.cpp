@@ -2,10 +2,13 @@
  * Copyright(c) 2023 Intel Corporation
  */
 
+#include <inttypes.h>
 #include <signal.h>
 #include <sys/epoll.h>
 #include <sys/signalfd.h>
 
+#include <thread>
+
 #include "log.h"
 #include "upl_test.h"
 
@@ -609,4 +612,137 @@ TEST(Loop, reuse_port) {
   para.sessions = 4;
   para.rx_timeout_us = 0;
   loop_sanity_test(ctx, &para);
-}
\ No newline at end of file
+}
+
+/* many ufds on one epoll with only few of them ready for each wait */
+static int epoll_sparse_test(struct uplt_ctx* ctx, int sessions, int active_sessions,
+                             int loops) {
+  uint16_t udp_port = 20000;
+  int udp_len = 1024;
+  std::vector<int> rx_fds;
+  int tx_fd = -1;
+  int epoll_fd = -1;
+  int ret;
+  char* buf = new char[udp_len];
+  struct epoll_event* events = new struct epoll_event[sessions];
+
+  ret = uplt_socket_port(AF_INET, SOCK_DGRAM, 0, UPLT_PORT_P);
+  EXPECT_GE(ret, 0);
+  if (ret < 0) goto exit;
+  tx_fd = ret;
+
+  for (int i = 0; i < sessions; i++) {
+    struct sockaddr_in addr;
+    uplt_init_sockaddr(&addr, ctx->sip_addr[UPLT_PORT_R], udp_port + i);
+    int fd = uplt_socket_port(AF_INET, SOCK_DGRAM, 0, UPLT_PORT_R);
+    if (fd < 0) break;
+    ret = bind(fd, (const struct sockaddr*)&addr, sizeof(addr));
+    if (ret < 0) {
+      close(fd);
+      break;
+    }
+    rx_fds.push_back(fd);
+  }
+  if (rx_fds.size() < (size_t)sessions) {
+    info("%s, only %d sessions created\n", __func__, (int)rx_fds.size());
+  }
+  sessions = rx_fds.size();
+  EXPECT_GE(sessions, active_sessions);
+  if (sessions < active_sessions) goto exit;
+
+  epoll_fd = epoll_create1(0);
+  EXPECT_GE(epoll_fd, 0);
+  if (epoll_fd < 0) goto exit;
+  for (int i = 0; i < sessions; i++) {
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.fd = rx_fds[i];
+    ret = epoll_ctl(epoll_fd, EPOLL_CTL_ADD, rx_fds[i], &ev);
+    EXPECT_GE(ret, 0);
+  }
+
+  {
+    /* the cost of the wait with no ready socket */
+    uint64_t start = st_test_get_monotonic_time();
+    for (int loop = 0; loop < loops; loop++) {
+      ret = epoll_wait(epoll_fd, events, sessions, 0);
+      EXPECT_EQ(ret, 0);
+    }
+    uint64_t idle_ns = (st_test_get_monotonic_time() - start) / loops;
+
+    /* only few sockets ready for each wait */
+    int total_events = 0;
+    uint64_t wait_ns = 0;
+    for (int loop = 0; loop < loops; loop++) {
+      for (int k = 0; k < active_sessions; k++) {
+        int idx = (loop * active_sessions + k) % sessions;
+        struct sockaddr_in addr;
+        uplt_init_sockaddr(&addr, ctx->sip_addr[UPLT_PORT_R], udp_port + idx);
+        ssize_t send = sendto(tx_fd, buf, udp_len, 0, (const struct sockaddr*)&addr,
+                              sizeof(addr));
+        EXPECT_EQ((size_t)send, udp_len);
+      }
+
+      int loop_events = 0;
+      for (int retry = 0; retry < 10 && loop_events < active_sessions; retry++) {
+        start = st_test_get_monotonic_time();
+        ret = epoll_wait(epoll_fd, events, sessions, 10);
+        wait_ns += st_test_get_monotonic_time() - start;
+        EXPECT_GE(ret, 0);
+        for (int i = 0; i < ret; i++) {
+          ssize_t recv;
+          while ((recv = recvfrom(events[i].data.fd, buf, udp_len, MSG_DONTWAIT, NULL,
+                                  NULL)) > 0)
+            EXPECT_EQ((size_t)recv, udp_len);
+        }
+        if (ret > 0) loop_events += ret;
+      }
+      total_events += loop_events;
+    }
+
+    info("%s, sessions %d, idle wait %" PRIu64 "ns, wait %" PRIu64 "ns, events %d\n",
+         __func__, sessions, idle_ns, wait_ns / loops, total_events);
+    /* expect 50% succ at least */
+    EXPECT_GT(total_events, loops * active_sessions / 2);
+  }
+
+  {
+    /* the infinite wait blocks until a pkt arrives */
+    std::thread tx_thread([&]() {
+      struct sockaddr_in addr;
+      uplt_init_sockaddr(&addr, ctx->sip_addr[UPLT_PORT_R], udp_port);
+      st_usleep(10 * 1000);
+      ssize_t send =
+          sendto(tx_fd, buf, udp_len, 0, (const struct sockaddr*)&addr, sizeof(addr));
+      EXPECT_EQ((size_t)send, udp_len);
+    });
+    uint64_t start = st_test_get_monotonic_time();
+    ret = epoll_wait(epoll_fd, events, sessions, -1);
+    uint64_t block_ns = st_test_get_monotonic_time() - start;
+    tx_thread.join();
+    EXPECT_EQ(ret, 1);
+    if (ret > 0) {
+      EXPECT_EQ(events[0].data.fd, rx_fds[0]);
+      ssize_t recv;
+      while ((recv = recvfrom(events[0].data.fd, buf, udp_len, MSG_DONTWAIT, NULL,
+                              NULL)) > 0)
+        EXPECT_EQ((size_t)recv, udp_len);
+    }
+    info("%s, infinite wait blocked %" PRIu64 "us\n", __func__, block_ns / 1000);
+    /* woken by the pkt, not returned at once */
+    EXPECT_GT(block_ns, (uint64_t)5 * 1000 * 1000);
+  }
+
+exit:
+  if (epoll_fd > 0) close(epoll_fd);
+  for (size_t i = 0; i < rx_fds.size(); i++) close(rx_fds[i]);
+  if (tx_fd > 0) close(tx_fd);
+  delete[] buf;
+  delete[] events;
+  return 0;
+}
+
+TEST(Loop, epoll_sparse_1k) {
+  struct uplt_ctx* ctx = uplt_get_ctx();
+  epoll_sparse_test(ctx, 1024, 4, 1000);
+}